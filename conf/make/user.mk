@@ -76,6 +76,12 @@ AregInclude     := $(AREG_BASE)
 # ###########################################################################
 
 # User can set specific preprocessor directives
+# ENABLE_TRACES         : enable compilation with logging; remove if no logging required.
+# ENABLE_LOCKFREE_QUEUE : use lock-free external event queue in dispatcher threads.
+# ENABLE_FUTEX_WAIT     : Linux only, threads wait on futex instead of POSIX condition variables.
+# ENABLE_SOCKET_EPOLL   : Linux only, router waits for connection events with epoll instead of select.
+# ENABLE_TIMER_WHEEL    : Linux only, timers run in the timing wheel driven by single timerfd instead of POSIX timer per timer.
+# ENABLE_TRACE_RING     : logging threads write binary records in own ring buffers and the tracer thread formats messages.
 UserDefines     := -DENABLE_TRACES
 
 # User can set specific include paths, must be prefixed with '-I' if used
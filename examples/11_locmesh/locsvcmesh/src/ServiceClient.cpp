@@ -111,6 +111,8 @@ void ServiceClient::broadcastServiceUnavailable(void)
 {
     TRACE_SCOPE(examples_11_locsvcmesh_ServiceClient_broadcastServiceUnavailable);
     TRACE_WARN("Service notify reached message output maximum, starting shutdown procedure");
+    // stop sending requests, otherwise the next request registers the client again.
+    mTimer.stopTimer();
     requestClientShutdown(mID, mTimer.getName());
 }
 
@@ -131,8 +133,12 @@ void ServiceClient::processTimer(Timer & timer)
     TRACE_SCOPE(examples_11_locsvcmesh_ServiceClient_processTimer);
     ASSERT(&timer == &mTimer);
 
-    TRACE_DBG("Timer [ %s ] expired, send request to output message.", timer.getName().getString());
-    requestHelloWorld(timer.getName(), "");
+    // the timer event might be already queued when the timer is stopped.
+    if (timer.isActive())
+    {
+        TRACE_DBG("Timer [ %s ] expired, send request to output message.", timer.getName().getString());
+        requestHelloWorld(timer.getName(), "");
+    }
 }
 
 inline String ServiceClient::timerName( Component & owner ) const
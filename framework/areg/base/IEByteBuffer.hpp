@@ -52,6 +52,20 @@ protected:
      **/
     static constexpr unsigned int   MAX_BUF_LENGTH  { 0x04000000u };
 
+public:
+    /**
+     * \brief   IEByteBuffer::DEFAULT_GROW_LIMIT
+     *          The default maximum size in bytes, which buffer can grow at once
+     *          when data is streamed. It is defined as 1 Mb.
+     **/
+    static constexpr unsigned int   DEFAULT_GROW_LIMIT  { 0x00100000u };
+
+    /**
+     * \brief   IEByteBuffer::MIN_GROW_SIZE
+     *          The minimum size in bytes of buffer to allocate when data is streamed.
+     **/
+    static constexpr unsigned int   MIN_GROW_SIZE       { 64u };
+
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
 //////////////////////////////////////////////////////////////////////////
@@ -125,10 +139,39 @@ public:
      **/
     virtual unsigned int resize(unsigned int size, bool copy);
 
+/************************************************************************/
+// IEByteBuffer static methods
+/************************************************************************/
+
+    /**
+     * \brief   Sets the maximum size in bytes, which buffer can grow at once when data is streamed.
+     *          Until the limit is reached, the buffers grow geometrically, i.e. double the size.
+     *          After that, the buffers grow linearly by the limit.
+     * \param   growLimit   The maximum size in bytes to grow at once. If zero, the limit is reset
+     *                      to IEByteBuffer::DEFAULT_GROW_LIMIT.
+     **/
+    static void setGrowLimit( unsigned int growLimit );
+
+    /**
+     * \brief   Returns the maximum size in bytes, which buffer can grow at once when data is streamed.
+     **/
+    static unsigned int getGrowLimit( void );
+
 /************************************************************************/
 // IEByteBuffer Attributes and operations
 /************************************************************************/
 
+    /**
+     * \brief   Makes sure that the buffer has at least given size in bytes to write data.
+     *          If needed, allocates new buffer and copies existing data. Unlike resize(),
+     *          the call never shrinks the buffer and does not change the used size
+     *          and the cursor positions. Call to reserve space before streaming data
+     *          if the size of data is known in advance.
+     * \param   size    The size in bytes to reserve.
+     * \return  Returns the size in bytes available to use, i.e. the length of buffer.
+     **/
+    unsigned int reserve( unsigned int size );
+
     /**
      * \brief   Returns pointer to the byte buffer.
      **/
@@ -201,6 +244,14 @@ protected:
      **/
     inline unsigned char * getEndOfBuffer( void );
 
+    /**
+     * \brief   Calculates the size of buffer to allocate when data is streamed and the buffer
+     *          has no enough space. The buffer grows geometrically, but not more than the
+     *          grow limit at once. The returned size is never less than the required size.
+     * \param   sizeRequired    The minimum size in bytes required to write data.
+     **/
+    unsigned int getGrowSize( unsigned int sizeRequired ) const;
+
 /************************************************************************/
 // IEByteBuffer protected overrides
 /************************************************************************/
@@ -0,0 +1,279 @@
+#pragma once
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/base/InternedString.hpp
+ * \ingroup     AREG SDK, Asynchronous Event Generator Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Interned immutable string class.
+ *
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/String.hpp"
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+class IEInStream;
+class IEOutStream;
+
+//////////////////////////////////////////////////////////////////////////
+// InternedString class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The immutable string, which keeps only the pointer to the string
+ *          in the pool of interned strings. All interned strings with the same
+ *          characters share one instance in the pool, so that copying the object
+ *          copies the pointer and comparing two interned strings compares pointers.
+ *
+ *          The interned strings are used for the names, which have limited number
+ *          of variants and are often copied and compared, like the names of
+ *          services, roles and threads in the addresses. The interned strings
+ *          remain in the pool until the process exits.
+ *
+ *          The interned string is streamed as a String object.
+ **/
+class AREG_API InternedString
+{
+//////////////////////////////////////////////////////////////////////////
+// Constructors / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Creates empty string.
+     **/
+    InternedString( void );
+
+    /**
+     * \brief   Interns the given string.
+     * \param   source      The null-terminated string to intern. If nullptr, creates empty string.
+     * \param   charCount   The maximum number of characters to take from the source.
+     *                      If NEString::COUNT_ALL, takes the characters until end-of-string.
+     **/
+    InternedString( const char * source, NEString::CharCount charCount = NEString::COUNT_ALL );
+
+    /**
+     * \brief   Interns the given string.
+     * \param   source      The string to intern.
+     * \param   charCount   The maximum number of characters to take from the source.
+     *                      If NEString::COUNT_ALL, takes all characters.
+     **/
+    InternedString( const String & source, NEString::CharCount charCount = NEString::COUNT_ALL );
+
+    /**
+     * \brief   Reads the string from the stream and interns it.
+     * \param   stream  The streaming object to read the string.
+     **/
+    explicit InternedString( const IEInStream & stream );
+
+    /**
+     * \brief   Copies the pointer of interned string.
+     **/
+    InternedString( const InternedString & source ) = default;
+
+    /**
+     * \brief   Destructor. The interned string remains in the pool.
+     **/
+    ~InternedString( void ) = default;
+
+//////////////////////////////////////////////////////////////////////////
+// Operators
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Copies the pointer of interned string.
+     **/
+    InternedString & operator = ( const InternedString & source ) = default;
+
+    /**
+     * \brief   Interns the given null-terminated string.
+     **/
+    InternedString & operator = ( const char * source );
+
+    /**
+     * \brief   Interns the given string.
+     **/
+    InternedString & operator = ( const String & source );
+
+    /**
+     * \brief   Compares two interned strings. Compares the pointers.
+     **/
+    inline bool operator == ( const InternedString & other ) const;
+
+    /**
+     * \brief   Compares two interned strings. Compares the pointers.
+     **/
+    inline bool operator != ( const InternedString & other ) const;
+
+    /**
+     * \brief   Compares the interned string with the given string. If the given string
+     *          is the object in the pool of interned strings, compares the pointers.
+     **/
+    inline bool operator == ( const String & other ) const;
+
+    /**
+     * \brief   Compares the interned string with the given string.
+     **/
+    inline bool operator != ( const String & other ) const;
+
+    /**
+     * \brief   Compares the interned string with the given null-terminated string.
+     **/
+    inline bool operator == ( const char * other ) const;
+
+    /**
+     * \brief   Compares the interned string with the given null-terminated string.
+     **/
+    inline bool operator != ( const char * other ) const;
+
+    /**
+     * \brief   Returns the interned string object.
+     **/
+    inline operator const String & ( void ) const;
+
+    /**
+     * \brief   Reads the string from the stream and interns it.
+     **/
+    friend inline const IEInStream & operator >> ( const IEInStream & stream, InternedString & input );
+
+    /**
+     * \brief   Writes the string to the stream.
+     **/
+    friend inline IEOutStream & operator << ( IEOutStream & stream, const InternedString & output );
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns the interned string object.
+     **/
+    inline const String & getData( void ) const;
+
+    /**
+     * \brief   Returns the null-terminated string.
+     **/
+    inline const char * getString( void ) const;
+
+    /**
+     * \brief   Returns the length of string.
+     **/
+    inline NEString::CharCount getLength( void ) const;
+
+    /**
+     * \brief   Returns true if the string is empty.
+     **/
+    inline bool isEmpty( void ) const;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Returns the interned string with the given characters.
+     *          Adds new entry in the pool if the string is not interned yet.
+     * \param   source      The string to intern.
+     * \param   charCount   The number of characters to take from the source.
+     **/
+    static const String * _intern( const char * source, NEString::CharCount charCount );
+
+    /**
+     * \brief   Returns the interned empty string.
+     **/
+    static const String * _emptyString( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The pointer to the string in the pool of interned strings.
+     **/
+    const String *  mString;
+};
+
+//////////////////////////////////////////////////////////////////////////
+// InternedString class inline functions
+//////////////////////////////////////////////////////////////////////////
+
+inline bool InternedString::operator == ( const InternedString & other ) const
+{
+    return (mString == other.mString);
+}
+
+inline bool InternedString::operator != ( const InternedString & other ) const
+{
+    return (mString != other.mString);
+}
+
+inline bool InternedString::operator == ( const String & other ) const
+{
+    return (mString == &other) || (*mString == other);
+}
+
+inline bool InternedString::operator != ( const String & other ) const
+{
+    return (mString != &other) && (*mString != other);
+}
+
+inline bool InternedString::operator == ( const char * other ) const
+{
+    return (*mString == other);
+}
+
+inline bool InternedString::operator != ( const char * other ) const
+{
+    return (*mString != other);
+}
+
+inline InternedString::operator const String & ( void ) const
+{
+    return (*mString);
+}
+
+inline const String & InternedString::getData( void ) const
+{
+    return (*mString);
+}
+
+inline const char * InternedString::getString( void ) const
+{
+    return mString->getString( );
+}
+
+inline NEString::CharCount InternedString::getLength( void ) const
+{
+    return mString->getLength( );
+}
+
+inline bool InternedString::isEmpty( void ) const
+{
+    return mString->isEmpty( );
+}
+
+//////////////////////////////////////////////////////////////////////////
+// InternedString class friend operators
+//////////////////////////////////////////////////////////////////////////
+
+inline const IEInStream & operator >> ( const IEInStream & stream, InternedString & input )
+{
+    String value;
+    stream >> value;
+    input = value;
+    return stream;
+}
+
+inline IEOutStream & operator << ( IEOutStream & stream, const InternedString & output )
+{
+    stream << *output.mString;
+    return stream;
+}
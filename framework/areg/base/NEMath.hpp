@@ -327,6 +327,8 @@ namespace NEMath
      * \brief	Cyclic Redundancy Check (CRC) calculation function on 
      *          standard IEEE 802.3, using lookup table (fast calculate).
      *          Calculates and returns 32-bit CRC value of a binary data in one step.
+     *          The binary data is calculated by 8 bytes per step (slicing-by-8)
+     *          or, if the CPU supports, with carry-less multiplication (PCLMULQDQ).
      * \param	data	Pointer to data to calculate CRC
      * \param	size	Size in bytes of given buffer
      * \return	32-bit value of Cyclic Redundancy Check (CRC)
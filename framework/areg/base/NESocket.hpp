@@ -37,8 +37,9 @@ struct sockaddr_in;
  *          number for socket connection. The Socket Address object also used
  *          to resolve names and get connected peer address.
  *
- * \note    Currently the existing socket functionalities support only TCP/IP
- *          connection for IP4 addresses. All other connection types
+ * \note    Currently the existing socket functionalities support TCP/IP
+ *          connection for IP4 addresses and, on POSIX systems, the local
+ *          Unix domain stream sockets. All other connection types
  *          are ignored and out of scope of this namespace
  **/
 namespace NESocket
@@ -150,8 +151,31 @@ namespace NESocket
          **/
         bool resolveSocket( SOCKETHANDLE hSocket );
 
+        /**
+         * \brief   Resolves and retrieves the address to which a socket is bound.
+         *          The function can be used to get the port number assigned by system,
+         *          when the server socket is bound to the port NESocket::InvalidPort.
+         * \param   hSocket     The socket descriptor of bound socket.
+         * \return  Returns true if succeeded to resolve address of bound socket.
+         **/
+        bool resolveBoundSocket( SOCKETHANDLE hSocket );
+
+        /**
+         * \brief   Sets the file system path of local (Unix domain) socket.
+         *          The address of local socket has no port number and it is
+         *          valid if the path is not empty.
+         * \param   socketPath  The file system path of local socket.
+         **/
+        void setLocalAddress( const std::string_view & socketPath );
+
+        /**
+         * \brief   Returns true if the address is the file system path of local (Unix domain) socket.
+         **/
+        inline bool isLocalSocket( void ) const;
+
         /**
          * \brief   Returns IP address of host as readable string.
+         *          For local socket, returns the file system path of socket.
          **/
         inline const String & getHostAddress( void ) const;
 
@@ -167,9 +191,16 @@ namespace NESocket
 
         /**
          * \brief   Returns true if IP-address is not empty and port number is valid.
+         *          For local socket, returns true if the path is not empty.
          **/
         inline bool isValid( void ) const;
 
+        /**
+         * \brief   Returns true if the IP-address is the loopback address of the local host (127.x.x.x)
+         *          or the address is the path of local socket.
+         **/
+        inline bool isLoopback( void ) const;
+
     //////////////////////////////////////////////////////////////////////////
     // Member variables
     //////////////////////////////////////////////////////////////////////////
@@ -182,8 +213,46 @@ namespace NESocket
          * \brief   The port number of socket to connect.
          **/
         unsigned short  mPortNr;
+        /**
+         * \brief   Flag, indicating whether the address is the path of local (Unix domain) socket.
+         **/
+        bool            mIsLocal;
     };
 
+//////////////////////////////////////////////////////////////////////////
+// NESocket::sSocketBuffer structure declaration
+//////////////////////////////////////////////////////////////////////////
+    /**
+     * \brief   NESocket::sSocketBuffer
+     *          Describes one buffer of the list of data buffers, which are
+     *          sent with single vectored (scatter-gather) send call.
+     **/
+    typedef struct S_SocketBuffer
+    {
+        /**
+         * \brief   The pointer to data buffer to send.
+         **/
+        const unsigned char *   sbData;
+        /**
+         * \brief   The length of data in bytes to send.
+         **/
+        int                     sbLength;
+    } sSocketBuffer;
+
+//////////////////////////////////////////////////////////////////////////
+// NESocket::eConnectState enumeration declaration
+//////////////////////////////////////////////////////////////////////////
+    /**
+     * \brief   NESocket::eConnectState
+     *          The state of client socket, which connects without blocking.
+     **/
+    typedef enum class E_ConnectState : int
+    {
+          ConnectFailed     = -1    //!< Failed to connect, the socket should be closed.
+        , ConnectPending    =  0    //!< The connection is in progress.
+        , ConnectSucceeded  =  1    //!< The socket is connected.
+    } eConnectState;
+
 //////////////////////////////////////////////////////////////////////////
 // NESocket namespace constants declaration
 //////////////////////////////////////////////////////////////////////////
@@ -219,6 +288,12 @@ namespace NESocket
      *          The default size of segment when sends or receives data.
      **/
     constexpr int                       DEFAULT_SEGMENT_SIZE        { 16384 };
+    /**
+     * \brief   NESocket::MAXIMUM_SEND_BUFFERS
+     *          The maximum number of buffers passed to the system in a single vectored send call.
+     *          If the list contains more buffers, they are sent with several calls.
+     **/
+    constexpr int                       MAXIMUM_SEND_BUFFERS        { 64 };
 
 //////////////////////////////////////////////////////////////////////////
 // NESocket namespace functions
@@ -291,10 +366,33 @@ namespace NESocket
      **/
     AREG_API SOCKETHANDLE clientSocketConnect( const std::string_view & hostName, unsigned short portNr, NESocket::SocketAddress * out_socketAddr = nullptr );
 
+    /**
+     * \brief   NESocket::clientSocketConnectAsync
+     *          Creates client TCP/IP socket and starts to connect to specified peer address
+     *          without blocking. The connection completes in background, call
+     *          clientSocketCheckConnect() to check the state of connection.
+     *          The local sockets connect immediately.
+     * \param   peerAddr    The object containing remote host IP-address and port number.
+     * \return  Returns valid socket descriptor, if could create socket and started to connect.
+     *          Otherwise, it returns NESocket::InvalidSocketHandle value.
+     **/
+    AREG_API SOCKETHANDLE clientSocketConnectAsync( const NESocket::SocketAddress & peerAddr );
+
+    /**
+     * \brief   NESocket::clientSocketCheckConnect
+     *          Checks without blocking the state of connection started by clientSocketConnectAsync().
+     *          When the connection succeeds, the socket is switched to blocking mode.
+     * \param   hSocket     The socket descriptor returned by clientSocketConnectAsync().
+     * \return  Returns the state of connection. If failed, the socket should be closed.
+     **/
+    AREG_API NESocket::eConnectState clientSocketCheckConnect( SOCKETHANDLE hSocket );
+
     /**
      * \brief   NESocket::serverSocketConnect
      *          Creates server TCP/IP socket and binds to specified server address.
      *          Before accepting any connection, the socket should be set for listening.
+     *          If the port number is NESocket::InvalidPort, the system binds the socket
+     *          to any free port. Use SocketAddress::resolveBoundSocket() to get it.
      * \param   peerAddr    The object containing host IP-address and port number of server.
      * \return  Returns valid socket descriptor, if could create socket and bind to specified address.
      *          Otherwise, it returns NESocket::InvalidSocketHandle value.
@@ -315,6 +413,28 @@ namespace NESocket
      **/
     AREG_API SOCKETHANDLE serverSocketConnect( const std::string_view & hostName, unsigned short portNr, NESocket::SocketAddress * out_socketAddr = nullptr );
 
+    /**
+     * \brief   NESocket::clientLocalSocketConnect
+     *          Creates client local (Unix domain) stream socket and connects to specified socket path.
+     *          Local sockets are supported only on POSIX systems, on other systems the call fails.
+     * \param   socketPath  The file system path of local socket to connect.
+     * \return  Returns valid socket descriptor, if could create socket and connect to the server.
+     *          Otherwise, it returns NESocket::InvalidSocketHandle value.
+     **/
+    AREG_API SOCKETHANDLE clientLocalSocketConnect( const std::string_view & socketPath );
+
+    /**
+     * \brief   NESocket::serverLocalSocketConnect
+     *          Creates server local (Unix domain) stream socket and binds to specified socket path.
+     *          If the path already exists and no server is listening on it, the stale file is removed.
+     *          Before accepting any connection, the socket should be set for listening.
+     *          Local sockets are supported only on POSIX systems, on other systems the call fails.
+     * \param   socketPath  The file system path of local socket to bind.
+     * \return  Returns valid socket descriptor, if could create socket and bind to specified path.
+     *          Otherwise, it returns NESocket::InvalidSocketHandle value.
+     **/
+    AREG_API SOCKETHANDLE serverLocalSocketConnect( const std::string_view & socketPath );
+
     /**
      * \brief   NESocket::serverListenConnection
      *          Called by server. Sets specified valid server socket for listening incoming connections.
@@ -376,6 +496,41 @@ namespace NESocket
      **/
     AREG_API int sendData( SOCKETHANDLE hSocket, const unsigned char * dataBuffer, int dataLength, int blockMaxSize = NECommon::DEFAULT_SIZE );
 
+    /**
+     * \brief   NESocket::sendDataVector
+     *          Sends the list of data buffers to specified socket with single vectored
+     *          (scatter-gather) system call, so that the data of all buffers are sent
+     *          as one stream without copying them in a single buffer. If the system
+     *          sends less data than requested, the call continues with the remaining data.
+     *          The passed socket descriptor should be valid.
+     * \param   hSocket         The valid socket descriptor to send data.
+     * \param   listBuffers     The list of data buffers to send. The empty buffers are ignored.
+     * \param   count           The number of entries in the list of buffers.
+     * \return  If succeeds, returns number of bytes sent.
+     *          If fails after a part of data is sent, returns the number of sent bytes,
+     *          which is less than the length of data in buffers.
+     *          If fails before any data is sent, returns negative number.
+     *          Returns zero if buffers are empty and nothing to sent.
+     **/
+    AREG_API int sendDataVector( SOCKETHANDLE hSocket, const NESocket::sSocketBuffer * listBuffers, int count );
+
+    /**
+     * \brief   NESocket::sendPendingDataVector
+     *          Sends the list of data buffers to specified socket with single vectored
+     *          system call without waiting until the socket can accept the data.
+     *          Unlike sendDataVector(), the call sends only the data, which fits in the
+     *          send buffer of socket, and returns. The caller should keep the rest of data
+     *          and retry later. The passed socket descriptor should be valid.
+     * \param   hSocket         The valid socket descriptor to send data.
+     * \param   listBuffers     The list of data buffers to send. The empty buffers are ignored.
+     * \param   count           The number of entries in the list of buffers. Only first
+     *                          NESocket::MAXIMUM_SEND_BUFFERS non-empty buffers are sent.
+     * \return  If succeeds, returns number of bytes sent, which might be less than the size of data.
+     *          Returns zero if the socket cannot accept data now or buffers are empty.
+     *          Returns negative number if failed to send. In this case the socket should be closed.
+     **/
+    AREG_API int sendPendingDataVector( SOCKETHANDLE hSocket, const NESocket::sSocketBuffer * listBuffers, int count );
+
     /**
      * \brief   NESocket::receiveData
      *          Receives data on specified socket. The passed socket descriptor should be valid.
@@ -393,6 +548,37 @@ namespace NESocket
      **/
     AREG_API int receiveData( SOCKETHANDLE hSocket, unsigned char * dataBuffer, int dataLength, int blockMaxSize  = NECommon::DEFAULT_SIZE );
 
+    /**
+     * \brief   NESocket::receiveAvailableData
+     *          Receives data on specified socket with single call. Unlike receiveData(), the call
+     *          does not wait until the buffer is filled, but returns as soon as any data is available.
+     *          If there is no data, the call blocks until data arrives or the connection is closed.
+     *          The passed socket descriptor should be valid.
+     * \param   hSocket         The valid socket descriptor to receive data.
+     * \param   dataBuffer      The pointer to data buffer, which should be filled.
+     * \param   dataLength      The length of buffer in bytes.
+     * \return  If succeeds, returns number of bytes received, which is not more than dataLength.
+     *          Returns zero if the opposite side closed connection or the buffer is empty.
+     *          If fails, returns negative number. In case of failure or zero, the socket should be closed.
+     **/
+    AREG_API int receiveAvailableData( SOCKETHANDLE hSocket, unsigned char * dataBuffer, int dataLength );
+
+    /**
+     * \brief   NESocket::receivePendingData
+     *          Receives data, which is already pending on specified socket, with single call.
+     *          Unlike receiveAvailableData(), the call never blocks. It is used to drain the socket
+     *          after it was reported readable by the event poller.
+     *          The passed socket descriptor should be valid.
+     * \param   hSocket         The valid socket descriptor to receive data.
+     * \param   dataBuffer      The pointer to data buffer, which should be filled.
+     * \param   dataLength      The length of buffer in bytes.
+     * \return  If succeeds, returns number of bytes received, which is not more than dataLength.
+     *          Returns zero if there is no pending data to receive.
+     *          Returns negative number if the opposite side closed connection or failed to receive.
+     *          In case of negative value, the socket should be closed.
+     **/
+    AREG_API int receivePendingData( SOCKETHANDLE hSocket, unsigned char * dataBuffer, int dataLength );
+
     /**
      * \brief   NESocket::disableSend
      *          Sets socket read-only, i.e. it will not be possible to send messages anymore.
@@ -440,7 +626,17 @@ namespace NESocket
 
 inline bool NESocket::SocketAddress::isValid( void ) const
 {
-    return ((mIpAddr.isEmpty() == false) && (mPortNr != NESocket::InvalidPort));
+    return ((mIpAddr.isEmpty() == false) && (mIsLocal || (mPortNr != NESocket::InvalidPort)));
+}
+
+inline bool NESocket::SocketAddress::isLoopback( void ) const
+{
+    return (mIsLocal || (NEString::compareStrings<char, char>( mIpAddr.getString(), "127.", 4 ) == 0));
+}
+
+inline bool NESocket::SocketAddress::isLocalSocket( void ) const
+{
+    return mIsLocal;
 }
 
 inline const String & NESocket::SocketAddress::getHostAddress( void ) const
@@ -457,4 +653,5 @@ inline void NESocket::SocketAddress::resetAddress( void )
 {
     mIpAddr = String::EmptyString.data();
     mPortNr = NESocket::InvalidPort;
+    mIsLocal= false;
 }
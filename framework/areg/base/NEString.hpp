@@ -183,6 +183,41 @@ namespace NEString
      **/
     using SString32 = SString<int>;
 
+    /**
+     * \brief   The size in bytes of the buffer of small string kept in the string object.
+     *          The buffer includes the end-of-string character.
+     *          NEString::SMALL_STRING_SIZE
+     **/
+    constexpr unsigned int  SMALL_STRING_SIZE   { 24 };
+
+    /**
+     * \brief   The string data kept in the string object without allocating memory.
+     *          It has the layout of NEString::SString and is used by the strings,
+     *          which length fits the buffer (small-string optimization).
+     *          NEString::SStringSmall
+     **/
+    template<typename CharType>
+    struct SStringSmall
+    {
+        /**
+         * \brief   The space of small string buffer in characters, including end-of-string.
+         **/
+        static constexpr CharCount  SMALL_SPACE { static_cast<CharCount>(SMALL_STRING_SIZE / sizeof(CharType)) };
+
+        /**
+         * \brief   Space allocated for the string. Equal to SMALL_SPACE if the buffer is used.
+         **/
+        CharCount       strSpace;
+        /**
+         * \brief   The space used by string or string length.
+         **/
+        CharCount       strUsed;
+        /**
+         * \brief   The buffer of string data.
+         **/
+        CharType        strBuffer[SMALL_SPACE];
+    };
+
     /**
      * \brief   Definition of Invalid String structure with 8-bit string data
      **/
@@ -137,7 +137,7 @@ public:
 
     /**
      * \brief   Returns checksum value of Remote Buffer.
-     *          The checksum value cannot be set. It is calculated by call ChecksumMark().
+     *          The checksum value cannot be set. It is calculated by call checksumMark().
      **/
     inline unsigned int getChecksum( void ) const;
 
@@ -200,12 +200,27 @@ public:
      **/
     bool isChecksumValid( void ) const;
 
+    /**
+     * \brief   Calculates and returns the checksum of the message data without setting it in the header.
+     *          Returns NEMath::CHECKSUM_IGNORE if the message is invalid.
+     **/
+    unsigned int checksumCalculate( void ) const;
+
+    /**
+     * \brief   Calculates the checksum of the message data and sets it in the header.
+     *          Call if the message should have valid checksum before it is sent,
+     *          for example, when it is sent before the connection agreed to skip checksums.
+     **/
+    void checksumMark( void );
+
     /**
      * \brief   Call when completed modifying buffer. Completion will fix such values as
-     *          length of Remote Buffer and checksum. When changing length of buffer,
+     *          length of Remote Buffer. When changing length of buffer,
      *          it will no resize the buffer and re-copy data, but it will use the value
-     *          of used space, which is set in header. The checksum will be calculated
-     *          based on available information in the buffer and it will set value.
+     *          of used space, which is set in header. The checksum is not calculated,
+     *          it is reset to NEMath::CHECKSUM_IGNORE. The connection calculates the
+     *          checksum when sends the message, unless the connection agreed to skip
+     *          checksums. To set the checksum in the header, call checksumMark().
      *          It is strongly recommended to call method again if the buffer was changed
      *          or before transferring buffer to remote target.
      **/
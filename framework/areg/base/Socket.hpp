@@ -157,6 +157,30 @@ public:
      **/
     virtual int sendData( const unsigned char * buffer, int length ) const;
 
+    /**
+     * \brief   If socket is valid, sends the list of data buffers using existing socket connection
+     *          with single vectored (scatter-gather) send call and returns number of sent bytes.
+     *          Returns negative number if either socket is invalid, or failed to send data to remote host.
+     *          Note:   The call is blocking and method will not return until all data are not sent
+     *                  or if data sending fails.
+     * \param   listBuffers The list of data buffers to send to remote target.
+     * \param   count       The number of buffers in the list.
+     * \return  Returns number of bytes sent to remote target.
+     *          Returns negative number if socket is not valid of failed to send.
+     **/
+    virtual int sendDataVector( const NESocket::sSocketBuffer * listBuffers, int count ) const;
+
+    /**
+     * \brief   If socket is valid, sends the list of data buffers with single vectored send call
+     *          without blocking and returns number of sent bytes. Only the data, which fits in the
+     *          send buffer of socket, is sent. The rest of data should be sent later.
+     * \param   listBuffers The list of data buffers to send to remote target.
+     * \param   count       The number of buffers in the list.
+     * \return  Returns number of bytes sent to remote target, zero if the socket cannot accept data now.
+     *          Returns negative number if socket is not valid of failed to send.
+     **/
+    virtual int sendPendingDataVector( const NESocket::sSocketBuffer * listBuffers, int count ) const;
+
     /**
      * \brief   If socket is valid, receives data using existing socket connection and returns
      *          number of received bytes in buffer, which is equal to specified length parameter.
@@ -170,6 +194,31 @@ public:
      **/
     virtual int receiveData( unsigned char * buffer, int length ) const;
 
+    /**
+     * \brief   If socket is valid, receives available data using existing socket connection with single call
+     *          and returns number of received bytes in buffer, which is not more than specified length.
+     *          If no data is available, the call blocks until data arrives.
+     *          Returns zero if remote host closed connection and negative number if either socket is invalid,
+     *          or failed to receive data from remote host.
+     * \param   buffer  The buffer to fill received data from remote target.
+     * \param   length  The length in bytes of allocated space in buffer.
+     * \return  Returns number of bytes received from remote target.
+     *          Returns zero or negative number if connection is closed, socket is not valid of failed to receive.
+     **/
+    virtual int receiveAvailableData( unsigned char * buffer, int length ) const;
+
+    /**
+     * \brief   If socket is valid, receives data, which is already pending in the socket,
+     *          without blocking and returns number of received bytes in buffer.
+     *          Returns zero if there is no pending data and negative number if either socket
+     *          is invalid, the remote host closed connection or failed to receive data.
+     * \param   buffer  The buffer to fill received data from remote target.
+     * \param   length  The length in bytes of allocated space in buffer.
+     * \return  Returns number of bytes received from remote target, zero if nothing is pending.
+     *          Returns negative number if connection is closed, socket is not valid of failed to receive.
+     **/
+    virtual int receivePendingData( unsigned char * buffer, int length ) const;
+
 //////////////////////////////////////////////////////////////////////////
 // Attributes and operations
 //////////////////////////////////////////////////////////////////////////
@@ -99,6 +99,26 @@ public:
      **/
     virtual bool createSocket( void ) override;
 
+//////////////////////////////////////////////////////////////////////////
+// Operations
+//////////////////////////////////////////////////////////////////////////
+
+    /**
+     * \brief   Creates new socket descriptor and starts to connect to the remote host
+     *          of socket address without blocking. The remote host address and port
+     *          number should be already set in socket address. Before sending any data,
+     *          call checkConnected() until the connection completes.
+     * \return  Returns true if the socket is created and the connection is started.
+     **/
+    bool createSocketAsync( void );
+
+    /**
+     * \brief   Checks without blocking the state of connection started by createSocketAsync().
+     *          When connection succeeds, the socket is switched to blocking mode.
+     * \return  Returns the state of connection.
+     **/
+    NESocket::eConnectState checkConnected( void ) const;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
 //////////////////////////////////////////////////////////////////////////
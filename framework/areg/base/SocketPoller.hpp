@@ -0,0 +1,210 @@
+#pragma once
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/base/SocketPoller.hpp
+ * \ingroup     AREG SDK, Asynchronous Event Generator Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Socket event poller.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/NESocket.hpp"
+
+/**
+ * \brief   AREG_SOCKET_EPOLL is defined if the server connection waits for
+ *          socket events using Linux epoll instead of select. It is enabled by
+ *          ENABLE_SOCKET_EPOLL preprocessor define, otherwise select is used.
+ **/
+#if defined(__linux__) && (defined(ENABLE_SOCKET_EPOLL) || defined(_ENABLE_SOCKET_EPOLL))
+    #define AREG_SOCKET_EPOLL
+#endif  // defined(__linux__) && (defined(ENABLE_SOCKET_EPOLL) || defined(_ENABLE_SOCKET_EPOLL))
+
+//////////////////////////////////////////////////////////////////////////
+// SocketPoller class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The socket poller waits for read events of registered sockets, or
+ *          until the registered sockets can accept data to send.
+ *          Unlike select, the number of registered sockets is not limited
+ *          and the cost of waiting does not depend on the number of sockets.
+ *          A single wait collects up to MAXIMUM_EVENTS ready sockets, which
+ *          are then returned one by one before waiting again.
+ *          Sockets can be registered in edge-triggered mode. In this mode
+ *          the socket is reported only when new data arrives, so that the
+ *          reader should drain the socket before it waits again.
+ *          The poller is supported only on Linux (epoll). On other platforms
+ *          the poller cannot be created and select should be used instead.
+ *          The sockets can be registered and removed by any thread, but only
+ *          one thread should wait for socket events.
+ **/
+class AREG_API SocketPoller
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   SocketPoller::MAXIMUM_EVENTS
+     *          The maximum number of ready sockets collected by single wait.
+     **/
+    static constexpr int    MAXIMUM_EVENTS      { 64 };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Initializes the poller object. The poller is not created.
+     **/
+    SocketPoller( void );
+
+    /**
+     * \brief   Destructor. Releases the poller.
+     **/
+    ~SocketPoller( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Operations and attributes
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns true if the poller is supported by the platform.
+     **/
+    static bool isSupported( void );
+
+    /**
+     * \brief   Returns true if the poller is created and valid.
+     **/
+    inline bool isValid( void ) const;
+
+    /**
+     * \brief   Creates the poller. Returns true if succeeded or the poller was already created.
+     *          Returns false if failed or the poller is not supported by the platform.
+     **/
+    bool create( void );
+
+    /**
+     * \brief   Releases the poller. Should be called when no thread waits for events.
+     **/
+    void release( void );
+
+    /**
+     * \brief   Registers the socket to wait for read events.
+     * \param   hSocket         The valid socket handle to register.
+     * \param   edgeTriggered   If true, the socket is reported only when new data arrives
+     *                          and the reader should drain the socket. Otherwise, the socket
+     *                          is reported as long as it has data to read.
+     * \return  Returns true if succeeded to register the socket.
+     **/
+    bool addSocket( SOCKETHANDLE hSocket, bool edgeTriggered );
+
+    /**
+     * \brief   Registers the socket to wait until it can accept data to send. The socket
+     *          is reported as long as it can accept data, so that it should be registered
+     *          only while there is data, which the socket could not accept.
+     * \param   hSocket         The valid socket handle to register.
+     * \return  Returns true if succeeded to register the socket.
+     **/
+    bool addWriteSocket( SOCKETHANDLE hSocket );
+
+    /**
+     * \brief   Removes the socket from the poller. Should be called before socket is closed.
+     * \param   hSocket         The socket handle to remove.
+     **/
+    void removeSocket( SOCKETHANDLE hSocket );
+
+    /**
+     * \brief   Returns the next ready socket. If there is no ready socket collected by
+     *          previous wait, the call blocks until any registered socket has an event,
+     *          the poller is woken up or the timeout expires.
+     *          The returned socket might be already closed by other thread.
+     * \param   timeout         The timeout in milliseconds to wait for socket events.
+     * \return  Returns the handle of ready socket. Returns invalid socket handle if
+     *          the poller is woken up by wakeUp() call, the timeout expired or failed to wait.
+     **/
+    SOCKETHANDLE waitSocketEvent( unsigned int timeout = NECommon::WAIT_INFINITE );
+
+    /**
+     * \brief   Removes the socket from the list of collected ready sockets. Should be
+     *          called by waiting thread if the handle of closed socket is reused.
+     * \param   hSocket         The socket handle to remove from the ready list.
+     **/
+    void dropReadySocket( SOCKETHANDLE hSocket );
+
+    /**
+     * \brief   Removes all sockets from the list of collected ready sockets. Should be
+     *          called by waiting thread if it handles all registered sockets at once.
+     **/
+    inline void dropReadySockets( void );
+
+    /**
+     * \brief   Wakes up the thread waiting for socket events. Can be called by any thread.
+     **/
+    void wakeUp( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   OS specific implementation. Waits for socket events and fills the ready list.
+     * \param   timeout         The timeout in milliseconds to wait for socket events.
+     * \return  Returns true if there are ready sockets. Returns false if woken up, timeout expired or failed.
+     **/
+    bool _osPollEvents( unsigned int timeout );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The handle of poller.
+     **/
+    int             mPollHandle;
+    /**
+     * \brief   The handle of object to wake up the waiting thread.
+     **/
+    int             mWakeUpHandle;
+    /**
+     * \brief   The number of ready sockets in the list.
+     **/
+    int             mReadyCount;
+    /**
+     * \brief   The index of next ready socket in the list.
+     **/
+    int             mReadyNext;
+    /**
+     * \brief   The list of ready sockets collected by the last wait.
+     **/
+    SOCKETHANDLE    mReadyList[MAXIMUM_EVENTS];
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    DECLARE_NOCOPY_NOMOVE( SocketPoller );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// SocketPoller class inline functions
+//////////////////////////////////////////////////////////////////////////
+
+inline bool SocketPoller::isValid( void ) const
+{
+    return (mPollHandle != -1);
+}
+
+inline void SocketPoller::dropReadySockets( void )
+{
+    mReadyCount = 0;
+    mReadyNext  = 0;
+}
@@ -96,7 +96,8 @@ public:
      *          call this method to create new socket descriptor and bind 
      *          socket to specified host name and port number.
      * \param   hostName    The name of host to bind.
-     * \param   portNr      The valid port number to bind.
+     * \param   portNr      The valid port number to bind. If NESocket::InvalidPort,
+     *                      the system assigns a free port and the address is updated.
      * \return  Returns true if operation succeeded.
      **/
     virtual bool createSocket( const char * hostName, unsigned short portNr ) override;
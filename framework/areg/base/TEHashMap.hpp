@@ -26,6 +26,33 @@
 #include "areg/base/IEIOStream.hpp"
 #include "areg/base/NEMemory.hpp"
 
+#include <type_traits>
+#include <utility>
+
+//////////////////////////////////////////////////////////////////////////
+// TEHashMapBackend<Implement> helper class template declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   Selects the table of hash map by the Implement class. If the Implement
+ *          class declares the static constant HASH_OPEN_ADDRESSING equal to true,
+ *          for example, TEOpenHashMapImpl, the hash map keeps elements in the
+ *          open-addressing table. Otherwise, the elements are chained in blocks.
+ * \tparam  Implement   The Implement class of hash map.
+ **/
+template <class Implement, typename = void>
+class TEHashMapBackend
+{
+public:
+    static constexpr bool   isOpenAddressing    { false };
+};
+
+template <class Implement>
+class TEHashMapBackend<Implement, std::void_t<decltype(Implement::HASH_OPEN_ADDRESSING)>>
+{
+public:
+    static constexpr bool   isOpenAddressing    { Implement::HASH_OPEN_ADDRESSING };
+};
+
 //////////////////////////////////////////////////////////////////////////
 // TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement> class template declaration
 //////////////////////////////////////////////////////////////////////////
@@ -47,6 +74,10 @@
  *          calculate the Hash. KEY and VALUE types should have at least default constructor
  *          and valid assigning operator.
  * 
+ *          If the Implement class declares HASH_OPEN_ADDRESSING equal to true
+ *          (see TEOpenHashMapImpl), the Hash Map keeps elements in the open-addressing
+ *          table, which grows automatically. See the specialization of TEHashMap below.
+ *
  *          The HashMap object is not thread safe and data should be  synchronized manually.
  *
  * \tparam  KEY         The type of Key to identify values in hash map.
@@ -67,8 +98,10 @@
  * \tparam  Implement   The class that contains methods to get hash key value,
  *                      compare keys and values of the map. Pass own implementation
  *                      if default methods needs to be changed.
+ * \tparam  OpenAddressing  The flag, indicating whether the elements are kept in the
+ *                      open-addressing table. Set by the Implement class, do not pass.
  **/
-template < typename KEY, typename VALUE, typename KEY_TYPE = KEY, typename VALUE_TYPE = VALUE, class Implement = TEHashMapImpl<KEY_TYPE, VALUE_TYPE> >
+template < typename KEY, typename VALUE, typename KEY_TYPE = KEY, typename VALUE_TYPE = VALUE, class Implement = TEHashMapImpl<KEY_TYPE, VALUE_TYPE>, bool OpenAddressing = TEHashMapBackend<Implement>::isOpenAddressing >
 class TEHashMap
 {
 //////////////////////////////////////////////////////////////////////////
@@ -150,13 +183,13 @@ public:
      * \brief   Copy constructor.
      * \param   src     The source to copy data.
      **/
-    TEHashMap( const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement> & src );
+    TEHashMap( const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing> & src );
 
     /**
      * \brief   Move constructor.
      * \param   src     The source to move data.
      **/
-    TEHashMap( TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement> && src ) noexcept;
+    TEHashMap( TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing> && src ) noexcept;
 
     /**
      * \brief   Destructor
@@ -174,26 +207,26 @@ public:
     /**
      * \brief	Assigning operator. It copies all elements from source map
      **/
-    TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>& operator = ( const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement> & src );
+    TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>& operator = ( const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing> & src );
 
     /**
      * \brief	Move operator. It moves all elements from source map
      **/
-    TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>& operator = ( TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement> && src ) noexcept;
+    TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>& operator = ( TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing> && src ) noexcept;
 
     /**
      * \brief   Checks equality of 2 hash-map objects, and returns true if they are equal.
      *          There should be possible to compare KEY and VALUE types of hash map.
      * \param   other   The hash-map object to compare
      **/
-    bool operator == ( const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement> & other ) const;
+    bool operator == ( const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing> & other ) const;
 
     /**
      * \brief   Checks inequality of 2 hash-map objects, and returns true if they are not equal.
      *          There should be possible to compare KEY and VALUE types of hash map.
      * \param   other   The hash-map object to compare
      **/
-    bool operator != ( const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement> & other ) const;
+    bool operator != ( const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing> & other ) const;
 
     /**
      * \brief	Subscript operator. Returns reference to value of element by given key.
@@ -566,6 +599,35 @@ protected:
         return result;
     }
 
+    /**
+     * \brief   Returns the position of first element with the given hash value or nullptr.
+     *          Used together with nextHashPosition() to search elements by other than key object.
+     * \param   hash    The hash value of searched elements.
+     **/
+    inline MAPPOS firstHashPosition( unsigned int hash ) const
+    {
+        Block * result = mHashTable != nullptr ? mHashTable[hash % static_cast<unsigned int>(mHashTableSize)] : nullptr;
+        for ( ; (result != nullptr) && (result->mHash != hash); result = result->mNext )
+            ;
+
+        return static_cast<MAPPOS>(result);
+    }
+
+    /**
+     * \brief   Returns the position of next element with the same hash value or nullptr.
+     * \param   atPosition  The valid position returned by firstHashPosition() or nextHashPosition().
+     **/
+    inline MAPPOS nextHashPosition( MAPPOS atPosition ) const
+    {
+        ASSERT( atPosition != nullptr );
+        const Block * block = static_cast<const Block *>(atPosition);
+        Block * result = block->mNext;
+        for ( ; (result != nullptr) && (result->mHash != block->mHash); result = result->mNext )
+            ;
+
+        return static_cast<MAPPOS>(result);
+    }
+
     /**
      * \brief   Returns Block object at the given position.
      *          If the position object is a first position, it will return first valid block.
@@ -732,635 +794,1721 @@ protected:
 };
 
 //////////////////////////////////////////////////////////////////////////
-// Function Implement
+// TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true> class template declaration
 //////////////////////////////////////////////////////////////////////////
 
+/**
+ * \brief   The Hash Map with open-addressing table. It is used if the Implement
+ *          class declares HASH_OPEN_ADDRESSING equal to true, for example, if it
+ *          is TEOpenHashMapImpl or derived from it. It has same interface as
+ *          the Hash Map with the chained blocks.
+ *
+ *          The Blocks are stored directly in the table and every Block has a
+ *          control byte, which indicates whether the Block is empty, deleted or
+ *          contains 7 bits of hash value. The search starts at the index of hash
+ *          value and linearly scans control bytes, the keys are compared only if
+ *          the bits of hash value match. The size of table is a power of 2 and
+ *          it grows twice when more than 7/8 of table is used.
+ *
+ *          The positions and the references of elements remain valid when other
+ *          elements are removed, so that the elements can be removed during
+ *          iteration. They are invalidated when a new element is inserted,
+ *          because the table may grow.
+ **/
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+class TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>
+{
 //////////////////////////////////////////////////////////////////////////
-// TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::Block class Implement
+// Internal objects and types declaration
 //////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   The Block contains the key, value and hash value of element.
+     *          The key and value are constructed only in used Blocks of table.
+     **/
+    class Block   : public TEPair<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>
+    {
+    public:
+        /**
+         * \brief   Hash value of element calculated by Implement class.
+         **/
+        unsigned int    mHash;
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-inline TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::Block::Block( void )
-    : TEPair<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>( )
-    , mNext ( nullptr )
-    , mHash (0)
-{
-}
+    private:
+        Block( void ) = delete;
+        DECLARE_NOCOPY_NOMOVE( Block );
+    };
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-inline TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::Block::Block(unsigned int hash, KEY_TYPE key, VALUE_TYPE value)
-    : TEPair<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>(key, value)
-    , mNext ( nullptr )
-    , mHash (hash)
-{
-}
+private:
+    /**
+     * \brief   The control byte of empty Block.
+     **/
+    static constexpr unsigned char  SLOT_EMPTY      { static_cast<unsigned char>(0x80) };
+    /**
+     * \brief   The control byte of deleted Block. The search does not stop at deleted Blocks.
+     **/
+    static constexpr unsigned char  SLOT_DELETED    { static_cast<unsigned char>(0xFE) };
+    /**
+     * \brief   The minimum size of table.
+     **/
+    static constexpr int            MIN_TABLE_SIZE  { 8 };
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-inline TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::Block::Block( TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::Block && src ) noexcept
-    : TEPair<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>( static_cast<TEPair<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement> &&>(src) )
-    , mNext ( src.mNext )
-    , mHash ( src.mHash )
-{
-    src.mNext   = nullptr;
-    src.mHash   = NECommon::MAP_INVALID_HASH;
-}
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Default constructor. The initial size of table is MAP_DEFAULT_HASH_SIZE (64).
+     **/
+    TEHashMap( void );
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::Block::~Block( void )
-{
-}
+    /**
+     * \brief	Initializes the size of table.
+     * \param	blockSize	Ignored, the Blocks are stored in the table.
+     * \param	hashSize	The initial size of table, which is rounded up to the power of 2.
+     *                      If it is negative, the size is MAP_DEFAULT_HASH_SIZE (64).
+     *                      The table grows when elements are added.
+     **/
+    TEHashMap( int blockSize, int hashSize );
+
+    /**
+     * \brief   Copy constructor.
+     * \param   src     The source to copy data.
+     **/
+    TEHashMap( const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true> & src );
+
+    /**
+     * \brief   Move constructor.
+     * \param   src     The source to move data.
+     **/
+    TEHashMap( TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true> && src ) noexcept;
+
+    /**
+     * \brief   Destructor
+     **/
+    ~TEHashMap( void );
 
 //////////////////////////////////////////////////////////////////////////
-// TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement> class template Implement
+// Operators
 //////////////////////////////////////////////////////////////////////////
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::TEHashMap( void )
-    : mHashTable    ( nullptr )
-    , mHashTableSize(0)
-    , mBlockList    ( nullptr )
-    , mBlockSize    ( NECommon::MAP_DEFAULT_BLOCK_SIZE)
-    , mElemCount    (0)
-    , mFreeList     ( nullptr )
-    , mImplement    ( )
-{
-    initHashTable( NECommon::MAP_DEFAULT_HASH_SIZE);
-}
+public:
+    /**
+     * \brief	Assigning operator. It copies all elements from source map
+     **/
+    TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true> & operator = ( const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true> & src );
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::TEHashMap(int blockSize, int hashSize)
-    : mHashTable    ( nullptr )
-    , mHashTableSize(0)
-    , mBlockList    ( nullptr )
-    , mBlockSize    (blockSize > 0 && blockSize <= NECommon::MAP_MAX_BLOCK_SIZE ? blockSize : (blockSize < 0 ? NECommon::MAP_DEFAULT_BLOCK_SIZE : NECommon::MAP_MAX_BLOCK_SIZE))
-    , mElemCount    (0)
-    , mFreeList     ( nullptr )
-    , mImplement    ( )
-{
-    initHashTable(hashSize > 0 && hashSize <= NECommon::MAP_MAX_TABLE_SIZE ? hashSize : hashSize < 0 ? NECommon::MAP_DEFAULT_HASH_SIZE : NECommon::MAP_MAX_TABLE_SIZE);
-}
+    /**
+     * \brief	Move operator. It moves all elements from source map
+     **/
+    TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true> & operator = ( TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true> && src ) noexcept;
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::TEHashMap(const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>& src)
-    : mHashTable    ( nullptr )
-    , mHashTableSize(0)
-    , mBlockList    ( nullptr )
-    , mBlockSize    (src.mBlockSize)
-    , mElemCount    (0)
-    , mFreeList     ( nullptr )
-    , mImplement    ( )
-{
-    initHashTable(src.mHashTableSize);
-    MAPPOS pos = src.firstPosition();
-    KEY key;
-    VALUE value;
-    while (pos != NECommon::INVALID_POSITION)
-    {
-        pos = src.nextPosition(pos, key, value);
-        setAt(key, value, false);
-    }
-}
+    /**
+     * \brief   Checks equality of 2 hash-map objects, and returns true if they are equal.
+     * \param   other   The hash-map object to compare
+     **/
+    bool operator == ( const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true> & other ) const;
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::TEHashMap( TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement> && src ) noexcept
-    : mHashTable    ( src.mHashTable )
-    , mHashTableSize( src.mHashTableSize )
-    , mBlockList    ( src.mBlockList )
-    , mBlockSize    ( src.mBlockSize )
-    , mElemCount    ( src.mElemCount )
-    , mFreeList     ( src.mFreeList  )
-    , mImplement    ( )
-{
-    src.mBlockList      = nullptr;
-    src.mBlockSize      = 0;
-    src.mElemCount      = 0;
-    src.mFreeList       = nullptr;
+    /**
+     * \brief   Checks inequality of 2 hash-map objects, and returns true if they are not equal.
+     * \param   other   The hash-map object to compare
+     **/
+    bool operator != ( const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true> & other ) const;
 
-    src.mHashTable	    = DEBUG_NEW Block *[src.mHashTableSize];
-    NEMemory::zeroElements<Block *>( mHashTable, mHashTableSize );
-}
+    /**
+     * \brief	Subscript operator. Returns reference to value of element by given key.
+     *          If the key does not exist, inserts an element with specified key.
+     **/
+    VALUE & operator [] ( KEY_TYPE Key );
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::~TEHashMap( void )
-{
-    removeAll();
-    if (mHashTable != nullptr )
-        delete [] mHashTable;
+    /**
+     * \brief	Subscript operator. Returns value of element by given key.
+     *          The key should exist in the hash map.
+     **/
+    inline VALUE_TYPE operator [] ( KEY_TYPE Key ) const;
 
-    mHashTable      = nullptr;
-    mHashTableSize  = 0;
-}
+    /**
+     * \brief   Reads out from the stream Hash Map Key and Value pair Elements and saves in Hash Map.
+     **/
+    template <typename K, typename V, typename KT, typename VT, class Impl>
+    friend const IEInStream & operator >> ( const IEInStream & stream, TEHashMap<K, V, KT, VT, Impl> & input);
+    /**
+     * \brief   Writes to the stream Hash Map Key and Value pair Elements.
+     **/
+    template <typename K, typename V, typename KT, typename VT, class Impl>
+    friend IEOutStream & operator << ( IEOutStream & stream, const TEHashMap<K, V, KT, VT, Impl> & output );
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>& TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::operator = ( const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement> & src )
-{
-    if (static_cast<const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement> *>(this) != static_cast<const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement> *>(&src))
-    {
-        removeAll();
-        mBlockSize  = src.mBlockSize;
-        initHashTable(src.mHashTableSize);
+//////////////////////////////////////////////////////////////////////////
+// Operations
+//////////////////////////////////////////////////////////////////////////
+public:
+/************************************************************************/
+// Attributes
+/************************************************************************/
 
-        MAPPOS pos = src.firstPosition();
-        KEY key;
-        VALUE value;
+    /**
+     * \brief	Returns true if Hash Map is empty
+     **/
+    inline bool isEmpty( void ) const;
 
-        while (pos != NECommon::INVALID_POSITION)
-        {
-            pos = src.nextPosition(pos, key, value);
-            setAt(key, value, false);
-        }
-    }
-    return (*this);
-}
+    /**
+     * \brief	Returns the size of Hash Map
+     **/
+    inline int getSize( void ) const;
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>& TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::operator = ( TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement> && src ) noexcept
-{
-    if ( static_cast<const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement> *>(this) != static_cast<const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement> *>(&src) )
-    {
-        removeAll( );
-        if ( mHashTable != nullptr )
-            delete [] mHashTable;
+    /**
+     * \brief	Returns the size of hash table
+     **/
+    inline int getTableSize( void ) const;
 
-        mHashTable    = src.mHashTable;
-        mHashTableSize= src.mHashTableSize;
-        mBlockList    = src.mBlockList;
-        mBlockSize    = src.mBlockSize;
-        mElemCount    = src.mElemCount;
-        mFreeList     = src.mFreeList;
+    /**
+     * \brief	Returns the position of first element or nullptr if Hash Map is empty.
+     **/
+    inline MAPPOS firstPosition( void ) const;
 
-        src.mHashTable      = nullptr;
-        src.mHashTableSize  = 0;
-        src.mBlockList      = nullptr;
-        src.mBlockSize      = 0;
-        src.mElemCount      = 0;
-        src.mFreeList       = nullptr;
-    }
+/************************************************************************/
+// Operations
+/************************************************************************/
 
-    return (*this);
-}
+    /**
+     * \brief	Searches element by given key. If found, on output returns the value of element.
+     * \param	Key	        Key to search.
+     * \param	out_Value   On output, contains value of found element
+     * \return	Returns true if finds element with specified key.
+     **/
+    inline bool find( KEY_TYPE Key, VALUE & out_Value ) const;
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-bool TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::operator == (const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>& other) const
-{
-    bool result = true;
+    /**
+     * \brief	Searches element by given key and returns position or nullptr if not found.
+     * \param	Key	    The key to search.
+     **/
+    inline MAPPOS find( KEY_TYPE Key ) const;
+
+    /**
+     * \brief	Update existing element value or inserts new element in the Hash Map.
+     *          If searchBeforeInsert is false, the new element is inserted without search.
+     * \param	Key	                The key of element to search or to create
+     * \param	newValue	        The value of element to set or insert
+     * \param	searchBeforeInsert	If true, searches element before inserting new.
+     * \return  Returns position of updated or new inserted element.
+     **/
+    MAPPOS setAt( KEY_TYPE Key, VALUE_TYPE newValue, bool searchBeforeInsert = true );
+    /**
+     * \brief	Update existing element value or inserts new element in the Hash Map.
+     * \param	newElement	        The Key and Value pair of element to set or insert
+     * \param	searchBeforeInsert	If true, searches element before inserting new.
+     * \return  Returns position of updated or new inserted element.
+     **/
+    inline MAPPOS setAt( const TEPair<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement> & newElement, bool searchBeforeInsert = true );
+
+    /**
+     * \brief   Updates the value of existing key. Returns the position of element
+     *          or nullptr if the key does not exist.
+     **/
+    MAPPOS updateAt( KEY_TYPE Key, VALUE_TYPE newValue );
+
+    /**
+     * \brief	Removes existing key. Returns true if the key existed.
+     **/
+    bool removeAt( KEY_TYPE Key );
+
+    /**
+     * \brief	Removes existing key. If removed, on output contains value of removed element.
+     **/
+    bool removeAt( KEY_TYPE Key, VALUE & out_Value );
+
+    /**
+     * \brief	Updates value of element at given position and returns position of next element.
+     **/
+    MAPPOS setPosition( MAPPOS atPosition, VALUE_TYPE newValue );
+
+    /**
+     * \brief	Removes element at given position, on output the parameters contain
+     *          the key and value of removed element. Returns position of next element.
+     **/
+    MAPPOS removePosition( MAPPOS curPos, KEY & out_Key, VALUE & out_Value );
+
+    /**
+     * \brief	Removes element at given position and returns value of removed element.
+     **/
+    VALUE removePosition( MAPPOS atPosition );
+
+    /**
+     * \brief   Removes all elements in hash map. The size of table remains.
+     **/
+    void removeAll( void );
+
+    /**
+     * \brief	Retrieves key and value of element at given position and returns position of next element.
+     **/
+    MAPPOS nextPosition( MAPPOS atPosition, KEY & out_Key, VALUE & out_Value ) const;
+    /**
+     * \brief	Retrieves key and value pair of element at given position and returns position of next element.
+     **/
+    inline MAPPOS nextPosition( MAPPOS atPosition, TEPair<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement> & out_Element ) const;
+    /**
+     * \brief	Returns position of next element or nullptr if it is the last element.
+     **/
+    inline MAPPOS nextPosition( MAPPOS atPosition ) const;
+    /**
+     * \brief   Returns reference of element value at given valid position.
+     **/
+    inline VALUE & getPosition( const MAPPOS atPosition );
+    /**
+     * \brief   Returns element value at given valid position.
+     **/
+    inline VALUE_TYPE getPosition( const MAPPOS atPosition ) const;
+    /**
+     * \brief	Returns reference to value of element by given key.
+     *          If the key does not exist, inserts an element with specified key.
+     **/
+    VALUE & getAt( KEY_TYPE Key );
+    /**
+     * \brief	Returns value of element by given key. The key should exist in hash map.
+     **/
+    inline VALUE_TYPE getAt( KEY_TYPE Key ) const;
+
+    /**
+     * \brief	Retrieves key and value of element at given position.
+     **/
+    inline void getAtPosition( MAPPOS atPosition, KEY & out_Key, VALUE & out_Value ) const;
+    /**
+     * \brief	Retrieves key and value pair of element at given position.
+     **/
+    inline void getAtPosition( MAPPOS atPosition, TEPair<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement> & out_Element ) const;
+
+    /**
+     * \brief   Returns the Key object value at the given position.
+     **/
+    inline KEY_TYPE keyAtPosition( MAPPOS atPosition ) const;
+
+    /**
+     * \brief   Returns the Value object value at the given position.
+     **/
+    inline VALUE_TYPE valueAtPosition( MAPPOS atPosition ) const;
+
+    /**
+     * \brief	Gets next element by given valid position and on output returns position,
+     *          key and value of next element. Returns true if next element exists.
+     **/
+    bool nextEntry( MAPPOS & in_out_NextPosition, KEY & out_NextKey, VALUE & out_NextValue ) const;
+
+//////////////////////////////////////////////////////////////////////////
+// Overrides
+//////////////////////////////////////////////////////////////////////////
+protected:
+
+    /**
+     * \brief	Calculates 32-bit hash value of the key.
+     **/
+    inline unsigned int getHashKey( KEY_TYPE Key ) const;
+
+    /**
+     * \brief   Called when comparing 2 keys. Returns true if keys are equal.
+     **/
+    inline bool isEqualKeys( KEY_TYPE key1, KEY_TYPE key2 ) const;
+
+    /**
+     * \brief   Called when comparing 2 values. Returns true if values are equal.
+     **/
+    inline bool isEqualValues( VALUE_TYPE value1, VALUE_TYPE value2) const;
+
+//////////////////////////////////////////////////////////////////////////
+// Protected / internal operations
+//////////////////////////////////////////////////////////////////////////
+
+    /**
+     * \brief	Allocates new empty table. The existing elements should be removed.
+     * \param	sizeHashTable	The size of table, rounded up to the power of 2.
+     **/
+    void initHashTable( int sizeHashTable = NECommon::MAP_DEFAULT_HASH_SIZE );
+
+    /**
+     * \brief   Moves the elements to the new table of given size.
+     * \param   sizeHashTable   The size of new table, which is a power of 2.
+     **/
+    void rehashTable( int sizeHashTable );
+
+    /**
+     * \brief   Takes a free Block for the new element and constructs key and value.
+     *          The table grows if more than 7/8 of it is used.
+     * \param   hash    The hash value of new element.
+     **/
+    Block * initNewBlock( unsigned int hash );
+
+    /**
+     * \brief   Destroys key and value of element and marks the Block as deleted.
+     **/
+    void removeBlock( Block * block );
+
+    /**
+     * \brief	Finds and returns pointer to block object by given Key or nullptr.
+     *          On output, 'outHash' contains hash value of key.
+     **/
+    inline Block * blockAt( KEY_TYPE Key, unsigned int & OUT out_Hash ) const
+    {
+        out_Hash = getHashKey( Key );
+        Block * result = nullptr;
+        if ( mTable != nullptr )
+        {
+            const unsigned int mask = static_cast<unsigned int>(mTableSize) - 1u;
+            const unsigned int mix  = mixHash( out_Hash );
+            const unsigned char tag = tagHash( mix );
+            for ( unsigned int idx = mix & mask; mControl[idx] != SLOT_EMPTY; idx = (idx + 1u) & mask )
+            {
+                Block * block = mTable + idx;
+                if ( (mControl[idx] == tag) && (block->mHash == out_Hash) && isEqualKeys( block->mKey, Key ) )
+                {
+                    result = block;
+                    break;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * \brief   Returns Block object at the given position.
+     *          If the position object is a first position, it will return first valid block.
+     **/
+    inline Block * blockAt( MAPPOS atPosition ) const
+    {
+        ASSERT( atPosition != nullptr );
+        return (atPosition == NECommon::START_POSITION ? firstValidBlock( ) : static_cast<Block *>(atPosition));
+    }
+
+    /**
+     * \brief   Returns the position of first element with the given hash value or nullptr.
+     *          Used together with nextHashPosition() to search elements by other than key object.
+     * \param   hash    The hash value of searched elements.
+     **/
+    inline MAPPOS firstHashPosition( unsigned int hash ) const
+    {
+        return (mTable != nullptr ? hashPosition( hash, mixHash( hash ) & (static_cast<unsigned int>(mTableSize) - 1u) ) : nullptr);
+    }
+
+    /**
+     * \brief   Returns the position of next element with the same hash value or nullptr.
+     * \param   atPosition  The valid position returned by firstHashPosition() or nextHashPosition().
+     **/
+    inline MAPPOS nextHashPosition( MAPPOS atPosition ) const
+    {
+        ASSERT( atPosition != nullptr );
+        const Block * block = static_cast<const Block *>(atPosition);
+        const unsigned int idx = static_cast<unsigned int>(block - mTable);
+        return hashPosition( block->mHash, (idx + 1u) & (static_cast<unsigned int>(mTableSize) - 1u) );
+    }
+
+    /**
+     * \brief   Returns the first used Block in the table or nullptr if the table is empty.
+     **/
+    inline Block * firstValidBlock( void ) const
+    {
+        return (mElemCount != 0 ? validBlockFrom( 0 ) : nullptr);
+    }
+
+    /**
+     * \brief   Returns the next used Block in the table after given Block or nullptr.
+     **/
+    inline Block * nextValidBlock( const Block * startAt ) const
+    {
+        ASSERT( startAt != nullptr );
+        return (mElemCount != 0 ? validBlockFrom( static_cast<int>(startAt - mTable) + 1 ) : nullptr);
+    }
+
+private:
+    /**
+     * \brief   Returns the first used Block starting at the given index or nullptr.
+     **/
+    inline Block * validBlockFrom( int idx ) const
+    {
+        for ( ; idx < mTableSize; ++ idx )
+        {
+            if ( isUsedSlot( mControl[idx] ) )
+                return (mTable + idx);
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * \brief   Returns the position of element with given hash value, scanning the table
+     *          from given index until the empty Block.
+     **/
+    inline MAPPOS hashPosition( unsigned int hash, unsigned int idx ) const
+    {
+        const unsigned int mask = static_cast<unsigned int>(mTableSize) - 1u;
+        const unsigned char tag = tagHash( mixHash( hash ) );
+        for ( ; mControl[idx] != SLOT_EMPTY; idx = (idx + 1u) & mask )
+        {
+            if ( (mControl[idx] == tag) && (mTable[idx].mHash == hash) )
+                return static_cast<MAPPOS>(mTable + idx);
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * \brief   Mixes the bits of hash value. The hash values of keys such as pointers
+     *          or handles differ mainly in the middle bits, while the index in table
+     *          is taken from the lower bits.
+     **/
+    static inline unsigned int mixHash( unsigned int hash )
+    {
+        return static_cast<unsigned int>((static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull) >> 32);
+    }
+
+    /**
+     * \brief   Returns 7 upper bits of mixed hash value saved in the control byte of used Block.
+     **/
+    static inline unsigned char tagHash( unsigned int mix )
+    {
+        return static_cast<unsigned char>(mix >> 25);
+    }
+
+    /**
+     * \brief   Returns true if the control byte is of used Block.
+     **/
+    static inline bool isUsedSlot( unsigned char control )
+    {
+        return ((control & SLOT_EMPTY) == 0);
+    }
+
+    /**
+     * \brief   Returns the power of 2, which is equal or bigger than given size of table.
+     **/
+    static inline int tableSize( int size )
+    {
+        int result = MIN_TABLE_SIZE;
+        while ( (result < size) && (result < (MAX_INT_32 / 2)) )
+            result <<= 1;
+
+        return result;
+    }
+
+    /**
+     * \brief   Allocates the table and control bytes in one buffer.
+     **/
+    static inline Block * allocateTable( int size, unsigned char * & out_Control )
+    {
+        unsigned char * buffer = DEBUG_NEW unsigned char[static_cast<unsigned int>(size) * (sizeof(Block) + 1u)];
+        out_Control = buffer + static_cast<unsigned int>(size) * sizeof(Block);
+        NEMemory::memSet( out_Control, size, SLOT_EMPTY );
+        return reinterpret_cast<Block *>(buffer);
+    }
+
+//////////////////////////////////////////////////////////////////////////
+// Member Variables
+//////////////////////////////////////////////////////////////////////////
+protected:
+    /**
+     * \brief   The table of Blocks. The control bytes follow the Blocks in the same buffer.
+     **/
+    Block *         mTable;
+    /**
+     * \brief   The control bytes of Blocks.
+     **/
+    unsigned char * mControl;
+    /**
+     * \brief   The size of table, which is a power of 2.
+     **/
+    int             mTableSize;
+    /**
+     * \brief   Number of elements in Hash Map
+     **/
+    int             mElemCount;
+    /**
+     * \brief   Number of deleted Blocks, which are not empty for the search.
+     **/
+    int             mDeletedCount;
+    /**
+     * \brief   Instance of object that compares keys and values.
+     **/
+    Implement       mImplement;
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Function Implement
+//////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////
+// TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::Block class Implement
+//////////////////////////////////////////////////////////////////////////
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+inline TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::Block::Block( void )
+    : TEPair<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>( )
+    , mNext ( nullptr )
+    , mHash (0)
+{
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+inline TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::Block::Block(unsigned int hash, KEY_TYPE key, VALUE_TYPE value)
+    : TEPair<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>(key, value)
+    , mNext ( nullptr )
+    , mHash (hash)
+{
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+inline TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::Block::Block( TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::Block && src ) noexcept
+    : TEPair<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>( static_cast<TEPair<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement> &&>(src) )
+    , mNext ( src.mNext )
+    , mHash ( src.mHash )
+{
+    src.mNext   = nullptr;
+    src.mHash   = NECommon::MAP_INVALID_HASH;
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::Block::~Block( void )
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+// TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement> class template Implement
+//////////////////////////////////////////////////////////////////////////
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::TEHashMap( void )
+    : mHashTable    ( nullptr )
+    , mHashTableSize(0)
+    , mBlockList    ( nullptr )
+    , mBlockSize    ( NECommon::MAP_DEFAULT_BLOCK_SIZE)
+    , mElemCount    (0)
+    , mFreeList     ( nullptr )
+    , mImplement    ( )
+{
+    initHashTable( NECommon::MAP_DEFAULT_HASH_SIZE);
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::TEHashMap(int blockSize, int hashSize)
+    : mHashTable    ( nullptr )
+    , mHashTableSize(0)
+    , mBlockList    ( nullptr )
+    , mBlockSize    (blockSize > 0 && blockSize <= NECommon::MAP_MAX_BLOCK_SIZE ? blockSize : (blockSize < 0 ? NECommon::MAP_DEFAULT_BLOCK_SIZE : NECommon::MAP_MAX_BLOCK_SIZE))
+    , mElemCount    (0)
+    , mFreeList     ( nullptr )
+    , mImplement    ( )
+{
+    initHashTable(hashSize > 0 && hashSize <= NECommon::MAP_MAX_TABLE_SIZE ? hashSize : hashSize < 0 ? NECommon::MAP_DEFAULT_HASH_SIZE : NECommon::MAP_MAX_TABLE_SIZE);
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::TEHashMap(const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>& src)
+    : mHashTable    ( nullptr )
+    , mHashTableSize(0)
+    , mBlockList    ( nullptr )
+    , mBlockSize    (src.mBlockSize)
+    , mElemCount    (0)
+    , mFreeList     ( nullptr )
+    , mImplement    ( )
+{
+    initHashTable(src.mHashTableSize);
+    MAPPOS pos = src.firstPosition();
+    KEY key;
+    VALUE value;
+    while (pos != NECommon::INVALID_POSITION)
+    {
+        pos = src.nextPosition(pos, key, value);
+        setAt(key, value, false);
+    }
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::TEHashMap( TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing> && src ) noexcept
+    : mHashTable    ( src.mHashTable )
+    , mHashTableSize( src.mHashTableSize )
+    , mBlockList    ( src.mBlockList )
+    , mBlockSize    ( src.mBlockSize )
+    , mElemCount    ( src.mElemCount )
+    , mFreeList     ( src.mFreeList  )
+    , mImplement    ( )
+{
+    src.mBlockList      = nullptr;
+    src.mBlockSize      = 0;
+    src.mElemCount      = 0;
+    src.mFreeList       = nullptr;
+
+    src.mHashTable	    = DEBUG_NEW Block *[src.mHashTableSize];
+    NEMemory::zeroElements<Block *>( mHashTable, mHashTableSize );
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::~TEHashMap( void )
+{
+    removeAll();
+    if (mHashTable != nullptr )
+        delete [] mHashTable;
+
+    mHashTable      = nullptr;
+    mHashTableSize  = 0;
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>& TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::operator = ( const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing> & src )
+{
+    if (static_cast<const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing> *>(this) != static_cast<const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing> *>(&src))
+    {
+        removeAll();
+        mBlockSize  = src.mBlockSize;
+        initHashTable(src.mHashTableSize);
+
+        MAPPOS pos = src.firstPosition();
+        KEY key;
+        VALUE value;
+
+        while (pos != NECommon::INVALID_POSITION)
+        {
+            pos = src.nextPosition(pos, key, value);
+            setAt(key, value, false);
+        }
+    }
+    return (*this);
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>& TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::operator = ( TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing> && src ) noexcept
+{
+    if ( static_cast<const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing> *>(this) != static_cast<const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing> *>(&src) )
+    {
+        removeAll( );
+        if ( mHashTable != nullptr )
+            delete [] mHashTable;
+
+        mHashTable    = src.mHashTable;
+        mHashTableSize= src.mHashTableSize;
+        mBlockList    = src.mBlockList;
+        mBlockSize    = src.mBlockSize;
+        mElemCount    = src.mElemCount;
+        mFreeList     = src.mFreeList;
+
+        src.mHashTable      = nullptr;
+        src.mHashTableSize  = 0;
+        src.mBlockList      = nullptr;
+        src.mBlockSize      = 0;
+        src.mElemCount      = 0;
+        src.mFreeList       = nullptr;
+    }
+
+    return (*this);
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+bool TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::operator == (const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>& other) const
+{
+    bool result = true;
     if ( this != &other )
     {
-        result = false;
-        if ( other.mElemCount == mElemCount )
+        result = false;
+        if ( other.mElemCount == mElemCount )
+        {
+            result = true;
+            KEY otherKey;
+            VALUE otherValue, thisValue;
+
+            for ( MAPPOS otherPos = other.firstPosition( ); result && (otherPos != NECommon::INVALID_POSITION); )
+            {
+                otherPos = other.nextPosition( otherPos, otherKey, otherValue );
+                result = find( otherKey, thisValue ) ? isEqualValues( otherValue, thisValue ) : false;
+            }
+        }
+    }
+    return result;
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+bool TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::operator != ( const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>& other ) const
+{
+    bool result = false;
+    if (this != &other )
+    {
+        result = true;
+        if (other.mElemCount == mElemCount)
+        {
+            KEY otherKey;
+            VALUE otherValue, thisValue;
+
+            for ( MAPPOS otherPos = other.firstPosition(); result && (otherPos != NECommon::INVALID_POSITION); )
+            {
+                otherPos = other.nextPosition(otherPos, otherKey, otherValue);
+                result = find(otherKey, thisValue) ? isEqualValues( otherValue, thisValue ) == false : true;
+            }
+        }
+    }
+
+    return result;
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+VALUE & TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::operator [] (KEY_TYPE Key)
+{
+    return getAt(Key);
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+inline VALUE_TYPE TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::operator [] ( KEY_TYPE Key ) const
+{
+    return getAt(Key);
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+inline int TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::getSize( void ) const
+{
+    return mElemCount;
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+inline int TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::getTableSize( void ) const
+{
+    return mHashTableSize;
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+inline bool TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::isEmpty( void ) const
+{
+    return (mElemCount == 0);
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+inline MAPPOS TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::firstPosition( void ) const
+{
+    return (mElemCount != 0 ? NECommon::START_POSITION : nullptr);
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+inline bool TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::find( KEY_TYPE Key, VALUE & out_Value ) const
+{
+    bool result     = false;
+    Block **block = blockAtRef(Key);
+    if ( (block != nullptr) && (*block != nullptr) )
+    {
+        out_Value   = (*block)->mValue;
+        result      = true;
+    }
+    
+    return result;
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+inline MAPPOS TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::find(KEY_TYPE Key) const
+{
+    Block** result = blockAtRef(Key);
+    return (result != nullptr ? static_cast<MAPPOS>(*result) : nullptr);
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+MAPPOS TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::setAt(KEY_TYPE Key, VALUE_TYPE newValue, bool searchBeforeInsert /*= true*/)
+{
+    ASSERT(mHashTable != nullptr);
+
+    unsigned int hash = NECommon::MAP_INVALID_HASH;
+    Block* block = nullptr; 
+    
+    if ( searchBeforeInsert )
+    {
+        block = blockAt(Key, hash);
+    }
+    else
+    {
+        hash = getHashKey(Key);
+    }
+
+    if (block == nullptr)
+    {
+        // it doesn't exist, add a new Block
+        unsigned int size = static_cast<unsigned int>(mHashTableSize);
+        unsigned int idx  = hash % size;
+        block       = initNewBlock();
+        block->mHash= hash;
+        block->mKey	= Key;
+        // 'block->mValue' is a constructed object, nothing more put into hash table
+        block->mNext= mHashTable[idx];
+        mHashTable[idx]= block;
+    }
+
+    block->mValue = newValue;
+    return static_cast<MAPPOS>(block);
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+inline MAPPOS TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::setAt(const TEPair<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement> &newItem, bool searchBeforeInsert /*= true*/)
+{
+    return setAt(newItem.mKey, newItem.mValue, searchBeforeInsert);
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+MAPPOS TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::updateAt(KEY_TYPE Key, VALUE_TYPE newValue)
+{
+    ASSERT(mHashTable != nullptr );
+
+    unsigned int hash = NECommon::MAP_INVALID_HASH;
+    Block* block    = blockAt(Key, hash);
+    if (block != nullptr)
+    {
+        // Block exists, update existing key value.
+        block->mValue = newValue;
+    }
+
+    return static_cast<MAPPOS>(block);
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+bool TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::removeAt(KEY_TYPE Key)
+{
+    bool result = false;
+    Block** block = blockAtRef(Key);
+    if ((block != nullptr) && (*block != nullptr))
+    {
+        result = true;
+        removeBlock(block);
+    }
+
+    return result;
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+bool TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::removeAt(KEY_TYPE Key, VALUE& out_Value)
+{
+    bool result = false;
+    Block** block = blockAtRef(Key);
+    if ((block != nullptr) && (*block != nullptr))
+    {
+        result      = true;
+        out_Value   = (*block)->mValue;
+        removeBlock(block);
+    }
+
+    return result;
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+MAPPOS TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::setPosition(MAPPOS atPosition, VALUE_TYPE newValue)
+{
+    ASSERT( mHashTable != nullptr );
+    ASSERT( atPosition != nullptr );
+
+    Block* block      = blockAt(atPosition);
+    Block* nextBlock  = nextValidBlock(block);
+    block->mValue     = newValue;
+    return static_cast<MAPPOS>(nextBlock);
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+MAPPOS TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::removePosition(MAPPOS curPos, KEY& out_Key, VALUE& out_Value)
+{
+    ASSERT( mHashTable != nullptr );
+    ASSERT( curPos     != nullptr );
+    MAPPOS   result = nullptr;
+    Block* block    = blockAt(curPos);
+    Block* nextBlock= nextValidBlock(block);
+    result      = static_cast<MAPPOS>(nextBlock);
+    out_Key		= block->mKey;
+    out_Value	= block->mValue;
+
+    ASSERT(block != nullptr);
+    removeBlock(blockReference(*block));
+
+    return result;
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+VALUE TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::removePosition(MAPPOS atPosition)
+{
+    ASSERT(mHashTable != nullptr);
+    ASSERT(atPosition != nullptr);
+
+    VALUE result;
+    Block* block = blockAt(atPosition);
+    result = block->mValue;
+    
+    ASSERT(block != nullptr);
+    removeBlock(blockReference(*block));
+    return result;
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+void TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::removeAll( void )
+{
+    Block	*block = nullptr;
+    for (int idx = 0; idx < mHashTableSize; ++ idx)
+    {
+        for (block = mHashTable[idx]; block != nullptr; block = block->mNext)
         {
-            result = true;
-            KEY otherKey;
-            VALUE otherValue, thisValue;
-
-            for ( MAPPOS otherPos = other.firstPosition( ); result && (otherPos != NECommon::INVALID_POSITION); )
-            {
-                otherPos = other.nextPosition( otherPos, otherKey, otherValue );
-                result = find( otherKey, thisValue ) ? isEqualValues( otherValue, thisValue ) : false;
-            }
+            (&block->mKey)->~KEY();
+            (&block->mValue)->~VALUE();
         }
     }
+
+    deleteAllBlocks();
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+MAPPOS TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::nextPosition(MAPPOS atPosition, KEY& out_Key, VALUE& out_Value) const
+{
+    ASSERT(mHashTable != nullptr);
+    ASSERT(atPosition != nullptr);
+
+    Block* block      = blockAt(atPosition);
+    Block* nextBlock  = nextValidBlock(block);
+    out_Key		      = block->mKey;
+    out_Value	      = block->mValue;
+
+    return static_cast<MAPPOS>(nextBlock);
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+inline MAPPOS TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::nextPosition(MAPPOS atPosition, TEPair<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement> & out_Element) const
+{
+    return nextPosition(atPosition, out_Element.mKey, out_Element.mValue);
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+inline MAPPOS TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::nextPosition( MAPPOS atPosition ) const
+{
+    ASSERT(mHashTable != nullptr);
+    ASSERT(atPosition != nullptr);
+    Block* block      = blockAt(atPosition);
+    return static_cast<MAPPOS>( nextValidBlock(block) );
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+inline VALUE& TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::getPosition( const MAPPOS atPosition )
+{
+    ASSERT( mHashTable != nullptr );
+    ASSERT( atPosition != nullptr );
+
+    Block* block = blockAt( atPosition );
+    return block->mValue;
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+inline VALUE_TYPE TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::getPosition( const MAPPOS atPosition ) const
+{
+    ASSERT( mHashTable != nullptr );
+    ASSERT( atPosition != nullptr );
+
+    Block* block = blockAt( atPosition );
+    return block->mValue;
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+VALUE& TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::getAt( KEY_TYPE Key )
+{
+    ASSERT( mHashTable != nullptr );
+
+    unsigned int hash   = NECommon::MAP_INVALID_HASH;
+    Block *list = blockAt( Key, hash );
+    if ( list == nullptr )
+    {
+        // add new list
+        int idx     = static_cast<int>(hash % mHashTableSize);
+        list        = initNewBlock( );
+        list->mHash = hash;
+        list->mKey	= Key;
+        list->mNext	= mHashTable[idx];
+        mHashTable[idx] = list;
+    }
+
+    return list->mValue;
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+inline VALUE_TYPE TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::getAt(KEY_TYPE Key) const
+{
+    Block ** block  = blockAtRef(Key);
+    ASSERT((block != nullptr) && (*block != nullptr));
+    return (*block)->mValue;
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+inline void TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::getAtPosition(MAPPOS atPosition, KEY & out_Key, VALUE & out_Value) const
+{
+    ASSERT(mHashTable != nullptr);
+    ASSERT(atPosition != nullptr);
+
+    Block* block    = blockAt(atPosition);
+    out_Key   = block->mKey;
+    out_Value= block->mValue;
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+inline void TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::getAtPosition(MAPPOS atPosition, TEPair<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement> & out_Element) const
+{
+    getAtPosition(atPosition, out_Element.mKey, out_Element.mValue);
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+inline VALUE_TYPE TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::valueAtPosition( MAPPOS atPosition ) const
+{
+    ASSERT( mHashTable != nullptr );
+    ASSERT( atPosition != nullptr );
+
+    Block* block    = blockAt(atPosition);
+    return block->mValue;
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+inline KEY_TYPE TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::keyAtPosition( MAPPOS atPosition ) const
+{
+    ASSERT( mHashTable != nullptr );
+    ASSERT( atPosition != nullptr );
+
+    Block* block    = blockAt(atPosition);
+    return block->mKey;
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+bool TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::nextEntry(MAPPOS & in_out_NextPosition, KEY & out_NextKey, VALUE & out_NextValue) const
+{
+    ASSERT( mHashTable != nullptr );
+    ASSERT( in_out_NextPosition != nullptr );
+
+    bool result     = false;
+    Block* block    = blockAt(in_out_NextPosition);
+    Block* nextBlock= nextValidBlock(block);
+    in_out_NextPosition = static_cast<MAPPOS>(nextBlock);
+    if ( nextBlock != nullptr )
+    {
+        out_NextKey     = nextBlock->mKey;
+        out_NextValue   = nextBlock->mValue;
+        result          = true;
+    }
+
     return result;
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-bool TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::operator != ( const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>& other ) const
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+void TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::initHashTable(int sizeHashTable /*= NECommon::MAP_DEFAULT_HASH_SIZE*/)
 {
-    bool result = false;
-    if (this != &other )
+    ASSERT(mElemCount   == 0);
+    ASSERT(sizeHashTable >  0 && sizeHashTable <= NECommon::MAP_MAX_TABLE_SIZE);
+    if (mHashTable != nullptr)
+        delete [] mHashTable;
+
+    mHashTable	    = DEBUG_NEW Block *[static_cast<unsigned int>(sizeHashTable)];
+    mHashTableSize	= mHashTable != nullptr ? sizeHashTable : 0;
+    NEMemory::zeroElements<Block *>( mHashTable, mHashTableSize);
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+void TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::createBlockList( void )
+{
+    // add another block
+    // chain them into free list
+    unsigned int length     = static_cast<unsigned int>(mBlockSize * sizeof(Block) + sizeof(Block *));
+    unsigned char* newBlock = DEBUG_NEW unsigned char[length];
+    if (newBlock != nullptr)
     {
-        result = true;
-        if (other.mElemCount == mElemCount)
+        // link blocks, copy the address of last block into
+        // beginning of new block (and skip address part)
+        NEMemory::memCopy(newBlock, static_cast<int>(length), &mBlockList, static_cast<int>(sizeof(Block *)));
+        mBlockList   = reinterpret_cast<Block *>(newBlock);
+        newBlock    += sizeof(Block *);
+        Block* block = reinterpret_cast<Block *>(newBlock);
+        block       += mBlockSize - 1;
+        for (int i = mBlockSize; i > 0; -- i, -- block )
+        {
+            block->mNext= mFreeList;
+            mFreeList   = block;
+        }
+    }
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+void TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::deleteBlockList( void )
+{
+    unsigned char* blocks = reinterpret_cast<unsigned char *>(mBlockList);
+    while (blocks != nullptr)
+    {
+        // copy address of next block, placed during creating blocks.
+        NEMemory::memCopy(&mBlockList, sizeof(Block *), blocks, sizeof(Block *));
+        delete [] blocks;
+        blocks = reinterpret_cast<unsigned char *>(mBlockList);
+    }
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+void TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::freeBlock(Block* block)
+{
+    (&block->mKey)->~KEY();
+    (&block->mValue)->~VALUE();
+    block->mHash = 0;
+    block->mNext = mFreeList;
+    mFreeList = block;
+    mElemCount --;
+    ASSERT(mElemCount >= 0);
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+inline unsigned int TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::getHashKey( KEY_TYPE Key ) const
+{
+    return mImplement.implHashKey(Key);
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+inline bool TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::isEqualKeys(KEY_TYPE key1, KEY_TYPE key2) const
+{
+    return mImplement.implEqualKeys(key1, key2);
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */, bool OpenAddressing /* = false */ >
+inline bool TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, OpenAddressing>::isEqualValues(VALUE_TYPE value1, VALUE_TYPE value2) const
+{
+    return mImplement.implEqualValues(value1, value2);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true> class template Implement
+//////////////////////////////////////////////////////////////////////////
+
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::TEHashMap( void )
+    : mTable        ( nullptr )
+    , mControl      ( nullptr )
+    , mTableSize    ( 0 )
+    , mElemCount    ( 0 )
+    , mDeletedCount ( 0 )
+    , mImplement    ( )
+{
+    initHashTable( NECommon::MAP_DEFAULT_HASH_SIZE );
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::TEHashMap( int /*blockSize*/, int hashSize )
+    : mTable        ( nullptr )
+    , mControl      ( nullptr )
+    , mTableSize    ( 0 )
+    , mElemCount    ( 0 )
+    , mDeletedCount ( 0 )
+    , mImplement    ( )
+{
+    initHashTable( hashSize > 0 ? hashSize : NECommon::MAP_DEFAULT_HASH_SIZE );
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::TEHashMap( const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true> & src )
+    : mTable        ( nullptr )
+    , mControl      ( nullptr )
+    , mTableSize    ( 0 )
+    , mElemCount    ( 0 )
+    , mDeletedCount ( 0 )
+    , mImplement    ( )
+{
+    initHashTable( src.mTableSize );
+    for ( MAPPOS pos = src.firstPosition( ); pos != nullptr; pos = src.nextPosition( pos ) )
+    {
+        const Block * block = static_cast<const Block *>(pos);
+        setAt( block->mKey, block->mValue, false );
+    }
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::TEHashMap( TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true> && src ) noexcept
+    : mTable        ( src.mTable )
+    , mControl      ( src.mControl )
+    , mTableSize    ( src.mTableSize )
+    , mElemCount    ( src.mElemCount )
+    , mDeletedCount ( src.mDeletedCount )
+    , mImplement    ( )
+{
+    src.mTable          = nullptr;
+    src.mControl        = nullptr;
+    src.mTableSize      = 0;
+    src.mElemCount      = 0;
+    src.mDeletedCount   = 0;
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::~TEHashMap( void )
+{
+    removeAll( );
+    delete [] reinterpret_cast<unsigned char *>(mTable);
+
+    mTable      = nullptr;
+    mControl    = nullptr;
+    mTableSize  = 0;
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true> & TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::operator = ( const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true> & src )
+{
+    if ( this != &src )
+    {
+        removeAll( );
+        if ( mTableSize < src.mTableSize )
+        {
+            initHashTable( src.mTableSize );
+        }
+
+        for ( MAPPOS pos = src.firstPosition( ); pos != nullptr; pos = src.nextPosition( pos ) )
+        {
+            const Block * block = static_cast<const Block *>(pos);
+            setAt( block->mKey, block->mValue, false );
+        }
+    }
+
+    return (*this);
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true> & TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::operator = ( TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true> && src ) noexcept
+{
+    if ( this != &src )
+    {
+        removeAll( );
+        delete [] reinterpret_cast<unsigned char *>(mTable);
+
+        mTable          = src.mTable;
+        mControl        = src.mControl;
+        mTableSize      = src.mTableSize;
+        mElemCount      = src.mElemCount;
+        mDeletedCount   = src.mDeletedCount;
+
+        src.mTable          = nullptr;
+        src.mControl        = nullptr;
+        src.mTableSize      = 0;
+        src.mElemCount      = 0;
+        src.mDeletedCount   = 0;
+    }
+
+    return (*this);
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+bool TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::operator == ( const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true> & other ) const
+{
+    bool result = true;
+    if ( this != &other )
+    {
+        result = other.mElemCount == mElemCount;
+        for ( MAPPOS pos = other.firstPosition( ); result && (pos != nullptr); pos = other.nextPosition( pos ) )
         {
-            KEY otherKey;
-            VALUE otherValue, thisValue;
-
-            for ( MAPPOS otherPos = other.firstPosition(); result && (otherPos != NECommon::INVALID_POSITION); )
-            {
-                otherPos = other.nextPosition(otherPos, otherKey, otherValue);
-                result = find(otherKey, thisValue) ? isEqualValues( otherValue, thisValue ) == false : true;
-            }
+            const Block * block = static_cast<const Block *>(pos);
+            unsigned int hash   = NECommon::MAP_INVALID_HASH;
+            const Block * found = blockAt( block->mKey, hash );
+            result = (found != nullptr) && isEqualValues( block->mValue, found->mValue );
         }
     }
 
     return result;
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-VALUE & TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::operator [] (KEY_TYPE Key)
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+bool TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::operator != ( const TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true> & other ) const
 {
-    return getAt(Key);
+    return (operator == ( other ) == false);
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-inline VALUE_TYPE TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::operator [] ( KEY_TYPE Key ) const
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+VALUE & TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::operator [] ( KEY_TYPE Key )
 {
-    return getAt(Key);
+    return getAt( Key );
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-inline int TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::getSize( void ) const
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+inline VALUE_TYPE TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::operator [] ( KEY_TYPE Key ) const
 {
-    return mElemCount;
+    return getAt( Key );
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-inline int TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::getTableSize( void ) const
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+inline bool TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::isEmpty( void ) const
 {
-    return mHashTableSize;
+    return (mElemCount == 0);
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-inline bool TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::isEmpty( void ) const
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+inline int TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::getSize( void ) const
 {
-    return (mElemCount == 0);
+    return mElemCount;
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-inline MAPPOS TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::firstPosition( void ) const
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+inline int TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::getTableSize( void ) const
 {
-    return (mElemCount != 0 ? NECommon::START_POSITION : nullptr);
+    return mTableSize;
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-inline bool TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::find( KEY_TYPE Key, VALUE & out_Value ) const
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+inline MAPPOS TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::firstPosition( void ) const
 {
-    bool result     = false;
-    Block **block = blockAtRef(Key);
-    if ( (block != nullptr) && (*block != nullptr) )
+    return static_cast<MAPPOS>(firstValidBlock( ));
+}
+
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+inline bool TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::find( KEY_TYPE Key, VALUE & out_Value ) const
+{
+    unsigned int hash   = NECommon::MAP_INVALID_HASH;
+    const Block * block = blockAt( Key, hash );
+    if ( block != nullptr )
     {
-        out_Value   = (*block)->mValue;
-        result      = true;
+        out_Value = block->mValue;
     }
-    
-    return result;
+
+    return (block != nullptr);
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-inline MAPPOS TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::find(KEY_TYPE Key) const
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+inline MAPPOS TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::find( KEY_TYPE Key ) const
 {
-    Block** result = blockAtRef(Key);
-    return (result != nullptr ? static_cast<MAPPOS>(*result) : nullptr);
+    unsigned int hash = NECommon::MAP_INVALID_HASH;
+    return static_cast<MAPPOS>(blockAt( Key, hash ));
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-MAPPOS TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::setAt(KEY_TYPE Key, VALUE_TYPE newValue, bool searchBeforeInsert /*= true*/)
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+MAPPOS TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::setAt( KEY_TYPE Key, VALUE_TYPE newValue, bool searchBeforeInsert /*= true*/ )
 {
-    ASSERT(mHashTable != nullptr);
-
-    unsigned int hash = NECommon::MAP_INVALID_HASH;
-    Block* block = nullptr; 
-    
+    unsigned int hash   = NECommon::MAP_INVALID_HASH;
+    Block * block       = nullptr;
     if ( searchBeforeInsert )
     {
-        block = blockAt(Key, hash);
+        block = blockAt( Key, hash );
     }
     else
     {
-        hash = getHashKey(Key);
+        hash = getHashKey( Key );
     }
 
-    if (block == nullptr)
+    if ( block == nullptr )
     {
-        // it doesn't exist, add a new Block
-        unsigned int size = static_cast<unsigned int>(mHashTableSize);
-        unsigned int idx  = hash % size;
-        block       = initNewBlock();
-        block->mHash= hash;
-        block->mKey	= Key;
-        // 'block->mValue' is a constructed object, nothing more put into hash table
-        block->mNext= mHashTable[idx];
-        mHashTable[idx]= block;
+        block       = initNewBlock( hash );
+        block->mKey = Key;
     }
 
     block->mValue = newValue;
     return static_cast<MAPPOS>(block);
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-inline MAPPOS TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::setAt(const TEPair<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement> &newItem, bool searchBeforeInsert /*= true*/)
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+inline MAPPOS TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::setAt( const TEPair<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement> & newElement, bool searchBeforeInsert /*= true*/ )
 {
-    return setAt(newItem.mKey, newItem.mValue, searchBeforeInsert);
+    return setAt( newElement.mKey, newElement.mValue, searchBeforeInsert );
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-MAPPOS TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::updateAt(KEY_TYPE Key, VALUE_TYPE newValue)
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+MAPPOS TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::updateAt( KEY_TYPE Key, VALUE_TYPE newValue )
 {
-    ASSERT(mHashTable != nullptr );
-
-    unsigned int hash = NECommon::MAP_INVALID_HASH;
-    Block* block    = blockAt(Key, hash);
-    if (block != nullptr)
+    unsigned int hash   = NECommon::MAP_INVALID_HASH;
+    Block * block       = blockAt( Key, hash );
+    if ( block != nullptr )
     {
-        // Block exists, update existing key value.
         block->mValue = newValue;
     }
 
     return static_cast<MAPPOS>(block);
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-bool TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::removeAt(KEY_TYPE Key)
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+bool TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::removeAt( KEY_TYPE Key )
 {
-    bool result = false;
-    Block** block = blockAtRef(Key);
-    if ((block != nullptr) && (*block != nullptr))
+    unsigned int hash   = NECommon::MAP_INVALID_HASH;
+    Block * block       = blockAt( Key, hash );
+    if ( block != nullptr )
     {
-        result = true;
-        removeBlock(block);
+        removeBlock( block );
     }
 
-    return result;
+    return (block != nullptr);
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-bool TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::removeAt(KEY_TYPE Key, VALUE& out_Value)
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+bool TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::removeAt( KEY_TYPE Key, VALUE & out_Value )
 {
-    bool result = false;
-    Block** block = blockAtRef(Key);
-    if ((block != nullptr) && (*block != nullptr))
+    unsigned int hash   = NECommon::MAP_INVALID_HASH;
+    Block * block       = blockAt( Key, hash );
+    if ( block != nullptr )
     {
-        result      = true;
-        out_Value   = (*block)->mValue;
-        removeBlock(block);
+        out_Value = block->mValue;
+        removeBlock( block );
     }
 
-    return result;
+    return (block != nullptr);
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-MAPPOS TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::setPosition(MAPPOS atPosition, VALUE_TYPE newValue)
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+MAPPOS TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::setPosition( MAPPOS atPosition, VALUE_TYPE newValue )
 {
-    ASSERT( mHashTable != nullptr );
-    ASSERT( atPosition != nullptr );
-
-    Block* block      = blockAt(atPosition);
-    Block* nextBlock  = nextValidBlock(block);
-    block->mValue     = newValue;
-    return static_cast<MAPPOS>(nextBlock);
+    Block * block = blockAt( atPosition );
+    block->mValue = newValue;
+    return static_cast<MAPPOS>(nextValidBlock( block ));
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-MAPPOS TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::removePosition(MAPPOS curPos, KEY& out_Key, VALUE& out_Value)
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+MAPPOS TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::removePosition( MAPPOS curPos, KEY & out_Key, VALUE & out_Value )
 {
-    ASSERT( mHashTable != nullptr );
-    ASSERT( curPos     != nullptr );
-    MAPPOS   result = nullptr;
-    Block* block    = blockAt(curPos);
-    Block* nextBlock= nextValidBlock(block);
-    result      = static_cast<MAPPOS>(nextBlock);
-    out_Key		= block->mKey;
-    out_Value	= block->mValue;
+    Block * block   = blockAt( curPos );
+    out_Key         = block->mKey;
+    out_Value       = block->mValue;
+    removeBlock( block );
 
-    ASSERT(block != nullptr);
-    removeBlock(blockReference(*block));
-
-    return result;
+    // the removed Block is not reused until next insert.
+    return static_cast<MAPPOS>(nextValidBlock( block ));
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-VALUE TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::removePosition(MAPPOS atPosition)
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+VALUE TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::removePosition( MAPPOS atPosition )
 {
-    ASSERT(mHashTable != nullptr);
-    ASSERT(atPosition != nullptr);
-
-    VALUE result;
-    Block* block = blockAt(atPosition);
-    result = block->mValue;
-    
-    ASSERT(block != nullptr);
-    removeBlock(blockReference(*block));
+    Block * block = blockAt( atPosition );
+    VALUE result  = block->mValue;
+    removeBlock( block );
     return result;
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-void TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::removeAll( void )
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+void TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::removeAll( void )
 {
-    Block	*block = nullptr;
-    for (int idx = 0; idx < mHashTableSize; ++ idx)
+    for ( int idx = 0; (mElemCount != 0) && (idx < mTableSize); ++ idx )
     {
-        for (block = mHashTable[idx]; block != nullptr; block = block->mNext)
+        if ( isUsedSlot( mControl[idx] ) )
         {
-            (&block->mKey)->~KEY();
-            (&block->mValue)->~VALUE();
+            Block * block = mTable + idx;
+            (&block->mKey)->~KEY( );
+            (&block->mValue)->~VALUE( );
+            -- mElemCount;
         }
     }
 
-    deleteAllBlocks();
+    if ( mControl != nullptr )
+    {
+        NEMemory::memSet( mControl, mTableSize, SLOT_EMPTY );
+    }
+
+    mElemCount      = 0;
+    mDeletedCount   = 0;
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-MAPPOS TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::nextPosition(MAPPOS atPosition, KEY& out_Key, VALUE& out_Value) const
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+MAPPOS TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::nextPosition( MAPPOS atPosition, KEY & out_Key, VALUE & out_Value ) const
 {
-    ASSERT(mHashTable != nullptr);
-    ASSERT(atPosition != nullptr);
-
-    Block* block      = blockAt(atPosition);
-    Block* nextBlock  = nextValidBlock(block);
-    out_Key		      = block->mKey;
-    out_Value	      = block->mValue;
-
-    return static_cast<MAPPOS>(nextBlock);
+    const Block * block = blockAt( atPosition );
+    out_Key     = block->mKey;
+    out_Value   = block->mValue;
+    return static_cast<MAPPOS>(nextValidBlock( block ));
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-inline MAPPOS TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::nextPosition(MAPPOS atPosition, TEPair<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement> & out_Element) const
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+inline MAPPOS TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::nextPosition( MAPPOS atPosition, TEPair<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement> & out_Element ) const
 {
-    return nextPosition(atPosition, out_Element.mKey, out_Element.mValue);
+    return nextPosition( atPosition, out_Element.mKey, out_Element.mValue );
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-inline MAPPOS TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::nextPosition( MAPPOS atPosition ) const
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+inline MAPPOS TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::nextPosition( MAPPOS atPosition ) const
 {
-    ASSERT(mHashTable != nullptr);
-    ASSERT(atPosition != nullptr);
-    Block* block      = blockAt(atPosition);
-    return static_cast<MAPPOS>( nextValidBlock(block) );
+    return static_cast<MAPPOS>(nextValidBlock( blockAt( atPosition ) ));
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-inline VALUE& TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::getPosition( const MAPPOS atPosition )
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+inline VALUE & TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::getPosition( const MAPPOS atPosition )
 {
-    ASSERT( mHashTable != nullptr );
-    ASSERT( atPosition != nullptr );
-
-    Block* block = blockAt( atPosition );
-    return block->mValue;
+    return blockAt( atPosition )->mValue;
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-inline VALUE_TYPE TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::getPosition( const MAPPOS atPosition ) const
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+inline VALUE_TYPE TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::getPosition( const MAPPOS atPosition ) const
 {
-    ASSERT( mHashTable != nullptr );
-    ASSERT( atPosition != nullptr );
-
-    Block* block = blockAt( atPosition );
-    return block->mValue;
+    return blockAt( atPosition )->mValue;
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-VALUE& TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::getAt( KEY_TYPE Key )
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+VALUE & TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::getAt( KEY_TYPE Key )
 {
-    ASSERT( mHashTable != nullptr );
-
     unsigned int hash   = NECommon::MAP_INVALID_HASH;
-    Block *list = blockAt( Key, hash );
-    if ( list == nullptr )
+    Block * block       = blockAt( Key, hash );
+    if ( block == nullptr )
     {
-        // add new list
-        int idx     = static_cast<int>(hash % mHashTableSize);
-        list        = initNewBlock( );
-        list->mHash = hash;
-        list->mKey	= Key;
-        list->mNext	= mHashTable[idx];
-        mHashTable[idx] = list;
+        block       = initNewBlock( hash );
+        block->mKey = Key;
     }
 
-    return list->mValue;
+    return block->mValue;
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-inline VALUE_TYPE TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::getAt(KEY_TYPE Key) const
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+inline VALUE_TYPE TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::getAt( KEY_TYPE Key ) const
 {
-    Block ** block  = blockAtRef(Key);
-    ASSERT((block != nullptr) && (*block != nullptr));
-    return (*block)->mValue;
+    unsigned int hash   = NECommon::MAP_INVALID_HASH;
+    const Block * block = blockAt( Key, hash );
+    ASSERT( block != nullptr );
+    return block->mValue;
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-inline void TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::getAtPosition(MAPPOS atPosition, KEY & out_Key, VALUE & out_Value) const
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+inline void TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::getAtPosition( MAPPOS atPosition, KEY & out_Key, VALUE & out_Value ) const
 {
-    ASSERT(mHashTable != nullptr);
-    ASSERT(atPosition != nullptr);
-
-    Block* block    = blockAt(atPosition);
-    out_Key   = block->mKey;
-    out_Value= block->mValue;
+    const Block * block = blockAt( atPosition );
+    out_Key     = block->mKey;
+    out_Value   = block->mValue;
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-inline void TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::getAtPosition(MAPPOS atPosition, TEPair<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement> & out_Element) const
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+inline void TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::getAtPosition( MAPPOS atPosition, TEPair<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement> & out_Element ) const
 {
-    getAtPosition(atPosition, out_Element.mKey, out_Element.mValue);
+    getAtPosition( atPosition, out_Element.mKey, out_Element.mValue );
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-inline VALUE_TYPE TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::valueAtPosition( MAPPOS atPosition ) const
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+inline KEY_TYPE TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::keyAtPosition( MAPPOS atPosition ) const
 {
-    ASSERT( mHashTable != nullptr );
-    ASSERT( atPosition != nullptr );
+    return blockAt( atPosition )->mKey;
+}
 
-    Block* block    = blockAt(atPosition);
-    return block->mValue;
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+inline VALUE_TYPE TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::valueAtPosition( MAPPOS atPosition ) const
+{
+    return blockAt( atPosition )->mValue;
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-inline KEY_TYPE TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::keyAtPosition( MAPPOS atPosition ) const
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+bool TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::nextEntry( MAPPOS & in_out_NextPosition, KEY & out_NextKey, VALUE & out_NextValue ) const
 {
-    ASSERT( mHashTable != nullptr );
-    ASSERT( atPosition != nullptr );
+    const Block * block = nextValidBlock( blockAt( in_out_NextPosition ) );
+    in_out_NextPosition = static_cast<MAPPOS>(const_cast<Block *>(block));
+    if ( block != nullptr )
+    {
+        out_NextKey     = block->mKey;
+        out_NextValue   = block->mValue;
+    }
 
-    Block* block    = blockAt(atPosition);
-    return block->mKey;
+    return (block != nullptr);
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-bool TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::nextEntry(MAPPOS & in_out_NextPosition, KEY & out_NextKey, VALUE & out_NextValue) const
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+inline unsigned int TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::getHashKey( KEY_TYPE Key ) const
 {
-    ASSERT( mHashTable != nullptr );
-    ASSERT( in_out_NextPosition != nullptr );
+    return mImplement.implHashKey( Key );
+}
 
-    bool result     = false;
-    Block* block    = blockAt(in_out_NextPosition);
-    Block* nextBlock= nextValidBlock(block);
-    in_out_NextPosition = static_cast<MAPPOS>(nextBlock);
-    if ( nextBlock != nullptr )
-    {
-        out_NextKey     = nextBlock->mKey;
-        out_NextValue   = nextBlock->mValue;
-        result          = true;
-    }
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+inline bool TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::isEqualKeys( KEY_TYPE key1, KEY_TYPE key2 ) const
+{
+    return mImplement.implEqualKeys( key1, key2 );
+}
 
-    return result;
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+inline bool TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::isEqualValues( VALUE_TYPE value1, VALUE_TYPE value2 ) const
+{
+    return mImplement.implEqualValues( value1, value2 );
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-void TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::initHashTable(int sizeHashTable /*= NECommon::MAP_DEFAULT_HASH_SIZE*/)
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+void TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::initHashTable( int sizeHashTable /*= NECommon::MAP_DEFAULT_HASH_SIZE*/ )
 {
-    ASSERT(mElemCount   == 0);
-    ASSERT(sizeHashTable >  0 && sizeHashTable <= NECommon::MAP_MAX_TABLE_SIZE);
-    if (mHashTable != nullptr)
-        delete [] mHashTable;
+    ASSERT( mElemCount == 0 );
+    delete [] reinterpret_cast<unsigned char *>(mTable);
 
-    mHashTable	    = DEBUG_NEW Block *[static_cast<unsigned int>(sizeHashTable)];
-    mHashTableSize	= mHashTable != nullptr ? sizeHashTable : 0;
-    NEMemory::zeroElements<Block *>( mHashTable, mHashTableSize);
+    mTableSize      = tableSize( sizeHashTable );
+    mTable          = allocateTable( mTableSize, mControl );
+    mDeletedCount   = 0;
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-void TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::createBlockList( void )
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+void TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::rehashTable( int sizeHashTable )
 {
-    // add another block
-    // chain them into free list
-    unsigned int length     = static_cast<unsigned int>(mBlockSize * sizeof(Block) + sizeof(Block *));
-    unsigned char* newBlock = DEBUG_NEW unsigned char[length];
-    if (newBlock != nullptr)
+    Block * oldTable            = mTable;
+    const unsigned char * oldControl = mControl;
+    const int oldSize           = mTableSize;
+
+    mTableSize      = sizeHashTable;
+    mTable          = allocateTable( mTableSize, mControl );
+    mDeletedCount   = 0;
+
+    const unsigned int mask = static_cast<unsigned int>(mTableSize) - 1u;
+    for ( int i = 0; i < oldSize; ++ i )
     {
-        // link blocks, copy the address of last block into
-        // beginning of new block (and skip address part)
-        NEMemory::memCopy(newBlock, static_cast<int>(length), &mBlockList, static_cast<int>(sizeof(Block *)));
-        mBlockList   = reinterpret_cast<Block *>(newBlock);
-        newBlock    += sizeof(Block *);
-        Block* block = reinterpret_cast<Block *>(newBlock);
-        block       += mBlockSize - 1;
-        for (int i = mBlockSize; i > 0; -- i, -- block )
+        if ( isUsedSlot( oldControl[i] ) )
         {
-            block->mNext= mFreeList;
-            mFreeList   = block;
+            Block * src = oldTable + i;
+            const unsigned int mix = mixHash( src->mHash );
+            unsigned int idx = mix & mask;
+            while ( mControl[idx] != SLOT_EMPTY )
+            {
+                idx = (idx + 1u) & mask;
+            }
+
+            Block * dst = mTable + idx;
+            mControl[idx] = tagHash( mix );
+            dst->mHash    = src->mHash;
+            new(&dst->mKey)     KEY( std::move( src->mKey ) );
+            new(&dst->mValue)   VALUE( std::move( src->mValue ) );
+            (&src->mKey)->~KEY( );
+            (&src->mValue)->~VALUE( );
         }
     }
+
+    delete [] reinterpret_cast<unsigned char *>(oldTable);
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-void TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::deleteBlockList( void )
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+typename TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::Block * TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::initNewBlock( unsigned int hash )
 {
-    unsigned char* blocks = reinterpret_cast<unsigned char *>(mBlockList);
-    while (blocks != nullptr)
+    if ( mTable == nullptr )
     {
-        // copy address of next block, placed during creating blocks.
-        NEMemory::memCopy(&mBlockList, sizeof(Block *), blocks, sizeof(Block *));
-        delete [] blocks;
-        blocks = reinterpret_cast<unsigned char *>(mBlockList);
+        initHashTable( NECommon::MAP_DEFAULT_HASH_SIZE );
+    }
+    else if ( (mElemCount + mDeletedCount + 1) * 8 > mTableSize * 7 )
+    {
+        // if mostly deleted Blocks fill the table, clean them up without growing.
+        rehashTable( (mElemCount + 1) * 16 > mTableSize * 7 ? mTableSize * 2 : mTableSize );
     }
-}
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-void TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::freeBlock(Block* block)
-{
-    (&block->mKey)->~KEY();
-    (&block->mValue)->~VALUE();
-    block->mHash = 0;
-    block->mNext = mFreeList;
-    mFreeList = block;
-    mElemCount --;
-    ASSERT(mElemCount >= 0);
-}
+    const unsigned int mask = static_cast<unsigned int>(mTableSize) - 1u;
+    const unsigned int mix  = mixHash( hash );
+    unsigned int idx = mix & mask;
+    while ( isUsedSlot( mControl[idx] ) )
+    {
+        idx = (idx + 1u) & mask;
+    }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */ >
-inline unsigned int TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::getHashKey( KEY_TYPE Key ) const
-{
-    return mImplement.implHashKey(Key);
-}
+    if ( mControl[idx] == SLOT_DELETED )
+    {
+        -- mDeletedCount;
+    }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */>
-inline bool TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::isEqualKeys(KEY_TYPE key1, KEY_TYPE key2) const
-{
-    return mImplement.implEqualKeys(key1, key2);
+    Block * block   = mTable + idx;
+    mControl[idx]   = tagHash( mix );
+    block->mHash    = hash;
+    new(&block->mKey)   KEY;
+    new(&block->mValue) VALUE;
+    ++ mElemCount;
+
+    return block;
 }
 
-template < typename KEY, typename VALUE, typename KEY_TYPE /*= KEY*/, typename VALUE_TYPE /*= VALUE */, class Implement /* = HashMapBase */>
-inline bool TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement>::isEqualValues(VALUE_TYPE value1, VALUE_TYPE value2) const
+template < typename KEY, typename VALUE, typename KEY_TYPE, typename VALUE_TYPE, class Implement >
+void TEHashMap<KEY, VALUE, KEY_TYPE, VALUE_TYPE, Implement, true>::removeBlock( Block * block )
 {
-    return mImplement.implEqualValues(value1, value2);
+    ASSERT( (block != nullptr) && (mElemCount > 0) );
+    const unsigned int mask = static_cast<unsigned int>(mTableSize) - 1u;
+    unsigned int idx = static_cast<unsigned int>(block - mTable);
+    ASSERT( isUsedSlot( mControl[idx] ) );
+
+    (&block->mKey)->~KEY( );
+    (&block->mValue)->~VALUE( );
+    -- mElemCount;
+
+    if ( mElemCount == 0 )
+    {
+        NEMemory::memSet( mControl, mTableSize, SLOT_EMPTY );
+        mDeletedCount = 0;
+    }
+    else if ( mControl[(idx + 1u) & mask] == SLOT_EMPTY )
+    {
+        // no search passes this Block, it and the deleted Blocks before become empty.
+        mControl[idx] = SLOT_EMPTY;
+        for ( idx = (idx - 1u) & mask; mControl[idx] == SLOT_DELETED; idx = (idx - 1u) & mask )
+        {
+            mControl[idx] = SLOT_EMPTY;
+            -- mDeletedCount;
+        }
+    }
+    else
+    {
+        mControl[idx] = SLOT_DELETED;
+        ++ mDeletedCount;
+    }
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -1386,11 +2534,9 @@ IEOutStream & operator << ( IEOutStream & stream, const TEHashMap<K, V, KT, VT,
 {
     int size = output.getSize();
     stream << size;
-    if ( size != 0 )
+    for ( MAPPOS pos = output.firstPosition( ); pos != nullptr; pos = output.nextPosition( pos ) )
     {
-        const typename TEHashMap<K, V, KT, VT, Impl>::Block * block = output.firstValidBlock();
-        for ( ; block != nullptr; block = output.nextValidBlock(block))
-            stream << static_cast<const TEPair<K, V, KT, VT, Impl> &>(*block);
+        stream << static_cast<const TEPair<K, V, KT, VT, Impl> &>(*output.blockAt( pos ));
     }
 
     return stream;
@@ -724,7 +724,7 @@ VALUE TERingStack<VALUE, VALUE_TYPE, Compare>::popFirst( void )
     if ( mElemCount > 0 )
     {
         ASSERT( mCapacity > 0 );
-        ASSERT( mStartPosition != mLastPosition );
+        ASSERT( (mStartPosition != mLastPosition) || (mElemCount == mCapacity) );
 
         result = mStackList[mStartPosition];
         NEMemory::destroyElems<VALUE>( mStackList + mStartPosition, 1 );
@@ -830,14 +830,14 @@ int TERingStack<VALUE, VALUE_TYPE, Compare>::resize( int newCapacity )
 
     if ( newCapacity != mCapacity )
     {
-        VALUE * newList = newCapacity > 0 ? reinterpret_cast<VALUE *>( DEBUG_NEW unsigned char[ newCapacity ] ) : nullptr;
+        VALUE * newList = newCapacity > 0 ? reinterpret_cast<VALUE *>( DEBUG_NEW unsigned char[ newCapacity * sizeof(VALUE) ] ) : nullptr;
         int dstLast     = 0;
         int srcStart    = mStartPosition;
         int elemCount   = newCapacity > mElemCount ? mElemCount : newCapacity;
 
         if ( newList != nullptr )
         {
-            NEMemory::constructElems(newList, elemCount);
+            NEMemory::constructElems<VALUE>(newList, elemCount);
             for ( int i = 0; i < elemCount; i ++ )
             {
                 newList[dstLast ++] = mStackList[srcStart];
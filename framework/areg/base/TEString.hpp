@@ -747,6 +747,55 @@ protected:
      **/
     inline void reallocate( NEString::CharCount charsAdd );
 
+    /**
+     * \brief   Returns true if the string data is kept in the small string buffer of the object.
+     **/
+    inline bool isSmallString( void ) const;
+
+    /**
+     * \brief   Initializes string data to keep specified number of characters. If the characters
+     *          fit the small string buffer, the buffer of object is used without allocating memory.
+     *          The current string data is not released and the small string buffer is overwritten.
+     * \param   charCount   The number of characters to reserve. If zero, returns invalid string.
+     * \return  Returns initialized string data.
+     **/
+    inline NEString::SString<CharType> * initData( NEString::CharCount charCount );
+
+    /**
+     * \brief   Initializes string data and copies specified characters. If the characters
+     *          fit the small string buffer, the buffer of object is used without allocating memory.
+     *          The current string data is not released.
+     * \param   strSource   The source of characters to copy.
+     * \param   charCount   The number of characters to copy. If COUNT_ALL, copies until end-of-string.
+     * \return  Returns initialized string data. If there is nothing to copy, returns invalid string.
+     **/
+    template<typename CharSrc>
+    inline NEString::SString<CharType> * initData( const CharSrc * strSource, NEString::CharCount charCount = NEString::COUNT_ALL );
+
+    /**
+     * \brief   Initializes string data and copies the characters of specified string structure.
+     *          If the characters fit the small string buffer, the buffer of object is used.
+     *          The current string data is not released.
+     * \param   strSource   The source string structure to copy.
+     * \return  Returns initialized string data. If the source is invalid, returns invalid string.
+     **/
+    template<typename CharSrc>
+    inline NEString::SString<CharType> * initData( const NEString::SString<CharSrc> & strSource );
+
+    /**
+     * \brief   Releases string data, if it is not the small string buffer of the object.
+     * \param   strData     The string data to release.
+     **/
+    inline void releaseData( NEString::SString<CharType> * strData );
+
+    /**
+     * \brief   Takes the string data of the source. If the source keeps the data in the
+     *          small string buffer, the characters are copied. The source becomes invalid.
+     *          The current string data should be released before calling the method.
+     * \param   strSource   The source of string data.
+     **/
+    inline void moveData( TEString<CharType, Helper> & strSource );
+
     /**
      * \brief   Checks whether possible to read data at specified position.
      *          To read data, the position should be less than the length of string.
@@ -856,7 +905,12 @@ protected:
 //////////////////////////////////////////////////////////////////////////
 protected:
     /**
-     * \brief   The pointer to string structure, which contains string buffer
+     * \brief   The buffer of small string. Used as string data if the string fits the buffer.
+     **/
+    NEString::SStringSmall<CharType>    mSmall;
+    /**
+     * \brief   The pointer to string structure, which contains string buffer.
+     *          Either allocated or points to the small string buffer.
      **/
     NEString::SString<CharType> *   mData;
     /**
@@ -1047,10 +1101,26 @@ inline const NEString::SString<CharType> & TEString<CharType, Helper>::getDataSt
 template<typename CharType, class Helper /*= TEStringImpl<CharType>*/>
 inline void TEString<CharType, Helper>::reallocate( NEString::CharCount charsAdd )
 {
-    NEString::SString<CharType> * tmp = NEString::reallocSpace<CharType, CharType>( *mData, charsAdd );
+    NEString::CharCount len     = getLength( );
+    NEString::CharCount newLen  = len + charsAdd;
+    NEString::SString<CharType> * tmp = NEString::getInvalidString<CharType>( );
+    if ( (isSmallString( ) == false) && (newLen < NEString::SStringSmall<CharType>::SMALL_SPACE) && (getActualLength( ) <= newLen) )
+    {
+        // the characters fit the small string buffer, no need to allocate
+        tmp = initData( (newLen == 0) && isValid( ) ? 1 : newLen );
+        if ( NEString::isValid<CharType>( tmp ) )
+        {
+            tmp->strUsed = NEString::copyString<CharType, CharType>( tmp->strBuffer, tmp->strSpace, getString( ), len );
+        }
+    }
+    else
+    {
+        tmp = NEString::reallocSpace<CharType, CharType>( *mData, charsAdd );
+    }
+
     if ( NEString::isValid<CharType>(tmp))
     {
-        NEString::releaseSpace<CharType>( mData );
+        releaseData( mData );
         mData   = tmp;
 
 #ifdef DEBUG
@@ -1059,6 +1129,90 @@ inline void TEString<CharType, Helper>::reallocate( NEString::CharCount charsAdd
     }
 }
 
+template<typename CharType, class Helper /*= TEStringImpl<CharType>*/>
+inline bool TEString<CharType, Helper>::isSmallString( void ) const
+{
+    return (reinterpret_cast<const void *>(mData) == reinterpret_cast<const void *>(&mSmall));
+}
+
+template<typename CharType, class Helper /*= TEStringImpl<CharType>*/>
+inline NEString::SString<CharType> * TEString<CharType, Helper>::initData( NEString::CharCount charCount )
+{
+    NEString::SString<CharType> * result = NEString::getInvalidString<CharType>( );
+    if ( (charCount > 0) && (charCount < NEString::SStringSmall<CharType>::SMALL_SPACE) )
+    {
+        mSmall.strSpace     = NEString::SStringSmall<CharType>::SMALL_SPACE;
+        mSmall.strUsed      = 0;
+        mSmall.strBuffer[0] = static_cast<CharType>(NEString::EndOfString);
+        result              = reinterpret_cast<NEString::SString<CharType> *>(&mSmall);
+    }
+    else if ( charCount > 0 )
+    {
+        result = NEString::initString<CharType>( charCount );
+    }
+
+    return result;
+}
+
+template<typename CharType, class Helper /*= TEStringImpl<CharType>*/>
+template<typename CharSrc>
+inline NEString::SString<CharType> * TEString<CharType, Helper>::initData( const CharSrc * strSource, NEString::CharCount charCount /*= NEString::COUNT_ALL*/ )
+{
+    NEString::SString<CharType> * result = NEString::getInvalidString<CharType>( );
+    const void * src = reinterpret_cast<const void *>(strSource);
+    if ( (src >= reinterpret_cast<const void *>(mSmall.strBuffer)) && (src < reinterpret_cast<const void *>(mSmall.strBuffer + NEString::SStringSmall<CharType>::SMALL_SPACE)) )
+    {
+        // the source is in the small string buffer, which is going to be overwritten
+        result = NEString::initString<CharType, CharSrc>( strSource, charCount );
+    }
+    else
+    {
+        charCount = charCount == NEString::COUNT_ALL ? NEString::getStringLength<CharSrc>( strSource ) : charCount;
+        result    = initData( charCount );
+        if ( NEString::isValid<CharType>( result ) )
+        {
+            result->strUsed = NEString::copyString<CharType, CharSrc>( result->strBuffer, result->strSpace, strSource, charCount );
+        }
+    }
+
+    return result;
+}
+
+template<typename CharType, class Helper /*= TEStringImpl<CharType>*/>
+template<typename CharSrc>
+inline NEString::SString<CharType> * TEString<CharType, Helper>::initData( const NEString::SString<CharSrc> & strSource )
+{
+    NEString::SString<CharType> * result = NEString::getInvalidString<CharType>( );
+    if ( NEString::isValid<CharSrc>( strSource ) )
+    {
+        result          = initData( strSource.strUsed == 0 ? 1 : strSource.strUsed );
+        result->strUsed = NEString::copyString<CharType, CharSrc>( result->strBuffer, result->strSpace, strSource.strBuffer, strSource.strUsed );
+    }
+
+    return result;
+}
+
+template<typename CharType, class Helper /*= TEStringImpl<CharType>*/>
+inline void TEString<CharType, Helper>::releaseData( NEString::SString<CharType> * strData )
+{
+    if ( reinterpret_cast<const void *>(strData) != reinterpret_cast<const void *>(&mSmall) )
+    {
+        NEString::releaseSpace<CharType>( strData );
+    }
+}
+
+template<typename CharType, class Helper /*= TEStringImpl<CharType>*/>
+inline void TEString<CharType, Helper>::moveData( TEString<CharType, Helper> & strSource )
+{
+    mData = strSource.isSmallString( ) ? initData<CharType>( *strSource.mData ) : strSource.mData;
+    strSource.mData = nullptr;
+
+#ifdef DEBUG
+    mString = mData != nullptr ? mData->strBuffer : nullptr;
+    strSource.mString = nullptr;
+#endif // DEBUG
+}
+
 template<typename CharType, class Helper /*= TEStringImpl<CharType>*/>
 inline bool TEString<CharType, Helper>::canRead( NEString::CharPos atPos ) const
 {
@@ -1074,7 +1228,7 @@ inline bool TEString<CharType, Helper>::canWrite( NEString::CharPos atPos ) cons
 template<typename CharType, class Helper /*= TEStringImpl<CharType>*/>
 inline void TEString<CharType, Helper>::release( void )
 {
-    NEString::releaseSpace<CharType>( mData );
+    releaseData( mData );
     mData   = NEString::getInvalidString<CharType>( );
 
 #ifdef DEBUG
@@ -1084,7 +1238,7 @@ inline void TEString<CharType, Helper>::release( void )
 
 template<typename CharType, class Helper /*= TEStringImpl<CharType>*/>
 inline TEString<CharType, Helper>::TEString( void )
-    : mData     ( NEString::initString<CharType>(static_cast<NEString::CharCount>(0) ) )
+    : mData     ( NEString::getInvalidString<CharType>( ) )
     , mHelper   ( )
 #ifdef DEBUG
     , mString   ( mData->strBuffer )
@@ -1094,7 +1248,7 @@ inline TEString<CharType, Helper>::TEString( void )
 
 template<typename CharType, class Helper /*= TEStringImpl<CharType>*/>
 inline TEString<CharType, Helper>::TEString( CharType ch )
-    : mData     ( NEString::initString<CharType, CharType>(&ch, 1) )
+    : mData     ( initData<CharType>(&ch, 1) )
     , mHelper   ( )
 #ifdef DEBUG
     , mString   ( mData->strBuffer )
@@ -1104,7 +1258,7 @@ inline TEString<CharType, Helper>::TEString( CharType ch )
 
 template<typename CharType, class Helper /*= TEStringImpl<CharType>*/>
 inline TEString<CharType, Helper>::TEString( const CharType * strSource )
-    : mData     ( NEString::initString<CharType, CharType>(strSource, NEString::COUNT_ALL) )
+    : mData     ( initData<CharType>(strSource, NEString::COUNT_ALL) )
     , mHelper   ( )
 #ifdef DEBUG
     , mString   ( mData->strBuffer )
@@ -1114,7 +1268,7 @@ inline TEString<CharType, Helper>::TEString( const CharType * strSource )
 
 template<typename CharType, class Helper /*= TEStringImpl<CharType>*/>
 inline TEString<CharType, Helper>::TEString( const CharType * strSource, NEString::CharCount charCount )
-    : mData     ( NEString::initString<CharType, CharType>(strSource, charCount) )
+    : mData     ( initData<CharType>(strSource, charCount) )
     , mHelper   ( )
 #ifdef DEBUG
     , mString   ( mData->strBuffer )
@@ -1124,7 +1278,7 @@ inline TEString<CharType, Helper>::TEString( const CharType * strSource, NEStrin
 
 template<typename CharType, class Helper /*= TEStringImpl<CharType>*/>
 inline TEString<CharType, Helper>::TEString( const NEString::SString<CharType> & strSource )
-    : mData     ( NEString::initString<CharType, CharType>(strSource) )
+    : mData     ( initData<CharType>(strSource) )
     , mHelper   ( )
 #ifdef DEBUG
     , mString   ( mData->strBuffer )
@@ -1134,7 +1288,7 @@ inline TEString<CharType, Helper>::TEString( const NEString::SString<CharType> &
 
 template<typename CharType, class Helper /*= TEStringImpl<CharType>*/>
 inline TEString<CharType, Helper>::TEString( const TEString<CharType, Helper> & strSource )
-    : mData     ( NEString::initString<CharType, CharType>( strSource.getDataString() ) )
+    : mData     ( initData<CharType>( strSource.getDataString() ) )
     , mHelper   ( )
 #ifdef DEBUG
     , mString   ( mData->strBuffer )
@@ -1144,23 +1298,19 @@ inline TEString<CharType, Helper>::TEString( const TEString<CharType, Helper> &
 
 template<typename CharType, class Helper /*= TEStringImpl<CharType>*/>
 inline TEString<CharType, Helper>::TEString( TEString<CharType, Helper> && strSource )
-    : mData     ( strSource.mData )
+    : mData     ( nullptr )
     , mHelper   ( )
 #ifdef DEBUG
-    , mString   ( mData->strBuffer )
+    , mString   ( nullptr )
 #endif // DEBUG
 {
-    strSource.mData     = nullptr;
-#ifdef DEBUG
-    strSource.mString   = nullptr;
-#endif // DEBUG
-
+    moveData( strSource );
 }
 
 template<typename CharType, class Helper /*= TEStringImpl<CharType>*/>
 TEString<CharType, Helper>::~TEString( void )
 {
-    NEString::releaseSpace<CharType>(mData);
+    releaseData(mData);
     mData = NEString::getInvalidString<CharType>();
 #ifdef DEBUG
     mString = mData->strBuffer;
@@ -1440,10 +1590,10 @@ inline void TEString<CharType, Helper>::truncate( NEString::CharCount maxChars )
         if ( spaceNeed < getActualLength() )
         {
             ASSERT( isValidPtr() );
-            NEString::SString<CharType> * tmp = NEString::initString<CharType>(getString(), maxChars);
+            NEString::SString<CharType> * tmp = initData<CharType>(getString(), maxChars);
             if (tmp != nullptr)
             {
-                NEString::releaseSpace<CharType>(mData);
+                releaseData(mData);
                 mData   = tmp;
 
 #ifdef DEBUG
@@ -1477,12 +1627,12 @@ inline void TEString<CharType, Helper>::compact( void )
         unsigned int space  = NEString::geStringRequiredSize<CharType>( len );
         NEString::CharCount charCount = static_cast<NEString::CharCount>(space / single);
 
-        if ( charCount < getActualLength() )
+        if ( (charCount < getActualLength()) && (isSmallString() == false) )
         {
-            NEString::SString<CharType> * tmp = NEString::initString<CharType>( getString( ), len );
+            NEString::SString<CharType> * tmp = initData<CharType>( getString( ), len );
             if ( tmp != nullptr )
             {
-                NEString::releaseSpace<CharType>( mData );
+                releaseData( mData );
                 mData   = tmp;
 
 #ifdef DEBUG
@@ -1801,17 +1951,7 @@ inline bool TEString<CharType, Helper>::resize( NEString::CharCount maxSpace )
 {
     NEString::CharCount len = getLength( );
     maxSpace = MACRO_MAX( maxSpace, len );
-    NEString::CharCount addChars        = maxSpace - len;
-    NEString::SString<CharType> * tmp   = NEString::reallocSpace<CharType, CharType>( *mData, addChars );
-    if ( NEString::isValid<CharType>(tmp) )
-    {
-        NEString::releaseSpace<CharType>( mData );
-        mData   = tmp;
-
-#ifdef DEBUG
-        mString = mData->strBuffer;
-#endif // DEBUG
-    }
+    reallocate( maxSpace - len );
 
     return (maxSpace < mData->strSpace);
 }
@@ -189,6 +189,41 @@ class TEHashMapImpl     : public TEPairImpl     <KEY_TYPE, VALUE_TYPE>
 
 };
 
+/**
+ * \brief   The class template for hash-map container, which keeps the elements
+ *          in the open-addressing table. The table grows automatically and
+ *          is preferred for the maps with large number of elements.
+ *          The positions of elements are invalidated when new element is inserted.
+ *          Derive own implementation to change the default methods.
+ * \tparam  KEY_TYPE    The type of key saved in the hash-map container.
+ * \tparam  VALUE_TYPE  The type of value associated with the key.
+ **/
+template <typename KEY_TYPE, typename VALUE_TYPE>
+class TEOpenHashMapImpl : public TEHashMapImpl  <KEY_TYPE, VALUE_TYPE>
+{
+public:
+    /**
+     * \brief   Indicates that the hash-map keeps elements in the open-addressing table.
+     **/
+    static constexpr bool   HASH_OPEN_ADDRESSING    { true };
+};
+
+/**
+ * \brief   The class template for hash-map container with pointer keys, which
+ *          keeps the elements in the open-addressing table.
+ * \tparam  KEY_TYPE    The type of key, which should be pointer, saved in the hash-map container.
+ * \tparam  VALUE_TYPE  The type of value associated with the key.
+ **/
+template <typename KEY_TYPE, typename VALUE_TYPE>
+class TEOpenPointerHashMapImpl  : public TEPointerHashMapImpl<KEY_TYPE, VALUE_TYPE>
+{
+public:
+    /**
+     * \brief   Indicates that the hash-map keeps elements in the open-addressing table.
+     **/
+    static constexpr bool   HASH_OPEN_ADDRESSING    { true };
+};
+
 /**
  * \brief   The class template for resource containers that save objects associated with the key.
  *          The methods of class are called when clean-up resource element.
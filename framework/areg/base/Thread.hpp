@@ -104,6 +104,45 @@ public:
      **/
     inline static const char * getString( Thread::eThreadPriority threadPriority );
 
+    /**
+     * \brief   Thread::eSchedulingPolicy
+     *          Defines the scheduling policy of the thread.
+     *          By default, the thread is created with the default time-sharing
+     *          scheduling of the OS. The real-time policies may require privileges.
+     **/
+    typedef enum class E_SchedulingPolicy : int
+    {
+          SchedulingDefault     = 0     //!< Default time-sharing scheduling of the OS
+        , SchedulingFifo        = 1     //!< Real-time first-in first-out scheduling
+        , SchedulingRoundRobin  = 2     //!< Real-time round-robin scheduling
+    } eSchedulingPolicy;
+
+    /**
+     * \brief   Converts Thread::eSchedulingPolicy values to string and return string values.
+     **/
+    inline static const char * getString( Thread::eSchedulingPolicy schedPolicy );
+
+    /**
+     * \brief   Thread::sThreadAttributes
+     *          The attributes applied when the thread is created.
+     *          The zero values of the fields mean the OS default.
+     **/
+    typedef struct S_ThreadAttributes
+    {
+        uint64_t                    thAffinityMask; //!< The mask of CPUs to run the thread, bit N is CPU N. If 0, not set.
+        int                         thNumaNode;     //!< The NUMA node to run the thread, used if the affinity mask is not set. If negative, not set.
+        unsigned int                thStackSize;    //!< The stack size of the thread in bytes. If 0, the OS default.
+        Thread::eSchedulingPolicy   thSchedPolicy;  //!< The scheduling policy of the thread.
+        int                         thSchedPriority;//!< The priority of real-time scheduling policy. Ignored for default policy.
+    } sThreadAttributes;
+
+    /**
+     * \brief   Thread::DEFAULT_THREAD_ATTRIBUTES
+     *          The default thread attributes: no affinity, no NUMA node,
+     *          default stack size and default scheduling policy.
+     **/
+    static constexpr Thread::sThreadAttributes  DEFAULT_THREAD_ATTRIBUTES   { 0u, -1, 0u, Thread::eSchedulingPolicy::SchedulingDefault, 0 };
+
     /**
      * \brief   Thread::INVALID_THREAD_ID
      *          Invalid thread ID.
@@ -174,6 +213,19 @@ public:
      **/
     virtual bool createThread( unsigned int waitForStartMs = NECommon::DO_NOT_WAIT );
 
+    /**
+     * \brief	Sets the thread attributes, creates and starts thread, if it was not created before.
+     *          The stack size is set when the thread is created. The CPU affinity and the
+     *          scheduling policy are set in the context of new thread before it starts the job.
+     *          If an attribute cannot be applied, for example because of missing privileges,
+     *          the thread runs with the OS default of that attribute.
+     * \param	waitForStartMs	Waiting time out in milliseconds until thread
+     *                          is created and running. See createThread( unsigned int ).
+     * \param   attributes      The attributes of the thread to apply.
+     * \return	Returns true if new thread is successfully created and started.
+     **/
+    bool createThread( unsigned int waitForStartMs, const Thread::sThreadAttributes & attributes );
+
     /**
      * \brief	Destroys thread and frees resources. Once thread is destroyed,
      *          it can be re-created again. The calling thread (current thread)
@@ -446,6 +498,10 @@ protected:
      * \brief   The thread current priority level.
      **/
     Thread::eThreadPriority mThreadPriority;
+    /**
+     * \brief   The attributes applied when thread is created.
+     **/
+    Thread::sThreadAttributes   mThreadAttributes;
     /**
      * \brief   Flag indicating whether thread is running or not.
      **/
@@ -477,6 +533,12 @@ private:
      **/
     bool _createSystemThread( void );
 
+    /**
+     * \brief   Applies the CPU affinity and the scheduling policy of the thread attributes.
+     *          Called in the context of new created thread before it starts the job.
+     **/
+    void _applyThreadAttributes( void );
+
     /**
      * \brief   Registers Thread. Returns true if succeed
      **/
@@ -743,3 +805,18 @@ inline const char * Thread::getString( Thread::eThreadPriority threadPriority )
         return "ERR: Invalid Thread::eThreadPriority value!";
     }
 }
+
+inline const char * Thread::getString( Thread::eSchedulingPolicy schedPolicy )
+{
+    switch ( schedPolicy )
+    {
+    case Thread::eSchedulingPolicy::SchedulingDefault:
+        return "Thread::SchedulingDefault";
+    case Thread::eSchedulingPolicy::SchedulingFifo:
+        return "Thread::SchedulingFifo";
+    case Thread::eSchedulingPolicy::SchedulingRoundRobin:
+        return "Thread::SchedulingRoundRobin";
+    default:
+        return "ERR: Invalid Thread::eSchedulingPolicy value!";
+    }
+}
@@ -18,6 +18,7 @@
  ************************************************************************/
 #include "areg/base/GEGlobal.h"
 #include "areg/base/String.hpp"
+#include "areg/base/InternedString.hpp"
 
 #include <string_view>
 #include <utility>
@@ -200,7 +201,7 @@ private:
     /**
      * \brief   The thread name.
      **/
-    String          mThreadName;
+    InternedString  mThreadName;
     /**
      * \brief   The calculated number of thread address.
      **/
@@ -239,7 +239,8 @@ unsigned int BufferStreamBase::insertAt( const unsigned char* buffer, unsigned i
         }
         else
         {
-            unsigned int remain = resize(writePos + size, true);
+            unsigned int required = writePos + size;
+            unsigned int remain = resize(required > getSizeAvailable() ? getGrowSize(required) : required, true);
             if (remain >= size)
             {
                 ASSERT(isValid());
@@ -274,7 +275,9 @@ unsigned int BufferStreamBase::writeData(const unsigned char* buffer, unsigned i
     ASSERT( (buffer != nullptr) || (size == 0) );
     unsigned int result     = 0;
     unsigned int writePos   = isValid() ? mWritePosition.getPosition() : 0;
-    unsigned int remain     = resize(writePos + size, writePos != 0);
+    unsigned int required   = writePos + size;
+    // grow geometrically to avoid reallocating and copying data on every write.
+    unsigned int remain     = resize(required > getSizeAvailable() ? getGrowSize(required) : required, writePos != 0);
 
     if ((remain != 0) && (size != 0))
     {
@@ -17,6 +17,15 @@
 
 #include <string.h>
 #include <utility>
+#include <atomic>
+
+namespace
+{
+    /**
+     * \brief   The maximum size in bytes, which buffer can grow at once when data is streamed.
+     **/
+    std::atomic_uint    _growLimit  { IEByteBuffer::DEFAULT_GROW_LIMIT };
+}
 
 //////////////////////////////////////////////////////////////////////////
 // IEByteBuffer class implementation
@@ -92,6 +101,41 @@ unsigned int IEByteBuffer::resize(unsigned int size, bool copy)
     return (isValid() ? mByteBuffer->bufHeader.biLength - mByteBuffer->bufHeader.biUsed : 0);
 }
 
+void IEByteBuffer::setGrowLimit( unsigned int growLimit )
+{
+    _growLimit.store( growLimit != 0 ? MACRO_ALIGN_SIZE(growLimit, NEMemory::BLOCK_SIZE) : IEByteBuffer::DEFAULT_GROW_LIMIT );
+}
+
+unsigned int IEByteBuffer::getGrowLimit( void )
+{
+    return _growLimit.load( );
+}
+
+unsigned int IEByteBuffer::reserve( unsigned int size )
+{
+    if ( size > getSizeAvailable() )
+    {
+        // call base class method, the cursors remain valid, since no data is lost.
+        IEByteBuffer::resize( size, true );
+    }
+
+    return getSizeAvailable( );
+}
+
+unsigned int IEByteBuffer::getGrowSize( unsigned int sizeRequired ) const
+{
+    unsigned int sizeLength = getSizeAvailable( );
+    unsigned int sizeAlign  = getAlignedSize( );
+    unsigned int sizeLimit  = _growLimit.load( );
+    unsigned int sizeGrow   = MACRO_MAX( sizeLength, IEByteBuffer::MIN_GROW_SIZE );
+    sizeGrow    = MACRO_MIN( sizeGrow, sizeLimit );
+    sizeGrow    = MACRO_MAX( sizeGrow, sizeAlign );
+
+    unsigned int result = sizeLength + sizeGrow;
+    result = MACRO_MAX( result, sizeRequired );
+    return MACRO_MIN( result, IEByteBuffer::MAX_BUF_LENGTH );
+}
+
 unsigned int IEByteBuffer::initBuffer(unsigned char * newBuffer, unsigned int bufLength, bool makeCopy) const
 {
     unsigned int result = IECursorPosition::INVALID_CURSOR_POSITION;
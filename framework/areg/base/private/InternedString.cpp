@@ -0,0 +1,113 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/base/private/InternedString.cpp
+ * \ingroup     AREG SDK, Asynchronous Event Generator Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Interned immutable string class.
+ *
+ ************************************************************************/
+#include "areg/base/InternedString.hpp"
+
+#include "areg/base/Containers.hpp"
+#include "areg/base/IEIOStream.hpp"
+#include "areg/base/SynchObjects.hpp"
+
+namespace
+{
+    /**
+     * \brief   The pool of interned strings. The key is the string and the value
+     *          is the interned object, which is shared by all interned strings.
+     **/
+    using MapInternedStrings    = TEStringHashMap<const String *, const String *, TEOpenHashMapImpl<const String &, const String *>>;
+
+    /**
+     * \brief   Returns the pool of interned strings.
+     *          The interned objects are not freed, since the objects with static
+     *          storage may refer to them until the process exits.
+     **/
+    inline MapInternedStrings & _getInternedStrings( void )
+    {
+        static MapInternedStrings _internedStrings;
+        return _internedStrings;
+    }
+
+    /**
+     * \brief   Returns the synchronization object of the pool of interned strings.
+     **/
+    inline SpinLock & _getInternedLock( void )
+    {
+        static SpinLock _lock;
+        return _lock;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// InternedString class implementation
+//////////////////////////////////////////////////////////////////////////
+
+InternedString::InternedString( void )
+    : mString   ( InternedString::_emptyString( ) )
+{
+}
+
+InternedString::InternedString( const char * source, NEString::CharCount charCount /*= NEString::COUNT_ALL*/ )
+    : mString   ( InternedString::_intern( source, charCount ) )
+{
+}
+
+InternedString::InternedString( const String & source, NEString::CharCount charCount /*= NEString::COUNT_ALL*/ )
+    : mString   ( InternedString::_intern( source.getString( ), charCount == NEString::COUNT_ALL ? source.getLength( ) : MACRO_MIN( source.getLength( ), charCount ) ) )
+{
+}
+
+InternedString::InternedString( const IEInStream & stream )
+    : mString   ( InternedString::_emptyString( ) )
+{
+    stream >> (*this);
+}
+
+InternedString & InternedString::operator = ( const char * source )
+{
+    mString = InternedString::_intern( source, NEString::COUNT_ALL );
+    return (*this);
+}
+
+InternedString & InternedString::operator = ( const String & source )
+{
+    mString = InternedString::_intern( source.getString( ), source.getLength( ) );
+    return (*this);
+}
+
+const String * InternedString::_emptyString( void )
+{
+    static const String _empty;
+    return &_empty;
+}
+
+const String * InternedString::_intern( const char * source, NEString::CharCount charCount )
+{
+    NEString::CharCount len = source != nullptr ? NEString::getStringLength<char>( source ) : 0;
+    len = charCount == NEString::COUNT_ALL ? len : MACRO_MIN( len, charCount );
+    const String * result = InternedString::_emptyString( );
+    if ( len > 0 )
+    {
+        String key( source, len );
+
+        Lock lock( _getInternedLock( ) );
+        MapInternedStrings & pool = _getInternedStrings( );
+        if ( pool.find( key, result ) == false )
+        {
+            result = DEBUG_NEW String( key );
+            pool.setAt( key, result, false );
+        }
+    }
+
+    return result;
+}
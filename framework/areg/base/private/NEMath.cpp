@@ -18,6 +18,17 @@
 #include "areg/base/NEMath.hpp"
 #include <math.h>
 
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #include <wmmintrin.h>
+    #include <smmintrin.h>
+    #define CRC32_CLMUL_SUPPORTED           1
+    #define CRC32_CLMUL_TARGET              __attribute__((target("pclmul,sse4.1")))
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+    #define CRC32_CLMUL_SUPPORTED           1
+    #define CRC32_CLMUL_TARGET
+#endif  // defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+
 /**
  * \brief   32-bit CRC (Cyclic Redundancy Check) lookup table (polynomial = 0x04C11DB7) with size 1024 bytes (256 x 4).
  *          CRC polynomial: X^32+X^26+X^23+X^22+X^16+X^12+X^11+X^10+X^8+X^7+X^5+X^4+X^2+X+1
@@ -153,6 +164,223 @@ static constexpr unsigned char _crc32LookupTable[] = {
     0x1B, 0xDF, 0x05, 0x5A, 0x8D, 0xEF, 0x02, 0x2D, 
 };
 
+namespace
+{
+    /**
+     * \brief   The number of lookup tables of the slicing-by-8 CRC calculation.
+     **/
+    constexpr unsigned int  CRC32_SLICES        { 8 };
+
+    /**
+     * \brief   The lookup tables of the slicing-by-8 CRC calculation.
+     *          The first table is the same as _crc32LookupTable, every next table
+     *          contains the CRC of the entry of previous table shifted by one byte.
+     **/
+    struct sCrc32Slices
+    {
+        unsigned int    csTable[CRC32_SLICES][256];
+    };
+
+    /**
+     * \brief   Creates the lookup tables of slicing-by-8 CRC calculation at compile time.
+     **/
+    constexpr sCrc32Slices _crc32CreateSlices( void )
+    {
+        sCrc32Slices result{ };
+        for ( unsigned int i = 0; i < 256; ++ i )
+        {
+            result.csTable[0][i] =    static_cast<unsigned int>(::_crc32LookupTable[i * 4 + 0])
+                                   | (static_cast<unsigned int>(::_crc32LookupTable[i * 4 + 1]) <<  8)
+                                   | (static_cast<unsigned int>(::_crc32LookupTable[i * 4 + 2]) << 16)
+                                   | (static_cast<unsigned int>(::_crc32LookupTable[i * 4 + 3]) << 24);
+        }
+
+        for ( unsigned int slice = 1; slice < CRC32_SLICES; ++ slice )
+        {
+            for ( unsigned int i = 0; i < 256; ++ i )
+            {
+                unsigned int prev = result.csTable[slice - 1][i];
+                result.csTable[slice][i] = (prev >> 8) ^ result.csTable[0][prev & 0xFF];
+            }
+        }
+
+        return result;
+    }
+
+    constexpr sCrc32Slices  _crc32Slices        { _crc32CreateSlices( ) };
+
+    /**
+     * \brief   The type of function to continue 32-bit CRC calculation of binary data.
+     **/
+    using FuncCrc32Update = unsigned int (*)( unsigned int /*crc*/, const unsigned char * /*data*/, unsigned int /*size*/ );
+
+    /**
+     * \brief   Continues CRC calculation using slicing-by-8 algorithm, which processes 8 bytes per step.
+     *          The bytes are combined explicitly, so that the result does not depend on byte order of the CPU.
+     **/
+    unsigned int _crc32UpdateSlicing( unsigned int crc, const unsigned char * data, unsigned int size )
+    {
+        const unsigned int (&table)[CRC32_SLICES][256] = _crc32Slices.csTable;
+
+        for ( ; size >= CRC32_SLICES; size -= CRC32_SLICES, data += CRC32_SLICES )
+        {
+            unsigned int one = crc ^ (  static_cast<unsigned int>(data[0])
+                                     | (static_cast<unsigned int>(data[1]) <<  8)
+                                     | (static_cast<unsigned int>(data[2]) << 16)
+                                     | (static_cast<unsigned int>(data[3]) << 24));
+            unsigned int two =          static_cast<unsigned int>(data[4])
+                                     | (static_cast<unsigned int>(data[5]) <<  8)
+                                     | (static_cast<unsigned int>(data[6]) << 16)
+                                     | (static_cast<unsigned int>(data[7]) << 24);
+
+            crc =   table[7][ one        & 0xFF] ^ table[6][(one >>  8) & 0xFF]
+                  ^ table[5][(one >> 16) & 0xFF] ^ table[4][ one >> 24        ]
+                  ^ table[3][ two        & 0xFF] ^ table[2][(two >>  8) & 0xFF]
+                  ^ table[1][(two >> 16) & 0xFF] ^ table[0][ two >> 24        ];
+        }
+
+        for ( ; size != 0; -- size, ++ data )
+        {
+            crc = (crc >> 8) ^ table[0][(*data ^ crc) & 0xFF];
+        }
+
+        return crc;
+    }
+
+#ifdef CRC32_CLMUL_SUPPORTED
+
+    /**
+     * \brief   The minimum size of data to calculate CRC with carry-less multiplication.
+     **/
+    constexpr unsigned int  CRC32_CLMUL_MIN_SIZE    { 64 };
+
+    /**
+     * \brief   Folds the blocks of 16 bytes with carry-less multiplication (PCLMULQDQ) and
+     *          reduces the result to 32-bit CRC with Barrett reduction, as described in the
+     *          Intel paper "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction".
+     *          The constants are for the bit-reflected polynomial of _crc32LookupTable.
+     *          The size of data must be multiple of 16 and not less than CRC32_CLMUL_MIN_SIZE.
+     **/
+    CRC32_CLMUL_TARGET unsigned int _crc32FoldClmul( unsigned int crc, const unsigned char * data, unsigned int size )
+    {
+        alignas(16) static constexpr uint64_t constK1K2[2]  { 0x0154442BD4ull, 0x01C6E41596ull };
+        alignas(16) static constexpr uint64_t constK3K4[2]  { 0x01751997D0ull, 0x00CCAA009Eull };
+        alignas(16) static constexpr uint64_t constK5K0[2]  { 0x0163CD6124ull, 0x0000000000ull };
+        alignas(16) static constexpr uint64_t constPoly[2]  { 0x01DB710641ull, 0x01F7011641ull };
+
+        // fold 4 blocks of 16 bytes in parallel
+        __m128i x1 = _mm_loadu_si128( reinterpret_cast<const __m128i *>(data + 0x00) );
+        __m128i x2 = _mm_loadu_si128( reinterpret_cast<const __m128i *>(data + 0x10) );
+        __m128i x3 = _mm_loadu_si128( reinterpret_cast<const __m128i *>(data + 0x20) );
+        __m128i x4 = _mm_loadu_si128( reinterpret_cast<const __m128i *>(data + 0x30) );
+        __m128i x0 = _mm_load_si128( reinterpret_cast<const __m128i *>(constK1K2) );
+        x1 = _mm_xor_si128( x1, _mm_cvtsi32_si128( static_cast<int>(crc) ) );
+        data += 0x40;
+        size -= 0x40;
+
+        for ( ; size >= 0x40; size -= 0x40, data += 0x40 )
+        {
+            __m128i x5 = _mm_clmulepi64_si128( x1, x0, 0x00 );
+            __m128i x6 = _mm_clmulepi64_si128( x2, x0, 0x00 );
+            __m128i x7 = _mm_clmulepi64_si128( x3, x0, 0x00 );
+            __m128i x8 = _mm_clmulepi64_si128( x4, x0, 0x00 );
+
+            x1 = _mm_clmulepi64_si128( x1, x0, 0x11 );
+            x2 = _mm_clmulepi64_si128( x2, x0, 0x11 );
+            x3 = _mm_clmulepi64_si128( x3, x0, 0x11 );
+            x4 = _mm_clmulepi64_si128( x4, x0, 0x11 );
+
+            x1 = _mm_xor_si128( _mm_xor_si128( x1, x5 ), _mm_loadu_si128( reinterpret_cast<const __m128i *>(data + 0x00) ) );
+            x2 = _mm_xor_si128( _mm_xor_si128( x2, x6 ), _mm_loadu_si128( reinterpret_cast<const __m128i *>(data + 0x10) ) );
+            x3 = _mm_xor_si128( _mm_xor_si128( x3, x7 ), _mm_loadu_si128( reinterpret_cast<const __m128i *>(data + 0x20) ) );
+            x4 = _mm_xor_si128( _mm_xor_si128( x4, x8 ), _mm_loadu_si128( reinterpret_cast<const __m128i *>(data + 0x30) ) );
+        }
+
+        // fold 4 blocks into one
+        x0 = _mm_load_si128( reinterpret_cast<const __m128i *>(constK3K4) );
+        __m128i x5 = _mm_clmulepi64_si128( x1, x0, 0x00 );
+        x1 = _mm_xor_si128( _mm_xor_si128( _mm_clmulepi64_si128( x1, x0, 0x11 ), x2 ), x5 );
+        x5 = _mm_clmulepi64_si128( x1, x0, 0x00 );
+        x1 = _mm_xor_si128( _mm_xor_si128( _mm_clmulepi64_si128( x1, x0, 0x11 ), x3 ), x5 );
+        x5 = _mm_clmulepi64_si128( x1, x0, 0x00 );
+        x1 = _mm_xor_si128( _mm_xor_si128( _mm_clmulepi64_si128( x1, x0, 0x11 ), x4 ), x5 );
+
+        // fold remaining blocks of 16 bytes
+        for ( ; size >= 0x10; size -= 0x10, data += 0x10 )
+        {
+            x5 = _mm_clmulepi64_si128( x1, x0, 0x00 );
+            x1 = _mm_clmulepi64_si128( x1, x0, 0x11 );
+            x1 = _mm_xor_si128( _mm_xor_si128( x1, _mm_loadu_si128( reinterpret_cast<const __m128i *>(data) ) ), x5 );
+        }
+
+        // fold 128 bits to 64 bits
+        const __m128i mask = _mm_setr_epi32( ~0, 0, ~0, 0 );
+        x2 = _mm_clmulepi64_si128( x1, x0, 0x10 );
+        x1 = _mm_xor_si128( _mm_srli_si128( x1, 8 ), x2 );
+        x0 = _mm_loadl_epi64( reinterpret_cast<const __m128i *>(constK5K0) );
+        x2 = _mm_srli_si128( x1, 4 );
+        x1 = _mm_xor_si128( _mm_clmulepi64_si128( _mm_and_si128( x1, mask ), x0, 0x00 ), x2 );
+
+        // Barrett reduction to 32 bits
+        x0 = _mm_load_si128( reinterpret_cast<const __m128i *>(constPoly) );
+        x2 = _mm_clmulepi64_si128( _mm_and_si128( x1, mask ), x0, 0x10 );
+        x2 = _mm_clmulepi64_si128( _mm_and_si128( x2, mask ), x0, 0x00 );
+        x1 = _mm_xor_si128( x1, x2 );
+
+        return static_cast<unsigned int>(_mm_extract_epi32( x1, 1 ));
+    }
+
+    /**
+     * \brief   Continues CRC calculation using carry-less multiplication for the blocks of 16 bytes
+     *          and slicing-by-8 for the rest of data.
+     **/
+    unsigned int _crc32UpdateClmul( unsigned int crc, const unsigned char * data, unsigned int size )
+    {
+        if ( size >= CRC32_CLMUL_MIN_SIZE )
+        {
+            unsigned int folded = size & ~static_cast<unsigned int>(0x0F);
+            crc   = _crc32FoldClmul( crc, data, folded );
+            data += folded;
+            size -= folded;
+        }
+
+        return _crc32UpdateSlicing( crc, data, size );
+    }
+
+    /**
+     * \brief   Returns true if the CPU supports carry-less multiplication (PCLMULQDQ) and SSE4.1 instructions.
+     **/
+    bool _isClmulSupported( void )
+    {
+#if defined(_MSC_VER)
+        int cpuInfo[4]{ 0 };
+        __cpuid( cpuInfo, 1 );
+        // ECX bit 1 is PCLMULQDQ, bit 19 is SSE4.1
+        return ((cpuInfo[2] & (1 << 1)) != 0) && ((cpuInfo[2] & (1 << 19)) != 0);
+#else   // defined(_MSC_VER)
+        __builtin_cpu_init( );
+        return (__builtin_cpu_supports( "pclmul" ) != 0) && (__builtin_cpu_supports( "sse4.1" ) != 0);
+#endif  // defined(_MSC_VER)
+    }
+
+#endif  // CRC32_CLMUL_SUPPORTED
+
+    /**
+     * \brief   Continues CRC calculation of binary data with the fastest method supported by the CPU.
+     *          The method is selected once, when the function is called first time.
+     **/
+    inline unsigned int _crc32Update( unsigned int crc, const unsigned char * data, unsigned int size )
+    {
+#ifdef CRC32_CLMUL_SUPPORTED
+        static const FuncCrc32Update _funcUpdate{ _isClmulSupported( ) ? &_crc32UpdateClmul : &_crc32UpdateSlicing };
+#else   // CRC32_CLMUL_SUPPORTED
+        static constexpr FuncCrc32Update _funcUpdate{ &_crc32UpdateSlicing };
+#endif  // CRC32_CLMUL_SUPPORTED
+
+        return _funcUpdate( crc, data, size );
+    }
+}
+
 NEMath::S_LargeInteger & NEMath::sLargeInteger::operator =  ( const NEMath::S_LargeInteger & src )
 {
     hiBits  = src.hiBits;
@@ -188,9 +416,11 @@ unsigned int AREG_API NEMath::getLowBits( const sLargeInteger &num )
 AREG_API unsigned int NEMath::crc32Calculate( const unsigned char* data, int size )
 {
     unsigned int result = static_cast<unsigned int>(~0);   // initialize
-    const unsigned int* crc32Tab = reinterpret_cast<const unsigned int *>(::_crc32LookupTable);   // get converted lookup table
-    for ( int count = size ; count != 0; -- count, ++ data )
-        result = (result >> 8) ^ crc32Tab[*data ^ static_cast<unsigned char>(result & 0x000000FF)];  // calculate
+    if ( (data != nullptr) && (size > 0) )
+    {
+        result = _crc32Update( result, data, static_cast<unsigned int>(size) );
+    }
+
     return (~result);   // return result
 }
 
@@ -241,30 +471,7 @@ AREG_API unsigned int NEMath::crc32Start( unsigned int crcInit, const unsigned c
     unsigned int result = crcInit;
     if ( data != nullptr && size > 0)
     {
-        const unsigned int* crc32Table = reinterpret_cast<const unsigned int *>(::_crc32LookupTable);  // get converted lookup table
-        for ( ; size > 0; -- size, ++ data )
-        {
-            result  = (result >> 8) ^ crc32Table[ *data ^ static_cast<unsigned char>(result & 0x000000FF)];
-            /************************************************************************
-             * This calculation is similar as following algorithm:
-             ************************************************************************/
-            /************************************************************************
-             *  unsigned char tmpCRC32[4];
-             *  unsigned char* crc32 = reinterpret_cast<unsigned char *>(&result);
-             *  for(int i = 0; i < size; i++)
-             *  {
-             *      tmpCRC32[0] = crc32[0];
-             *      tmpCRC32[1] = crc32[1];
-             *      tmpCRC32[2] = crc32[2];
-             *      tmpCRC32[3] = crc32[3];
-             *
-             *      crc32[3]   =               ::_crc32LookupTable[ ((data[i] ^ tmpCRC32[0]) * 4) + 3];
-             *      crc32[2]   = tmpCRC32[3] ^ ::_crc32LookupTable[ ((data[i] ^ tmpCRC32[0]) * 4) + 2];
-             *      crc32[1]   = tmpCRC32[2] ^ ::_crc32LookupTable[ ((data[i] ^ tmpCRC32[0]) * 4) + 1];
-             *      crc32[0]   = tmpCRC32[1] ^ ::_crc32LookupTable[ ((data[i] ^ tmpCRC32[0]) * 4) + 0];
-             *  }
-             ************************************************************************/
-        }
+        result = _crc32Update( result, data, static_cast<unsigned int>(size) );
     }
     return result;
 }
@@ -26,12 +26,15 @@
     #include <ws2tcpip.h>
 #else
     #include <sys/socket.h>
+    #include <sys/un.h>
     #include <sys/ioctl.h>
     #include <sys/select.h>
     #include <netinet/in.h>
     #include <netdb.h>
     #include <arpa/inet.h>
     #include <ctype.h>      // IEEE Std 1003.1-2001
+    #include <unistd.h>
+    #include <errno.h>
 #endif
 
 #include <utility>
@@ -39,6 +42,28 @@
 DEF_TRACE_SCOPE(areg_base_NESocket_clientSocketConnect);
 DEF_TRACE_SCOPE(areg_base_NESocket_serverSocketConnect);
 DEF_TRACE_SCOPE(areg_base_NESocket_serverAcceptConnection);
+DEF_TRACE_SCOPE(areg_base_NESocket_clientLocalSocketConnect);
+DEF_TRACE_SCOPE(areg_base_NESocket_serverLocalSocketConnect);
+
+#ifndef _WINDOWS
+namespace
+{
+    /**
+     * \brief   Initializes the address of local (Unix domain) socket.
+     *          Returns false if the path is empty or does not fit the address structure.
+     **/
+    inline bool _initLocalAddress( const std::string_view & socketPath, struct sockaddr_un & out_addr )
+    {
+        NEMemory::memZero( &out_addr, sizeof( struct sockaddr_un ) );
+        out_addr.sun_family = AF_UNIX;
+        if ( socketPath.empty( ) || (socketPath.length( ) >= sizeof( out_addr.sun_path )) )
+            return false;
+
+        NEMemory::memCopy( out_addr.sun_path, static_cast<int>(sizeof( out_addr.sun_path )), socketPath.data( ), static_cast<int>(socketPath.length( )) );
+        return true;
+    }
+}
+#endif  // !_WINDOWS
 
 //////////////////////////////////////////////////////////////////////////
 // NESocket namespace members
@@ -60,18 +85,21 @@ AREG_API const int                  NESocket::MAXIMUM_LISTEN_QUEUE_SIZE = SOMAXC
 NESocket::SocketAddress::SocketAddress( void )
     : mIpAddr   ( "" )
     , mPortNr   ( NESocket::InvalidPort )
+    , mIsLocal  ( false )
 {
 }
 
 NESocket::SocketAddress::SocketAddress(const NESocket::SocketAddress & src)
     : mIpAddr   ( src.mIpAddr )
     , mPortNr   ( src.mPortNr )
+    , mIsLocal  ( src.mIsLocal )
 {
 }
 
 NESocket::SocketAddress::SocketAddress( NESocket::SocketAddress && src ) noexcept
     : mIpAddr   ( std::move(src.mIpAddr) )
     , mPortNr   ( std::move(src.mPortNr) )
+    , mIsLocal  ( src.mIsLocal )
 {
 }
 
@@ -79,6 +107,7 @@ NESocket::SocketAddress & NESocket::SocketAddress::operator = ( const NESocket::
 {
     mIpAddr = src.mIpAddr;
     mPortNr = src.mPortNr;
+    mIsLocal= src.mIsLocal;
 
     return (*this);
 }
@@ -87,6 +116,7 @@ NESocket::SocketAddress & NESocket::SocketAddress::operator = ( NESocket::Socket
 {
     mIpAddr = std::move(src.mIpAddr);
     mPortNr = std::move(src.mPortNr);
+    mIsLocal= src.mIsLocal;
 
     return (*this);
 }
@@ -94,7 +124,7 @@ NESocket::SocketAddress & NESocket::SocketAddress::operator = ( NESocket::Socket
 bool NESocket::SocketAddress::getAddress(struct sockaddr_in & out_sockAddr) const
 {
     bool result = false;
-    if ( mPortNr != NESocket::InvalidPort )
+    if ( mIsLocal == false )
     {
         NEMemory::memZero(&out_sockAddr, sizeof(out_sockAddr));
         out_sockAddr.sin_family = AF_INET;
@@ -119,6 +149,7 @@ bool NESocket::SocketAddress::getAddress(struct sockaddr_in & out_sockAddr) cons
 
 void NESocket::SocketAddress::setAddress(const struct sockaddr_in & addrHost)
 {
+    mIsLocal= false;
     mPortNr = ntohs(addrHost.sin_port);
 #if defined(_MSC_VER) && (_MSC_VER >= 1800)
     char ipAddr[32] = { 0 };
@@ -137,6 +168,7 @@ bool NESocket::SocketAddress::resolveSocket(SOCKETHANDLE hSocket)
     bool result = false;
     mPortNr     = NESocket::InvalidPort;
     mIpAddr     = "";
+    mIsLocal    = false;
 
     if ( hSocket != NESocket::InvalidSocketHandle )
     {
@@ -188,6 +220,36 @@ bool NESocket::SocketAddress::resolveSocket(SOCKETHANDLE hSocket)
     return result;
 }
 
+bool NESocket::SocketAddress::resolveBoundSocket(SOCKETHANDLE hSocket)
+{
+    bool result = false;
+    resetAddress( );
+
+    if ( hSocket != NESocket::InvalidSocketHandle )
+    {
+        struct sockaddr_in sAddr;
+        NEMemory::memZero(&sAddr, sizeof(sockaddr_in));
+
+#ifdef  _WINDOWS
+        int len = sizeof(sockaddr_in);
+#else   // !_WINDOWS
+        socklen_t len = sizeof(sockaddr_in);
+#endif  // _WINDOWS
+
+        if ( (RETURNED_OK == getsockname(hSocket, reinterpret_cast<struct sockaddr *>(&sAddr), &len)) && (sAddr.sin_family == AF_INET) )
+        {
+            setAddress( sAddr );
+            result = (mIpAddr.isEmpty() == false);
+        }
+        else
+        {
+            OUTPUT_WARN("Failed to get bound name of socket [ %u ]", static_cast<unsigned int>(hSocket));
+        }
+    }
+
+    return result;
+}
+
 bool NESocket::SocketAddress::resolveAddress( const std::string_view & hostName, unsigned short portNr, bool isServer)
 {
     bool result = false;
@@ -196,6 +258,7 @@ bool NESocket::SocketAddress::resolveAddress( const std::string_view & hostName,
 
     mPortNr = NESocket::InvalidPort;
     mIpAddr = "";
+    mIsLocal= false;
 
     if ( isalnum(*host) )
     {
@@ -257,14 +320,21 @@ bool NESocket::SocketAddress::resolveAddress( const std::string_view & hostName,
     return result;
 }
 
+void NESocket::SocketAddress::setLocalAddress( const std::string_view & socketPath )
+{
+    mIpAddr = String( socketPath.data(), static_cast<NEString::CharCount>(socketPath.length()) );
+    mPortNr = NESocket::InvalidPort;
+    mIsLocal= true;
+}
+
 bool NESocket::SocketAddress::operator == ( const NESocket::SocketAddress & other ) const
 {
-    return (this != &other ? mIpAddr == other.mIpAddr && mPortNr == other.mPortNr : true);
+    return (this != &other ? mIpAddr == other.mIpAddr && mPortNr == other.mPortNr && mIsLocal == other.mIsLocal : true);
 }
 
 bool NESocket::SocketAddress::operator != ( const NESocket::SocketAddress & other ) const
 {
-    return (this != &other ? mIpAddr != other.mIpAddr || mPortNr != other.mPortNr : false);
+    return (this != &other ? mIpAddr != other.mIpAddr || mPortNr != other.mPortNr || mIsLocal != other.mIsLocal : false);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -321,7 +391,7 @@ AREG_API SOCKETHANDLE NESocket::clientSocketConnect(const std::string_view & hos
 {
     TRACE_SCOPE(areg_base_NESocket_clientSocketConnect);
 
-    const char * host = hostName.empty() ? hostName.data() : NESocket::LocalHost.data();
+    const char * host = hostName.empty() ? NESocket::LocalHost.data() : hostName.data();
 
     TRACE_DBG("Creating client socket to connect remote host [ %s ] and port number [ %u ]", host, static_cast<unsigned int>(portNr));
 
@@ -348,6 +418,11 @@ AREG_API SOCKETHANDLE NESocket::clientSocketConnect(const SocketAddress & peerAd
 {
     TRACE_SCOPE(areg_base_NESocket_clientSocketConnect);
 
+    if ( peerAddr.isLocalSocket() )
+    {
+        return NESocket::clientLocalSocketConnect( peerAddr.getHostAddress().getString() );
+    }
+
     SOCKETHANDLE result   = NESocket::InvalidSocketHandle;
     if ( peerAddr.isValid() )
     {
@@ -394,7 +469,7 @@ AREG_API SOCKETHANDLE NESocket::serverSocketConnect(const std::string_view & hos
 {
     TRACE_SCOPE(areg_base_NESocket_serverSocketConnect);
 
-    const char * host = hostName.empty() ? hostName.data() : NESocket::LocalHost.data();
+    const char * host = hostName.empty() ? NESocket::LocalHost.data() : hostName.data();
 
     TRACE_DBG("Creating server socket on host [ %s ] and port number [ %u ]", host, static_cast<unsigned int>(portNr));
 
@@ -422,8 +497,13 @@ AREG_API SOCKETHANDLE NESocket::serverSocketConnect(const SocketAddress & peerAd
 {
     TRACE_SCOPE(areg_base_NESocket_serverSocketConnect);
 
+    if ( peerAddr.isLocalSocket() )
+    {
+        return NESocket::serverLocalSocketConnect( peerAddr.getHostAddress().getString() );
+    }
+
     SOCKETHANDLE result   = NESocket::InvalidSocketHandle;
-    if ( peerAddr.isValid() )
+    if ( peerAddr.getHostAddress().isEmpty() == false )
     {
         // struct sockaddr_in remoteAddr = {0};
         sockaddr_in serverAddr;
@@ -467,6 +547,111 @@ AREG_API SOCKETHANDLE NESocket::serverSocketConnect(const SocketAddress & peerAd
     return result;
 }
 
+AREG_API SOCKETHANDLE NESocket::clientLocalSocketConnect( const std::string_view & socketPath )
+{
+    TRACE_SCOPE(areg_base_NESocket_clientLocalSocketConnect);
+
+    SOCKETHANDLE result = NESocket::InvalidSocketHandle;
+
+#ifndef _WINDOWS
+
+    struct sockaddr_un remoteAddr;
+    if ( _initLocalAddress(socketPath, remoteAddr) )
+    {
+        result = static_cast<SOCKETHANDLE>( socket(AF_UNIX, SOCK_STREAM, 0) );
+        if ( result != NESocket::InvalidSocketHandle )
+        {
+            if ( RETURNED_OK != connect(result, reinterpret_cast<sockaddr *>(&remoteAddr), sizeof(struct sockaddr_un)) )
+            {
+                TRACE_ERR("Client failed to connect to local socket [ %s ]. Closing socket [ %u ]", remoteAddr.sun_path, static_cast<unsigned int>(result));
+                NESocket::socketClose(result);
+                result = NESocket::InvalidSocketHandle;
+            }
+            else
+            {
+                TRACE_DBG("Client socket [ %u ] succeeded to connect to local socket [ %s ]", static_cast<unsigned int>(result), remoteAddr.sun_path);
+            }
+        }
+        else
+        {
+            TRACE_ERR("Failed to create local socket, cannot create client!");
+        }
+    }
+    else
+    {
+        TRACE_ERR("The local socket path is empty or too long, no client is created");
+    }
+
+#else   // _WINDOWS
+
+    TRACE_ERR("Local sockets are not supported, cannot connect to [ %s ]", socketPath.empty() ? "" : socketPath.data());
+
+#endif  // _WINDOWS
+
+    return result;
+}
+
+AREG_API SOCKETHANDLE NESocket::serverLocalSocketConnect( const std::string_view & socketPath )
+{
+    TRACE_SCOPE(areg_base_NESocket_serverLocalSocketConnect);
+
+    SOCKETHANDLE result = NESocket::InvalidSocketHandle;
+
+#ifndef _WINDOWS
+
+    struct sockaddr_un serverAddr;
+    if ( _initLocalAddress(socketPath, serverAddr) )
+    {
+        result = static_cast<SOCKETHANDLE>( socket(AF_UNIX, SOCK_STREAM, 0) );
+        if ( result != NESocket::InvalidSocketHandle )
+        {
+            if ( RETURNED_OK != bind(result, reinterpret_cast<sockaddr *>(&serverAddr), sizeof(struct sockaddr_un)) )
+            {
+                // The file of previous server may remain. Remove it only if no server is listening on it.
+                bool inUse = (errno == EADDRINUSE);
+                SOCKETHANDLE hProbe = inUse ? NESocket::clientLocalSocketConnect( socketPath ) : NESocket::InvalidSocketHandle;
+                if ( inUse && (hProbe == NESocket::InvalidSocketHandle) )
+                {
+                    TRACE_WARN("Removing stale local socket file [ %s ]", serverAddr.sun_path);
+                    unlink( serverAddr.sun_path );
+                }
+                else if ( hProbe != NESocket::InvalidSocketHandle )
+                {
+                    NESocket::socketClose( hProbe );
+                }
+
+                if ( RETURNED_OK != bind(result, reinterpret_cast<sockaddr *>(&serverAddr), sizeof(struct sockaddr_un)) )
+                {
+                    TRACE_ERR("Server failed to bind on local socket [ %s ]. Closing socket [ %u ]", serverAddr.sun_path, static_cast<unsigned int>(result));
+                    NESocket::socketClose( result );
+                    result = NESocket::InvalidSocketHandle;
+                }
+            }
+
+            if ( result != NESocket::InvalidSocketHandle )
+            {
+                TRACE_DBG("Server socket [ %u ] succeeded to bind on local socket [ %s ]. Ready to listen.", static_cast<unsigned int>(result), serverAddr.sun_path);
+            }
+        }
+        else
+        {
+            TRACE_ERR("Failed to create local socket, cannot create server!");
+        }
+    }
+    else
+    {
+        TRACE_ERR("The local socket path is empty or too long, no server is created");
+    }
+
+#else   // _WINDOWS
+
+    TRACE_ERR("Local sockets are not supported, cannot bind on [ %s ]", socketPath.empty() ? "" : socketPath.data());
+
+#endif  // _WINDOWS
+
+    return result;
+}
+
 AREG_API bool NESocket::serverListenConnection(SOCKETHANDLE serverSocket, int maxQueueSize /*= NESocket::MAXIMUM_LISTEN_QUEUE_SIZE*/)
 {
     return ( (serverSocket != NESocket::InvalidSocketHandle) && (RETURNED_OK == listen(serverSocket, maxQueueSize)) );
@@ -531,20 +716,36 @@ AREG_API SOCKETHANDLE NESocket::serverAcceptConnection(SOCKETHANDLE serverSocket
                 if ( FD_ISSET(serverSocket, &readList) != 0 )
                 {
                     // have got new client connection. resolve and get socket
-                    struct sockaddr_in acceptAddr; // connecting client address information
-                    NEMemory::memZero(&acceptAddr, sizeof(sockaddr_in));
+                    struct sockaddr_storage acceptAddr; // connecting client address information
+                    NEMemory::memZero(&acceptAddr, sizeof(sockaddr_storage));
 
 #ifdef  _WINDOWS
-                    int len = sizeof(sockaddr_in);
+                    int len = sizeof(sockaddr_storage);
 #else   // !_WINDOWS
-                    socklen_t len = sizeof(sockaddr_in);
+                    socklen_t len = sizeof(sockaddr_storage);
 #endif  // _WINDOWS
 
                     TRACE_DBG("... server waiting for new connection event ...");
                     result = accept( serverSocket, reinterpret_cast<sockaddr *>(&acceptAddr), &len );
                     TRACE_DBG("Server accepted new connection of client socket [ %u ]", static_cast<unsigned int>(result));
                     if ( (result != NESocket::InvalidSocketHandle) && (out_socketAddr != nullptr) )
-                        out_socketAddr->setAddress(acceptAddr);
+                    {
+                        if ( acceptAddr.ss_family == AF_INET )
+                        {
+                            out_socketAddr->setAddress(reinterpret_cast<const struct sockaddr_in &>(acceptAddr));
+                        }
+#ifndef _WINDOWS
+                        else if ( acceptAddr.ss_family == AF_UNIX )
+                        {
+                            // the peers of local sockets are unnamed, use the path of the server socket.
+                            struct sockaddr_un serverAddr;
+                            socklen_t serverLen = sizeof(struct sockaddr_un);
+                            NEMemory::memZero(&serverAddr, sizeof(struct sockaddr_un));
+                            getsockname(serverSocket, reinterpret_cast<sockaddr *>(&serverAddr), &serverLen);
+                            out_socketAddr->setLocalAddress(serverAddr.sun_path);
+                        }
+#endif  // !_WINDOWS
+                    }
                 }
                 else
                 {
@@ -112,6 +112,20 @@ bool RemoteMessage::isChecksumValid(void) const
     return isValid() ? getChecksum() == RemoteMessage::_checksumCalculate( _getRemoteMessage() ) : false;
 }
 
+unsigned int RemoteMessage::checksumCalculate(void) const
+{
+    return isValid() ? RemoteMessage::_checksumCalculate( _getRemoteMessage() ) : NEMath::CHECKSUM_IGNORE;
+}
+
+void RemoteMessage::checksumMark(void)
+{
+    if ( isValid() )
+    {
+        NEMemory::sRemoteMessage & msg = _getRemoteMessage();
+        msg.rbHeader.rbhChecksum = RemoteMessage::_checksumCalculate( msg );
+    }
+}
+
 DEF_TRACE_SCOPE(areg_base_RemoteMessage_bufferCompletionFix);
 void RemoteMessage::bufferCompletionFix(void)
 {
@@ -122,7 +136,6 @@ void RemoteMessage::bufferCompletionFix(void)
         NEMemory::sRemoteMessage & msg = _getRemoteMessage();
         NEMemory::sRemoteMessageHeader & header = msg.rbHeader;
 
-        unsigned int checksum   = RemoteMessage::_checksumCalculate( msg );
         unsigned int dataUsed   = header.rbhBufHeader.biUsed;
         unsigned int dataLen    = header.rbhBufHeader.biUsed;
         unsigned int bufSize    = header.rbhBufHeader.biOffset + dataUsed;
@@ -137,12 +150,13 @@ void RemoteMessage::bufferCompletionFix(void)
 
         header.rbhBufHeader.biBufSize   = bufSize;
         header.rbhBufHeader.biLength    = dataLen;
-        header.rbhChecksum              = checksum;
+        // the checksum is calculated when the message is sent.
+        header.rbhChecksum              = NEMath::CHECKSUM_IGNORE;
 
-        TRACE_INFO("Remote message completion: bufSize [ %u ], msg.biBufSize = [ %u ]; dataLen [ %u ], msg.biLength = [ %u ], dataUsed [ %u ], checksum [ %u ]"
+        TRACE_INFO("Remote message completion: bufSize [ %u ], msg.biBufSize = [ %u ]; dataLen [ %u ], msg.biLength = [ %u ], dataUsed [ %u ]"
                         , bufSize, header.rbhBufHeader.biBufSize
                         , dataLen, header.rbhBufHeader.biLength
-                        , dataUsed, checksum);
+                        , dataUsed);
     }
 }
 
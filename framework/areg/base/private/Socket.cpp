@@ -95,11 +95,31 @@ int Socket::sendData( const unsigned char * buffer, int length ) const
     return (mSocket.get() != nullptr ? NESocket::sendData( *mSocket, buffer, length, -1 ) : 0);
 }
 
+int Socket::sendDataVector( const NESocket::sSocketBuffer * listBuffers, int count ) const
+{
+    return (mSocket.get() != nullptr ? NESocket::sendDataVector( *mSocket, listBuffers, count ) : 0);
+}
+
+int Socket::sendPendingDataVector( const NESocket::sSocketBuffer * listBuffers, int count ) const
+{
+    return (mSocket.get() != nullptr ? NESocket::sendPendingDataVector( *mSocket, listBuffers, count ) : -1);
+}
+
 int Socket::receiveData( unsigned char * buffer, int length ) const
 {
     return (mSocket.get() != nullptr ? NESocket::receiveData( *mSocket, buffer, length, -1 ) : 0);
 }
 
+int Socket::receiveAvailableData( unsigned char * buffer, int length ) const
+{
+    return (mSocket.get() != nullptr ? NESocket::receiveAvailableData( *mSocket, buffer, length ) : 0);
+}
+
+int Socket::receivePendingData( unsigned char * buffer, int length ) const
+{
+    return (mSocket.get() != nullptr ? NESocket::receivePendingData( *mSocket, buffer, length ) : -1);
+}
+
 bool Socket::setAddress(const char * hostName, unsigned short portNr, bool isServer)
 {
     if ( isValid() && (mAddress.getHostAddress() != hostName || mAddress.getHostPort() != portNr) )
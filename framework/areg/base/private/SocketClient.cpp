@@ -37,7 +37,7 @@ bool SocketClient::createSocket( void )
 
     if ( mAddress.isValid() )
     {
-    	SOCKETHANDLE hSocket = NESocket::clientSocketConnect(static_cast<const char *>(mAddress.getHostAddress()), mAddress.getHostPort());
+        SOCKETHANDLE hSocket = NESocket::clientSocketConnect(mAddress);
         if ( hSocket != NESocket::InvalidSocketHandle )
         {
         	mSocket = std::make_shared<SOCKETHANDLE>(hSocket);
@@ -46,3 +46,24 @@ bool SocketClient::createSocket( void )
 
     return isValid();
 }
+
+bool SocketClient::createSocketAsync( void )
+{
+    decreaseLock();
+
+    if ( mAddress.isValid() )
+    {
+        SOCKETHANDLE hSocket = NESocket::clientSocketConnectAsync(mAddress);
+        if ( hSocket != NESocket::InvalidSocketHandle )
+        {
+            mSocket = std::make_shared<SOCKETHANDLE>(hSocket);
+        }
+    }
+
+    return isValid();
+}
+
+NESocket::eConnectState SocketClient::checkConnected( void ) const
+{
+    return NESocket::clientSocketCheckConnect( getHandle() );
+}
@@ -0,0 +1,53 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/base/private/SocketPoller.cpp
+ * \ingroup     AREG SDK, Asynchronous Event Generator Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Socket event poller.
+ *              OS independent part of implementation.
+ ************************************************************************/
+#include "areg/base/SocketPoller.hpp"
+
+SocketPoller::SocketPoller( void )
+    : mPollHandle   ( -1 )
+    , mWakeUpHandle ( -1 )
+    , mReadyCount   ( 0 )
+    , mReadyNext    ( 0 )
+    , mReadyList    { }
+{
+}
+
+SocketPoller::~SocketPoller( void )
+{
+    release();
+}
+
+SOCKETHANDLE SocketPoller::waitSocketEvent( unsigned int timeout /*= NECommon::WAIT_INFINITE*/ )
+{
+    SOCKETHANDLE result = NESocket::InvalidSocketHandle;
+    if ( (mReadyNext < mReadyCount) || _osPollEvents( timeout ) )
+    {
+        ASSERT(mReadyNext < mReadyCount);
+        result = mReadyList[mReadyNext ++];
+    }
+
+    return result;
+}
+
+void SocketPoller::dropReadySocket( SOCKETHANDLE hSocket )
+{
+    for ( int i = mReadyNext; i < mReadyCount; ++ i )
+    {
+        if ( mReadyList[i] == hSocket )
+        {
+            mReadyList[i] = mReadyList[mReadyNext ++];
+        }
+    }
+}
@@ -35,12 +35,17 @@ bool SocketServer::createSocket(const char * hostName, unsigned short portNr)
 bool SocketServer::createSocket(void)
 {
     decreaseLock();
-    if ( mAddress.isValid() )
+    if ( mAddress.getHostAddress().isEmpty() == false )
     {
-    	SOCKETHANDLE hSocket = NESocket::serverSocketConnect(static_cast<const char *>(mAddress.getHostAddress()), mAddress.getHostPort());
+        SOCKETHANDLE hSocket = NESocket::serverSocketConnect(mAddress);
         if ( hSocket != NESocket::InvalidSocketHandle )
         {
             mSocket = std::make_shared<SOCKETHANDLE>( hSocket );
+            if ( (mAddress.isLocalSocket() == false) && (mAddress.getHostPort() == NESocket::InvalidPort) )
+            {
+                // the port is assigned by system, get it to let clients connect
+                mAddress.resolveBoundSocket( hSocket );
+            }
         }
     }
 
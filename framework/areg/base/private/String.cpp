@@ -217,7 +217,7 @@ String & String::operator = (const String & src)
         release();
         if ( src.isEmpty() == false)
         {
-            mData = NEString::initString<char, char>(src.getString(), src.getLength());
+            mData = initData<char>(src.getString(), src.getLength());
         }
 
 #ifdef DEBUG
@@ -233,13 +233,7 @@ String & String::operator = ( String && src ) noexcept
     if ( this != &src )
     {
         release( );
-        mData = src.mData;
-        src.mData = nullptr;
-
-#ifdef DEBUG
-        mString = mData != nullptr ? mData->strBuffer : nullptr;
-        src.mString = nullptr;
-#endif // DEBUG
+        moveData( src );
     }
 
     return (*this);
@@ -250,8 +244,8 @@ String & String::operator = (const char * src)
     if (getString() != src)
     {
         NEString::SString<char> * temp = mData;
-        mData = NEString::initString<char, char>( src, NEString::COUNT_ALL );
-        NEString::releaseSpace<char>(temp);
+        mData = initData<char>( src, NEString::COUNT_ALL );
+        releaseData(temp);
 
 #ifdef DEBUG
         mString = mData != nullptr ? mData->strBuffer : nullptr;
@@ -264,7 +258,7 @@ String & String::operator = (const char * src)
 String & String::operator = (char chSource)
 {
     release( );
-    mData = NEString::initString<char, char>( &chSource, 1 );
+    mData = initData<char>( &chSource, 1 );
 
 #ifdef DEBUG
     mString = mData != nullptr ? mData->strBuffer : nullptr;
@@ -276,7 +270,7 @@ String & String::operator = (char chSource)
 String & String::operator = ( const wchar_t * src )
 {
     release( );
-    mData = NEString::initString<char, wchar_t>( src, NEString::COUNT_ALL );
+    mData = initData<wchar_t>( src, NEString::COUNT_ALL );
 
 #ifdef DEBUG
     mString = mData != nullptr ? mData->strBuffer : nullptr;
@@ -288,7 +282,7 @@ String & String::operator = ( const wchar_t * src )
 String & String::operator = (const WideString & src)
 {
     release();
-    mData = NEString::initString<char, wchar_t>(src.getString(), src.getLength());
+    mData = initData<wchar_t>(src.getString(), src.getLength());
 
 #ifdef DEBUG
     mString = mData != nullptr ? mData->strBuffer : nullptr;
@@ -74,6 +74,7 @@ unsigned long Thread::_defaultThreadFunction(void* data)
         {
             // Check if initialization is completed and ready to run.
             Lock lock(threadObj->mSynchObject);
+            threadObj->_applyThreadAttributes();
         } while (false);
 
         OUTPUT_DBG("Thread [ %s ] starts job...", static_cast<const char *>(threadObj->getName()));
@@ -148,6 +149,7 @@ Thread::Thread(IEThreadConsumer &threadConsumer, const char* threadName /* = nul
     , mThreadId         (Thread::INVALID_THREAD_ID)
     , mThreadAddress    (NEString::isEmpty<char>(threadName) == false ? threadName : NEUtilities::generateName(DEFAULT_THREAD_PREFIX.data()).getString())
     , mThreadPriority   (Thread::eThreadPriority::PriorityUndefined)
+    , mThreadAttributes (Thread::DEFAULT_THREAD_ATTRIBUTES)
     , mIsRunning        ( false )
 
     , mSynchObject      ( )
@@ -201,6 +203,20 @@ bool Thread::createThread(unsigned int waitForStartMs /* = NECommon::DO_NOT_WAIT
     return result;
 }
 
+bool Thread::createThread( unsigned int waitForStartMs, const Thread::sThreadAttributes & attributes )
+{
+    do 
+    {
+        Lock  lock(mSynchObject);
+        if ( _isValidNoLock() == false )
+        {
+            mThreadAttributes = attributes;
+        }
+    } while (false);
+
+    return createThread(waitForStartMs);
+}
+
 
 void Thread::shutdownThread( void )
 {
@@ -51,10 +51,9 @@ ThreadAddress::ThreadAddress( void )
 }
 
 ThreadAddress::ThreadAddress( const char * threadName )
-    : mThreadName   ( threadName != nullptr ? threadName : INVALID_THREAD_NAME.data() )
+    : mThreadName   ( threadName != nullptr ? threadName : INVALID_THREAD_NAME.data(), NEUtilities::ITEM_NAMES_MAX_LENGTH )
     , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
 {
-    mThreadName.truncate( NEUtilities::ITEM_NAMES_MAX_LENGTH );
     mMagicNum    = ThreadAddress::_magicNumber(*this);
 }
 
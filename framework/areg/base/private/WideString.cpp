@@ -217,7 +217,7 @@ WideString & WideString::operator = (const WideString & src)
         release();
         if ( src.isEmpty() == false)
         {
-            mData = NEString::initString<wchar_t, wchar_t>(src.getString(), src.getLength());
+            mData = initData<wchar_t>(src.getString(), src.getLength());
         }
 
 #ifdef DEBUG
@@ -233,13 +233,7 @@ WideString & WideString::operator = ( WideString && src ) noexcept
     if ( this != &src )
     {
         release( );
-        mData = src.mData;
-        src.mData = nullptr;
-
-#ifdef DEBUG
-        mString = mData != nullptr ? mData->strBuffer : nullptr;
-        src.mString = nullptr;
-#endif // DEBUG
+        moveData( src );
     }
 
     return (*this);
@@ -250,8 +244,8 @@ WideString & WideString::operator = (const wchar_t * src)
     if (getString() != src)
     {
         NEString::SString<wchar_t> * temp = mData;
-        mData = NEString::initString<wchar_t, wchar_t>( src, NEString::COUNT_ALL );
-        NEString::releaseSpace<wchar_t>(temp);
+        mData = initData<wchar_t>( src, NEString::COUNT_ALL );
+        releaseData(temp);
 
 #ifdef DEBUG
         mString = mData != nullptr ? mData->strBuffer : nullptr;
@@ -264,7 +258,7 @@ WideString & WideString::operator = (const wchar_t * src)
 WideString & WideString::operator = (wchar_t chSource)
 {
     release( );
-    mData = NEString::initString<wchar_t, wchar_t>( &chSource, 1 );
+    mData = initData<wchar_t>( &chSource, 1 );
 
 #ifdef DEBUG
     mString = mData != nullptr ? mData->strBuffer : nullptr;
@@ -276,7 +270,7 @@ WideString & WideString::operator = (wchar_t chSource)
 WideString & WideString::operator = ( const char * src )
 {
     release( );
-    mData = NEString::initString<wchar_t, char>( src, NEString::COUNT_ALL );
+    mData = initData<char>( src, NEString::COUNT_ALL );
 
 #ifdef DEBUG
     mString = mData != nullptr ? mData->strBuffer : nullptr;
@@ -288,7 +282,7 @@ WideString & WideString::operator = ( const char * src )
 WideString & WideString::operator = (const String & src)
 {
     release();
-    mData = NEString::initString<wchar_t, char>(src.getString(), src.getLength());
+    mData = initData<char>(src.getString(), src.getLength());
 
 #ifdef DEBUG
     mString = mData != nullptr ? mData->strBuffer : nullptr;
@@ -708,7 +702,7 @@ int WideString::setString( const unsigned char * buffer )
 
     if (result != 0)
     {
-        mData = NEString::initString<wchar_t>(result);
+        mData = initData(result);
         if (mData != nullptr)
         {
 #ifdef DEBUG
@@ -29,6 +29,9 @@
 
 IEWaitableBaseIX::IEWaitableBaseIX( NESynchTypesIX::eSynchObject synchType, bool isRecursive, const char* asciiName /* = nullptr */ )
     : MutexIX     ( synchType, isRecursive, asciiName )
+#if defined(AREG_FUTEX_WAIT)
+    , mWaiters    ( )
+#endif  // defined(AREG_FUTEX_WAIT)
 {
 }
 
@@ -37,6 +40,10 @@ IEWaitableBaseIX::~IEWaitableBaseIX( void )
     ASSERT(SynchLockAndWaitIX::isWaitableRegistered(*this) == false);
 }
 
+void IEWaitableBaseIX::notifyReleaseOwnership( pthread_t /*ownerThread*/ )
+{
+}
+
 void IEWaitableBaseIX::freeResources(void)
 {
     SynchLockAndWaitIX::eventRemove(*this);
@@ -23,6 +23,7 @@
 #if defined(_POSIX) || defined(POSIX)
 
 #include "areg/base/private/posix/MutexIX.hpp"
+#include "areg/base/private/posix/SynchFutexWaitIX.hpp"
 
 //////////////////////////////////////////////////////////////////////////
 // SynchWaitable class declaration
@@ -71,6 +72,14 @@ public:
      **/
     virtual bool notifyRequestOwnership( pthread_t ownerThread ) = 0;
 
+    /**
+     * \brief   This callback is triggered to return the ownership taken by notifyRequestOwnership(),
+     *          when the waiting thread failed to take the ownership of all waitables it waits.
+     *          By default, it does nothing.
+     * \param   ownerThread     Indicates the POSIX thread ID that has taken the ownership.
+     **/
+    virtual void notifyReleaseOwnership( pthread_t ownerThread );
+
     /**
      * \brief   This callback is triggered to when a system needs to know whether waitable
      *          can signal multiple threads. Returned 'true' value indicates that there can be
@@ -94,6 +103,19 @@ public:
      **/
     virtual void freeResources( void );
 
+#if defined(AREG_FUTEX_WAIT)
+//////////////////////////////////////////////////////////////////////////
+// Member variables.
+//////////////////////////////////////////////////////////////////////////
+private:
+    friend class SynchFutexWaitIX;
+
+    /**
+     * \brief   The list of threads waiting for the waitable.
+     **/
+    SynchFutexWaitIX::WaiterList    mWaiters;
+#endif  // defined(AREG_FUTEX_WAIT)
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls.
 //////////////////////////////////////////////////////////////////////////
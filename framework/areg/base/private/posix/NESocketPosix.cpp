@@ -23,8 +23,11 @@
 
 #include <unistd.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <sys/select.h>
 #include <sys/ioctl.h>
+#include <fcntl.h>
+#include <poll.h>
 #include <netinet/in.h>
 #include <netdb.h>
 #include <errno.h>
@@ -38,8 +41,13 @@
 
 DEF_TRACE_SCOPE(areg_base_NESocketPosix_socketClose);
 DEF_TRACE_SCOPE(areg_base_NESocketPosix_sendData);
+DEF_TRACE_SCOPE(areg_base_NESocketPosix_sendDataVector);
+DEF_TRACE_SCOPE(areg_base_NESocketPosix_sendPendingDataVector);
 DEF_TRACE_SCOPE(areg_base_NESocketPosix_receiveData);
+DEF_TRACE_SCOPE(areg_base_NESocketPosix_receiveAvailableData);
+DEF_TRACE_SCOPE(areg_base_NESocketPosix_receivePendingData);
 DEF_TRACE_SCOPE(areg_base_NESocketPosix_remainDataRead);
+DEF_TRACE_SCOPE(areg_base_NESocketPosix_clientSocketConnectAsync);
 
 //////////////////////////////////////////////////////////////////////////
 // NESocket namespace functions implementation
@@ -131,6 +139,147 @@ AREG_API int NESocket::sendData(SOCKETHANDLE hSocket, const unsigned char * data
     return result;
 }
 
+AREG_API int NESocket::sendDataVector( SOCKETHANDLE hSocket, const NESocket::sSocketBuffer * listBuffers, int count )
+{
+    TRACE_SCOPE(areg_base_NESocketPosix_sendDataVector);
+
+    int result = -1;
+
+    if ( hSocket != NESocket::InvalidSocketHandle )
+    {
+        result = 0;
+        struct iovec ioList[NESocket::MAXIMUM_SEND_BUFFERS];
+        int index = 0;
+
+        while ( (index < count) && (result >= 0) )
+        {
+            // collect next portion of non-empty buffers
+            int entries = 0;
+            int dataLength = 0;
+            for ( ; (index < count) && (entries < NESocket::MAXIMUM_SEND_BUFFERS); ++ index )
+            {
+                const NESocket::sSocketBuffer & buffer = listBuffers[index];
+                if ( (buffer.sbData != nullptr) && (buffer.sbLength > 0) )
+                {
+                    ioList[entries].iov_base= const_cast<unsigned char *>(buffer.sbData);
+                    ioList[entries].iov_len = static_cast<size_t>(buffer.sbLength);
+                    dataLength += buffer.sbLength;
+                    ++ entries;
+                }
+            }
+
+            TRACE_DBG("Going to send [ %d ] bytes of data in [ %d ] buffers", dataLength, entries);
+
+            struct iovec * ioNext = ioList;
+            while ( entries > 0 )
+            {
+                struct msghdr msg;
+                NEMemory::zeroElement<struct msghdr>(msg);
+                msg.msg_iov     = ioNext;
+                msg.msg_iovlen  = static_cast<size_t>(entries);
+
+                ssize_t written = sendmsg(hSocket, &msg, 0);
+                if ( (written < 0) && (errno == EINTR) )
+                {
+                    continue;   // interrupted before any data is sent, repeat
+                }
+                else if ( written > 0 )
+                {
+                    result += static_cast<int>(written);
+                    // skip completely sent buffers and adjust partially sent one
+                    while ( (entries > 0) && (static_cast<size_t>(written) >= ioNext->iov_len) )
+                    {
+                        written -= static_cast<ssize_t>(ioNext->iov_len);
+                        ++ ioNext;
+                        -- entries;
+                    }
+
+                    if ( entries > 0 )
+                    {
+                        ioNext->iov_base = reinterpret_cast<unsigned char *>(ioNext->iov_base) + written;
+                        ioNext->iov_len -= static_cast<size_t>(written);
+                    }
+                }
+                else
+                {
+                    // the sent part of data is reported, the caller detects failure by length.
+                    TRACE_ERR("FAILED to sent data in [ %d ] buffers, error code is [ %p ], sent [ %d ] bytes, terminating sending"
+                                , entries
+                                , static_cast<id_type>(written < 0 ? errno : 0)
+                                , result);
+                    entries = 0;    // break loop
+                    index   = count;
+                    result  = result > 0 ? result : -1;
+                }
+            }
+        }
+    }
+    else
+    {
+        TRACE_ERR("INVALID socket, will not be able to sent data of [ %d ] buffers", count);
+    }
+
+    return result;
+}
+
+AREG_API int NESocket::sendPendingDataVector( SOCKETHANDLE hSocket, const NESocket::sSocketBuffer * listBuffers, int count )
+{
+    TRACE_SCOPE(areg_base_NESocketPosix_sendPendingDataVector);
+
+    int result = -1;
+
+    if ( hSocket != NESocket::InvalidSocketHandle )
+    {
+        result = 0;
+        struct iovec ioList[NESocket::MAXIMUM_SEND_BUFFERS];
+        int entries = 0;
+        for ( int index = 0; (index < count) && (entries < NESocket::MAXIMUM_SEND_BUFFERS); ++ index )
+        {
+            const NESocket::sSocketBuffer & buffer = listBuffers[index];
+            if ( (buffer.sbData != nullptr) && (buffer.sbLength > 0) )
+            {
+                ioList[entries].iov_base= const_cast<unsigned char *>(buffer.sbData);
+                ioList[entries].iov_len = static_cast<size_t>(buffer.sbLength);
+                ++ entries;
+            }
+        }
+
+        if ( entries > 0 )
+        {
+            struct msghdr msg;
+            NEMemory::zeroElement<struct msghdr>(msg);
+            msg.msg_iov     = ioList;
+            msg.msg_iovlen  = static_cast<size_t>(entries);
+
+            ssize_t written = -1;
+            do
+            {
+                written = sendmsg(hSocket, &msg, MSG_DONTWAIT);
+            } while ( (written < 0) && (errno == EINTR) );
+
+            if ( written >= 0 )
+            {
+                result = static_cast<int>(written);
+            }
+            else if ( (errno == EAGAIN) || (errno == EWOULDBLOCK) )
+            {
+                result = 0; // the send buffer of socket is full
+            }
+            else
+            {
+                TRACE_ERR("FAILED to sent data in [ %d ] buffers, error code is [ %p ]", entries, static_cast<id_type>(errno));
+                result = -1;
+            }
+        }
+    }
+    else
+    {
+        TRACE_ERR("INVALID socket, will not be able to sent data of [ %d ] buffers", count);
+    }
+
+    return result;
+}
+
 AREG_API int NESocket::receiveData(SOCKETHANDLE hSocket, unsigned char * dataBuffer, int dataLength, int blockMaxSize /*= -1*/ )
 {
     TRACE_SCOPE(areg_base_NESocketPosix_receiveData);
@@ -183,6 +332,154 @@ AREG_API int NESocket::receiveData(SOCKETHANDLE hSocket, unsigned char * dataBuf
     return result;
 }
 
+AREG_API int NESocket::receiveAvailableData( SOCKETHANDLE hSocket, unsigned char * dataBuffer, int dataLength )
+{
+    TRACE_SCOPE(areg_base_NESocketPosix_receiveAvailableData);
+
+    int result = -1;
+    if ( hSocket != NESocket::InvalidSocketHandle )
+    {
+        result = 0;
+        if ( (dataBuffer != nullptr) && (dataLength > 0) )
+        {
+            do
+            {
+                result = static_cast<int>(recv(hSocket, dataBuffer, static_cast<size_t>(dataLength), 0));
+            } while ( (result < 0) && (errno == EINTR) );
+
+            if ( result < 0 )
+            {
+                TRACE_ERR("FAILED to receive data, error code is [ %p ]", static_cast<id_type>(errno));
+            }
+            else if ( result == 0 )
+            {
+                TRACE_INFO("No data to read, the other side disconnected");
+            }
+        }
+        else
+        {
+            TRACE_ERR("Either buffer is nullptr [ %s ] or wrong data length to receive [ %d ]", dataBuffer == nullptr ? "YES" : "NO", dataLength);
+        }
+    }
+    else
+    {
+        TRACE_ERR("INVALID socket, will not be able to receive data");
+    }
+
+    return result;
+}
+
+AREG_API int NESocket::receivePendingData( SOCKETHANDLE hSocket, unsigned char * dataBuffer, int dataLength )
+{
+    TRACE_SCOPE(areg_base_NESocketPosix_receivePendingData);
+
+    int result = -1;
+    if ( hSocket != NESocket::InvalidSocketHandle )
+    {
+        result = 0;
+        if ( (dataBuffer != nullptr) && (dataLength > 0) )
+        {
+            do
+            {
+                result = static_cast<int>(recv(hSocket, dataBuffer, static_cast<size_t>(dataLength), MSG_DONTWAIT));
+            } while ( (result < 0) && (errno == EINTR) );
+
+            if ( result < 0 )
+            {
+                if ( (errno == EAGAIN) || (errno == EWOULDBLOCK) )
+                {
+                    result = 0;
+                }
+                else
+                {
+                    TRACE_ERR("FAILED to receive data, error code is [ %p ]", static_cast<id_type>(errno));
+                }
+            }
+            else if ( result == 0 )
+            {
+                TRACE_INFO("No data to read, the other side disconnected");
+                result = -1;
+            }
+        }
+        else
+        {
+            TRACE_ERR("Either buffer is nullptr [ %s ] or wrong data length to receive [ %d ]", dataBuffer == nullptr ? "YES" : "NO", dataLength);
+        }
+    }
+    else
+    {
+        TRACE_ERR("INVALID socket, will not be able to receive data");
+    }
+
+    return result;
+}
+
+AREG_API SOCKETHANDLE NESocket::clientSocketConnectAsync( const NESocket::SocketAddress & peerAddr )
+{
+    TRACE_SCOPE(areg_base_NESocketPosix_clientSocketConnectAsync);
+
+    if ( peerAddr.isLocalSocket() )
+    {
+        return NESocket::clientLocalSocketConnect( peerAddr.getHostAddress().getString() );
+    }
+
+    SOCKETHANDLE result = NESocket::InvalidSocketHandle;
+    sockaddr_in remoteAddr;
+    if ( peerAddr.isValid() && peerAddr.getAddress(remoteAddr) )
+    {
+        result = NESocket::socketCreate();
+        if ( result != NESocket::InvalidSocketHandle )
+        {
+            int flags = fcntl(result, F_GETFL, 0);
+            if ( (flags == -1) || (fcntl(result, F_SETFL, flags | O_NONBLOCK) == -1) ||
+                 ((connect(result, reinterpret_cast<sockaddr *>(&remoteAddr), sizeof(sockaddr_in)) != RETURNED_OK) && (errno != EINPROGRESS)) )
+            {
+                TRACE_ERR("Client failed to start connecting to remote host [ %s ] and port number [ %u ], error [ %d ]. Closing socket [ %u ]"
+                            , static_cast<const char *>(peerAddr.getHostAddress())
+                            , static_cast<unsigned int>(peerAddr.getHostPort())
+                            , errno
+                            , static_cast<unsigned int>(result));
+
+                NESocket::socketClose(result);
+                result = NESocket::InvalidSocketHandle;
+            }
+        }
+    }
+
+    return result;
+}
+
+AREG_API NESocket::eConnectState NESocket::clientSocketCheckConnect( SOCKETHANDLE hSocket )
+{
+    NESocket::eConnectState result = NESocket::eConnectState::ConnectFailed;
+    if ( hSocket != NESocket::InvalidSocketHandle )
+    {
+        struct pollfd pollSocket { hSocket, POLLOUT, 0 };
+        int ready = poll(&pollSocket, 1, 0);
+        if ( ready == 0 )
+        {
+            result = NESocket::eConnectState::ConnectPending;
+        }
+        else if ( ready > 0 )
+        {
+            int error = 0;
+            socklen_t len = sizeof(int);
+            int flags = fcntl(hSocket, F_GETFL, 0);
+            if ( (getsockopt(hSocket, SOL_SOCKET, SO_ERROR, &error, &len) == RETURNED_OK) && (error == 0) &&
+                 (flags != -1) && (fcntl(hSocket, F_SETFL, flags & ~O_NONBLOCK) != -1) )
+            {
+                result = NESocket::eConnectState::ConnectSucceeded;
+            }
+        }
+        else if ( errno == EINTR )
+        {
+            result = NESocket::eConnectState::ConnectPending;
+        }
+    }
+
+    return result;
+}
+
 AREG_API bool NESocket::disableSend(SOCKETHANDLE hSocket)
 {
     return ( hSocket != NESocket::InvalidSocketHandle ? RETURNED_OK == shutdown( hSocket, SHUT_WR) : false );
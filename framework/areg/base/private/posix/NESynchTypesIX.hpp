@@ -27,6 +27,15 @@
 #include <unistd.h>
 #include <time.h>
 
+/**
+ * \brief   AREG_FUTEX_WAIT is defined if the threads on Linux wait on futex.
+ *          It is enabled by ENABLE_FUTEX_WAIT preprocessor define,
+ *          otherwise the portable POSIX implementation is used.
+ **/
+#if defined(__linux__) && (defined(ENABLE_FUTEX_WAIT) || defined(_ENABLE_FUTEX_WAIT))
+    #define AREG_FUTEX_WAIT
+#endif  // defined(__linux__) && (defined(ENABLE_FUTEX_WAIT) || defined(_ENABLE_FUTEX_WAIT))
+
 //////////////////////////////////////////////////////////////////////////
 // NESynchTypesIX namespace declaration
 //////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,245 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/base/private/posix/SocketPollerPosix.cpp
+ * \ingroup     AREG SDK, Asynchronous Event Generator Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Socket event poller.
+ *              POSIX specific implementation, uses epoll on Linux.
+ ************************************************************************/
+#include "areg/base/SocketPoller.hpp"
+
+#if defined(_POSIX) || defined(POSIX)
+
+#include "areg/trace/GETrace.h"
+
+#if defined(__linux__)
+
+#include <unistd.h>
+#include <errno.h>
+#include <stdint.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+DEF_TRACE_SCOPE(areg_base_SocketPollerPosix_create);
+DEF_TRACE_SCOPE(areg_base_SocketPollerPosix_addSocket);
+DEF_TRACE_SCOPE(areg_base_SocketPollerPosix_addWriteSocket);
+DEF_TRACE_SCOPE(areg_base_SocketPollerPosix__osPollEvents);
+
+bool SocketPoller::isSupported( void )
+{
+    return true;
+}
+
+bool SocketPoller::create( void )
+{
+    TRACE_SCOPE(areg_base_SocketPollerPosix_create);
+
+    if ( mPollHandle == -1 )
+    {
+        mPollHandle     = epoll_create1( EPOLL_CLOEXEC );
+        mWakeUpHandle   = mPollHandle != -1 ? eventfd( 0, EFD_CLOEXEC | EFD_NONBLOCK ) : -1;
+
+        struct epoll_event ev;
+        ev.events   = EPOLLIN;
+        ev.data.fd  = mWakeUpHandle;
+        if ( (mWakeUpHandle == -1) || (epoll_ctl( mPollHandle, EPOLL_CTL_ADD, mWakeUpHandle, &ev ) == -1) )
+        {
+            TRACE_ERR("Failed to create socket poller, error code [ %p ]", static_cast<id_type>(errno));
+            release( );
+        }
+        else
+        {
+            TRACE_DBG("Created socket poller [ %d ]", mPollHandle);
+        }
+
+        mReadyCount = 0;
+        mReadyNext  = 0;
+    }
+
+    return (mPollHandle != -1);
+}
+
+void SocketPoller::release( void )
+{
+    if ( mWakeUpHandle != -1 )
+    {
+        close( mWakeUpHandle );
+        mWakeUpHandle = -1;
+    }
+
+    if ( mPollHandle != -1 )
+    {
+        close( mPollHandle );
+        mPollHandle = -1;
+    }
+
+    mReadyCount = 0;
+    mReadyNext  = 0;
+}
+
+bool SocketPoller::addSocket( SOCKETHANDLE hSocket, bool edgeTriggered )
+{
+    TRACE_SCOPE(areg_base_SocketPollerPosix_addSocket);
+
+    bool result = false;
+    if ( (mPollHandle != -1) && (hSocket != NESocket::InvalidSocketHandle) )
+    {
+        struct epoll_event ev;
+        ev.events   = edgeTriggered ? EPOLLIN | EPOLLRDHUP | EPOLLET : EPOLLIN;
+        ev.data.fd  = static_cast<int>(hSocket);
+        result      = (epoll_ctl( mPollHandle, EPOLL_CTL_ADD, static_cast<int>(hSocket), &ev ) == 0);
+        if ( result == false )
+        {
+            TRACE_ERR("Failed to add socket [ %d ] to poller, error code [ %p ]", static_cast<int>(hSocket), static_cast<id_type>(errno));
+        }
+    }
+
+    return result;
+}
+
+bool SocketPoller::addWriteSocket( SOCKETHANDLE hSocket )
+{
+    TRACE_SCOPE(areg_base_SocketPollerPosix_addWriteSocket);
+
+    bool result = false;
+    if ( (mPollHandle != -1) && (hSocket != NESocket::InvalidSocketHandle) )
+    {
+        struct epoll_event ev;
+        ev.events   = EPOLLOUT;
+        ev.data.fd  = static_cast<int>(hSocket);
+        result      = (epoll_ctl( mPollHandle, EPOLL_CTL_ADD, static_cast<int>(hSocket), &ev ) == 0);
+        if ( (result == false) && (errno == EEXIST) )
+        {
+            // the handle of closed socket is reused and is still registered.
+            result  = (epoll_ctl( mPollHandle, EPOLL_CTL_MOD, static_cast<int>(hSocket), &ev ) == 0);
+        }
+
+        if ( result == false )
+        {
+            TRACE_ERR("Failed to add socket [ %d ] to poller for write, error code [ %p ]", static_cast<int>(hSocket), static_cast<id_type>(errno));
+        }
+    }
+
+    return result;
+}
+
+void SocketPoller::removeSocket( SOCKETHANDLE hSocket )
+{
+    if ( (mPollHandle != -1) && (hSocket != NESocket::InvalidSocketHandle) )
+    {
+        // the event parameter is ignored, but should not be nullptr in old kernels.
+        struct epoll_event ev { };
+        epoll_ctl( mPollHandle, EPOLL_CTL_DEL, static_cast<int>(hSocket), &ev );
+    }
+}
+
+void SocketPoller::wakeUp( void )
+{
+    if ( mWakeUpHandle != -1 )
+    {
+        uint64_t value = 1;
+        ssize_t written = write( mWakeUpHandle, &value, sizeof(uint64_t) );
+        static_cast<void>(written);
+    }
+}
+
+bool SocketPoller::_osPollEvents( unsigned int timeout )
+{
+    TRACE_SCOPE(areg_base_SocketPollerPosix__osPollEvents);
+
+    bool result = false;
+    mReadyCount = 0;
+    mReadyNext  = 0;
+
+    if ( mPollHandle != -1 )
+    {
+        struct epoll_event events[SocketPoller::MAXIMUM_EVENTS];
+        int count = -1;
+        do
+        {
+            count = epoll_wait( mPollHandle, events, SocketPoller::MAXIMUM_EVENTS, timeout == NECommon::WAIT_INFINITE ? -1 : static_cast<int>(timeout) );
+        } while ( (count < 0) && (errno == EINTR) );
+
+        bool wokeUp = false;
+        for ( int i = 0; i < count; ++ i )
+        {
+            if ( events[i].data.fd == mWakeUpHandle )
+            {
+                uint64_t value = 0;
+                ssize_t received = read( mWakeUpHandle, &value, sizeof(uint64_t) );
+                static_cast<void>(received);
+                wokeUp = true;
+            }
+            else
+            {
+                mReadyList[mReadyCount ++] = static_cast<SOCKETHANDLE>(events[i].data.fd);
+            }
+        }
+
+        if ( count < 0 )
+        {
+            TRACE_ERR("Failed to wait for socket events, error code [ %p ]", static_cast<id_type>(errno));
+        }
+        else if ( wokeUp )
+        {
+            // keep the ready sockets for the next call, the edge-triggered events are not repeated.
+            TRACE_DBG("The socket poller is woken up, there are [ %d ] ready sockets", mReadyCount);
+        }
+        else
+        {
+            result = (mReadyCount > 0);
+        }
+    }
+
+    return result;
+}
+
+#else   // !defined(__linux__)
+
+bool SocketPoller::isSupported( void )
+{
+    return false;
+}
+
+bool SocketPoller::create( void )
+{
+    return false;
+}
+
+void SocketPoller::release( void )
+{
+}
+
+bool SocketPoller::addSocket( SOCKETHANDLE /*hSocket*/, bool /*edgeTriggered*/ )
+{
+    return false;
+}
+
+bool SocketPoller::addWriteSocket( SOCKETHANDLE /*hSocket*/ )
+{
+    return false;
+}
+
+void SocketPoller::removeSocket( SOCKETHANDLE /*hSocket*/ )
+{
+}
+
+void SocketPoller::wakeUp( void )
+{
+}
+
+bool SocketPoller::_osPollEvents( unsigned int /*timeout*/ )
+{
+    return false;
+}
+
+#endif  // defined(__linux__)
+
+#endif  // defined(_POSIX) || defined(POSIX)
@@ -0,0 +1,656 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/base/private/posix/SynchFutexWaitIX.cpp
+ * \ingroup     AREG SDK, Asynchronous Event Generator Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Linux futex based lock and wait object
+ *              for POSIX synchronization objects.
+ *
+ ************************************************************************/
+
+#include "areg/base/private/posix/SynchFutexWaitIX.hpp"
+
+#if defined(_POSIX) || defined(POSIX)
+
+#if defined(AREG_FUTEX_WAIT)
+
+#include "areg/base/private/posix/IEWaitableBaseIX.hpp"
+#include "areg/base/Containers.hpp"
+#include "areg/base/TEResourceMap.hpp"
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <sched.h>
+#include <errno.h>
+
+//////////////////////////////////////////////////////////////////////////
+// Local types, constants and methods
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    static_assert(sizeof(std::atomic_int) == sizeof(int), "The futex word should have size of integer");
+
+    /**
+     * \brief   The fired entry value, indicating that a thread reserved the right to fire waiting object.
+     **/
+    constexpr int   FIRED_ENTRY_RESERVED    = static_cast<int>(NESynchTypesIX::SynchObjectInvalid) - 1;
+
+    /**
+     * \brief   Blocks the calling thread while the futex word has specified value.
+     * \param   futex       The futex word.
+     * \param   value       The expected value of futex word.
+     * \param   deadline    The absolute monotonic time to wake up. If nullptr, waits infinite.
+     * \return  Returns 0 if woke up, otherwise returns error code.
+     **/
+    inline int _futexWait( std::atomic_int & futex, int value, const timespec * deadline )
+    {
+        long result = syscall( SYS_futex, reinterpret_cast<int *>(&futex), FUTEX_WAIT_BITSET_PRIVATE, value, deadline, nullptr, FUTEX_BITSET_MATCH_ANY );
+        return (result == 0 ? RETURNED_OK : errno);
+    }
+
+    /**
+     * \brief   Wakes up the thread sleeping on futex word.
+     **/
+    inline void _futexWake( std::atomic_int & futex )
+    {
+        syscall( SYS_futex, reinterpret_cast<int *>(&futex), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0 );
+    }
+
+    /**
+     * \brief   The per thread slot to keep the waiting object of the thread.
+     *          It is used to break waiting by asynchronous signal.
+     **/
+    class ThreadWaitSlot
+    {
+    public:
+        ThreadWaitSlot( void );
+        ~ThreadWaitSlot( void );
+
+        /**
+         * \brief   Sets the waiting object of the thread.
+         **/
+        inline void setWaiter( SynchFutexWaitIX * waiter )
+        {
+            pthread_mutex_lock( &mSlotLock );
+            mWaiter = waiter;
+            pthread_mutex_unlock( &mSlotLock );
+        }
+
+        /**
+         * \brief   The lock of the slot.
+         **/
+        pthread_mutex_t     mSlotLock;
+        /**
+         * \brief   The waiting object of the thread. It is nullptr if thread does not wait.
+         **/
+        SynchFutexWaitIX *  mWaiter;
+        /**
+         * \brief   The ID of the thread.
+         **/
+        const id_type       mThreadId;
+    };
+
+    /**
+     * \brief   The resource map of thread slots, where the keys are thread IDs.
+     *          The slots are registered once per thread and not on every wait.
+     **/
+    using ImplMapWaitSlot   = TEHashMapImpl<id_type, ThreadWaitSlot *>;
+    using MapWaitSlot       = TEIdHashMap<ThreadWaitSlot *, ThreadWaitSlot *, ImplMapWaitSlot>;
+    using ImplWaitSlotRes   = TEResourceMapImpl<id_type, ThreadWaitSlot>;
+    using MapWaitSlotRes    = TELockResourceMap<id_type, ThreadWaitSlot, MapWaitSlot, ImplWaitSlotRes>;
+
+    /**
+     * \brief   The map of thread slots.
+     **/
+    MapWaitSlotRes  _mapWaitSlots;
+
+    ThreadWaitSlot::ThreadWaitSlot( void )
+        : mSlotLock ( )
+        , mWaiter   ( nullptr )
+        , mThreadId ( static_cast<id_type>(pthread_self()) )
+    {
+        pthread_mutex_init( &mSlotLock, nullptr );
+        _mapWaitSlots.registerResourceObject( mThreadId, this );
+    }
+
+    ThreadWaitSlot::~ThreadWaitSlot( void )
+    {
+        _mapWaitSlots.unregisterResourceObject( mThreadId );
+        pthread_mutex_destroy( &mSlotLock );
+    }
+
+    /**
+     * \brief   Returns the wait slot of the calling thread.
+     **/
+    inline ThreadWaitSlot & _getThreadWaitSlot( void )
+    {
+        static thread_local ThreadWaitSlot _threadSlot;
+        return _threadSlot;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// SynchFutexWaitIX::WaiterList class implementation
+//////////////////////////////////////////////////////////////////////////
+
+SynchFutexWaitIX::WaiterList::WaiterList( void )
+    : mListLock     ( )
+    , mFirstNode    ( nullptr )
+    , mLastNode     ( nullptr )
+{
+    pthread_mutex_init( &mListLock, nullptr );
+}
+
+SynchFutexWaitIX::WaiterList::~WaiterList( void )
+{
+    ASSERT( mFirstNode == nullptr );
+    pthread_mutex_destroy( &mListLock );
+}
+
+//////////////////////////////////////////////////////////////////////////
+// SynchFutexWaitIX class implementation
+//////////////////////////////////////////////////////////////////////////
+
+int SynchFutexWaitIX::waitForSingleObject( IEWaitableBaseIX & synchWait, unsigned int msTimeout /* = NECommon::WAIT_INFINITE */ )
+{
+    IEWaitableBaseIX * list[] = { &synchWait };
+    return waitForMultipleObjects(list, 1, true, msTimeout);
+}
+
+int SynchFutexWaitIX::waitForMultipleObjects( IEWaitableBaseIX ** listWaitables, int count, bool waitAll /* = false */, unsigned int msTimeout /* = NECommon::WAIT_INFINITE */ )
+{
+    int result = static_cast<int>(NESynchTypesIX::SynchObjectInvalid);
+    if ( (listWaitables != nullptr) && (count > 0) )
+    {
+        SynchFutexWaitIX waiter(  listWaitables
+                                , count
+                                , waitAll && (count > 1) ? NESynchTypesIX::eMatchCondition::MatchConditionExact : NESynchTypesIX::eMatchCondition::MatchConditionAny);
+
+        if ( waiter.mCount != 0 )
+        {
+            waiter._register( );
+            if ( waiter._noEventFired( ) )
+            {
+                ThreadWaitSlot & slot = _getThreadWaitSlot( );
+                slot.setWaiter( &waiter );
+                waiter._wait( msTimeout );
+                slot.setWaiter( nullptr );
+            }
+
+            waiter._unregister( );
+        }
+
+        result = waiter.mFiredEntry.load( );
+    }
+
+    return result;
+}
+
+int SynchFutexWaitIX::eventSignaled( IEWaitableBaseIX & synchWaitable )
+{
+    int result = 0;
+
+    WaiterList & waiters = synchWaitable.mWaiters;
+    waiters._lock( );
+
+    for ( WaitNode * node = waiters.mFirstNode; node != nullptr; node = node->mNext )
+    {
+        SynchFutexWaitIX * waiter = node->mWaiter;
+        ASSERT(waiter != nullptr);
+
+        if ( synchWaitable.checkSignaled(waiter->mContext) == false )
+            break;
+
+        if ( waiter->mMatchCondition == NESynchTypesIX::eMatchCondition::MatchConditionAny )
+        {
+            if ( waiter->_reserve( ) )
+            {
+                if ( synchWaitable.notifyRequestOwnership(waiter->mContext) )
+                {
+                    ++ result;
+                    waiter->_fire( node->mIndex );
+                }
+                else
+                {
+                    waiter->_cancel( true );
+                }
+            }
+        }
+        else
+        {
+            waiter->_checkWaitAll( &waiters );
+        }
+    }
+
+    if ( result != 0 )
+    {
+        synchWaitable.notifyReleasedThreads( result );
+    }
+
+    waiters._unlock( );
+    return result;
+}
+
+void SynchFutexWaitIX::eventRemove( IEWaitableBaseIX & synchWaitable )
+{
+    WaiterList & waiters = synchWaitable.mWaiters;
+    waiters._lock( );
+
+    if ( waiters.mFirstNode != nullptr )
+    {
+        OUTPUT_ERR("The event [ %p / %s] is cleaning resource, there are still waiting threads, going to notify error."
+                    , &synchWaitable
+                    , NESynchTypesIX::getString(synchWaitable.getSynchType()));
+    }
+
+    // The waitable may be deleted right after the call, wait until all threads are released.
+    while ( waiters.mFirstNode != nullptr )
+    {
+        for ( WaitNode * node = waiters.mFirstNode; node != nullptr; node = node->mNext )
+        {
+            SynchFutexWaitIX * waiter = node->mWaiter;
+            if ( waiter->_reserve( ) )
+            {
+                waiter->_fire( node->mIndex + static_cast<int>(NESynchTypesIX::SynchObject0Error) );
+            }
+        }
+
+        waiters._unlock( );
+        sched_yield( );
+        waiters._lock( );
+    }
+
+    waiters._unlock( );
+}
+
+void SynchFutexWaitIX::eventFailed( IEWaitableBaseIX & synchWaitable )
+{
+    WaiterList & waiters = synchWaitable.mWaiters;
+    waiters._lock( );
+
+    for ( WaitNode * node = waiters.mFirstNode; node != nullptr; node = node->mNext )
+    {
+        SynchFutexWaitIX * waiter = node->mWaiter;
+        if ( waiter->_reserve( ) )
+        {
+            waiter->_fire( node->mIndex + static_cast<int>(NESynchTypesIX::SynchObject0Error) );
+        }
+    }
+
+    waiters._unlock( );
+}
+
+bool SynchFutexWaitIX::isWaitableRegistered( IEWaitableBaseIX & synchWaitable )
+{
+    return (synchWaitable.mWaiters.isEmpty() == false);
+}
+
+bool SynchFutexWaitIX::notifyAsynchSignal( id_type threadId )
+{
+    bool result = false;
+
+    _mapWaitSlots.lock( );
+    ThreadWaitSlot * slot = _mapWaitSlots.findResourceObject( threadId );
+    if ( slot != nullptr )
+    {
+        pthread_mutex_lock( &slot->mSlotLock );
+        SynchFutexWaitIX * waiter = slot->mWaiter;
+        if ( (waiter != nullptr) && waiter->_reserve( ) )
+        {
+            waiter->_fire( static_cast<int>(NESynchTypesIX::SynchAsynchSignal) );
+            result = true;
+        }
+
+        pthread_mutex_unlock( &slot->mSlotLock );
+    }
+
+    _mapWaitSlots.unlock( );
+
+    return result;
+}
+
+SynchFutexWaitIX::SynchFutexWaitIX( IEWaitableBaseIX ** listWaitables, int count, NESynchTypesIX::eMatchCondition matchCondition )
+    : mFutex            ( 0 )
+    , mFiredEntry       ( static_cast<int>(NESynchTypesIX::SynchObjectInvalid) )
+    , mRecheck          ( false )
+    , mMatchCondition   ( matchCondition )
+    , mContext          ( pthread_self() )
+    , mCount            ( 0 )
+    , mWaitingList      ( )
+    , mNodes            ( )
+    , mOrderedLists     ( )
+    , mListCount        ( 0 )
+{
+    ASSERT( listWaitables  != nullptr);
+
+    count = MACRO_MIN(NECommon::MAXIMUM_WAITING_OBJECTS, count);
+    for ( ; mCount < count; ++ mCount )
+    {
+        IEWaitableBaseIX * synchWaitable = listWaitables[mCount];
+        if ( synchWaitable == nullptr )
+        {
+            mFiredEntry.store( mCount + static_cast<int>(NESynchTypesIX::SynchObject0Error) );
+            break;
+        }
+
+        ASSERT( (static_cast<unsigned int>(synchWaitable->getSynchType()) & static_cast<unsigned int>(NESynchTypesIX::eSynchObject::SoWaitable)) != 0);
+
+        mWaitingList[mCount]    = synchWaitable;
+        WaitNode & node         = mNodes[mCount];
+        node.mWaiter            = this;
+        node.mIndex             = mCount;
+        node.mLinked            = false;
+        node.mPrev              = nullptr;
+        node.mNext              = nullptr;
+    }
+
+    if ( mMatchCondition == NESynchTypesIX::eMatchCondition::MatchConditionExact )
+    {
+        // sort the lists by address, so that all threads lock them in the same order.
+        for ( int i = 0; i < mCount; ++ i )
+        {
+            WaiterList * waiters = &mWaitingList[i]->mWaiters;
+            int pos = 0;
+            for ( ; (pos < mListCount) && (reinterpret_cast<uintptr_t>(mOrderedLists[pos]) < reinterpret_cast<uintptr_t>(waiters)); ++ pos )
+                ;
+
+            if ( (pos == mListCount) || (mOrderedLists[pos] != waiters) )
+            {
+                for ( int j = mListCount; j > pos; -- j )
+                {
+                    mOrderedLists[j] = mOrderedLists[j - 1];
+                }
+
+                mOrderedLists[pos] = waiters;
+                ++ mListCount;
+            }
+        }
+    }
+}
+
+SynchFutexWaitIX::~SynchFutexWaitIX( void )
+{
+#ifdef  DEBUG
+    for ( int i = 0; i < mCount; ++ i )
+    {
+        ASSERT( mNodes[i].mLinked == false );
+    }
+#endif  // DEBUG
+}
+
+void SynchFutexWaitIX::_register( void )
+{
+    if ( mMatchCondition == NESynchTypesIX::eMatchCondition::MatchConditionAny )
+    {
+        for ( int i = 0; (i < mCount) && _noEventFired( ); ++ i )
+        {
+            WaiterList & waiters = mWaitingList[i]->mWaiters;
+            waiters._lock( );
+            waiters._link( mNodes[i] );
+            _checkWaitable( i );
+            waiters._unlock( );
+        }
+    }
+    else
+    {
+        for ( int i = 0; i < mCount; ++ i )
+        {
+            WaiterList & waiters = mWaitingList[i]->mWaiters;
+            waiters._lock( );
+            waiters._link( mNodes[i] );
+            waiters._unlock( );
+        }
+
+        _checkWaitAll( nullptr );
+    }
+}
+
+void SynchFutexWaitIX::_unregister( void )
+{
+    // Only the waiting thread links and unlinks the nodes, no need to lock to check the flag.
+    for ( int i = 0; i < mCount; ++ i )
+    {
+        if ( mNodes[i].mLinked )
+        {
+            WaiterList & waiters = mWaitingList[i]->mWaiters;
+            waiters._lock( );
+            waiters._unlink( mNodes[i] );
+            waiters._unlock( );
+        }
+    }
+}
+
+void SynchFutexWaitIX::_wait( unsigned int msTimeout )
+{
+    timespec deadline { 0, 0 };
+    const timespec * timeout = nullptr;
+    if ( (msTimeout != NECommon::WAIT_INFINITE) && (NESynchTypesIX::POSIX_SUCCESS == clock_gettime(CLOCK_MONOTONIC, &deadline)) )
+    {
+        NESynchTypesIX::convTimeout( deadline, msTimeout );
+        timeout = &deadline;
+    }
+
+    for ( ; ; )
+    {
+        const int value = mFutex.load( );
+        if ( mRecheck.exchange( false ) )
+        {
+            if ( mMatchCondition == NESynchTypesIX::eMatchCondition::MatchConditionAny )
+            {
+                for ( int i = 0; (i < mCount) && _noEventFired( ); ++ i )
+                {
+                    WaiterList & waiters = mWaitingList[i]->mWaiters;
+                    waiters._lock( );
+                    _checkWaitable( i );
+                    waiters._unlock( );
+                }
+            }
+            else
+            {
+                _checkWaitAll( nullptr );
+            }
+        }
+
+        const int fired = mFiredEntry.load( );
+        if ( (fired != static_cast<int>(NESynchTypesIX::SynchObjectInvalid)) && (fired != FIRED_ENTRY_RESERVED) )
+        {
+            break;
+        }
+
+        int waitResult = _futexWait( mFutex, value, timeout );
+        if ( (waitResult != RETURNED_OK) && (waitResult != EAGAIN) && (waitResult != EINTR) )
+        {
+            int expected = static_cast<int>(NESynchTypesIX::SynchObjectInvalid);
+            int reason   = static_cast<int>(waitResult == ETIMEDOUT ? NESynchTypesIX::SynchObjectTimeout : NESynchTypesIX::SynchWaitInterrupted);
+            if ( mFiredEntry.compare_exchange_strong( expected, reason ) )
+            {
+                break;
+            }
+            else if ( expected == FIRED_ENTRY_RESERVED )
+            {
+                // other thread is firing right now, let it complete.
+                sched_yield( );
+            }
+        }
+    }
+}
+
+bool SynchFutexWaitIX::_checkWaitable( int index )
+{
+    bool result = false;
+    IEWaitableBaseIX * waitable = mWaitingList[index];
+
+    if ( waitable->checkSignaled(mContext) && _reserve() )
+    {
+        if ( waitable->notifyRequestOwnership(mContext) )
+        {
+            OUTPUT_DBG("Waitable [ %s ] with ID [ %p ] of type [ %s ] is signaled, going unlock thread [ %p ]"
+                        , waitable->getName()
+                        , waitable
+                        , NESynchTypesIX::getString(waitable->getSynchType())
+                        , reinterpret_cast<id_type>(mContext));
+
+            // called by waiting thread, no need to wake up
+            waitable->notifyReleasedThreads( 1 );
+            mFiredEntry.store( index );
+            result = true;
+        }
+        else
+        {
+            _cancel( false );
+        }
+    }
+
+    return result;
+}
+
+bool SynchFutexWaitIX::_checkWaitAll( WaiterList * heldList )
+{
+    bool result = false;
+    const bool notifyWaiter = (heldList != nullptr);
+
+    if ( _lockWaitAll( heldList ) )
+    {
+        int i = 0;
+        for ( ; (i < mCount) && mWaitingList[i]->checkSignaled(mContext); ++ i )
+            ;
+
+        if ( (i == mCount) && _reserve() )
+        {
+            for ( i = 0; (i < mCount) && mWaitingList[i]->notifyRequestOwnership(mContext); ++ i )
+                ;
+
+            if ( i == mCount )
+            {
+                OUTPUT_DBG("Releasing thread [ %p ], all events are fired.", reinterpret_cast<id_type>(mContext));
+                for ( i = 0; i < mCount; ++ i )
+                {
+                    mWaitingList[i]->notifyReleasedThreads( 1 );
+                }
+
+                if ( notifyWaiter )
+                {
+                    _fire( static_cast<int>(NESynchTypesIX::SynchObjectAll) );
+                }
+                else
+                {
+                    mFiredEntry.store( static_cast<int>(NESynchTypesIX::SynchObjectAll) );
+                }
+
+                result = true;
+            }
+            else
+            {
+                // return the ownership taken before the failed entry.
+                while ( i > 0 )
+                {
+                    -- i;
+                    mWaitingList[i]->notifyReleaseOwnership( mContext );
+                }
+
+                _cancel( notifyWaiter );
+            }
+        }
+
+        _unlockWaitAll( heldList );
+    }
+    else
+    {
+        // other thread holds one of the lists, the waiting thread should check again.
+        _notifyRecheck( );
+    }
+
+    return result;
+}
+
+bool SynchFutexWaitIX::_lockWaitAll( WaiterList * heldList )
+{
+    bool result = true;
+    int i = 0;
+    for ( ; (i < mListCount) && result; ++ i )
+    {
+        WaiterList * waiters = mOrderedLists[i];
+        if ( heldList == nullptr )
+        {
+            waiters->_lock( );
+        }
+        else if ( waiters != heldList )
+        {
+            result = waiters->_tryLock( );
+        }
+    }
+
+    if ( result == false )
+    {
+        // unlock the lists before the failed entry.
+        for ( -- i; i > 0; )
+        {
+            -- i;
+            if ( mOrderedLists[i] != heldList )
+            {
+                mOrderedLists[i]->_unlock( );
+            }
+        }
+    }
+
+    return result;
+}
+
+void SynchFutexWaitIX::_unlockWaitAll( WaiterList * heldList )
+{
+    for ( int i = mListCount; i > 0; )
+    {
+        -- i;
+        if ( mOrderedLists[i] != heldList )
+        {
+            mOrderedLists[i]->_unlock( );
+        }
+    }
+}
+
+inline bool SynchFutexWaitIX::_reserve( void )
+{
+    int expected = static_cast<int>(NESynchTypesIX::SynchObjectInvalid);
+    return mFiredEntry.compare_exchange_strong( expected, FIRED_ENTRY_RESERVED );
+}
+
+inline void SynchFutexWaitIX::_fire( int firedEntry )
+{
+    mFiredEntry.store( firedEntry );
+    mFutex.fetch_add( 1 );
+    _futexWake( mFutex );
+}
+
+inline void SynchFutexWaitIX::_cancel( bool notifyWaiter )
+{
+    mFiredEntry.store( static_cast<int>(NESynchTypesIX::SynchObjectInvalid) );
+    if ( notifyWaiter )
+    {
+        _notifyRecheck( );
+    }
+}
+
+inline void SynchFutexWaitIX::_notifyRecheck( void )
+{
+    mRecheck.store( true );
+    mFutex.fetch_add( 1 );
+    _futexWake( mFutex );
+}
+
+inline bool SynchFutexWaitIX::_noEventFired( void ) const
+{
+    return (mFiredEntry.load() == static_cast<int>(NESynchTypesIX::SynchObjectInvalid));
+}
+
+#endif  // defined(AREG_FUTEX_WAIT)
+
+#endif  // defined(_POSIX) || defined(POSIX)
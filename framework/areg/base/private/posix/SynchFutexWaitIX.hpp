@@ -0,0 +1,430 @@
+#pragma once
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/base/private/posix/SynchFutexWaitIX.hpp
+ * \ingroup     AREG SDK, Asynchronous Event Generator Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Linux futex based lock and wait object
+ *              for POSIX synchronization objects.
+ *
+ ************************************************************************/
+
+/************************************************************************
+ * Includes
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+
+#if defined(_POSIX) || defined(POSIX)
+
+#include "areg/base/private/posix/NESynchTypesIX.hpp"
+
+#if defined(AREG_FUTEX_WAIT)
+
+#include <pthread.h>
+#include <atomic>
+
+/************************************************************************
+ * dependencies.
+ ************************************************************************/
+class IEWaitableBaseIX;
+
+//////////////////////////////////////////////////////////////////////////
+// SynchFutexWaitIX class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   Linux specific LockAndWait object. It has the same interface and the same
+ *          wait-any / wait-all semantic as SynchLockAndWaitIX, but it does not use
+ *          global registry of waiting threads and does not create POSIX mutex and
+ *          condition variable on every wait. Instead, every waitable keeps the
+ *          list of threads waiting for it, and the waiting thread sleeps on
+ *          a futex word, which is woken by the thread signaling waitable.
+ *          The object is selected by ENABLE_FUTEX_WAIT preprocessor define,
+ *          otherwise SynchLockAndWaitIX is used.
+ **/
+class SynchFutexWaitIX
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types.
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   The node to link waiting object in the list of waitable.
+     *          Every waiting object has one node per waitable.
+     **/
+    struct WaitNode
+    {
+        /**
+         * \brief   The waiting object.
+         **/
+        SynchFutexWaitIX *  mWaiter;
+        /**
+         * \brief   The index of waitable in the waiting list of waiting object.
+         **/
+        int                 mIndex;
+        /**
+         * \brief   Flag, indicating whether the node is linked in the list of waitable.
+         **/
+        bool                mLinked;
+        /**
+         * \brief   Previous node in the list of waitable.
+         **/
+        WaitNode *          mPrev;
+        /**
+         * \brief   Next node in the list of waitable.
+         **/
+        WaitNode *          mNext;
+    };
+
+    /**
+     * \brief   The list of threads waiting for the waitable object.
+     *          Every waitable object contains one instance of the list.
+     **/
+    class WaiterList
+    {
+        friend class SynchFutexWaitIX;
+
+    public:
+        /**
+         * \brief   Initializes empty list.
+         **/
+        WaiterList( void );
+        /**
+         * \brief   Destructor.
+         **/
+        ~WaiterList( void );
+
+        /**
+         * \brief   Returns true if no thread waits for waitable.
+         **/
+        inline bool isEmpty( void ) const;
+
+    private:
+        /**
+         * \brief   Locks the list.
+         **/
+        inline void _lock( void ) const;
+        /**
+         * \brief   Unlocks the list.
+         **/
+        inline void _unlock( void ) const;
+        /**
+         * \brief   Tries to lock the list without blocking. Returns true if the list is locked.
+         **/
+        inline bool _tryLock( void ) const;
+        /**
+         * \brief   Links the node at the end of the list. The list should be locked.
+         **/
+        inline void _link( WaitNode & node );
+        /**
+         * \brief   Removes the node from the list. The list should be locked.
+         **/
+        inline void _unlink( WaitNode & node );
+
+    private:
+        /**
+         * \brief   POSIX mutex to synchronize list access.
+         **/
+        mutable pthread_mutex_t mListLock;
+        /**
+         * \brief   The first node in the list.
+         **/
+        WaitNode *              mFirstNode;
+        /**
+         * \brief   The last node in the list.
+         **/
+        WaitNode *              mLastNode;
+
+    private:
+        DECLARE_NOCOPY_NOMOVE( WaiterList );
+    };
+
+//////////////////////////////////////////////////////////////////////////
+// Public static methods.
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Call to lock the synchronization object of wait until it is released by other thread.
+     *          The parameters and return values are same as in SynchLockAndWaitIX::waitForSingleObject()
+     **/
+    static int waitForSingleObject( IEWaitableBaseIX & synchWait, unsigned int msTimeout = NECommon::WAIT_INFINITE );
+
+    /**
+     * \brief   Call to lock and wait the list of synchronization objects until one or all objects are signaled.
+     *          The parameters and return values are same as in SynchLockAndWaitIX::waitForMultipleObjects()
+     **/
+    static int waitForMultipleObjects( IEWaitableBaseIX ** listWaitables, int count, bool waitAll = false, unsigned int msTimeout = NECommon::WAIT_INFINITE);
+
+    /**
+     * \brief   Called by waitable object to indicate that it is in signaled state.
+     * \param   synchWaitable   The waitable object that is in signaled state.
+     * \return  Returns the number of threads that are notified.
+     **/
+    static int eventSignaled( IEWaitableBaseIX & synchWaitable );
+
+    /**
+     * \brief   Called by waitable object to indicate wait failure.
+     *          This call unlocks all threads that wait for event and the waiting return indicates error.
+     * \param   synchWaitable   The waitable object that should indicate error.
+     **/
+    static void eventFailed( IEWaitableBaseIX & synchWaitable );
+
+    /**
+     * \brief   Call to remove waitable object from the waiting list. All waiting threads are
+     *          released with error and the call returns when no thread refers waitable anymore.
+     * \param   synchWaitable   The waitable object to remove from the list.
+     **/
+    static void eventRemove( IEWaitableBaseIX & synchWaitable );
+
+    /**
+     * \brief   Checks whether there is any thread waiting for waitable.
+     * \param   synchWaitable   Waitable to check.
+     * \return  Returns true if waitable has waiting threads.
+     **/
+    static bool isWaitableRegistered( IEWaitableBaseIX & synchWaitable );
+
+    /**
+     * \brief   Breaks waiting of the specified thread, so that it can process asynchronous execution.
+     * \param   threadId    The ID of the thread that is going to break waiting.
+     * \return  Returns true if operation succeeded. The operation can fail if thread is not waiting.
+     **/
+    static bool notifyAsynchSignal( id_type threadId );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden constructor / destructor
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Initializes waiting object. No system resource is allocated.
+     * \param   listWaitables   The list of waitables.
+     * \param   count           The number of waitables in the list.
+     * \param   matchCondition  The signaled state matching criteria.
+     **/
+    SynchFutexWaitIX( IEWaitableBaseIX ** listWaitables, int count, NESynchTypesIX::eMatchCondition matchCondition );
+
+    /**
+     * \brief   Destructor. Makes sure that the object is not in waiting list of any waitable.
+     **/
+    ~SynchFutexWaitIX( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden operations
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Links the waiting object in the lists of waitables and checks whether
+     *          the waiting condition is already fulfilled.
+     **/
+    void _register( void );
+
+    /**
+     * \brief   Removes the waiting object from the lists of waitables.
+     **/
+    void _unregister( void );
+
+    /**
+     * \brief   Sleeps until waiting condition is fulfilled or the timeout expires.
+     * \param   msTimeout   The timeout in milliseconds to wait.
+     **/
+    void _wait( unsigned int msTimeout );
+
+    /**
+     * \brief   Checks the waitable at given index. If waitable is signaled, takes ownership
+     *          and marks it as fired. Used only in wait-any mode by the waiting thread.
+     *          The list of waitable should be locked.
+     * \param   index   The index of waitable to check.
+     * \return  Returns true if waitable is fired.
+     **/
+    bool _checkWaitable( int index );
+
+    /**
+     * \brief   Checks whether all waitables are signaled. If they are, takes ownership of all
+     *          waitables and marks the object as fired. Used only in wait-all mode.
+     *          The check is done while the lists of all waitables are locked. If the ownership
+     *          of any waitable fails, the ownership of other waitables is returned.
+     * \param   heldList    The list of signaled waitable, which is already locked by the calling
+     *                      thread. If not nullptr, the call is done by other thread and the waiting
+     *                      thread should be woken up. If nullptr, the call is done by waiting thread.
+     * \return  Returns true if all waitables are fired.
+     **/
+    bool _checkWaitAll( WaiterList * heldList );
+
+    /**
+     * \brief   Locks the lists of all waitables in the order of their addresses.
+     * \param   heldList    The list, which is already locked by the calling thread or nullptr.
+     *                      If not nullptr, the other lists are locked only if they are free,
+     *                      so that the calling thread does not lock in wrong order.
+     * \return  Returns true if all lists are locked. If fails, no list is locked by the call.
+     **/
+    bool _lockWaitAll( WaiterList * heldList );
+
+    /**
+     * \brief   Unlocks the lists locked by _lockWaitAll().
+     * \param   heldList    The list, which should remain locked or nullptr.
+     **/
+    void _unlockWaitAll( WaiterList * heldList );
+
+    /**
+     * \brief   Exclusively reserves the right to fire the waiting object.
+     * \return  Returns true if reserved. Returns false if the object is already fired
+     *          or another thread reserved the right.
+     **/
+    inline bool _reserve( void );
+
+    /**
+     * \brief   Marks the waiting object fired and wakes up waiting thread.
+     * \param   firedEntry  The fired entry to set.
+     **/
+    inline void _fire( int firedEntry );
+
+    /**
+     * \brief   Cancels the reservation.
+     * \param   notifyWaiter    If true, the call is done by other thread and the waiting
+     *                          thread should be woken up to check the list of waitables again.
+     **/
+    inline void _cancel( bool notifyWaiter );
+
+    /**
+     * \brief   Wakes up the waiting thread to check the list of waitables again.
+     **/
+    inline void _notifyRecheck( void );
+
+    /**
+     * \brief   Returns true if the waiting object is not fired yet.
+     **/
+    inline bool _noEventFired( void ) const;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden member variables.
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The futex word. It is incremented every time the waiting thread should wake up.
+     **/
+    std::atomic_int                         mFutex;
+    /**
+     * \brief   Indicates the fired event object or error code.
+     **/
+    std::atomic_int                         mFiredEntry;
+    /**
+     * \brief   Flag, indicating that the waiting thread should check waitables again.
+     **/
+    std::atomic_bool                        mRecheck;
+    /**
+     * \brief   Describes the lock and wait condition.
+     **/
+    const NESynchTypesIX::eMatchCondition   mMatchCondition;
+    /**
+     * \brief   The ID of thread that instantiated waiting object.
+     **/
+    const pthread_t                         mContext;
+    /**
+     * \brief   The number of valid entries in the list of waitables.
+     **/
+    int                                     mCount;
+    /**
+     * \brief   The list of waitables.
+     **/
+    IEWaitableBaseIX *                      mWaitingList[NECommon::MAXIMUM_WAITING_OBJECTS];
+    /**
+     * \brief   The nodes to link in the lists of waitables.
+     **/
+    WaitNode                                mNodes[NECommon::MAXIMUM_WAITING_OBJECTS];
+    /**
+     * \brief   The lists of waitables without duplicates, sorted by address. Used in wait-all mode.
+     **/
+    WaiterList *                            mOrderedLists[NECommon::MAXIMUM_WAITING_OBJECTS];
+    /**
+     * \brief   The number of entries in the sorted lists of waitables.
+     **/
+    int                                     mListCount;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls.
+//////////////////////////////////////////////////////////////////////////
+private:
+    SynchFutexWaitIX( void ) = delete;
+    DECLARE_NOCOPY_NOMOVE( SynchFutexWaitIX );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// SynchFutexWaitIX::WaiterList class inline implementation
+//////////////////////////////////////////////////////////////////////////
+
+inline bool SynchFutexWaitIX::WaiterList::isEmpty( void ) const
+{
+    _lock();
+    bool result = (mFirstNode == nullptr);
+    _unlock();
+
+    return result;
+}
+
+inline void SynchFutexWaitIX::WaiterList::_lock( void ) const
+{
+    pthread_mutex_lock( &mListLock );
+}
+
+inline void SynchFutexWaitIX::WaiterList::_unlock( void ) const
+{
+    pthread_mutex_unlock( &mListLock );
+}
+
+inline bool SynchFutexWaitIX::WaiterList::_tryLock( void ) const
+{
+    return (pthread_mutex_trylock( &mListLock ) == 0);
+}
+
+inline void SynchFutexWaitIX::WaiterList::_link( WaitNode & node )
+{
+    ASSERT(node.mLinked == false);
+    node.mPrev  = mLastNode;
+    node.mNext  = nullptr;
+    if ( mLastNode != nullptr )
+    {
+        mLastNode->mNext = &node;
+    }
+    else
+    {
+        mFirstNode = &node;
+    }
+
+    mLastNode   = &node;
+    node.mLinked= true;
+}
+
+inline void SynchFutexWaitIX::WaiterList::_unlink( WaitNode & node )
+{
+    ASSERT(node.mLinked);
+    if ( node.mPrev != nullptr )
+    {
+        node.mPrev->mNext = node.mNext;
+    }
+    else
+    {
+        mFirstNode = node.mNext;
+    }
+
+    if ( node.mNext != nullptr )
+    {
+        node.mNext->mPrev = node.mPrev;
+    }
+    else
+    {
+        mLastNode = node.mPrev;
+    }
+
+    node.mPrev  = nullptr;
+    node.mNext  = nullptr;
+    node.mLinked= false;
+}
+
+#endif  // defined(AREG_FUTEX_WAIT)
+
+#endif  // defined(_POSIX) || defined(POSIX)
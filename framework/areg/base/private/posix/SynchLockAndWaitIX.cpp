@@ -16,7 +16,7 @@
 
 #include "areg/base/private/posix/SynchLockAndWaitIX.hpp"
 
-#if defined(_POSIX) || defined(POSIX)
+#if (defined(_POSIX) || defined(POSIX)) && !defined(AREG_FUTEX_WAIT)
 
 #include "areg/base/private/posix/IEWaitableBaseIX.hpp"
 #include "areg/base/SynchObjects.hpp"
@@ -600,4 +600,4 @@ bool SynchLockAndWaitIX::_notifyAsynchSignal( void )
     return result;
 }
 
-#endif // defined(_POSIX) || defined(POSIX)
+#endif // (defined(_POSIX) || defined(POSIX)) && !defined(AREG_FUTEX_WAIT)
@@ -24,6 +24,19 @@
 
 #include "areg/base/NECommon.hpp"
 #include "areg/base/private/posix/NESynchTypesIX.hpp"
+
+#if defined(AREG_FUTEX_WAIT)
+
+#include "areg/base/private/posix/SynchFutexWaitIX.hpp"
+
+/**
+ * \brief   On Linux with ENABLE_FUTEX_WAIT the threads wait on futex,
+ *          without global registry of waiting threads.
+ **/
+using SynchLockAndWaitIX    = SynchFutexWaitIX;
+
+#else   // !defined(AREG_FUTEX_WAIT)
+
 #include "areg/base/IESynchObject.hpp"
 #include "areg/base/TEHashMap.hpp"
 #include "areg/base/TELinkedList.hpp"
@@ -438,4 +451,6 @@ private:
     DECLARE_NOCOPY_NOMOVE( SynchLockAndWaitIX );
 };
 
+#endif  // defined(AREG_FUTEX_WAIT)
+
 #endif  // defined(_POSIX) || defined(POSIX)
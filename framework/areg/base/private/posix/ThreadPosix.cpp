@@ -29,6 +29,8 @@
 #include <sched.h>
 #include <time.h> 
 #include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <sys/signal.h>
 #include <sys/unistd.h>
 #include <sys/types.h>
@@ -43,6 +45,86 @@ namespace
         pthread_attr_t  pthreadAttr;    //!< The POSIX thread attribute
     } sPosixThread;
 
+    /**
+     * \brief   Sets the stack size in the thread attribute. If the size is zero,
+     *          the default stack size is used. The size is not less than PTHREAD_STACK_MIN.
+     **/
+    inline int _setStackSize( pthread_attr_t & threadAttr, unsigned int stackSize )
+    {
+        return (stackSize != 0 ? pthread_attr_setstacksize(&threadAttr, MACRO_MAX(static_cast<size_t>(stackSize), static_cast<size_t>(PTHREAD_STACK_MIN))) : RETURNED_OK);
+    }
+
+#if defined(CPU_SETSIZE)
+
+    /**
+     * \brief   Reads the list of CPUs of the NUMA node and sets them in the CPU set.
+     *          The list has format like "0-3,8-11". Returns true if at least one CPU is set.
+     **/
+    bool _getNumaNodeCpus( int numaNode, cpu_set_t & cpuSet )
+    {
+        bool result = false;
+        char path[64];
+        snprintf(path, 64, "/sys/devices/system/node/node%d/cpulist", numaNode);
+
+        FILE * file = fopen(path, "r");
+        if ( file != nullptr )
+        {
+            char buffer[512];
+            const char * pos = fgets(buffer, 512, file);
+            while ( (pos != nullptr) && (*pos >= '0') && (*pos <= '9') )
+            {
+                char * next = nullptr;
+                long first  = strtol(pos, &next, 10);
+                long last   = first;
+                if ( *next == '-' )
+                {
+                    last = strtol(next + 1, &next, 10);
+                }
+
+                for ( long cpu = first; (cpu <= last) && (cpu < CPU_SETSIZE); ++ cpu )
+                {
+                    CPU_SET(static_cast<int>(cpu), &cpuSet);
+                    result = true;
+                }
+
+                pos = *next == ',' ? next + 1 : nullptr;
+            }
+
+            fclose(file);
+        }
+
+        return result;
+    }
+
+    /**
+     * \brief   Sets in the CPU set the CPUs to run the thread. Returns true if the
+     *          thread attributes have an affinity mask or a valid NUMA node.
+     **/
+    bool _getAffinityCpus( const Thread::sThreadAttributes & attributes, cpu_set_t & cpuSet )
+    {
+        bool result = false;
+        CPU_ZERO(&cpuSet);
+        if ( attributes.thAffinityMask != 0 )
+        {
+            for ( int cpu = 0; (cpu < 64) && (cpu < CPU_SETSIZE); ++ cpu )
+            {
+                if ( (attributes.thAffinityMask & (static_cast<uint64_t>(1u) << cpu)) != 0 )
+                {
+                    CPU_SET(cpu, &cpuSet);
+                    result = true;
+                }
+            }
+        }
+        else if ( attributes.thNumaNode >= 0 )
+        {
+            result = _getNumaNodeCpus(attributes.thNumaNode, cpuSet);
+        }
+
+        return result;
+    }
+
+#endif  // defined(CPU_SETSIZE)
+
 } // namespace
 
 /************************************************************************/
@@ -176,6 +258,7 @@ bool Thread::_createSystemThread( void )
 
             if ((RETURNED_OK == pthread_attr_init(&handle->pthreadAttr)) &&
                 (RETURNED_OK == pthread_attr_setdetachstate(&handle->pthreadAttr, PTHREAD_CREATE_DETACHED)) &&
+                (RETURNED_OK == _setStackSize(handle->pthreadAttr, mThreadAttributes.thStackSize)) &&
                 (RETURNED_OK == pthread_create(&handle->pthreadId, &handle->pthreadAttr, &Thread::_posixThreadRoutine, static_cast<void *>(this))) )
             {
                 result          = true;
@@ -200,6 +283,39 @@ bool Thread::_createSystemThread( void )
     return result;
 }
 
+void Thread::_applyThreadAttributes( void )
+{
+    pthread_t threadId = pthread_self();
+
+#if defined(CPU_SETSIZE)
+    cpu_set_t cpuSet;
+    int affinityError = _getAffinityCpus(mThreadAttributes, cpuSet) ? pthread_setaffinity_np(threadId, sizeof(cpu_set_t), &cpuSet) : RETURNED_OK;
+    if ( affinityError != RETURNED_OK )
+    {
+        OUTPUT_ERR("Cannot set CPU affinity of thread [ %s ], failed with error code [ %x ].", mThreadAddress.getThreadName().getString(), affinityError);
+    }
+#endif  // defined(CPU_SETSIZE)
+
+    if ( mThreadAttributes.thSchedPolicy != Thread::eSchedulingPolicy::SchedulingDefault )
+    {
+        int schedPolicy = mThreadAttributes.thSchedPolicy == Thread::eSchedulingPolicy::SchedulingFifo ? SCHED_FIFO : SCHED_RR;
+        int minPriority = sched_get_priority_min(schedPolicy);
+        int maxPriority = sched_get_priority_max(schedPolicy);
+
+        struct sched_param schedParam;
+        schedParam.sched_priority   = MACRO_MIN(MACRO_MAX(mThreadAttributes.thSchedPriority, minPriority), maxPriority);
+        int schedError  = pthread_setschedparam(threadId, schedPolicy, &schedParam);
+        if ( schedError != RETURNED_OK )
+        {
+            OUTPUT_ERR("Cannot set scheduling policy [ %s ] with priority [ %d ] of thread [ %s ], failed with error code [ %x ]."
+                        , Thread::getString(mThreadAttributes.thSchedPolicy)
+                        , schedParam.sched_priority
+                        , mThreadAddress.getThreadName().getString()
+                        , schedError);
+        }
+    }
+}
+
 Thread::eThreadPriority Thread::setPriority( eThreadPriority newPriority )
 {
     /**
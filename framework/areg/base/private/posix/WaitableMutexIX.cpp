@@ -115,6 +115,18 @@ bool WaitableMutexIX::notifyRequestOwnership(pthread_t ownerThread)
     return result;
 }
 
+void WaitableMutexIX::notifyReleaseOwnership(pthread_t ownerThread)
+{
+    ObjectLockIX lock(*this);
+    if ((mOwnerThread == ownerThread) && (mLockCount > 0))
+    {
+        if (-- mLockCount == 0)
+        {
+            mOwnerThread = static_cast<pthread_t>(0);
+        }
+    }
+}
+
 bool WaitableMutexIX::checkCanSignalMultipleThreads(void) const
 {
     return false;
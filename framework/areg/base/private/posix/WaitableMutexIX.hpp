@@ -110,6 +110,14 @@ public:
      **/
     virtual bool notifyRequestOwnership( pthread_t ownerThread ) override;
 
+    /**
+     * \brief   This callback is triggered to return the ownership taken by notifyRequestOwnership().
+     *          Decreases the lock count and releases the owner thread if the count reaches zero.
+     *          Does not signal waiting threads, since the ownership was not visible to them.
+     * \param   ownerThread     Indicates the POSIX thread ID that has taken the ownership.
+     **/
+    virtual void notifyReleaseOwnership( pthread_t ownerThread ) override;
+
     /**
      * \brief   This callback is triggered to when a system needs to know whether waitable
      *          can signal multiple threads. Returned 'true' value indicates that there can be
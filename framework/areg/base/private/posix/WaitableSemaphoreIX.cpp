@@ -79,6 +79,15 @@ bool WaitableSemaphoreIX::notifyRequestOwnership(pthread_t ownerThread)
     return result;
 }
 
+void WaitableSemaphoreIX::notifyReleaseOwnership(pthread_t /*ownerThread*/)
+{
+    ObjectLockIX lock(*this);
+    if (mCurCount < mMaxCount)
+    {
+        ++ mCurCount;
+    }
+}
+
 bool WaitableSemaphoreIX::checkCanSignalMultipleThreads(void) const
 {
     return true;
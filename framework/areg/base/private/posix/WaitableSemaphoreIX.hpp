@@ -104,6 +104,13 @@ public:
      **/
     virtual bool notifyRequestOwnership( pthread_t ownerThread ) override;
 
+    /**
+     * \brief   This callback is triggered to return the lock taken by notifyRequestOwnership().
+     *          Increases the count of available locks.
+     * \param   ownerThread     The ID of POSIX thread that has taken the lock.
+     **/
+    virtual void notifyReleaseOwnership( pthread_t ownerThread ) override;
+
     /**
      * \brief   This method returns true if the count is more than one. Otherwise, it returns false.
      **/
@@ -133,6 +133,115 @@ AREG_API int NESocket::sendData(SOCKETHANDLE hSocket, const unsigned char * data
     return result;
 }
 
+AREG_API int NESocket::sendDataVector( SOCKETHANDLE hSocket, const NESocket::sSocketBuffer * listBuffers, int count )
+{
+    int result = -1;
+    if ( hSocket != NESocket::InvalidSocketHandle )
+    {
+        result = 0;
+        WSABUF bufList[NESocket::MAXIMUM_SEND_BUFFERS];
+        int index = 0;
+
+        while ( (index < count) && (result >= 0) )
+        {
+            // collect next portion of non-empty buffers
+            DWORD entries = 0;
+            for ( ; (index < count) && (entries < static_cast<DWORD>(NESocket::MAXIMUM_SEND_BUFFERS)); ++ index )
+            {
+                const NESocket::sSocketBuffer & buffer = listBuffers[index];
+                if ( (buffer.sbData != nullptr) && (buffer.sbLength > 0) )
+                {
+                    bufList[entries].buf = reinterpret_cast<CHAR *>(const_cast<unsigned char *>(buffer.sbData));
+                    bufList[entries].len = static_cast<ULONG>(buffer.sbLength);
+                    ++ entries;
+                }
+            }
+
+            WSABUF * bufNext = bufList;
+            while ( entries > 0 )
+            {
+                DWORD written = 0;
+                if ( (::WSASend(hSocket, bufNext, entries, &written, 0, nullptr, nullptr) == 0) && (written > 0) )
+                {
+                    result += static_cast<int>(written);
+                    // skip completely sent buffers and adjust partially sent one
+                    while ( (entries > 0) && (written >= bufNext->len) )
+                    {
+                        written -= bufNext->len;
+                        ++ bufNext;
+                        -- entries;
+                    }
+
+                    if ( entries > 0 )
+                    {
+                        bufNext->buf += written;
+                        bufNext->len -= written;
+                    }
+                }
+                else
+                {
+                    // the sent part of data is reported, the caller detects failure by length.
+                    entries = 0;    // break loop
+                    index   = count;
+                    result  = result > 0 ? result : -1;
+                }
+            }
+        }
+    }
+    else
+    {
+        ; // invalid socket
+    }
+
+    return result;
+}
+
+AREG_API int NESocket::sendPendingDataVector( SOCKETHANDLE hSocket, const NESocket::sSocketBuffer * listBuffers, int count )
+{
+    int result = -1;
+    if ( hSocket != NESocket::InvalidSocketHandle )
+    {
+        result = 0;
+        WSABUF bufList[NESocket::MAXIMUM_SEND_BUFFERS];
+        DWORD entries = 0;
+        for ( int index = 0; (index < count) && (entries < static_cast<DWORD>(NESocket::MAXIMUM_SEND_BUFFERS)); ++ index )
+        {
+            const NESocket::sSocketBuffer & buffer = listBuffers[index];
+            if ( (buffer.sbData != nullptr) && (buffer.sbLength > 0) )
+            {
+                bufList[entries].buf = reinterpret_cast<CHAR *>(const_cast<unsigned char *>(buffer.sbData));
+                bufList[entries].len = static_cast<ULONG>(buffer.sbLength);
+                ++ entries;
+            }
+        }
+
+        if ( entries > 0 )
+        {
+            // there is no per-call non-blocking flag, send only if the socket is writable.
+            fd_set writeList;
+            FD_ZERO(&writeList);
+            FD_SET(hSocket, &writeList);
+            struct timeval noWait { 0, 0 };
+            int ready = ::select(0, nullptr, &writeList, nullptr, &noWait);
+            if ( ready > 0 )
+            {
+                DWORD written = 0;
+                result = (::WSASend(hSocket, bufList, entries, &written, 0, nullptr, nullptr) == 0) ? static_cast<int>(written) : -1;
+            }
+            else
+            {
+                result = ready == 0 ? 0 : -1;
+            }
+        }
+    }
+    else
+    {
+        ; // invalid socket
+    }
+
+    return result;
+}
+
 AREG_API int NESocket::receiveData(SOCKETHANDLE hSocket, unsigned char * dataBuffer, int dataLength, int blockMaxSize /*= NECommon::DEFAULT_SIZE*/ )
 {
     int result = -1;
@@ -187,6 +296,113 @@ AREG_API int NESocket::receiveData(SOCKETHANDLE hSocket, unsigned char * dataBuf
     return result;
 }
 
+AREG_API int NESocket::receiveAvailableData( SOCKETHANDLE hSocket, unsigned char * dataBuffer, int dataLength )
+{
+    int result = -1;
+    if ( hSocket != NESocket::InvalidSocketHandle )
+    {
+        result = 0;
+        if ( (dataBuffer != nullptr) && (dataLength > 0) )
+        {
+            result = recv(hSocket, reinterpret_cast<char *>(dataBuffer), dataLength, 0);
+            result = result >= 0 ? result : -1;
+        }
+        else
+        {
+            ; // no data to receive
+        }
+    }
+    else
+    {
+        ; // invalid socket
+    }
+
+    return result;
+}
+
+AREG_API int NESocket::receivePendingData( SOCKETHANDLE hSocket, unsigned char * dataBuffer, int dataLength )
+{
+    int result = -1;
+    if ( hSocket != NESocket::InvalidSocketHandle )
+    {
+        result = 0;
+        if ( (dataBuffer != nullptr) && (dataLength > 0) )
+        {
+            // there is no per-call non-blocking flag, receive only if data is pending.
+            // The closed connection is reported by next select.
+            int remain = static_cast<int>(NESocket::remainDataRead(hSocket));
+            if ( remain > 0 )
+            {
+                result = recv(hSocket, reinterpret_cast<char *>(dataBuffer), MACRO_MIN(remain, dataLength), 0);
+                result = result > 0 ? result : -1;
+            }
+        }
+        else
+        {
+            ; // no data to receive
+        }
+    }
+    else
+    {
+        ; // invalid socket
+    }
+
+    return result;
+}
+
+AREG_API SOCKETHANDLE NESocket::clientSocketConnectAsync( const NESocket::SocketAddress & peerAddr )
+{
+    SOCKETHANDLE result = NESocket::InvalidSocketHandle;
+    sockaddr_in remoteAddr;
+    if ( (peerAddr.isLocalSocket() == false) && peerAddr.isValid() && peerAddr.getAddress(remoteAddr) )
+    {
+        result = NESocket::socketCreate();
+        if ( result != NESocket::InvalidSocketHandle )
+        {
+            u_long nonBlocking = 1;
+            if ( (ioctlsocket(result, FIONBIO, &nonBlocking) != RETURNED_OK) ||
+                 ((connect(result, reinterpret_cast<sockaddr *>(&remoteAddr), sizeof(sockaddr_in)) != RETURNED_OK) && (WSAGetLastError() != WSAEWOULDBLOCK)) )
+            {
+                NESocket::socketClose(result);
+                result = NESocket::InvalidSocketHandle;
+            }
+        }
+    }
+
+    return result;
+}
+
+AREG_API NESocket::eConnectState NESocket::clientSocketCheckConnect( SOCKETHANDLE hSocket )
+{
+    NESocket::eConnectState result = NESocket::eConnectState::ConnectFailed;
+    if ( hSocket != NESocket::InvalidSocketHandle )
+    {
+        fd_set writeSet;
+        fd_set errorSet;
+        FD_ZERO(&writeSet);
+        FD_ZERO(&errorSet);
+        FD_SET(hSocket, &writeSet);
+        FD_SET(hSocket, &errorSet);
+        timeval noWait{ 0, 0 };
+
+        int ready = select(0, nullptr, &writeSet, &errorSet, &noWait);
+        if ( ready == 0 )
+        {
+            result = NESocket::eConnectState::ConnectPending;
+        }
+        else if ( (ready > 0) && FD_ISSET(hSocket, &writeSet) && (FD_ISSET(hSocket, &errorSet) == 0) )
+        {
+            u_long nonBlocking = 0;
+            if ( ioctlsocket(hSocket, FIONBIO, &nonBlocking) == RETURNED_OK )
+            {
+                result = NESocket::eConnectState::ConnectSucceeded;
+            }
+        }
+    }
+
+    return result;
+}
+
 AREG_API bool NESocket::disableSend(SOCKETHANDLE hSocket)
 {
     return ( hSocket != NESocket::InvalidSocketHandle ? RETURNED_OK == shutdown(hSocket, SD_SEND    ) : false );
@@ -0,0 +1,58 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/base/private/win32/SocketPollerWin32.cpp
+ * \ingroup     AREG SDK, Asynchronous Event Generator Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Socket event poller.
+ *              Windows OS specific implementation. The poller is not
+ *              supported and the server connection uses select.
+ ************************************************************************/
+#include "areg/base/SocketPoller.hpp"
+
+#ifdef  _WINDOWS
+
+bool SocketPoller::isSupported( void )
+{
+    return false;
+}
+
+bool SocketPoller::create( void )
+{
+    return false;
+}
+
+void SocketPoller::release( void )
+{
+}
+
+bool SocketPoller::addSocket( SOCKETHANDLE /*hSocket*/, bool /*edgeTriggered*/ )
+{
+    return false;
+}
+
+bool SocketPoller::addWriteSocket( SOCKETHANDLE /*hSocket*/ )
+{
+    return false;
+}
+
+void SocketPoller::removeSocket( SOCKETHANDLE /*hSocket*/ )
+{
+}
+
+void SocketPoller::wakeUp( void )
+{
+}
+
+bool SocketPoller::_osPollEvents( unsigned int /*timeout*/ )
+{
+    return false;
+}
+
+#endif  // _WINDOWS
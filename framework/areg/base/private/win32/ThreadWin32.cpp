@@ -155,9 +155,11 @@ bool Thread::_createSystemThread( void )
         mWaitForExit.resetEvent( );
 
         unsigned long threadId  = 0;
-        HANDLE handle = ::CreateThread( nullptr, 0,
+        HANDLE handle = ::CreateThread( nullptr, static_cast<SIZE_T>(mThreadAttributes.thStackSize),
                                        (LPTHREAD_START_ROUTINE)&Thread::_windowsThreadRoutine, 
-                                       static_cast<void *>(this), 0 /*CREATE_SUSPENDED*/, &threadId);
+                                       static_cast<void *>(this),
+                                       mThreadAttributes.thStackSize != 0 ? STACK_SIZE_PARAM_IS_A_RESERVATION : 0,
+                                       &threadId);
         if (handle != nullptr)
         {
             result          = true;
@@ -177,6 +179,30 @@ bool Thread::_createSystemThread( void )
     return result;
 }
 
+void Thread::_applyThreadAttributes( void )
+{
+    HANDLE handle   = ::GetCurrentThread();
+    ULONGLONG mask  = static_cast<ULONGLONG>(mThreadAttributes.thAffinityMask);
+    if ( (mask == 0) && (mThreadAttributes.thNumaNode >= 0) && (::GetNumaNodeProcessorMask(static_cast<UCHAR>(mThreadAttributes.thNumaNode), &mask) == FALSE) )
+    {
+        mask = 0;
+    }
+
+    if ( (mask != 0) && (::SetThreadAffinityMask(handle, static_cast<DWORD_PTR>(mask)) == 0) )
+    {
+        OUTPUT_ERR("Cannot set CPU affinity of thread [ %s ], failed with error code [ %x ].", mThreadAddress.getThreadName().getString(), ::GetLastError());
+    }
+
+    // Windows has no real-time scheduling policies per thread, use the time critical priority instead.
+    if ( (mThreadAttributes.thSchedPolicy != Thread::eSchedulingPolicy::SchedulingDefault) && (::SetThreadPriority(handle, THREAD_PRIORITY_TIME_CRITICAL) == FALSE) )
+    {
+        OUTPUT_ERR("Cannot set scheduling policy [ %s ] of thread [ %s ], failed with error code [ %x ]."
+                    , Thread::getString(mThreadAttributes.thSchedPolicy)
+                    , mThreadAddress.getThreadName().getString()
+                    , ::GetLastError());
+    }
+}
+
 Thread::eThreadPriority Thread::setPriority( eThreadPriority newPriority )
 {
     Lock  lock(mSynchObject);
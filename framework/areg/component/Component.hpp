@@ -241,9 +241,13 @@ public:
      * \param   consumer        Worker Thread consumer object, which
      *                          start and stop functions will be triggered.
      * \param   masterThread    The component thread, which owns worker thread,
+     * \param   attributes      The CPU affinity, NUMA node, stack size and scheduling policy of worker thread.
      * \return	Pointer to created worker thread object.
      **/
-    WorkerThread * createWorkerThread( const char * threadName, IEWorkerThreadConsumer & consumer, ComponentThread & masterThread );
+    WorkerThread * createWorkerThread( const char * threadName
+                                     , IEWorkerThreadConsumer & consumer
+                                     , ComponentThread & masterThread
+                                     , const Thread::sThreadAttributes & attributes = Thread::DEFAULT_THREAD_ATTRIBUTES );
 
     /**
      * \brief	Stops and deletes worker thread by given name
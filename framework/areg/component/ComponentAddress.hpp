@@ -24,6 +24,7 @@
 
 #include "areg/base/ThreadAddress.hpp"
 #include "areg/base/String.hpp"
+#include "areg/base/InternedString.hpp"
 
 #include <utility>
 
@@ -259,7 +260,7 @@ private:
     /**
      * \brief   Component name. Or Role Name of component
      **/
-    String          mRoleName;
+    InternedString  mRoleName;
     /**
      * \brief   Thread address object.
      **/
@@ -72,6 +72,25 @@
             /*  Begin registering component thread                                  */                          \
             NERegistry::ComponentThreadEntry  thrEntry((thread_name));
 
+/**
+ * \brief   Register thread with attributes to start component thread. Extended version.
+ *          This should be called between scopes BEGIN_MODEL and END_MODEL
+ *          instead of BEGIN_REGISTER_THREAD and ends by calling END_REGISTER_THREAD.
+ *          The attributes are applied when the model is loaded and the thread is created.
+ *
+ * \param   thread_name     The name of component thread, which should be unique.
+ * \param   affinity_mask   The mask of CPUs to run the thread, bit N is CPU N. If 0, not set.
+ * \param   numa_node       The NUMA node to run the thread if affinity mask is 0. If negative, not set.
+ * \param   stack_size      The stack size of the thread in bytes. If 0, the OS default.
+ * \param   sched_policy    The scheduling policy of the thread, one of Thread::eSchedulingPolicy values.
+ * \param   sched_priority  The priority of real-time scheduling policy.
+ **/
+#define BEGIN_REGISTER_THREAD_EX(thread_name, affinity_mask, numa_node, stack_size, sched_policy, sched_priority)   \
+        {                                                                                                       \
+            /*  Begin registering component thread with attributes                  */                          \
+            NERegistry::ComponentThreadEntry  thrEntry( (thread_name)                                           \
+                                                      , Thread::sThreadAttributes{ static_cast<uint64_t>(affinity_mask), (numa_node), (stack_size), (sched_policy), (sched_priority) } );
+
 #define END_REGISTER_THREAD(thread_name)                                                                        \
             /*  End registering component thread, add to model                      */                          \
             __model.addThread(thrEntry);                                                                        \
@@ -150,6 +169,25 @@
                 /*  Register implemented service in component                       */                          \
                 comEntry.addSupportedService( NERegistry::ServiceEntry((service_name), (implemented_version)) );
 
+/**
+ * \brief   Register implemented service in every component with direct calls
+ *          between service and clients running in the same component thread.
+ *          This should be called between BEGIN_REGISTER_COMPONENT and
+ *          END_REGISTER_COMPONENT scope instead of REGISTER_IMPLEMENT_SERVICE.
+ *          The request of a client in the same component thread is processed
+ *          by the service before the request call returns, and the response
+ *          of the service updates the client proxy before the response call
+ *          returns. The call is queued as usual if the thread has pending events,
+ *          or the request is sent while a service request is processed.
+ *          The clients in other threads and processes are not affected.
+ *
+ * \param   service_name        The name of implemented service.
+ * \param   implemented_version The version of implemented service interface.
+ **/
+#define REGISTER_IMPLEMENT_SERVICE_DIRECT(service_name, implemented_version)                                    \
+                /*  Register implemented service with direct calls in component     */                          \
+                comEntry.addSupportedService( NERegistry::ServiceEntry((service_name), (implemented_version), true) );
+
 /**
  * \brief   Register worker thread if needed by component. Optional.
  *          If component requires Worker thread, declare it within
@@ -171,6 +209,28 @@
                                             , comEntry.mRoleName.getString()                                    \
                                             , (consumer_name))  );
 
+/**
+ * \brief   Register worker thread with attributes if needed by component. Extended version.
+ *          This should be called between BEGIN_REGISTER_COMPONENT and
+ *          END_REGISTER_COMPONENT scope instead of REGISTER_WORKER_THREAD.
+ *          The attributes are applied when the worker thread is created.
+ *
+ * \param   worker_thread_name  The name of worker thread.
+ * \param   consumer_name       The consumer name of worker thread.
+ * \param   affinity_mask       The mask of CPUs to run the thread, bit N is CPU N. If 0, not set.
+ * \param   numa_node           The NUMA node to run the thread if affinity mask is 0. If negative, not set.
+ * \param   stack_size          The stack size of the thread in bytes. If 0, the OS default.
+ * \param   sched_policy        The scheduling policy of the thread, one of Thread::eSchedulingPolicy values.
+ * \param   sched_priority      The priority of real-time scheduling policy.
+ **/
+#define REGISTER_WORKER_THREAD_EX(worker_thread_name, consumer_name, affinity_mask, numa_node, stack_size, sched_policy, sched_priority) \
+                /*  Register component worker thread with attributes                */                          \
+                comEntry.addWorkerThread(     NERegistry::WorkerThreadEntry(comEntry.mThreadName.getString()    \
+                                            , (worker_thread_name)                                              \
+                                            , comEntry.mRoleName.getString()                                    \
+                                            , (consumer_name)                                                   \
+                                            , Thread::sThreadAttributes{ static_cast<uint64_t>(affinity_mask), (numa_node), (stack_size), (sched_policy), (sched_priority) } ) );
+
 /**
  * \brief   Declare and register component dependency. Optional.
  *          If registered component has dependency on other
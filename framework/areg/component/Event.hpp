@@ -508,6 +508,16 @@ protected:
      **/
     DispatcherThread*   mTargetThread;
 
+private:
+    /**
+     * \brief   The link to the next event in the lock-free event queue.
+     *          Used only by intrusive LockFreeEventQueue, an event object
+     *          can be queued only in one queue at a time.
+     **/
+    Event *             mNextEvent;
+
+    friend class LockFreeEventQueue;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden method calls.
 //////////////////////////////////////////////////////////////////////////
@@ -167,6 +167,14 @@ public:
      **/
     inline IEOutStream & getStreamForWrite( void );
 
+    /**
+     * \brief   Reserves space in the data buffer to stream data. Call it before writing parameters
+     *          if the size of streamed data is known in advance, for example, the data contains
+     *          only fixed-size parameters. It avoids reallocations of buffer while data is streamed.
+     * \param   sizeHint    The size in bytes of data, which is going to be streamed.
+     **/
+    inline void reserve( unsigned int sizeHint );
+
 /************************************************************************/
 // IEInStream interface overrides
 /************************************************************************/
@@ -344,3 +352,8 @@ inline IEOutStream & EventDataStream::getStreamForWrite( void )
 {
     return static_cast<IEOutStream &>(*this);
 }
+
+inline void EventDataStream::reserve( unsigned int sizeHint )
+{
+    mDataBuffer.reserve( sizeHint );
+}
@@ -24,6 +24,7 @@
 #include "areg/base/TELinkedList.hpp"
 #include "areg/base/String.hpp"
 #include "areg/base/NEMemory.hpp"
+#include "areg/base/Thread.hpp"
 
 /************************************************************************
  * Declared classes
@@ -122,7 +123,7 @@ namespace NERegistry
          *          Creates invalid Service Entry and required by Array List object.
          *          Invalid Service Entry has name NERegistry::INVALID_SERVICE_ENTRY_NAME
          **/
-        ServiceEntry( void ) = default;
+        ServiceEntry( void );
 
         /**
          * \brief   Initialize service entry by given name and version numbers.
@@ -144,8 +145,11 @@ namespace NERegistry
          * \param   serviceName The name of service interface
          * \param   version     The version object of implemented service interface,
          *                      containing major, minor and patch version numbers
+         * \param   directCall  If true, the requests and the responses between the
+         *                      service and the clients running in the same component
+         *                      thread are processed directly, without event queue.
          **/
-        ServiceEntry( const char* serviceName, const Version & version );
+        ServiceEntry( const char* serviceName, const Version & version, bool directCall = false );
 
         /**
          * \brief   Copies data from given source.
@@ -210,6 +214,13 @@ namespace NERegistry
          * \brief   The Version of implemented Service.
          **/
         Version   mVersion;
+
+        /**
+         * \brief   Flag, indicating whether the requests and the responses between
+         *          the service and the clients in the same component thread are
+         *          processed directly in the context of the call, without event queue.
+         **/
+        bool      mDirectCall;
     };
 
     //////////////////////////////////////////////////////////////////////////
@@ -331,7 +342,7 @@ namespace NERegistry
         /**
          * \brief   Creates invalid Worker Thread Entry.
          **/
-        WorkerThreadEntry( void ) = default;
+        WorkerThreadEntry( void );
 
         /**
          * \brief   Initialize Worker Thread Entry by given name and specifying the name of Master Thread.
@@ -344,8 +355,10 @@ namespace NERegistry
          * \param   workerThreadName    The name of Worker Thread of Component. The name should be unique.
          * \param   compRoleName        The name of Component (Role Name) where consumer is registered.
          * \param   compConsumerName    The name of Consumer object to configure, it should not be same as Component name.
+         * \param   attributes          The CPU affinity, NUMA node, stack size and scheduling policy of the Worker Thread.
          **/
-        WorkerThreadEntry( const char * masterThreadName, const char* workerThreadName, const char * compRoleName, const char* compConsumerName );
+        WorkerThreadEntry( const char * masterThreadName, const char* workerThreadName, const char * compRoleName, const char* compConsumerName
+                         , const Thread::sThreadAttributes & attributes = Thread::DEFAULT_THREAD_ATTRIBUTES );
 
         /**
          * \brief   Copies entries from given source.
@@ -409,6 +422,11 @@ namespace NERegistry
          * \brief   The name of Worker Thread Consumer.
          **/
         String mConsumerName;
+
+        /**
+         * \brief   The attributes applied when Worker Thread is created.
+         **/
+        Thread::sThreadAttributes   mThreadAttributes;
    };
 
     //////////////////////////////////////////////////////////////////////////
@@ -1235,7 +1253,7 @@ namespace NERegistry
         /**
          * \brief   Creates invalid Thread Entry.
          **/
-        ComponentThreadEntry( void ) = default;
+        ComponentThreadEntry( void );
 
         /**
          * \brief   Initialize Thread Entry with given Thread Name.
@@ -1243,6 +1261,13 @@ namespace NERegistry
          **/
         explicit ComponentThreadEntry( const char* threadName );
 
+        /**
+         * \brief   Initialize Component Thread Entry by given name and thread attributes.
+         * \param   threadName  The name of Component Thread.
+         * \param   attributes  The CPU affinity, NUMA node, stack size and scheduling policy of the Component Thread.
+         **/
+        ComponentThreadEntry( const char* threadName, const Thread::sThreadAttributes & attributes );
+
         /**
          * \brief   Initialize Thread Entry with given Thread Name and given Component List.
          * \param   threadName      The Thread Name to assign.
@@ -1399,6 +1424,11 @@ namespace NERegistry
          * \brief   List of component entries
          **/
         ComponentList   mComponents;
+
+        /**
+         * \brief   The attributes applied when Component Thread is created.
+         **/
+        Thread::sThreadAttributes   mThreadAttributes;
     };
 
     //////////////////////////////////////////////////////////////////////////
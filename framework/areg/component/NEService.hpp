@@ -234,6 +234,7 @@ namespace NEService
           CookieInvalid     = 0     //!< Invalid cookie value
         , CookieLocal       = 1     //!< Valid cookie value of local services
         , CookieRouter      = 2     //!< Valid cookie value of Routing Service
+        , CookieMulticast   = 3     //!< The target of message, which is forwarded by Routing Service to several remote services
         , CookieAny         = 255   //!< Any valid cookie
         , CookieFirstValid  = 256   //!< First valid cookie of any other remote service
     } eCookies;
@@ -258,6 +259,11 @@ namespace NEService
      *          Indicates any valid cookie
      **/
     const ITEM_ID   COOKIE_ANY          = static_cast<ITEM_ID>(NEService::eCookies::CookieAny);
+    /**
+     * \brief   NEService::HANDLE_INVALID
+     *          Invalid handle of interned proxy or stub address.
+     **/
+    const unsigned int  HANDLE_INVALID  = 0u;
     /**
      * \brief   NEService::TARGET_UNKNOWN
      *          The unknown target ID
@@ -268,6 +274,11 @@ namespace NEService
      *          The local target ID
      **/
     const ITEM_ID   TARGET_LOCAL        = static_cast<ITEM_ID>(NEService::eCookies::CookieLocal);
+    /**
+     * \brief   NEService::TARGET_MULTICAST
+     *          The target ID of message multicast to several remote services
+     **/
+    const ITEM_ID   TARGET_MULTICAST    = static_cast<ITEM_ID>(NEService::eCookies::CookieMulticast);
     /**
      * \brief   NEService::SOURCE_UNKNOWN
      *          The unknown source ID
@@ -410,6 +421,10 @@ namespace NEService
         , ServiceRouterQuery
         //!< Sent by Routing Service as a reply to register service and notifies the the registered service availability
         , ServiceRouterNotifyRegister
+        //!< Sent via local connection instead of message, which data is passed via shared memory
+        , ServiceRouterSharedData
+        //!< Sent by Routing Service to notify the source of messages that the target connection is congested or recovered
+        , ServiceRouterNotifyCongestion
         //!< The last ID of service calls.
         , ServiceLastId         = SERVICE_ID_LAST  //!< Servicing call last ID
 
@@ -1321,6 +1336,10 @@ inline const char * NEService::getString( NEService::eFuncIdRange funcId )
         return "NEService::eFuncIdRange::ServiceRouterQuery";
     case NEService::eFuncIdRange::ServiceRouterNotifyRegister:
         return "NEService::eFuncIdRange::ServiceRouterNotifyRegister";
+    case NEService::eFuncIdRange::ServiceRouterSharedData:
+        return "NEService::eFuncIdRange::ServiceRouterSharedData";
+    case NEService::eFuncIdRange::ServiceRouterNotifyCongestion:
+        return "NEService::eFuncIdRange::ServiceRouterNotifyCongestion";
     case NEService::eFuncIdRange::RequestFirstId:
         return "NEService::eFuncIdRange::RequestFirstId";
     case NEService::eFuncIdRange::ResponseFirstId:
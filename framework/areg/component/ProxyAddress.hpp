@@ -198,6 +198,23 @@ public:
      **/
     friend AREG_API IEOutStream & operator << ( IEOutStream & stream, const ProxyAddress & output);
 
+    /**
+     * \brief   Writes the interned proxy address into the stream. If the address has a handle,
+     *          writes only the handle and the cookie, so that the receiver finds the address
+     *          in the table of registered addresses. Otherwise, writes the complete address.
+     * \param   stream      The streaming object to write data.
+     * \param   complete    If true, writes the complete address even if it has a handle.
+     **/
+    void writeInterned( IEOutStream & stream, bool complete = false ) const;
+
+    /**
+     * \brief   Reads the proxy address written by writeInterned() method. If the stream
+     *          contains only the handle and the cookie, searches the address in the
+     *          table of registered addresses. If the address is not found, it is invalid.
+     * \param   stream  The streaming object to read data.
+     **/
+    void readInterned( const IEInStream & stream );
+
 //////////////////////////////////////////////////////////////////////////
 // Attributes
 //////////////////////////////////////////////////////////////////////////
@@ -244,6 +261,15 @@ public:
      * \brief   Sets Proxy source ID
      **/
     inline void setSource( ITEM_ID source );
+    /**
+     * \brief   Returns the handle of interned address, unique in the owner process.
+     *          The handle is NEService::HANDLE_INVALID if the address is not interned.
+     **/
+    inline unsigned int getHandle( void ) const;
+    /**
+     * \brief   Sets the handle of interned address.
+     **/
+    inline void setHandle( unsigned int handle );
     /**
      * \brief   Returns Proxy target ID
      **/
@@ -336,11 +362,15 @@ private:
     /**
      * \brief   Thread name of Proxy
      **/
-    String          mThreadName;
+    InternedString  mThreadName;
     /**
      * \brief   Communication channel of Proxy.
      **/
     Channel         mChannel;
+    /**
+     * \brief   The handle of interned address, unique in the owner process.
+     **/
+    unsigned int    mHandle;
 
 //////////////////////////////////////////////////////////////////////////
 // Hidden members
@@ -368,6 +398,7 @@ inline ProxyAddress & ProxyAddress::operator = ( const ProxyAddress & source )
         static_cast<ServiceAddress &>(*this) = static_cast<const ServiceAddress &>(source);
         mThreadName = source.mThreadName;
         mChannel    = source.mChannel;
+        mHandle     = source.mHandle;
         mMagicNum   = source.mMagicNum;
     }
 
@@ -381,6 +412,7 @@ inline ProxyAddress & ProxyAddress::operator = ( ProxyAddress && source )noexcep
         static_cast<ServiceAddress &>(*this) = static_cast<ServiceAddress &&>(source);
         mThreadName = std::move(source.mThreadName);
         mChannel    = std::move(source.mChannel);
+        mHandle     = source.mHandle;
         mMagicNum   = source.mMagicNum;
     }
 
@@ -437,6 +469,16 @@ inline void ProxyAddress::setCookie( ITEM_ID cookie )
     mChannel.setCookie(cookie);
 }
 
+inline unsigned int ProxyAddress::getHandle( void ) const
+{
+    return mHandle;
+}
+
+inline void ProxyAddress::setHandle( unsigned int handle )
+{
+    mHandle = handle;
+}
+
 inline ITEM_ID ProxyAddress::getSource( void ) const
 {
     return mChannel.getSource();
@@ -222,7 +222,7 @@ private:
     /**
      * \brief   Proxy map helper functions implementation.
      **/
-    class ImplProxyMap   : public TEHashMapImpl<const ProxyAddress &, ProxyBase *>
+    class ImplProxyMap   : public TEOpenHashMapImpl<const ProxyAddress &, ProxyBase *>
     {
     public:
 
@@ -956,6 +956,13 @@ protected:
      **/
     bool                    mIsStopped;
 
+    /**
+     * \brief   Flag, indicating whether the connected stub runs in the same
+     *          component thread and is registered for direct calls. In this
+     *          case the stub may process the requests in the context of the call.
+     **/
+    bool                    mDirectCall;
+
     /**
      * \brief   Proxy data, containing service interface information
      *          attribute and parameter update state.
@@ -1003,6 +1010,16 @@ private:
      **/
     inline ProxyBase & self( void );
 
+    /**
+     * \brief   Delivers the request event to the stub. If the stub is registered for
+     *          direct calls and runs in the same thread, the stub processes the event
+     *          before the call returns, unless the thread has pending events or a
+     *          stub request is in process. Otherwise, queues the event in the event
+     *          queue of the stub thread.
+     * \param   eventElem   The request event to deliver.
+     **/
+    void _deliverRequestEvent( ServiceRequestEvent & eventElem );
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
 //////////////////////////////////////////////////////////////////////////
@@ -18,6 +18,7 @@
  * Include files.
  ************************************************************************/
 #include "areg/base/GEGlobal.h"
+#include "areg/base/TEArrayList.hpp"
 
 /************************************************************************
  * Dependencies
@@ -61,6 +62,20 @@ public:
      **/
     static StreamableEvent * createEventFromStream( const RemoteMessage & stream, const Channel & comChannel );
 
+    /**
+     * \brief   Call to create events of multicast message from streaming object.
+     *          The multicast message is forwarded by router to every connection,
+     *          which has proxies to notify. The message contains the addresses of
+     *          subscribed proxies followed by event data. An event is created for
+     *          every listed proxy of the process, the other proxies of the service
+     *          are not notified. After processing, the events are automatically deleted by dispatcher.
+     * \param   stream          The streaming object of multicast message containing event data.
+     * \param   comChannel      The communication channel object to send event.
+     * \param   out_listEvents  On output, contains the list of created remote event objects.
+     * \return  Returns the number of created events.
+     **/
+    static int createEventsFromMulticast( const RemoteMessage & stream, const Channel & comChannel, TEArrayList<StreamableEvent *, StreamableEvent *> & OUT out_listEvents );
+
     /**
      * \brief   Call to serialize remote event object to streaming object.
      *          The specified event should be remote type. Otherwise, event data
@@ -71,6 +86,10 @@ public:
      * \param   comChannel      The communication channel object to send event.
      * \return  Returns true if successfully recognized remote object and could
      *          serialize to streaming object. Otherwise, it returns false.
+     * \note    The multicast response event is streamed with the list of cookies
+     *          of target connections, the list of addresses of target proxies and
+     *          the event data. The router removes the list of cookies and forwards
+     *          the rest to every listed connection.
      **/
     static bool createStreamFromEvent( RemoteMessage & stream, const StreamableEvent & eventStreamable, const Channel & comChannel );
 
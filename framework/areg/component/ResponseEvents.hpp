@@ -345,6 +345,13 @@ protected:
      **/
     inline void setTargetChannel( const Channel & channel );
 
+    /**
+     * \brief   Sets the address of target proxy. Used when the event is created
+     *          from multicast message, which contains the address of other proxy.
+     * \param   target      The address of target proxy to set in remote event.
+     **/
+    inline void setTargetProxy( const ProxyAddress & target );
+
     /**
      * \brief   Returns the event communication channel object.
      **/
@@ -396,6 +403,11 @@ inline void RemoteResponseEvent::setTargetChannel(const Channel & channel)
     mTargetProxyAddress.setChannel(channel);
 }
 
+inline void RemoteResponseEvent::setTargetProxy( const ProxyAddress & target )
+{
+    mTargetProxyAddress = target;
+}
+
 inline const Channel & RemoteResponseEvent::getTargetChannel( void ) const
 {
     return mTargetProxyAddress.getChannel();
@@ -229,7 +229,7 @@ protected:
     /**
      * \brief   The role name of service address.
      **/
-    String          mRoleName;
+    InternedString  mRoleName;
 
 //////////////////////////////////////////////////////////////////////////
 // Hidden members
@@ -291,8 +291,7 @@ inline const String & ServiceAddress::getRoleName(void) const
 
 inline void ServiceAddress::setRoleName(const char * roleName)
 {
-    mRoleName = roleName;
-    mRoleName.truncate(NEUtilities::ITEM_NAMES_MAX_LENGTH);
+    mRoleName = InternedString(roleName, NEUtilities::ITEM_NAMES_MAX_LENGTH);
     mMagicNum = ServiceAddress::_magicNumber(*this);
 }
 
@@ -18,6 +18,7 @@
  ************************************************************************/
 #include "areg/base/GEGlobal.h"
 #include "areg/base/String.hpp"
+#include "areg/base/InternedString.hpp"
 #include "areg/base/Version.hpp"
 #include "areg/base/NEUtilities.hpp"
 #include "areg/component/NEService.hpp"
@@ -254,7 +255,7 @@ protected:
     /**
      * \brief   Service name
      **/
-    String                  mServiceName;
+    InternedString          mServiceName;
     /**
      * \brief   Service Version
      **/
@@ -285,8 +286,7 @@ inline const String & ServiceItem::getServiceName( void ) const
 
 inline void ServiceItem::setServiceName( const char * serviceName )
 {
-    mServiceName = serviceName;
-    mServiceName.truncate(NEUtilities::ITEM_NAMES_MAX_LENGTH);
+    mServiceName = InternedString(serviceName, NEUtilities::ITEM_NAMES_MAX_LENGTH);
     mMagicNum    = ServiceItem::_magicNumber(*this);
 }
 
@@ -22,6 +22,7 @@
 #include "areg/base/GEGlobal.h"
 #include "areg/component/ProxyEvent.hpp"
 #include "areg/component/NEService.hpp"
+#include "areg/base/TEArrayList.hpp"
 
 /************************************************************************
  * Dependencies.
@@ -49,6 +50,13 @@ class AREG_API ServiceResponseEvent    : public ProxyEvent
 //////////////////////////////////////////////////////////////////////////
 // Internal defines
 //////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   ServiceResponseEvent::ListTargets
+     *          The list of addresses of remote proxies to multicast the event.
+     **/
+    using ListTargets   = TEArrayList<ProxyAddress, const ProxyAddress &>;
+
 protected:
     /**
      * \todo        <b>TODO :</b> remove version object from here and place
@@ -126,6 +134,27 @@ public:
      **/
     inline void setSequenceNumber( unsigned int newSeqNr );
 
+    /**
+     * \brief   Returns true if the event is multicast, i.e. it is serialized once
+     *          and the router forwards it to the every remote connection in the
+     *          list of multicast targets.
+     **/
+    inline bool isMulticast( void ) const;
+
+    /**
+     * \brief   Returns the list of addresses of remote proxies to multicast the event.
+     **/
+    inline const ServiceResponseEvent::ListTargets & getMulticastTargets( void ) const;
+
+    /**
+     * \brief   Sets the list of addresses of remote proxies to multicast the event.
+     *          The list is not streamed with the event data and it is not copied
+     *          when the event is cloned.
+     * \param   targets     The list of addresses of remote proxies. If the list
+     *                      is empty, the event is sent only to the target proxy.
+     **/
+    inline void setMulticastTargets( const ServiceResponseEvent::ListTargets & targets );
+
 //////////////////////////////////////////////////////////////////////////
 // Overrides
 //////////////////////////////////////////////////////////////////////////
@@ -181,6 +210,11 @@ protected:
      **/
     unsigned int            mSequenceNr;
 
+    /**
+     * \brief   The list of addresses of remote proxies to multicast the event.
+     **/
+    ListTargets             mMulticastTargets;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
 //////////////////////////////////////////////////////////////////////////
@@ -212,3 +246,18 @@ inline void ServiceResponseEvent::setSequenceNumber( unsigned int newSeqNr )
 {
     mSequenceNr = newSeqNr;
 }
+
+inline bool ServiceResponseEvent::isMulticast( void ) const
+{
+    return (mMulticastTargets.isEmpty() == false);
+}
+
+inline const ServiceResponseEvent::ListTargets & ServiceResponseEvent::getMulticastTargets( void ) const
+{
+    return mMulticastTargets;
+}
+
+inline void ServiceResponseEvent::setMulticastTargets( const ServiceResponseEvent::ListTargets & targets )
+{
+    mMulticastTargets = targets;
+}
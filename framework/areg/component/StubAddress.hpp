@@ -20,6 +20,7 @@
 #include "areg/base/GEGlobal.h"
 #include "areg/component/ServiceAddress.hpp"
 #include "areg/component/Channel.hpp"
+#include "areg/component/NEService.hpp"
 
 #include <utility>
 
@@ -217,6 +218,23 @@ public:
      **/
     friend AREG_API IEOutStream & operator << ( IEOutStream & stream, const StubAddress & output);
 
+    /**
+     * \brief   Writes the interned stub address into the stream. If the address has a handle,
+     *          writes only the handle and the cookie, so that the receiver finds the address
+     *          in the table of registered addresses. Otherwise, writes the complete address.
+     * \param   stream      The streaming object to write data.
+     * \param   complete    If true, writes the complete address even if it has a handle.
+     **/
+    void writeInterned( IEOutStream & stream, bool complete = false ) const;
+
+    /**
+     * \brief   Reads the stub address written by writeInterned() method. If the stream
+     *          contains only the handle and the cookie, searches the address in the
+     *          table of registered addresses. If the address is not found, it is invalid.
+     * \param   stream  The streaming object to read data.
+     **/
+    void readInterned( const IEInStream & stream );
+
 //////////////////////////////////////////////////////////////////////////
 // Attributes and operations
 //////////////////////////////////////////////////////////////////////////
@@ -260,6 +278,15 @@ public:
      * \brief   Sets the ID of source in communication channel.
      **/
     inline void setSource( ITEM_ID source );
+    /**
+     * \brief   Returns the handle of interned address, unique in the owner process.
+     *          The handle is NEService::HANDLE_INVALID if the address is not interned.
+     **/
+    inline unsigned int getHandle( void ) const;
+    /**
+     * \brief   Sets the handle of interned address.
+     **/
+    inline void setHandle( unsigned int handle );
 
     /**
      * \brief   Returns the service owner thread name.
@@ -336,11 +363,15 @@ private:
     /**
      * \brief   The name of owner thread.
      **/
-    String          mThreadName;
+    InternedString  mThreadName;
     /**
      * \brief   The communication channel.
      **/
     Channel         mChannel;
+    /**
+     * \brief   The handle of interned address, unique in the owner process.
+     **/
+    unsigned int    mHandle;
 
 private:
     /**
@@ -364,6 +395,7 @@ inline StubAddress & StubAddress::operator = ( const StubAddress & source )
         static_cast<ServiceAddress &>(*this) = static_cast<const ServiceAddress &>(source);
         mThreadName = source.mThreadName;
         mChannel    = source.mChannel;
+        mHandle     = source.mHandle;
         mMagicNum   = source.mMagicNum;
     }
 
@@ -377,6 +409,7 @@ inline StubAddress & StubAddress::operator = ( StubAddress && source ) noexcept
         static_cast<ServiceAddress &>(*this) = static_cast<ServiceAddress &&>(source);
         mThreadName = std::move(source.mThreadName);
         mChannel    = std::move(source.mChannel);
+        mHandle     = source.mHandle;
         mMagicNum   = source.mMagicNum;
     }
 
@@ -390,6 +423,7 @@ inline StubAddress & StubAddress::operator = (const ServiceAddress & addrService
         static_cast<ServiceAddress &>(*this) = static_cast<const ServiceAddress &>(addrService);
         mThreadName = "";
         mChannel    = Channel();
+        mHandle     = NEService::HANDLE_INVALID;
         mMagicNum   = StubAddress::_magicNumber(*this);
     }
 
@@ -403,6 +437,7 @@ inline StubAddress & StubAddress::operator = ( ServiceAddress && addrService ) n
         static_cast<ServiceAddress &>(*this) = static_cast<ServiceAddress &&>(addrService);
         mThreadName = "";
         mChannel    = Channel( );
+        mHandle     = NEService::HANDLE_INVALID;
         mMagicNum   = StubAddress::_magicNumber( *this );
     }
 
@@ -464,6 +499,16 @@ inline void StubAddress::setCookie( ITEM_ID cookie )
     mChannel.setCookie(cookie);
 }
 
+inline unsigned int StubAddress::getHandle( void ) const
+{
+    return mHandle;
+}
+
+inline void StubAddress::setHandle( unsigned int handle )
+{
+    mHandle = handle;
+}
+
 inline ITEM_ID StubAddress::getSource( void ) const
 {
     return mChannel.getSource();
@@ -253,6 +253,13 @@ public:
      **/
     const StubAddress & getAddress( void ) const;
 
+    /**
+     * \brief   Returns true if the service is registered in the model for direct
+     *          delivery of events between the stub and the proxies running in the
+     *          same component thread.
+     **/
+    inline bool isDirectCall( void ) const;
+
     /**
      * \brief   Sends error event to all pending responses and notification updates
      **/
@@ -584,6 +591,8 @@ protected:
     /**
      * \brief   Sends attribute update notification message to all
      *          listed listeners, containing target proxy addresses.
+     *          If there are several remote listeners, the notification
+     *          is serialized once and multicast to remote connections.
      * \param   whichListeners  The list of listeners, containing
      *                          address of proxy to send update notification.
      * \param   eventElem       The event message to send, which contains 
@@ -594,7 +603,10 @@ protected:
 
     /**
      * \brief   Sends Service Response message to trigger response call 
-     *          on Proxy and Clients side
+     *          on Proxy and Clients side. If the service is registered for direct
+     *          calls and the target proxy runs in the same component thread, the
+     *          proxy processes the event before the call returns, unless the thread
+     *          has pending events. The clients are notified as usual.
      * \param   eventElem   Service response event to send.
      **/
     void sendServiceResponse( ServiceResponseEvent & eventElem ) const;
@@ -695,6 +707,12 @@ private:
      **/
     unsigned int                        mSessionId;
 
+    /**
+     * \brief   Flag, indicating whether the events between the stub and the proxies
+     *          in the same component thread are processed directly.
+     **/
+    const bool                          mDirectCall;
+
 private:
 #if defined(_MSC_VER) && (_MSC_VER > 1200)
     #pragma warning(disable: 4251)
@@ -721,6 +739,14 @@ private:
      **/
     inline StubBase & self( void );
 
+    /**
+     * \brief   Returns true if the service of the stub is registered in the model
+     *          of the component for direct delivery of events.
+     * \param   masterComp  The component object, which holds the stub.
+     * \param   siData      The service interface data of the stub.
+     **/
+    static bool _isDirectCallService( Component & masterComp, const NEService::SInterfaceData & siData );
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
 //////////////////////////////////////////////////////////////////////////
@@ -811,3 +837,8 @@ inline StubBase & StubBase::self( void )
 {
     return (*this);
 }
+
+inline bool StubBase::isDirectCall( void ) const
+{
+    return mDirectCall;
+}
@@ -25,6 +25,7 @@
  ************************************************************************/
 #include "areg/base/GEGlobal.h"
 #include "areg/component/private/ThreadEventBase.hpp"
+#include "areg/component/private/EventPool.hpp"
 
 #include "areg/component/WorkerThread.hpp"
 
@@ -344,6 +345,10 @@ public:
     /* \brief	Returns read-only event data.                                                                               **/                     \
     /**                                                                                                                     **/                     \
     inline const DATA_CLASS & getData( void ) const;                                                                                                \
+    /**                                                                                                                     **/                     \
+    /** \brief  Declares the pool of event class. The objects are allocated in the pool and released by Event::destroy().   **/                     \
+    /**                                                                                                                     **/                     \
+    DECLARE_EVENT_POOL(__##EventClass, #EventClass)                                                                                                 \
 protected:                                                                                                                                          \
     /**                                                                                                                     **/                     \
     /** \brief  Event data. Class or simple object, which has copy constructor and assignment operator.                     **/                     \
@@ -48,6 +48,7 @@ class AREG_API Timer
 
     friend class TimerInfo;
     friend class TimerEvent;
+    friend class TimerBatchEvent;
 
 //////////////////////////////////////////////////////////////////////////
 // Predefined constants and types
@@ -78,6 +79,12 @@ public:
      **/
     static constexpr int            IGNORE_TIMER_QUEUE    = static_cast<int>(0);            /*0x00000000*/
 
+    /**
+     * \brief   Timer::NO_SLACK
+     *          The timer is not allowed to be delayed to coalesce with other timers.
+     **/
+    static constexpr unsigned int   NO_SLACK            = static_cast<unsigned int>(0);    /*0x00000000*/
+
     /**
      * \brief   1 millisecond
      **/
@@ -157,9 +164,12 @@ public:
      *                      until it will not be stopped manually.
      *                      Otherwise, timer will be triggered until event count 
      *                      reached specified number.
+     * \param   slackInMs   The time in milliseconds the timer event is allowed to be delayed.
+     *                      The system may use it to coalesce the timers with nearby timeouts
+     *                      and fire them at once. If zero, the timer fires at exact timeout.
      * \return  Returns true if Timer was successfully started.
      **/
-    bool startTimer(unsigned int timeoutInMs, unsigned int eventCount = Timer::CONTINUOUSLY);
+    bool startTimer(unsigned int timeoutInMs, unsigned int eventCount = Timer::CONTINUOUSLY, unsigned int slackInMs = Timer::NO_SLACK);
 
     /**
      * \brief   Call to start timer. The system will send and the
@@ -180,9 +190,12 @@ public:
      *                      until it will not be stopped manually.
      *                      Otherwise, timer will be triggered until event count is not
      *                      reaching specified number.
+     * \param   slackInMs   The time in milliseconds the timer event is allowed to be delayed.
+     *                      The system may use it to coalesce the timers with nearby timeouts
+     *                      and fire them at once. If zero, the timer fires at exact timeout.
      * \return  Returns true if Timer was successfully started.
      **/
-    bool startTimer(unsigned int timeoutInMs, DispatcherThread & whichThread, unsigned int eventCount = Timer::CONTINUOUSLY);
+    bool startTimer(unsigned int timeoutInMs, DispatcherThread & whichThread, unsigned int eventCount = Timer::CONTINUOUSLY, unsigned int slackInMs = Timer::NO_SLACK);
 
     /**
      * \brief   Call to stop previously started timer.
@@ -230,6 +243,12 @@ public:
      **/
     inline unsigned int getTimeout( void ) const;
 
+    /**
+     * \brief   Returns the time in milliseconds the timer event is allowed to be delayed
+     *          to coalesce with other timers. Returns Timer::NO_SLACK if the timer fires at exact timeout.
+     **/
+    inline unsigned int getSlack( void ) const;
+
     /**
      * \brief   Returns true if timer is active.
      *          The timer is inactive, if event count is zero.
@@ -315,6 +334,10 @@ protected:
      * \brief   The amount of events to fire
      **/
     unsigned int        mEventsCount;
+    /**
+     * \brief   The allowed delay in milliseconds to coalesce the timer with other timers.
+     **/
+    unsigned int        mSlackInMs;
     /**
      * \brief   Next event to fire relative since the system was started, up to 49.7 days
      **/
@@ -429,6 +452,11 @@ inline unsigned int Timer::getTimeout( void ) const
     return mTimeoutInMs;
 }
 
+inline unsigned int Timer::getSlack( void ) const
+{
+    return mSlackInMs;
+}
+
 inline unsigned int Timer::getEventCount( void ) const
 {
     return mEventsCount;
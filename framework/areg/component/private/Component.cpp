@@ -51,7 +51,7 @@ Component* Component::loadComponent(const NERegistry::ComponentEntry &entry, Com
             const NERegistry::WorkerThreadEntry& wtEntry = wThreads[i];
             IEWorkerThreadConsumer* consumer = static_cast<Component *>(component)->workerThreadConsumer(wtEntry.mConsumerName.getString(), wtEntry.mThreadName.getBuffer());
             if (consumer != nullptr)
-                component->createWorkerThread(wtEntry.mThreadName.getString(), *consumer, componentThread);
+                component->createWorkerThread(wtEntry.mThreadName.getString(), *consumer, componentThread, wtEntry.mThreadAttributes);
         }
     }
 
@@ -134,7 +134,10 @@ Component::~Component( void )
 //////////////////////////////////////////////////////////////////////////
 // Methods
 //////////////////////////////////////////////////////////////////////////
-WorkerThread* Component::createWorkerThread( const char* threadName, IEWorkerThreadConsumer& consumer, ComponentThread & /* masterThread */ )
+WorkerThread* Component::createWorkerThread( const char* threadName
+                                            , IEWorkerThreadConsumer& consumer
+                                            , ComponentThread & /* masterThread */
+                                            , const Thread::sThreadAttributes & attributes /*= Thread::DEFAULT_THREAD_ATTRIBUTES*/ )
 {
     WorkerThread* workThread = mComponentInfo.findWorkerThread(threadName);
     if (workThread == nullptr)
@@ -143,7 +146,7 @@ WorkerThread* Component::createWorkerThread( const char* threadName, IEWorkerThr
         workThread = DEBUG_NEW WorkerThread(threadName, self(), consumer);
         if (workThread != nullptr)
         {
-            if (workThread->createThread(NECommon::WAIT_INFINITE))
+            if (workThread->createThread(NECommon::WAIT_INFINITE, attributes))
             {
                 OUTPUT_DBG("Registering WorkerThread [ %s ]", threadName);
                 mComponentInfo.registerWorkerThread(*workThread);
@@ -63,20 +63,18 @@ ComponentAddress::ComponentAddress( const ThreadAddress & threadAddress )
 }
 
 ComponentAddress::ComponentAddress( const ThreadAddress & threadAddress, const char * roleName )
-    : mRoleName     ( NEString::isEmpty<char>(roleName) ?  INVALID_COMPONENT_NAME.data() : roleName )
+    : mRoleName     ( NEString::isEmpty<char>(roleName) ?  INVALID_COMPONENT_NAME.data() : roleName, NEUtilities::ITEM_NAMES_MAX_LENGTH )
     , mThreadAddress( threadAddress )
     , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
 {
-    mRoleName.truncate(NEUtilities::ITEM_NAMES_MAX_LENGTH);
     mMagicNum   = ComponentAddress::_magicNumber(*this);
 }
 
 ComponentAddress::ComponentAddress( const char * roleName )
-    : mRoleName     ( NEString::isEmpty<char>(roleName) ? INVALID_COMPONENT_NAME.data() : roleName )
+    : mRoleName     ( NEString::isEmpty<char>(roleName) ? INVALID_COMPONENT_NAME.data() : roleName, NEUtilities::ITEM_NAMES_MAX_LENGTH )
     , mThreadAddress( DispatcherThread::getCurrentDispatcherThread().getAddress() )
     , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
 {
-    mRoleName.truncate(NEUtilities::ITEM_NAMES_MAX_LENGTH);
     Component* comp = Component::findComponentByName(roleName);
     if (comp != nullptr)
     {
@@ -87,11 +85,10 @@ ComponentAddress::ComponentAddress( const char * roleName )
 }
 
 ComponentAddress::ComponentAddress( const char*  roleName, const char * nameThread )
-    : mRoleName     ( NEString::isEmpty<char>(roleName) ? INVALID_COMPONENT_NAME.data() : roleName )
+    : mRoleName     ( NEString::isEmpty<char>(roleName) ? INVALID_COMPONENT_NAME.data() : roleName, NEUtilities::ITEM_NAMES_MAX_LENGTH )
     , mThreadAddress( nameThread != nullptr ? DispatcherThread::getDispatcherThread(nameThread).getAddress() : ThreadAddress::INVALID_THREAD_ADDRESS )
     , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
 {
-    mRoleName.truncate(NEUtilities::ITEM_NAMES_MAX_LENGTH);
     mMagicNum   = ComponentAddress::_magicNumber(*this);
 }
 
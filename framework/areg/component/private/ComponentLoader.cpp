@@ -369,7 +369,7 @@ bool ComponentLoader::loadModel( NERegistry::Model & whichModel ) const
                 if ( thrObject != nullptr )
                 {
                     OUTPUT_DBG( "Starting thread [ %s ] and loading components.", thrObject->getName( ).getString( ) );
-                    if ( thrObject->createThread( NECommon::WAIT_INFINITE ) == false )
+                    if ( thrObject->createThread( NECommon::WAIT_INFINITE, entry.mThreadAttributes ) == false )
                     {
                         OUTPUT_ERR( "Failed to create and start thread [ %s ], going to delete and unload components.", thrObject->getName( ).getString( ) );
                         thrObject->destroyThread( NECommon::DO_NOT_WAIT );
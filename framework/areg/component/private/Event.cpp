@@ -76,6 +76,7 @@ Event::Event( void )
     , mEventType    ( Event::eEventType::EventUnknown )
     , mConsumer     ( nullptr )
     , mTargetThread ( nullptr )
+    , mNextEvent    ( nullptr )
 {
 }
 
@@ -84,6 +85,7 @@ Event::Event( Event::eEventType eventType )
     , mEventType    ( eventType )
     , mConsumer     ( nullptr )
     , mTargetThread ( nullptr )
+    , mNextEvent    ( nullptr )
 {
 }
 
@@ -17,6 +17,41 @@
 
 #include "areg/component/IEEventConsumer.hpp"
 
+//////////////////////////////////////////////////////////////////////////
+// EventConsumerSnapshot class implementation
+//////////////////////////////////////////////////////////////////////////
+
+EventConsumerSnapshot::EventConsumerSnapshot( int count )
+    : mRefCount ( 1 )
+    , mCount    ( count )
+    , mConsumers( DEBUG_NEW IEEventConsumer * [static_cast<unsigned int>(count)] )
+{
+}
+
+EventConsumerSnapshot::~EventConsumerSnapshot( void )
+{
+    delete [] mConsumers;
+}
+
+EventConsumerSnapshot * EventConsumerSnapshot::createSnapshot( const EventConsumerListBase & consumers )
+{
+    EventConsumerSnapshot * result = nullptr;
+    if ( consumers.isEmpty() == false )
+    {
+        result = DEBUG_NEW EventConsumerSnapshot( consumers.getSize() );
+        if ( result != nullptr )
+        {
+            int index = 0;
+            for ( LISTPOS pos = consumers.firstPosition(); pos != nullptr; pos = consumers.nextPosition(pos) )
+            {
+                result->mConsumers[index ++] = consumers.getAt(pos);
+            }
+        }
+    }
+
+    return result;
+}
+
 //////////////////////////////////////////////////////////////////////////
 // EventConsumerList class implementation
 //////////////////////////////////////////////////////////////////////////
@@ -25,11 +60,72 @@
 // EventConsumerList class, Constructors / Destructor
 //////////////////////////////////////////////////////////////////////////
 
+EventConsumerList::EventConsumerList( void )
+    : EventConsumerListBase ( )
+    , mSnapshot             ( nullptr )
+{
+}
+
+EventConsumerList::EventConsumerList( const EventConsumerList & src )
+    : EventConsumerListBase ( static_cast<const EventConsumerListBase &>(src) )
+    , mSnapshot             ( src.mSnapshot )
+{
+    if ( mSnapshot != nullptr )
+    {
+        mSnapshot->addRef();
+    }
+}
+
+EventConsumerList::EventConsumerList( EventConsumerList && src ) noexcept
+    : EventConsumerListBase ( static_cast<EventConsumerListBase &&>(src) )
+    , mSnapshot             ( src.mSnapshot )
+{
+    src.mSnapshot = nullptr;
+}
+
 EventConsumerList::~EventConsumerList( void )
 {
     removeAllConsumers();
 }
 
+EventConsumerList & EventConsumerList::operator = ( const EventConsumerList & src )
+{
+    if ( this != &src )
+    {
+        static_cast<EventConsumerListBase &>(*this) = static_cast<const EventConsumerListBase &>(src);
+        if ( src.mSnapshot != nullptr )
+        {
+            src.mSnapshot->addRef();
+        }
+
+        if ( mSnapshot != nullptr )
+        {
+            mSnapshot->release();
+        }
+
+        mSnapshot = src.mSnapshot;
+    }
+
+    return (*this);
+}
+
+EventConsumerList & EventConsumerList::operator = ( EventConsumerList && src ) noexcept
+{
+    if ( this != &src )
+    {
+        static_cast<EventConsumerListBase &>(*this) = static_cast<EventConsumerListBase &&>(src);
+        if ( mSnapshot != nullptr )
+        {
+            mSnapshot->release();
+        }
+
+        mSnapshot       = src.mSnapshot;
+        src.mSnapshot   = nullptr;
+    }
+
+    return (*this);
+}
+
 //////////////////////////////////////////////////////////////////////////
 // EventConsumerList class, methods
 //////////////////////////////////////////////////////////////////////////
@@ -39,6 +135,7 @@ bool EventConsumerList::addConsumer( IEEventConsumer& whichConsumer )
     if (EventConsumerListBase::pushLast(&whichConsumer) != nullptr)
     {
         result = true;
+        _updateSnapshot();
         whichConsumer.consumerRegistered(true);
     }
     
@@ -51,6 +148,7 @@ bool EventConsumerList::removeConsumer( IEEventConsumer& whichConsumer )
     if ( EventConsumerListBase::removeEntry(&whichConsumer, nullptr) )
     {
         result = true;
+        _updateSnapshot();
         whichConsumer.consumerRegistered(false);
     }
 
@@ -67,6 +165,17 @@ void EventConsumerList::removeAllConsumers( void )
     }
     
     EventConsumerListBase::removeAll();
+    _updateSnapshot();
+}
+
+void EventConsumerList::_updateSnapshot( void )
+{
+    if ( mSnapshot != nullptr )
+    {
+        mSnapshot->release();
+    }
+
+    mSnapshot = EventConsumerSnapshot::createSnapshot( static_cast<const EventConsumerListBase &>(*this) );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -91,3 +200,12 @@ void ImplEventConsumerMap::implCleanResource( RuntimeClassID & /*Key*/, EventCon
     delete Resource;
 }
 #endif
+
+//////////////////////////////////////////////////////////////////////////
+// ImplConsumerSnapshotMap class implementation
+//////////////////////////////////////////////////////////////////////////
+void ImplConsumerSnapshotMap::implCleanResource( RuntimeClassID & /*Key*/, EventConsumerSnapshot * Resource )
+{
+    ASSERT(Resource != nullptr);
+    Resource->release();
+}
@@ -23,9 +23,12 @@
 #include "areg/base/Containers.hpp"
 #include "areg/base/TEResourceMap.hpp"
 
+#include <atomic>
+
 /************************************************************************
  * Declared classes
  ************************************************************************/
+class EventConsumerSnapshot;
 class EventConsumerList;
 
 /************************************************************************
@@ -35,18 +38,105 @@ class IEEventConsumer;
 
 /************************************************************************
  * \brief   In this file are declared Event Consumer contain classes:
- *              1. EventConsumerList  -- List of Event Consumers
- *              2. EventConsumerMap   -- Map of Event Consumer.
+ *              1. EventConsumerSnapshot  -- Immutable array of Event Consumers
+ *              2. EventConsumerList      -- List of Event Consumers
+ *              3. EventConsumerMap       -- Map of Event Consumer.
+ *              4. ConsumerSnapshotMap    -- Map of cached Event Consumer snapshots.
  *          These are helper classes used in Dispatcher object.
  *          For details, see description bellow.
  ************************************************************************/
 
-//////////////////////////////////////////////////////////////////////////
-// EventConsumerList class declaration
-//////////////////////////////////////////////////////////////////////////
 using ImplEventConsumerList = TEListImpl<IEEventConsumer *>;
 using EventConsumerListBase	= TELinkedList<IEEventConsumer *, IEEventConsumer *, ImplEventConsumerList>;
 
+//////////////////////////////////////////////////////////////////////////
+// EventConsumerSnapshot class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   Event Consumer Snapshot is an immutable, reference counted array
+ *          of Event Consumers. The snapshot is created every time when the
+ *          list of Event Consumers is changed and it is used by Dispatcher
+ *          to dispatch events without copying the list of consumers.
+ *          The snapshot is deleted when the last reference is released.
+ **/
+class EventConsumerSnapshot
+{
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor. Hidden
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Creates snapshot to store specified number of consumers.
+     *          The reference counter is set to 1.
+     **/
+    explicit EventConsumerSnapshot( int count );
+
+    /**
+     * \brief   Destructor. Called when the reference counter reaches 0.
+     **/
+    ~EventConsumerSnapshot( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Creates the snapshot of given list of consumers. Returns nullptr
+     *          if the list is empty. The reference counter of created snapshot is 1.
+     * \param   consumers   The list of consumers to create snapshot.
+     **/
+    static EventConsumerSnapshot * createSnapshot( const EventConsumerListBase & consumers );
+
+    /**
+     * \brief   Increases the reference counter of the snapshot.
+     **/
+    inline void addRef( void );
+
+    /**
+     * \brief   Decreases the reference counter and deletes the snapshot
+     *          if there are no more references.
+     **/
+    inline void release( void );
+
+    /**
+     * \brief   Returns the number of consumers in the snapshot.
+     **/
+    inline int getSize( void ) const;
+
+    /**
+     * \brief   Returns the consumer at given position.
+     * \param   index   The valid index of the consumer in the snapshot.
+     **/
+    inline IEEventConsumer * getAt( int index ) const;
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The reference counter.
+     **/
+    std::atomic_int     mRefCount;
+    /**
+     * \brief   The number of consumers in the array.
+     **/
+    const int           mCount;
+    /**
+     * \brief   The array of consumers.
+     **/
+    IEEventConsumer **  mConsumers;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden method calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    EventConsumerSnapshot( void ) = delete;
+    DECLARE_NOCOPY_NOMOVE( EventConsumerSnapshot );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// EventConsumerList class declaration
+//////////////////////////////////////////////////////////////////////////
 /**
  * \brief   Event Consumer List is a helper class containing 
  *          Event Consumer objects. It is used in Dispatcher, when 
@@ -63,17 +153,17 @@ public:
     /**
      * \brief   Default Constructor. Initializes empty list
      **/
-    EventConsumerList( void ) = default;
+    EventConsumerList( void );
     /**
-     * \brief   Copy constructor.
+     * \brief   Copy constructor. The snapshot of consumers is shared.
      * \param   src     The source of data to copy.
      **/
-    EventConsumerList(const EventConsumerList & src) = default;
+    EventConsumerList(const EventConsumerList & src);
     /**
      * \brief   Move constructor.
      * \param   src     The source of data to move.
      **/
-    EventConsumerList( EventConsumerList && src ) noexcept = default;
+    EventConsumerList( EventConsumerList && src ) noexcept;
     /**
      * \brief   Destructor
      **/
@@ -87,13 +177,13 @@ public:
      * \brief   Assigns entries from given source.
      * \param   src     THe source of event consumer list.
      */
-    inline EventConsumerList & operator = (const EventConsumerList & src ) = default;
+    EventConsumerList & operator = (const EventConsumerList & src );
 
     /**
      * \brief   Assigns entries from given source.
      * \param   src     THe source of event consumer list.
      */
-    inline EventConsumerList & operator = ( EventConsumerList && src ) noexcept = default;
+    EventConsumerList & operator = ( EventConsumerList && src ) noexcept;
 
     /**
      * \brief   Adds Event Consumer object to the list. Returns true, 
@@ -130,6 +220,32 @@ public:
      * \return  Returns true, if the specified Event Consumer already exists in the list.
      **/
     inline bool existConsumer( IEEventConsumer & whichConsumer ) const;
+
+    /**
+     * \brief   Returns the snapshot of registered Event Consumers.
+     *          The snapshot is rebuilt every time the list is changed.
+     *          Returns nullptr if the list is empty. The caller should
+     *          call addRef() to keep the snapshot.
+     **/
+    inline EventConsumerSnapshot * getSnapshot( void ) const;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Releases the existing snapshot and creates new.
+     **/
+    void _updateSnapshot( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The snapshot of Event Consumers.
+     **/
+    EventConsumerSnapshot * mSnapshot;
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -156,10 +272,58 @@ public:
  **/
 using EventConsumerMap  = TELockRuntimeResourceMap<EventConsumerList, ImplEventConsumerMap>;
 
+//////////////////////////////////////////////////////////////////////////
+// ConsumerSnapshotMap class declaration
+//////////////////////////////////////////////////////////////////////////
+class ImplConsumerSnapshotMap   : public TEResourceMapImpl<RuntimeClassID, EventConsumerSnapshot>
+{
+public:
+    /**
+     * \brief	Called when all resources are removed. Releases the snapshot.
+     * \param	Key	        The Key value of resource
+     * \param	Resource	Pointer to resource object
+     **/
+    void implCleanResource( RuntimeClassID & Key, EventConsumerSnapshot * Resource );
+};
+
+/**
+ * \brief   Consumer Snapshot Map is a non-locking map of Event Consumer
+ *          snapshots cached by the dispatching thread. Every entry keeps
+ *          the reference to the snapshot.
+ **/
+using ConsumerSnapshotMap   = TENolockRuntimeResourceMap<EventConsumerSnapshot, ImplConsumerSnapshotMap>;
+
 //////////////////////////////////////////////////////////////////////////
 // Inline functions implementation
 //////////////////////////////////////////////////////////////////////////
 
+//////////////////////////////////////////////////////////////////////////
+// EventConsumerSnapshot class inline functions
+//////////////////////////////////////////////////////////////////////////
+inline void EventConsumerSnapshot::addRef( void )
+{
+    mRefCount.fetch_add( 1 );
+}
+
+inline void EventConsumerSnapshot::release( void )
+{
+    if ( mRefCount.fetch_sub( 1 ) == 1 )
+    {
+        delete this;
+    }
+}
+
+inline int EventConsumerSnapshot::getSize( void ) const
+{
+    return mCount;
+}
+
+inline IEEventConsumer * EventConsumerSnapshot::getAt( int index ) const
+{
+    ASSERT( (index >= 0) && (index < mCount) );
+    return mConsumers[index];
+}
+
 //////////////////////////////////////////////////////////////////////////
 // EventConsumerList class inline functions
 //////////////////////////////////////////////////////////////////////////
@@ -167,3 +331,8 @@ inline bool EventConsumerList::existConsumer( IEEventConsumer & whichConsumer )
 {
     return (EventConsumerListBase::find( &whichConsumer, nullptr) != nullptr);
 }
+
+inline EventConsumerSnapshot * EventConsumerList::getSnapshot( void ) const
+{
+    return mSnapshot;
+}
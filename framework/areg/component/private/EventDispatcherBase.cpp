@@ -34,9 +34,12 @@ EventDispatcherBase::EventDispatcherBase(const char* name )
     , mExternaEvents    ( static_cast<IEQueueListener &>(self()) )
     , mInternalEvents   ( )
     , mConsumerMap      ( )
+    , mConsumerCache    ( )
+    , mConsumerVersion  ( 0u )
     , mEventExit        ( false, false )
     , mEventQueue       ( true, false )
     , mHasStarted       ( false )
+    , mCacheVersion     ( 0u )
 {
     ; // do nothing
 }
@@ -44,6 +47,7 @@ EventDispatcherBase::EventDispatcherBase(const char* name )
 EventDispatcherBase::~EventDispatcherBase( void )
 {
     removeAllEvents( );
+    mConsumerCache.removeAllResources();
     mHasStarted = false;
 }
 
@@ -134,6 +138,7 @@ bool EventDispatcherBase::registerEventConsumer( const RuntimeClassID& whichClas
     {
         OUTPUT_DBG("[ %s ] dispatcher: Add new consumer. There are [ %d ] registered consumers for event [ %s ]. There are [ %d ] Consumer Lists in map", mDispatcherName.getString(), listConsumers->getSize(), whichClass.getName(), mConsumerMap.getSize());
         result = listConsumers->addConsumer(whichConsumer);
+        mConsumerVersion.fetch_add(1u);
     }
 
     mConsumerMap.unlock();
@@ -173,6 +178,7 @@ bool EventDispatcherBase::unregisterEventConsumer( const RuntimeClassID & whichC
         mConsumerMap.unregisterResourceObject(whichClass);
     }
 
+    mConsumerVersion.fetch_add(1u);
     mConsumerMap.unlock();
     return result;
 }
@@ -217,6 +223,7 @@ int EventDispatcherBase::removeConsumer( IEEventConsumer & whichConsumer )
         OUTPUT_WARN("[ %s ] dispatcher: Unregistered and deleted Consumer List of event entry [ %s ]. There are still [ %d ] Consumer Lists in map", mDispatcherName.getString(), Key.getName(), mConsumerMap.getSize());
     }
 
+    mConsumerVersion.fetch_add(1u);
     mConsumerMap.unlock();
     return result;
 }
@@ -266,6 +273,19 @@ bool EventDispatcherBase::runDispatcher( void )
                         eventElem = static_cast<EventQueue &>(mInternalEvents).isEmpty() == false ? mInternalEvents.popEvent() : nullptr;
                     }
 
+                    // No more internal events, but the external queue is still signaled.
+                    // Drain the external events in the batch without returning to blocking wait.
+                    if ( (eventElem == nullptr) && (eventLock == static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue)) )
+                    {
+                        eventElem = pickEvent();
+                        if ( static_cast<const Event *>(eventElem) == static_cast<const Event *>(&exitEvent) )
+                        {
+                            eventElem   = nullptr;
+                            whichEvent  = static_cast<int>(EventDispatcherBase::eEventOrder::EventExit);
+                            OUTPUT_WARN("Received exit event. Going to exit [ %s ] dispatcher", static_cast<const char *>(mDispatcherName.getString()));
+                        }
+                    }
+
                 } while (eventElem != nullptr);
             }
             else
@@ -311,35 +331,60 @@ void EventDispatcherBase::postDispatchEvent( Event* eventElem )
 
 bool EventDispatcherBase::dispatchEvent( Event& eventElem )
 {
-    EventConsumerList processingList;
+    bool result = false;
     IEEventConsumer* consumer = eventElem.getEventConsumer();
     if ( consumer != nullptr)
     {
-        processingList.pushFirst(consumer);
+        eventElem.dispatchSelf(consumer);
+        result = true;
     }
     else
     {
-        // Lock resource, before get any information
-        mConsumerMap.lock();
+        // The snapshot is immutable. It is kept in the cache, so that it is valid
+        // even if consumers are registered or unregistered while dispatching event.
+        EventConsumerSnapshot * snapshot = _getConsumerSnapshot(eventElem.getRuntimeClassId());
+        if ( snapshot != nullptr )
+        {
+            int count = snapshot->getSize();
+            for ( int i = 0; i < count; ++ i )
+            {
+                eventElem.dispatchSelf(snapshot->getAt(i));
+            }
 
-        EventConsumerList* listConsumers = mConsumerMap.findResourceObject(eventElem.getRuntimeClassId());
-        if (listConsumers != nullptr)
-            processingList = *listConsumers;
+            result = (count != 0);
+        }
+    }
 
-        // Unlock resource as soon as possible. Otherwise we may block other threads
-        // on registering / unregistering consumer.
-        mConsumerMap.unlock();
+    return result;
+}
+
+EventConsumerSnapshot * EventDispatcherBase::_getConsumerSnapshot( const RuntimeClassID & eventClassId )
+{
+    unsigned int version = mConsumerVersion.load();
+    if ( version != mCacheVersion )
+    {
+        mConsumerCache.removeAllResources();
+        mCacheVersion = version;
     }
 
-    LISTPOS pos = processingList.firstPosition();
-    while (pos != nullptr)
+    EventConsumerSnapshot * result = mConsumerCache.findResourceObject(eventClassId);
+    if ( result == nullptr )
     {
-        consumer = processingList.getNext(pos);
-        eventElem.dispatchSelf(consumer);
-        consumer = nullptr;
+        // Lock resource only when the snapshot is not cached yet.
+        mConsumerMap.lock();
+
+        EventConsumerList* listConsumers = mConsumerMap.findResourceObject(eventClassId);
+        result = listConsumers != nullptr ? listConsumers->getSnapshot() : nullptr;
+        if ( result != nullptr )
+        {
+            result->addRef();
+            mConsumerCache.registerResourceObject(eventClassId, result);
+        }
+
+        mConsumerMap.unlock();
     }
 
-    return (processingList.isEmpty() == false);
+    return result;
 }
 
 bool EventDispatcherBase::hasRegisteredConsumer( const RuntimeClassID& whichClass ) const
@@ -363,7 +408,10 @@ void EventDispatcherBase::_clean()
         OUTPUT_WARN("[ %s ] dispatcher: Unregistered and deleted Consumer List of event entry [ %s ]. There are still [ %d ] Consumer Lists in map", mDispatcherName.getString(), Key.getName(), mConsumerMap.getSize());
     }
 
+    mConsumerVersion.fetch_add(1u);
     mConsumerMap.unlock();
+
+    mConsumerCache.removeAllResources();
 }
 
 bool EventDispatcherBase::pulseExit(void)
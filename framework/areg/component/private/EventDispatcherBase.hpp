@@ -129,6 +129,12 @@ public:
      **/
     inline int removeExternalEventType(const RuntimeClassID & eventClassId);
 
+    /**
+     * \brief   Returns true if the external or the internal event queue
+     *          has events, which are not dispatched yet.
+     **/
+    inline bool hasPendingEvents( void ) const;
+
 /************************************************************************/
 // IEEventDispatcher overrides
 /************************************************************************/
@@ -282,6 +288,22 @@ protected:
      **/
     virtual void readyForEvents( bool isReady );
 
+/************************************************************************/
+// EventDispatcherBase protected operations
+/************************************************************************/
+
+    /**
+     * \brief   Picks up the next pending external Event element only if it is
+     *          an instance of specified runtime class. The picked element is
+     *          not dispatched and the caller is responsible to destroy it.
+     *          Used by dispatchers, which process several pending events of
+     *          the same type at once.
+     * \param   eventClassId    Runtime class ID of Event object to pick.
+     * \return  Returns valid pointer if next pending external event is an
+     *          instance of specified class. Otherwise, returns nullptr.
+     **/
+    inline Event * pickNextEvent( const RuntimeClassID & eventClassId );
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
@@ -291,11 +313,19 @@ protected:
      **/
     String              mDispatcherName;
 
+#if defined(ENABLE_LOCKFREE_QUEUE) || defined(_ENABLE_LOCKFREE_QUEUE)
+    /**
+     * \brief   External Event Queue element. One External queue per one dispatcher.
+     *          It is lock-free queue. Any thread can queue elements
+     **/
+    LockFreeEventQueue  mExternaEvents;
+#else   // defined(ENABLE_LOCKFREE_QUEUE) || defined(_ENABLE_LOCKFREE_QUEUE)
     /**
      * \brief   External Event Queue element. One External queue per one dispatcher.
      *          It is locking queue. Any thread can queue elements
      **/
     ExternalEventQueue  mExternaEvents;
+#endif  // defined(ENABLE_LOCKFREE_QUEUE) || defined(_ENABLE_LOCKFREE_QUEUE)
 
     /**
      * \brief   Internal Event Queue element. One Internal queue per one dispatcher.
@@ -312,6 +342,18 @@ protected:
      **/
     EventConsumerMap    mConsumerMap;
 
+    /**
+     * \brief   The snapshots of consumers cached by the dispatching thread.
+     *          Accessed only from dispatcher thread and not locked.
+     **/
+    ConsumerSnapshotMap mConsumerCache;
+
+    /**
+     * \brief   The version of consumer map, increased every time
+     *          when consumers are registered or unregistered.
+     **/
+    std::atomic_uint    mConsumerVersion;
+
 #if defined(_MSC_VER) && (_MSC_VER > 1200)
     #pragma warning(default: 4251)
 #endif  // _MSC_VER
@@ -334,6 +376,11 @@ protected:
      **/
     bool                mHasStarted;
 
+    /**
+     * \brief   The version of consumer map, when the consumer cache was built.
+     **/
+    unsigned int        mCacheVersion;
+
 //////////////////////////////////////////////////////////////////////////
 // Hidden calls.
 //////////////////////////////////////////////////////////////////////////
@@ -348,6 +395,15 @@ private:
      **/
     void _clean();
 
+    /**
+     * \brief   Returns the snapshot of consumers registered for given event class.
+     *          The snapshot is taken from cache, which is rebuilt if consumer map
+     *          has been changed. Should be called only from dispatcher thread.
+     * \param   eventClassId    The runtime class ID of event to dispatch.
+     * \return  Returns the snapshot of consumers or nullptr if there is no consumer.
+     **/
+    EventConsumerSnapshot * _getConsumerSnapshot( const RuntimeClassID & eventClassId );
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden method calls
 //////////////////////////////////////////////////////////////////////////
@@ -386,6 +442,16 @@ inline int EventDispatcherBase::removeExternalEventType( const RuntimeClassID &
     return mExternaEvents.removeEvents(eventClassId);
 }
 
+inline bool EventDispatcherBase::hasPendingEvents( void ) const
+{
+    return ((static_cast<const EventQueue &>(mInternalEvents).isEmpty() == false) || (static_cast<const EventQueue &>(mExternaEvents).isEmpty() == false));
+}
+
+inline Event * EventDispatcherBase::pickNextEvent( const RuntimeClassID & eventClassId )
+{
+    return mExternaEvents.popEvent(eventClassId);
+}
+
 inline EventDispatcherBase& EventDispatcherBase::self( void )
 {
     return (*this);
@@ -0,0 +1,370 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/component/private/EventPool.cpp
+ * \ingroup     AREG SDK, Asynchronous Event Generator Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, The pool of event objects.
+ *
+ ************************************************************************/
+#include "areg/component/private/EventPool.hpp"
+
+//////////////////////////////////////////////////////////////////////////
+// EventPoolCache class declaration and implementation
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * \brief   The cache of free event objects of a thread. Every slot of the cache
+ *          keeps the free objects of one event class. The counters are added
+ *          to the pool when objects are moved to or from the shared list,
+ *          periodically and when the thread exits.
+ **/
+class EventPoolCache
+{
+public:
+    /**
+     * \brief   EventPoolCache::sCacheSlot
+     *          The free objects of one event class in the cache of thread.
+     **/
+    typedef struct S_CacheSlot
+    {
+        EventPool *     csPool;         //!< The pool of event class, nullptr if the slot is free.
+        void *          csHead;         //!< The head of list of free objects.
+        unsigned int    csCount;        //!< The number of free objects.
+        unsigned int    csAllocated;    //!< The number of allocated objects, not added to the pool counters.
+        unsigned int    csHits;         //!< The number of objects taken from the pool, not added to the pool counters.
+        unsigned int    csReleased;     //!< The number of released objects, not added to the pool counters.
+    } sCacheSlot;
+
+    /**
+     * \brief   The number of allocations, after which the counters are added to the pool.
+     **/
+    static constexpr unsigned int   FLUSH_COUNTERS  { 256 };
+
+    EventPoolCache( void )
+        : mSlots    { }
+        , mIsClosed ( false )
+    {
+    }
+
+    /**
+     * \brief   Returns the objects of the thread to the shared lists of pools.
+     **/
+    ~EventPoolCache( void )
+    {
+        for ( unsigned int i = 0; i < EventPool::THREAD_CACHE_SLOTS; ++ i )
+        {
+            sCacheSlot & slot = mSlots[i];
+            if ( slot.csPool != nullptr )
+            {
+                EventPoolCache::flushCounters( slot );
+                slot.csPool->_giveShared( slot.csHead );
+                slot = sCacheSlot{ };
+            }
+        }
+
+        // the events might be destroyed after the thread local objects, they are not cached.
+        mIsClosed = true;
+    }
+
+    /**
+     * \brief   Returns the slot of the pool. Assigns a free slot if the pool has no slot.
+     *          Returns nullptr if all slots are used by other pools.
+     **/
+    inline sCacheSlot * getSlot( EventPool & pool )
+    {
+        sCacheSlot * result = nullptr;
+        if ( mIsClosed == false )
+        {
+            sCacheSlot * freeSlot = nullptr;
+            for ( unsigned int i = 0; (result == nullptr) && (i < EventPool::THREAD_CACHE_SLOTS); ++ i )
+            {
+                sCacheSlot & slot = mSlots[i];
+                if ( slot.csPool == &pool )
+                {
+                    result = &slot;
+                }
+                else if ( (slot.csPool == nullptr) && (freeSlot == nullptr) )
+                {
+                    freeSlot = &slot;
+                }
+            }
+
+            if ( (result == nullptr) && (freeSlot != nullptr) )
+            {
+                freeSlot->csPool = &pool;
+                result = freeSlot;
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * \brief   Adds the counters of the slot to the pool and resets them.
+     **/
+    static inline void flushCounters( sCacheSlot & slot )
+    {
+        slot.csPool->_addCounters( slot.csAllocated, slot.csHits, slot.csReleased );
+        slot.csAllocated= 0;
+        slot.csHits     = 0;
+        slot.csReleased = 0;
+    }
+
+private:
+    sCacheSlot  mSlots[EventPool::THREAD_CACHE_SLOTS];  //!< The slots of event classes.
+    bool        mIsClosed;                              //!< The flag, indicating that the thread exits.
+};
+
+namespace
+{
+    //!< The cache of free event objects of the current thread.
+    thread_local EventPoolCache _threadCache;
+
+    /**
+     * \brief   Returns the synchronization object of the list of all pools.
+     *          Never destroyed, same as the pools, which use it.
+     **/
+    inline SpinLock & _getPoolsLock( void )
+    {
+        static SpinLock & _lock = *(DEBUG_NEW SpinLock( ));
+        return _lock;
+    }
+
+    //!< The list of all pools to sum the counters.
+    EventPool *     _listPools  { nullptr };
+}
+
+//////////////////////////////////////////////////////////////////////////
+// EventPool class implementation
+//////////////////////////////////////////////////////////////////////////
+
+EventPool::EventPool( const char * eventName, unsigned int blockSize )
+    : mName         ( eventName != nullptr ? eventName : "" )
+    , mBlockSize    ( blockSize < sizeof(void *) ? static_cast<unsigned int>(sizeof(void *)) : blockSize )
+    , mSharedHead   ( nullptr )
+    , mSharedCount  ( 0 )
+    , mLock         ( )
+    , mAllocated    ( 0 )
+    , mHits         ( 0 )
+    , mReleased     ( 0 )
+    , mFreed        ( 0 )
+    , mNextPool     ( nullptr )
+{
+    Lock lock( _getPoolsLock( ) );
+    mNextPool   = _listPools;
+    _listPools  = this;
+}
+
+EventPool::~EventPool( void )
+{
+    {
+        Lock lock( _getPoolsLock( ) );
+        EventPool ** next = &_listPools;
+        while ( (*next != nullptr) && (*next != this) )
+        {
+            next = &(*next)->mNextPool;
+        }
+
+        if ( *next == this )
+        {
+            *next = mNextPool;
+        }
+    }
+
+    Lock lock( mLock );
+    mBlockSize = 0;
+    while ( mSharedHead != nullptr )
+    {
+        void * block = mSharedHead;
+        mSharedHead  = EventPool::_next( block );
+        ::operator delete( block );
+    }
+
+    mSharedCount = 0;
+}
+
+inline void * & EventPool::_next( void * block )
+{
+    return *reinterpret_cast<void **>(block);
+}
+
+inline void EventPool::_addCounters( unsigned int allocated, unsigned int hits, unsigned int released )
+{
+    mAllocated.fetch_add( allocated, std::memory_order_relaxed );
+    mHits.fetch_add( hits, std::memory_order_relaxed );
+    mReleased.fetch_add( released, std::memory_order_relaxed );
+}
+
+void * EventPool::allocate( size_t size )
+{
+    void * result = nullptr;
+    if ( size == mBlockSize )
+    {
+        EventPoolCache::sCacheSlot * slot = _threadCache.getSlot( *this );
+        if ( slot != nullptr )
+        {
+            if ( slot->csHead == nullptr )
+            {
+                slot->csCount = _takeShared( EventPool::TRANSFER_BATCH, slot->csHead );
+            }
+
+            if ( slot->csHead != nullptr )
+            {
+                result          = slot->csHead;
+                slot->csHead    = EventPool::_next( result );
+                slot->csCount  -= 1;
+                slot->csHits   += 1;
+            }
+
+            if ( ++ slot->csAllocated >= EventPoolCache::FLUSH_COUNTERS )
+            {
+                EventPoolCache::flushCounters( *slot );
+            }
+        }
+        else
+        {
+            _addCounters( 1, _takeShared( 1, result ), 0 );
+        }
+    }
+
+    return (result != nullptr ? result : ::operator new( size ));
+}
+
+void EventPool::release( void * block, size_t size )
+{
+    if ( block == nullptr )
+    {
+        return;
+    }
+
+    if ( (size == mBlockSize) && (mBlockSize != 0) )
+    {
+        EventPoolCache::sCacheSlot * slot = _threadCache.getSlot( *this );
+        if ( slot != nullptr )
+        {
+            EventPool::_next( block ) = slot->csHead;
+            slot->csHead        = block;
+            slot->csCount      += 1;
+            slot->csReleased   += 1;
+
+            if ( slot->csCount > EventPool::THREAD_CACHE_SIZE )
+            {
+                // keep the rest in the cache, the objects are mainly released and allocated by different threads.
+                void * head = slot->csHead;
+                void * tail = head;
+                for ( unsigned int i = 1; i < EventPool::TRANSFER_BATCH; ++ i )
+                {
+                    tail = EventPool::_next( tail );
+                }
+
+                slot->csHead    = EventPool::_next( tail );
+                slot->csCount  -= EventPool::TRANSFER_BATCH;
+                EventPool::_next( tail ) = nullptr;
+
+                EventPoolCache::flushCounters( *slot );
+                _giveShared( head );
+            }
+        }
+        else
+        {
+            _addCounters( 0, 0, 1 );
+            EventPool::_next( block ) = nullptr;
+            _giveShared( block );
+        }
+    }
+    else
+    {
+        ::operator delete( block );
+    }
+}
+
+EventPool::sPoolStatistics EventPool::getStatistics( void ) const
+{
+    sPoolStatistics result;
+    result.psAllocated  = mAllocated.load( std::memory_order_relaxed );
+    result.psHits       = mHits.load( std::memory_order_relaxed );
+    result.psReleased   = mReleased.load( std::memory_order_relaxed );
+    result.psFreed      = mFreed.load( std::memory_order_relaxed );
+    return result;
+}
+
+EventPool::sPoolStatistics EventPool::getTotalStatistics( void )
+{
+    sPoolStatistics result{ 0, 0, 0, 0 };
+
+    Lock lock( _getPoolsLock( ) );
+    for ( const EventPool * pool = _listPools; pool != nullptr; pool = pool->mNextPool )
+    {
+        sPoolStatistics stats = pool->getStatistics( );
+        result.psAllocated += stats.psAllocated;
+        result.psHits      += stats.psHits;
+        result.psReleased  += stats.psReleased;
+        result.psFreed     += stats.psFreed;
+    }
+
+    return result;
+}
+
+unsigned int EventPool::_takeShared( unsigned int count, void * & out_head )
+{
+    unsigned int result = 0;
+    out_head = nullptr;
+
+    Lock lock( mLock );
+    if ( mSharedHead != nullptr )
+    {
+        void * tail = mSharedHead;
+        result      = 1;
+        while ( (result < count) && (EventPool::_next( tail ) != nullptr) )
+        {
+            tail = EventPool::_next( tail );
+            ++ result;
+        }
+
+        out_head        = mSharedHead;
+        mSharedHead     = EventPool::_next( tail );
+        mSharedCount   -= result;
+        EventPool::_next( tail ) = nullptr;
+    }
+
+    return result;
+}
+
+void EventPool::_giveShared( void * head )
+{
+    // the objects exceeding the limit of shared list are freed outside of lock.
+    void * rest = head;
+    {
+        Lock lock( mLock );
+        unsigned int space = (mBlockSize != 0) && (mSharedCount < EventPool::SHARED_LIST_SIZE) ? EventPool::SHARED_LIST_SIZE - mSharedCount : 0u;
+        for ( unsigned int i = 0; (i < space) && (rest != nullptr); ++ i )
+        {
+            void * block = rest;
+            rest = EventPool::_next( block );
+            EventPool::_next( block ) = mSharedHead;
+            mSharedHead = block;
+            ++ mSharedCount;
+        }
+    }
+
+    unsigned int freed = 0;
+    while ( rest != nullptr )
+    {
+        void * block = rest;
+        rest = EventPool::_next( block );
+        ::operator delete( block );
+        ++ freed;
+    }
+
+    if ( freed != 0 )
+    {
+        mFreed.fetch_add( freed, std::memory_order_relaxed );
+    }
+}
@@ -0,0 +1,301 @@
+#pragma once
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/component/private/EventPool.hpp
+ * \ingroup     AREG SDK, Asynchronous Event Generator Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, The pool of event objects.
+ *
+ ************************************************************************/
+
+/************************************************************************
+ * Include files
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/SynchObjects.hpp"
+
+#include <atomic>
+#include <new>
+
+/**
+ * \brief   AREG_EVENT_POOL is defined if the event classes declared by TEEvent
+ *          macro are allocated in the pools of event objects. It is enabled by
+ *          default and is disabled by DISABLE_EVENT_POOL preprocessor define,
+ *          for example, to check the memory with sanitizers.
+ **/
+#if !defined(DISABLE_EVENT_POOL) && !defined(_DISABLE_EVENT_POOL)
+    #define AREG_EVENT_POOL
+#endif  // !defined(DISABLE_EVENT_POOL) && !defined(_DISABLE_EVENT_POOL)
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+class EventPoolCache;
+
+//////////////////////////////////////////////////////////////////////////
+// EventPool class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The pool of released objects of one event class. The events are
+ *          mainly created in one thread and destroyed in another, so that
+ *          every thread has a small cache of free objects per event class,
+ *          which is used without locking. When the cache of a thread is
+ *          empty, it takes a batch of objects from the shared list of pool.
+ *          When the cache is full, it returns a batch to the shared list.
+ *          The objects exceeding the limit of shared list are freed.
+ *
+ *          The pool allocates only objects of the size of event class.
+ *          The objects of derived classes are allocated in the heap.
+ **/
+class AREG_API EventPool
+{
+    friend class EventPoolCache;
+
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   EventPool::sPoolStatistics
+     *          The counters of event pool.
+     **/
+    typedef struct S_PoolStatistics
+    {
+        uint64_t    psAllocated;    //!< The number of allocated event objects.
+        uint64_t    psHits;         //!< The number of event objects taken from the pool, i.e. without heap allocation.
+        uint64_t    psReleased;     //!< The number of released event objects.
+        uint64_t    psFreed;        //!< The number of event objects, which are freed, because the pool is full.
+
+        /**
+         * \brief   Returns the hit rate of pool in percent.
+         **/
+        inline unsigned int getHitRate( void ) const;
+
+    } sPoolStatistics;
+
+    /**
+     * \brief   EventPool::THREAD_CACHE_SIZE
+     *          The maximum number of free objects in the cache of a thread per event class.
+     **/
+    static constexpr unsigned int   THREAD_CACHE_SIZE   { 64 };
+
+    /**
+     * \brief   EventPool::TRANSFER_BATCH
+     *          The number of objects moved at once between the cache of a thread and the shared list.
+     **/
+    static constexpr unsigned int   TRANSFER_BATCH      { THREAD_CACHE_SIZE / 2 };
+
+    /**
+     * \brief   EventPool::SHARED_LIST_SIZE
+     *          The maximum number of free objects in the shared list of pool.
+     **/
+    static constexpr unsigned int   SHARED_LIST_SIZE    { 1024 };
+
+    /**
+     * \brief   EventPool::THREAD_CACHE_SLOTS
+     *          The number of event classes cached per thread. The other event classes
+     *          use the shared list of pool directly.
+     **/
+    static constexpr unsigned int   THREAD_CACHE_SLOTS  { 16 };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Initializes the pool of event class.
+     * \param   eventName   The name of event class. Should be valid during the lifetime of pool.
+     * \param   blockSize   The size of event object in bytes.
+     **/
+    EventPool( const char * eventName, unsigned int blockSize );
+
+    /**
+     * \brief   Frees the objects in the shared list. After destruction,
+     *          the objects are allocated and freed in the heap.
+     *          The pools of event classes are never destroyed, since the
+     *          events and the caches of threads might release objects
+     *          after the static objects are destroyed.
+     **/
+    ~EventPool( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Allocates the memory of event object. Takes the object from the cache
+     *          of thread or the shared list. If both are empty, allocates in the heap.
+     * \param   size    The size of object to allocate.
+     * \return  Returns valid pointer. Throws std::bad_alloc if failed to allocate.
+     **/
+    void * allocate( size_t size );
+
+    /**
+     * \brief   Releases the memory of event object. Puts the object in the cache of thread.
+     * \param   block   The memory of event object to release. Can be nullptr.
+     * \param   size    The size of released object.
+     **/
+    void release( void * block, size_t size );
+
+    /**
+     * \brief   Returns the counters of the pool. The counters of thread caches
+     *          are periodically added, so that the latest operations might be missed.
+     **/
+    sPoolStatistics getStatistics( void ) const;
+
+    /**
+     * \brief   Returns the name of event class of the pool.
+     **/
+    inline const char * getName( void ) const;
+
+    /**
+     * \brief   Returns the sum of counters of all pools of event classes.
+     **/
+    static sPoolStatistics getTotalStatistics( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Moves up to given number of objects from the shared list to the list.
+     * \param   count       The maximum number of objects to move.
+     * \param   out_head    On output, contains the head of moved objects.
+     * \return  Returns the number of moved objects.
+     **/
+    unsigned int _takeShared( unsigned int count, void * & out_head );
+
+    /**
+     * \brief   Moves the list of objects to the shared list. The objects exceeding
+     *          the limit of shared list are freed.
+     * \param   head    The head of list of objects, which ends with nullptr.
+     **/
+    void _giveShared( void * head );
+
+    /**
+     * \brief   Adds the counters of the thread cache.
+     **/
+    inline void _addCounters( unsigned int allocated, unsigned int hits, unsigned int released );
+
+    /**
+     * \brief   Returns the next object in the list of free objects.
+     **/
+    static inline void * & _next( void * block );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The name of event class.
+     **/
+    const char *            mName;
+    /**
+     * \brief   The size of event object. Zero if the pool is destroyed.
+     **/
+    unsigned int            mBlockSize;
+    /**
+     * \brief   The head of shared list of free objects.
+     **/
+    void *                  mSharedHead;
+    /**
+     * \brief   The number of objects in the shared list.
+     **/
+    unsigned int            mSharedCount;
+    /**
+     * \brief   The synchronization object of the shared list.
+     **/
+    SpinLock                mLock;
+    /**
+     * \brief   The number of allocated objects.
+     **/
+    std::atomic<uint64_t>   mAllocated;
+    /**
+     * \brief   The number of objects taken from the pool.
+     **/
+    std::atomic<uint64_t>   mHits;
+    /**
+     * \brief   The number of released objects.
+     **/
+    std::atomic<uint64_t>   mReleased;
+    /**
+     * \brief   The number of freed objects.
+     **/
+    std::atomic<uint64_t>   mFreed;
+    /**
+     * \brief   The next pool in the list of all pools.
+     **/
+    EventPool *             mNextPool;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    EventPool( void ) = delete;
+    DECLARE_NOCOPY_NOMOVE( EventPool );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// The operators new and delete of event class
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   Declares the pool of event class and the operators, allocating
+ *          and releasing objects in the pool. Used in the declaration of class.
+ *          The Event::destroy() deletes the object, which releases it in the pool.
+ *          The pool is created when first used and is never destroyed, so that
+ *          the events destroyed on exit do not access the destroyed pool.
+ * \param   EventClass  The event class.
+ * \param   EventName   The name of event class as a string literal.
+ **/
+#if defined(AREG_EVENT_POOL)
+
+    #if defined(_DEBUG) && defined(_WINDOWS)
+        // the DEBUG_NEW passes the file and line, which are ignored by pool.
+        #define DECLARE_EVENT_POOL_DEBUG_OPERATORS( EventClass )                                                                \
+        static inline void * operator new( std::size_t size, int /*block*/, const char * /*file*/, int /*line*/ )               \
+        {   return EventClass::getEventPool().allocate( size );                 }                                               \
+        static inline void operator delete( void * block, int /*block*/, const char * /*file*/, int /*line*/ )                  \
+        {   ::operator delete( block );                                         }
+    #else   // defined(_DEBUG) && defined(_WINDOWS)
+        #define DECLARE_EVENT_POOL_DEBUG_OPERATORS( EventClass )
+    #endif  // defined(_DEBUG) && defined(_WINDOWS)
+
+    #define DECLARE_EVENT_POOL( EventClass, EventName )                                                                         \
+    public:                                                                                                                     \
+        static inline EventPool & getEventPool( void )                                                                          \
+        {                                                                                                                       \
+            static EventPool & _pool = *(DEBUG_NEW EventPool( EventName, static_cast<unsigned int>(sizeof(EventClass)) ));      \
+            return _pool;                                                                                                       \
+        }                                                                                                                       \
+        static inline void * operator new( std::size_t size )                                                                   \
+        {   return EventClass::getEventPool().allocate( size );                 }                                               \
+        static inline void operator delete( void * block, std::size_t size )                                                    \
+        {   EventClass::getEventPool().release( block, size );                  }                                               \
+        DECLARE_EVENT_POOL_DEBUG_OPERATORS( EventClass )
+
+#else   // defined(AREG_EVENT_POOL)
+
+    #define DECLARE_EVENT_POOL( EventClass, EventName )
+
+#endif  // defined(AREG_EVENT_POOL)
+
+//////////////////////////////////////////////////////////////////////////
+// EventPool class inline functions
+//////////////////////////////////////////////////////////////////////////
+
+inline unsigned int EventPool::S_PoolStatistics::getHitRate( void ) const
+{
+    return (psAllocated != 0 ? static_cast<unsigned int>((psHits * 100u) / psAllocated) : 0u);
+}
+
+inline const char * EventPool::getName( void ) const
+{
+    return mName;
+}
@@ -38,6 +38,16 @@ EventQueue::EventQueue( IEQueueListener & eventListener, TEStack<Event *, Event
 //////////////////////////////////////////////////////////////////////////
 // EventQueue class, methods
 //////////////////////////////////////////////////////////////////////////
+bool EventQueue::isEmpty( void ) const
+{
+    return mEventQueue.isEmpty();
+}
+
+int EventQueue::getSize( void ) const
+{
+    return mEventQueue.getSize();
+}
+
 void EventQueue::pushEvent( Event& evendElem )
 {
     mEventListener.signalEvent( mEventQueue.pushLast(&evendElem) );
@@ -57,6 +67,28 @@ Event* EventQueue::popEvent( void )
     return result;
 }
 
+Event * EventQueue::popEvent( const RuntimeClassID & eventClassId )
+{
+    mEventQueue.lock();
+    Event * result = mEventQueue.isEmpty() == false ? mEventQueue.firstEntry() : nullptr;
+    if ( (result != nullptr) && (result->getRuntimeClassId() == eventClassId) && (result != static_cast<Event *>(&ExitEvent::getExitEvent())) )
+    {
+        mEventQueue.popFirst();
+        if ( mEventQueue.isEmpty() )
+        {
+            mEventListener.signalEvent( 0 );
+        }
+    }
+    else
+    {
+        result = nullptr;
+    }
+
+    mEventQueue.unlock();
+
+    return result;
+}
+
 void EventQueue::removeAllEvents(void)
 {
     mEventQueue.lock();
@@ -131,24 +163,10 @@ bool EventQueue::removePendingEvents( bool keepSpecials )
                 specials.pushLast(eventElem);
                 eventElem = nullptr;
             }
-            else if ( keepSpecials )
+            else if ( keepSpecials && isSpecialEvent(*eventElem) )
             {
-                ServiceResponseEvent* respEvent = RUNTIME_CAST(eventElem, ServiceResponseEvent);
-                if ( respEvent != nullptr)
-                {
-                    unsigned int respId = respEvent->getResponseId();
-                    if ( NEService::isConnectNotifyId(respId) )
-                    {
-                        OUTPUT_DBG("Keep response event with response ID NEService::SI_NOTIFY_CONNECT for target proxy [ %s ]"
-                                        , ProxyAddress::convAddressToPath(respEvent->getTargetProxy()).getString());
-                        specials.pushLast(eventElem);
-                        eventElem = nullptr;
-                    }
-                    else
-                    {
-                        ; // do nothing, should be removed!
-                    }
-                }
+                specials.pushLast(eventElem);
+                eventElem = nullptr;
             }
         }
 
@@ -164,6 +182,27 @@ bool EventQueue::removePendingEvents( bool keepSpecials )
     return (mEventQueue.isEmpty() == false);
 }
 
+bool EventQueue::isSpecialEvent( Event & eventElem )
+{
+    bool result = false;
+    if ( &eventElem == static_cast<Event *>(&ExitEvent::getExitEvent()) )
+    {
+        result = true;
+    }
+    else
+    {
+        ServiceResponseEvent* respEvent = RUNTIME_CAST(&eventElem, ServiceResponseEvent);
+        if ( (respEvent != nullptr) && NEService::isConnectNotifyId(respEvent->getResponseId()) )
+        {
+            OUTPUT_DBG("Keep response event with response ID NEService::SI_NOTIFY_CONNECT for target proxy [ %s ]"
+                            , ProxyAddress::convAddressToPath(respEvent->getTargetProxy()).getString());
+            result = true;
+        }
+    }
+
+    return result;
+}
+
 //////////////////////////////////////////////////////////////////////////
 // ExternalEventQueue class implementation
 //////////////////////////////////////////////////////////////////////////
@@ -207,3 +246,305 @@ inline InternalEventQueue & InternalEventQueue::self( void )
 {
     return (*this);
 }
+
+//////////////////////////////////////////////////////////////////////////
+// LockFreeEventQueue class implementation
+//////////////////////////////////////////////////////////////////////////
+
+LockFreeEventQueue::ExitMarker::ExitMarker( void )
+    : Event ( Event::eEventType::EventExternal )
+{
+}
+
+void LockFreeEventQueue::ExitMarker::destroy( void )
+{
+}
+
+LockFreeEventQueue::LockFreeEventQueue( IEQueueListener & eventListener )
+    : EventQueue    ( eventListener, static_cast<TEStack<Event *, Event *> &>(self()) )
+    , TELockStack<Event *, Event *>( )
+
+    , mPushedEvents ( nullptr )
+    , mEventCount   ( 0 )
+    , mExitQueued   ( false )
+    , mFirstEvent   ( nullptr )
+    , mLastEvent    ( nullptr )
+    , mExitMarker   ( )
+{
+    static_assert(std::atomic<Event *>::is_always_lock_free);
+}
+
+LockFreeEventQueue::~LockFreeEventQueue( void )
+{
+    lockQueue();
+    removePendingEvents( false );
+    mFirstEvent = nullptr;
+    mLastEvent  = nullptr;
+    unlockQueue();
+}
+
+bool LockFreeEventQueue::isEmpty( void ) const
+{
+    return (mEventCount.load() <= 0);
+}
+
+int LockFreeEventQueue::getSize( void ) const
+{
+    int result = mEventCount.load();
+    return (result > 0 ? result : 0);
+}
+
+void LockFreeEventQueue::pushEvent( Event & evendElem )
+{
+    Event * newEvent = &evendElem;
+    if ( newEvent == static_cast<Event *>(&ExitEvent::getExitEvent()) )
+    {
+        // queue the exit event only once
+        if ( mExitQueued.exchange(true) )
+            return;
+
+        newEvent = &mExitMarker;
+    }
+
+    mEventCount.fetch_add(1);
+
+    Event * lastEvent = mPushedEvents.load(std::memory_order_relaxed);
+    do
+    {
+        newEvent->mNextEvent = lastEvent;
+    } while ( mPushedEvents.compare_exchange_weak(lastEvent, newEvent) == false );
+
+    // signal only when switching from empty to non-empty state.
+    if ( lastEvent == nullptr )
+    {
+        mEventListener.signalEvent( 1 );
+    }
+}
+
+Event * LockFreeEventQueue::popEvent( void )
+{
+    lockQueue();
+
+    if ( mFirstEvent == nullptr )
+    {
+        _takePushedEvents();
+    }
+
+    Event * result = mFirstEvent;
+    if ( result != nullptr )
+    {
+        mFirstEvent = result->mNextEvent;
+        if ( mFirstEvent == nullptr )
+        {
+            mLastEvent = nullptr;
+        }
+
+        result->mNextEvent = nullptr;
+        mEventCount.fetch_sub(1);
+
+        if ( result == static_cast<Event *>(&mExitMarker) )
+        {
+            mExitQueued.store(false);
+            result = static_cast<Event *>(&ExitEvent::getExitEvent());
+        }
+    }
+
+    if ( mFirstEvent == nullptr )
+    {
+        _signalEmptyQueue();
+    }
+
+    unlockQueue();
+
+    return result;
+}
+
+Event * LockFreeEventQueue::popEvent( const RuntimeClassID & eventClassId )
+{
+    lockQueue();
+
+    if ( mFirstEvent == nullptr )
+    {
+        _takePushedEvents();
+    }
+
+    Event * result = mFirstEvent;
+    if ( (result != nullptr) && (result != static_cast<Event *>(&mExitMarker)) && (result->getRuntimeClassId() == eventClassId) )
+    {
+        mFirstEvent = result->mNextEvent;
+        if ( mFirstEvent == nullptr )
+        {
+            mLastEvent = nullptr;
+            _signalEmptyQueue();
+        }
+
+        result->mNextEvent = nullptr;
+        mEventCount.fetch_sub(1);
+    }
+    else
+    {
+        result = nullptr;
+    }
+
+    unlockQueue();
+
+    return result;
+}
+
+void LockFreeEventQueue::removeEvents( bool keepSpecials )
+{
+    lockQueue();
+    if ( removePendingEvents(keepSpecials) )
+    {
+        mEventListener.signalEvent( 1 );
+    }
+    else
+    {
+        _signalEmptyQueue();
+    }
+
+    unlockQueue();
+}
+
+int LockFreeEventQueue::removeEvents( const RuntimeClassID & eventClassId )
+{
+    int removedCount = 0;
+
+    if ( eventClassId != ExitEvent::getExitEvent().getRuntimeClassId() )
+    {
+        lockQueue();
+        _takePushedEvents();
+
+        Event * eventElem = mFirstEvent;
+        mFirstEvent = nullptr;
+        mLastEvent  = nullptr;
+        while ( eventElem != nullptr )
+        {
+            Event * nextEvent = eventElem->mNextEvent;
+            eventElem->mNextEvent = nullptr;
+            if ( (eventElem != static_cast<Event *>(&mExitMarker)) && (eventElem->getRuntimeClassId() == eventClassId) )
+            {
+                mEventCount.fetch_sub(1);
+                eventElem->destroy();
+                ++ removedCount;
+            }
+            else
+            {
+                if ( mLastEvent != nullptr )
+                    mLastEvent->mNextEvent = eventElem;
+                else
+                    mFirstEvent = eventElem;
+
+                mLastEvent = eventElem;
+            }
+
+            eventElem = nextEvent;
+        }
+
+        if ( mFirstEvent != nullptr )
+            mEventListener.signalEvent( 1 );
+        else
+            _signalEmptyQueue( );
+
+        unlockQueue();
+    }
+
+    return removedCount;
+}
+
+void LockFreeEventQueue::removeAllEvents( void )
+{
+    lockQueue();
+    _takePushedEvents();
+
+    while ( mFirstEvent != nullptr )
+    {
+        Event * eventElem = mFirstEvent;
+        mFirstEvent = eventElem->mNextEvent;
+        eventElem->mNextEvent = nullptr;
+        mEventCount.fetch_sub(1);
+        eventElem->destroy();
+    }
+
+    mLastEvent = nullptr;
+    mExitQueued.store(false);
+    _signalEmptyQueue();
+
+    unlockQueue();
+}
+
+bool LockFreeEventQueue::removePendingEvents( bool keepSpecials )
+{
+    lockQueue();
+    _takePushedEvents();
+
+    Event * eventElem = mFirstEvent;
+    mFirstEvent = nullptr;
+    mLastEvent  = nullptr;
+    while ( eventElem != nullptr )
+    {
+        Event * nextEvent = eventElem->mNextEvent;
+        eventElem->mNextEvent = nullptr;
+        if ( (eventElem == static_cast<Event *>(&mExitMarker)) || (keepSpecials && isSpecialEvent(*eventElem)) )
+        {
+            if ( mLastEvent != nullptr )
+                mLastEvent->mNextEvent = eventElem;
+            else
+                mFirstEvent = eventElem;
+
+            mLastEvent = eventElem;
+        }
+        else
+        {
+            mEventCount.fetch_sub(1);
+            eventElem->destroy();
+        }
+
+        eventElem = nextEvent;
+    }
+
+    unlockQueue();
+
+    return (mFirstEvent != nullptr);
+}
+
+void LockFreeEventQueue::_takePushedEvents( void )
+{
+    Event * pushedEvent = mPushedEvents.exchange(nullptr);
+    if ( pushedEvent != nullptr )
+    {
+        // The producers push in LIFO order, reverse the list to keep the order of events.
+        Event * lastEvent   = pushedEvent;
+        Event * firstEvent  = nullptr;
+        while ( pushedEvent != nullptr )
+        {
+            Event * nextEvent = pushedEvent->mNextEvent;
+            pushedEvent->mNextEvent = firstEvent;
+            firstEvent  = pushedEvent;
+            pushedEvent = nextEvent;
+        }
+
+        if ( mLastEvent != nullptr )
+            mLastEvent->mNextEvent = firstEvent;
+        else
+            mFirstEvent = firstEvent;
+
+        mLastEvent = lastEvent;
+    }
+}
+
+void LockFreeEventQueue::_signalEmptyQueue( void )
+{
+    // Reset the listener and check again, because the producer does not signal
+    // if the pushed event list was not empty when the consumer has checked it.
+    mEventListener.signalEvent( 0 );
+    if ( mPushedEvents.load() != nullptr )
+    {
+        mEventListener.signalEvent( 1 );
+    }
+}
+
+inline LockFreeEventQueue & LockFreeEventQueue::self( void )
+{
+    return (*this);
+}
@@ -21,11 +21,13 @@
 #include "areg/base/GEGlobal.h"
 #include "areg/base/TEStack.hpp"
 #include "areg/component/private/IEQueueListener.hpp"
+#include "areg/component/Event.hpp"
+
+#include <atomic>
 
 /************************************************************************
  * Dependencies
  ************************************************************************/
-class Event;
 class RuntimeClassID;
 
 //////////////////////////////////////////////////////////////////////////
@@ -82,18 +84,18 @@ public:
     /**
      * \brief   Returns true, if Event Queue is empty.
      **/
-    inline bool isEmpty( void ) const;
+    virtual bool isEmpty( void ) const;
 
     /**
      * \brief   Returns number of pending Events in the Queue.
      **/
-    inline int getSize( void ) const;
+    virtual int getSize( void ) const;
 
     /**
      * \brief   Pushes new Event in the Queue and notifies Event Listener
      *          about new Event element availability.
      **/
-    void pushEvent( Event & evendElem );
+    virtual void pushEvent( Event & evendElem );
 
     /**
      * \brief   Pops Event object from Queue and notifies Event Listener if
@@ -102,7 +104,17 @@ public:
      *          If Queue was not empty, it will return valid pointer.
      *          If Queue was empty, it will return nullptr.
      **/
-    Event * popEvent( void );
+    virtual Event * popEvent( void );
+
+    /**
+     * \brief   Pops the first Event object from Queue only if it is an instance of
+     *          specified runtime class. Notifies Event Listener if there is no more
+     *          Event element in the Queue left. The call never pops exit event.
+     * \param   eventClassId    Runtime class ID of Event object to pop from the Queue.
+     * \return  Returns the first pending Event object if it is an instance of specified class.
+     *          Otherwise, returns nullptr and the Queue remains unchanged.
+     **/
+    virtual Event * popEvent( const RuntimeClassID & eventClassId );
 
     /**
      * \brief   Removes all Event elements from the Queue and if keepSpecials is true,
@@ -116,7 +128,7 @@ public:
      *                          except predefined special Exit Event (ExitEvent).
      *                          Otherwise it will remove all elements.
      **/
-    void removeEvents( bool keepSpecials );
+    virtual void removeEvents( bool keepSpecials );
 
     /**
      * \brief   Removes the specified Runtime Event objects from the Queue and returns
@@ -127,7 +139,7 @@ public:
      * \param   eventClassId    Runtime class ID of Event object to remove from the Queue.
      * \return  Returns number of removed Events from the Queue.
      **/
-    int removeEvents( const RuntimeClassID & eventClassId );
+    virtual int removeEvents( const RuntimeClassID & eventClassId );
 
     /**
      * \brief   Removes all events. Makes event queue empty
@@ -149,17 +161,27 @@ protected:
      *                          except predefined special Exit Event (ExitEvent).
      *                          Otherwise it will remove all elements.
      **/
-    bool removePendingEvents( bool keepSpecials );
+    virtual bool removePendingEvents( bool keepSpecials );
+
+    /**
+     * \brief   Returns true if the Event should be kept in the queue when
+     *          special events are requested to be kept. These are the
+     *          exit event and the service connection notification responses.
+     * \param   eventElem   The Event object to check.
+     **/
+    static bool isSpecialEvent( Event & eventElem );
 
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
-private:
+protected:
     /**
      * \brief   Queue Listener object, which is signaled every time 
      *          new Event is pushed or removed.
      **/
     IEQueueListener &           mEventListener;
+
+private:
     /**
      * \brief   Event queue stack object, which stores event elements
      **/
@@ -275,6 +297,198 @@ private:
     DECLARE_NOCOPY_NOMOVE( InternalEventQueue );
 };
 
+//////////////////////////////////////////////////////////////////////////
+// LockFreeEventQueue class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   Lock-free external event queue, which is accessed from many threads.
+ *          The queue is multiple-producer / single-consumer. The events are linked
+ *          through the field of Event object, so that queuing an event requires
+ *          neither locking nor allocation. Producers push events in the atomic
+ *          list and signal Event Listener only when the list switches from empty
+ *          to non-empty state. The consumer takes all pushed events at once and
+ *          dispatches them in the order they have been queued.
+ *          The resource lock of the queue is used only by the consumer side
+ *          operations like popping and removing events, so that those operations
+ *          can be safely called from any thread.
+ *          Enable the queue by defining ENABLE_LOCKFREE_QUEUE preprocessor directive.
+ **/
+class AREG_API LockFreeEventQueue   : public    EventQueue
+                                    , private   TELockStack<Event *, Event *>
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The exit event is a shared singleton and cannot be linked
+     *          in the queue. Instead, the marker object of the queue is
+     *          linked and the exit event is returned when marker is popped.
+     **/
+    class ExitMarker : public Event
+    {
+    public:
+        ExitMarker( void );
+        virtual ~ExitMarker( void ) = default;
+        virtual void destroy( void ) override;
+    };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Initialization constructor.
+     *          Event Listener object, which is signaled when Queue is receiving 
+     *          new Event object or when Queue is empty.
+     * \param   eventListener   The Event Listener object, which should
+     *                          be signaled when receive new Event or when
+     *                          the Queue is empty.
+     **/
+    LockFreeEventQueue( IEQueueListener & eventListener );
+
+    /**
+     * \brief   Destructor
+     **/
+    virtual ~LockFreeEventQueue( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Overrides
+//////////////////////////////////////////////////////////////////////////
+public:
+/************************************************************************/
+// EventQueue overrides
+/************************************************************************/
+
+    /**
+     * \brief   Returns true, if Event Queue is empty.
+     **/
+    virtual bool isEmpty( void ) const override;
+
+    /**
+     * \brief   Returns number of pending Events in the Queue.
+     **/
+    virtual int getSize( void ) const override;
+
+    /**
+     * \brief   Pushes new Event in the Queue without locking. Notifies Event Listener
+     *          only if the queue of pushed events was empty.
+     **/
+    virtual void pushEvent( Event & evendElem ) override;
+
+    /**
+     * \brief   Pops Event object from Queue and notifies Event Listener if
+     *          there is no more Event element in the Queue left.
+     * \return  Returns Event object pending in FIFO Stack.
+     *          If Queue was not empty, it will return valid pointer.
+     *          If Queue was empty, it will return nullptr.
+     **/
+    virtual Event * popEvent( void ) override;
+
+    /**
+     * \brief   Pops the first Event object from Queue only if it is an instance of
+     *          specified runtime class. The call never pops exit event.
+     * \param   eventClassId    Runtime class ID of Event object to pop from the Queue.
+     * \return  Returns the first pending Event object if it is an instance of specified class.
+     *          Otherwise, returns nullptr and the Queue remains unchanged.
+     **/
+    virtual Event * popEvent( const RuntimeClassID & eventClassId ) override;
+
+    /**
+     * \brief   Removes all Event elements from the Queue and if keepSpecials is true,
+     *          it will not remove special events. The exit event is never removed.
+     * \param   keepSpecials    If true, it keeps special events in the queue.
+     **/
+    virtual void removeEvents( bool keepSpecials ) override;
+
+    /**
+     * \brief   Removes the specified Runtime Event objects from the Queue and returns
+     *          the number of removed Events.
+     * \param   eventClassId    Runtime class ID of Event object to remove from the Queue.
+     * \return  Returns number of removed Events from the Queue.
+     **/
+    virtual int removeEvents( const RuntimeClassID & eventClassId ) override;
+
+    /**
+     * \brief   Removes all events. Makes event queue empty
+     **/
+    virtual void removeAllEvents( void ) override;
+
+protected:
+    /**
+     * \brief   Removes all Event elements from the Queue except exit event, and if
+     *          keepSpecials is true, it will not remove special events.
+     *          The method does not send any signal to Event Listener object.
+     * \param   keepSpecials    If true, it keeps special events in the queue.
+     * \return  Returns true if queue still contains events.
+     **/
+    virtual bool removePendingEvents( bool keepSpecials ) override;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Moves all events pushed by producers in the list of consumer
+     *          by keeping the order of events. Should be called when queue is locked.
+     **/
+    void _takePushedEvents( void );
+
+    /**
+     * \brief   Called when the list of consumer is empty. Resets the state of
+     *          Event Listener and signals it again if a producer has pushed
+     *          an event in the meantime. Should be called when queue is locked.
+     **/
+    void _signalEmptyQueue( void );
+
+    /**
+     * \brief   Returns instance of LockFreeEventQueue object
+     **/
+    inline LockFreeEventQueue & self( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+    /**
+     * \brief   The last pushed event. Producers link events in LIFO order.
+     **/
+    std::atomic<Event *>    mPushedEvents;
+    /**
+     * \brief   The number of events in the queue.
+     **/
+    std::atomic_int         mEventCount;
+    /**
+     * \brief   The flag, indicating whether the exit marker is queued.
+     **/
+    std::atomic_bool        mExitQueued;
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(default: 4251)
+#endif  // _MSC_VER
+    /**
+     * \brief   The first event in the list of consumer.
+     **/
+    Event *                 mFirstEvent;
+    /**
+     * \brief   The last event in the list of consumer.
+     **/
+    Event *                 mLastEvent;
+    /**
+     * \brief   The marker linked in the queue instead of exit event.
+     **/
+    ExitMarker              mExitMarker;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden method calls.
+//////////////////////////////////////////////////////////////////////////
+private:
+    LockFreeEventQueue( void ) = delete;
+    DECLARE_NOCOPY_NOMOVE( LockFreeEventQueue );
+};
+
 //////////////////////////////////////////////////////////////////////////
 // EventQueue class inline functions implementation
 //////////////////////////////////////////////////////////////////////////
@@ -287,13 +501,3 @@ inline void EventQueue::unlockQueue( void )
 {
     mEventQueue.unlock();
 }
-
-inline bool EventQueue::isEmpty( void ) const
-{
-    return mEventQueue.isEmpty();
-}
-
-inline int EventQueue::getSize( void ) const
-{
-    return mEventQueue.getSize();
-}
@@ -27,8 +27,19 @@ void IETimerConsumer::processEvent( const TimerEventData & /* data */ )
 
 void IETimerConsumer::startEventProcessing( Event& eventElem )
 {
+    Timer *timer = nullptr;
     TimerEvent* timerEvent = static_cast<TimerEvent *>( RUNTIME_CAST(&eventElem, TimerEvent) );
-    Timer *timer = timerEvent != nullptr ? timerEvent->getData().getTimer() : nullptr;
+    if ( timerEvent != nullptr )
+    {
+        timer = timerEvent->getData().getTimer();
+    }
+    else
+    {
+        // the batch of expired timers is dispatched one by one.
+        TimerBatchEvent * batchEvent = static_cast<TimerBatchEvent *>( RUNTIME_CAST(&eventElem, TimerBatchEvent) );
+        timer = batchEvent != nullptr ? batchEvent->getCurrentTimer() : nullptr;
+    }
+
     if (timer != nullptr )
     {
         processTimer(*timer);
@@ -77,45 +77,58 @@ AREG_API const NERegistry::Model                  NERegistry::INVALID_MODEL;
 // class NERegistry::ServiceEntry implementation
 //////////////////////////////////////////////////////////////////////////
 
+NERegistry::ServiceEntry::ServiceEntry( void )
+    : mName         ( )
+    , mVersion      ( )
+    , mDirectCall   ( false )
+{
+}
+
 NERegistry::ServiceEntry::ServiceEntry( const char* serviceName, unsigned int major, unsigned int minor, unsigned int patch )
-    : mName     ( serviceName )
-    , mVersion  ( major, minor, patch )
+    : mName         ( serviceName )
+    , mVersion      ( major, minor, patch )
+    , mDirectCall   ( false )
 {
     ASSERT( mName.isEmpty( ) == false );
     ASSERT( mVersion.isValid( ) );
 }
 
-NERegistry::ServiceEntry::ServiceEntry( const char* serviceName, const Version & version )
-    : mName     (serviceName)
-    , mVersion  (version)
+NERegistry::ServiceEntry::ServiceEntry( const char* serviceName, const Version & version, bool directCall /*= false*/ )
+    : mName         (serviceName)
+    , mVersion      (version)
+    , mDirectCall   (directCall)
 {
     ASSERT( mName.isEmpty() == false );
 }
 
 NERegistry::ServiceEntry::ServiceEntry( const NERegistry::ServiceEntry & src )
-    : mName     (src.mName)
-    , mVersion  (src.mVersion)
+    : mName         (src.mName)
+    , mVersion      (src.mVersion)
+    , mDirectCall   (src.mDirectCall)
 {
 }
 
 NERegistry::ServiceEntry::ServiceEntry( NERegistry::ServiceEntry && src ) noexcept
-    : mName     ( std::move(src.mName) )
-    , mVersion  ( std::move(src.mVersion) )
+    : mName         ( std::move(src.mName) )
+    , mVersion      ( std::move(src.mVersion) )
+    , mDirectCall   ( src.mDirectCall )
 {
 }
 
 NERegistry::ServiceEntry & NERegistry::ServiceEntry::operator = ( const NERegistry::ServiceEntry & src )
 {
-    mName   = src.mName;
-    mVersion= src.mVersion;
-    
+    mName       = src.mName;
+    mVersion    = src.mVersion;
+    mDirectCall = src.mDirectCall;
+
     return (*this);
 }
 
 NERegistry::ServiceEntry & NERegistry::ServiceEntry::operator = ( NERegistry::ServiceEntry && src ) noexcept
 {
-    mName   = std::move(src.mName);
-    mVersion= std::move(src.mVersion);
+    mName       = std::move(src.mName);
+    mVersion    = std::move(src.mVersion);
+    mDirectCall = src.mDirectCall;
 
     return (*this);
 }
@@ -172,36 +185,49 @@ bool NERegistry::ServiceList::isValid( void ) const
 // class NERegistry::WorkerThreadEntry implementation
 //////////////////////////////////////////////////////////////////////////
 
-NERegistry::WorkerThreadEntry::WorkerThreadEntry( const char * masterThreadName, const char* workerThreadName, const char * compRoleName, const char* compConsumerName )
-    : mThreadName   (NEUtilities::createComponentItemName(masterThreadName, workerThreadName))
-    , mConsumerName (NEUtilities::createComponentItemName(compRoleName, compConsumerName))
+NERegistry::WorkerThreadEntry::WorkerThreadEntry( void )
+    : mThreadName       ( )
+    , mConsumerName     ( )
+    , mThreadAttributes ( Thread::DEFAULT_THREAD_ATTRIBUTES )
+{
+}
+
+NERegistry::WorkerThreadEntry::WorkerThreadEntry( const char * masterThreadName, const char* workerThreadName, const char * compRoleName, const char* compConsumerName
+                                                , const Thread::sThreadAttributes & attributes /*= Thread::DEFAULT_THREAD_ATTRIBUTES*/ )
+    : mThreadName       (NEUtilities::createComponentItemName(masterThreadName, workerThreadName))
+    , mConsumerName     (NEUtilities::createComponentItemName(compRoleName, compConsumerName))
+    , mThreadAttributes (attributes)
 {
 }
 
 NERegistry::WorkerThreadEntry::WorkerThreadEntry( const NERegistry::WorkerThreadEntry &src )
-    : mThreadName   (src.mThreadName)
-    , mConsumerName (src.mConsumerName)
+    : mThreadName       (src.mThreadName)
+    , mConsumerName     (src.mConsumerName)
+    , mThreadAttributes (src.mThreadAttributes)
 {
 }
 
 NERegistry::WorkerThreadEntry::WorkerThreadEntry( NERegistry::WorkerThreadEntry &&src ) noexcept
-    : mThreadName   ( std::move(src.mThreadName) )
-    , mConsumerName ( std::move(src.mConsumerName) )
+    : mThreadName       ( std::move(src.mThreadName) )
+    , mConsumerName     ( std::move(src.mConsumerName) )
+    , mThreadAttributes ( src.mThreadAttributes )
 {
 }
 
 NERegistry::WorkerThreadEntry & NERegistry::WorkerThreadEntry::operator = ( const NERegistry::WorkerThreadEntry & src )
 {
-    mThreadName     = src.mThreadName;
-    mConsumerName   = src.mConsumerName;
+    mThreadName         = src.mThreadName;
+    mConsumerName       = src.mConsumerName;
+    mThreadAttributes   = src.mThreadAttributes;
 
     return (*this);
 }
 
 NERegistry::WorkerThreadEntry & NERegistry::WorkerThreadEntry::operator = ( NERegistry::WorkerThreadEntry && src ) noexcept
 {
-    mThreadName     = std::move(src.mThreadName);
-    mConsumerName   = std::move(src.mConsumerName);
+    mThreadName         = std::move(src.mThreadName);
+    mConsumerName       = std::move(src.mConsumerName);
+    mThreadAttributes   = src.mThreadAttributes;
 
     return (*this);
 }
@@ -720,42 +746,62 @@ bool NERegistry::ComponentList::setComponentData( const char * roleName, NEMemor
 // class NERegistry::ComponentThreadEntry implementation
 //////////////////////////////////////////////////////////////////////////
 
+NERegistry::ComponentThreadEntry::ComponentThreadEntry( void )
+    : mThreadName       ( )
+    , mComponents       ( )
+    , mThreadAttributes ( Thread::DEFAULT_THREAD_ATTRIBUTES )
+{
+}
+
 NERegistry::ComponentThreadEntry::ComponentThreadEntry( const char* threadName )
-    : mThreadName   (threadName)
-    , mComponents   ( )
+    : mThreadName       (threadName)
+    , mComponents       ( )
+    , mThreadAttributes ( Thread::DEFAULT_THREAD_ATTRIBUTES )
+{
+}
+
+NERegistry::ComponentThreadEntry::ComponentThreadEntry( const char* threadName, const Thread::sThreadAttributes & attributes )
+    : mThreadName       (threadName)
+    , mComponents       ( )
+    , mThreadAttributes (attributes)
 {
 }
 
 NERegistry::ComponentThreadEntry::ComponentThreadEntry( const char* threadName, const NERegistry::ComponentList& supCompList )
-    : mThreadName   (threadName)
-    , mComponents   (supCompList)
+    : mThreadName       (threadName)
+    , mComponents       (supCompList)
+    , mThreadAttributes ( Thread::DEFAULT_THREAD_ATTRIBUTES )
 {
 }
 
 NERegistry::ComponentThreadEntry::ComponentThreadEntry( const NERegistry::ComponentThreadEntry& src )
-    : mThreadName   (src.mThreadName)
-    , mComponents   (src.mComponents)
+    : mThreadName       (src.mThreadName)
+    , mComponents       (src.mComponents)
+    , mThreadAttributes (src.mThreadAttributes)
 {
 }
 
 NERegistry::ComponentThreadEntry::ComponentThreadEntry( NERegistry::ComponentThreadEntry && src ) noexcept
-    : mThreadName   ( std::move(src.mThreadName) )
-    , mComponents   ( std::move(src.mComponents) )
+    : mThreadName       ( std::move(src.mThreadName) )
+    , mComponents       ( std::move(src.mComponents) )
+    , mThreadAttributes ( src.mThreadAttributes )
 {
 }
 
 NERegistry::ComponentThreadEntry & NERegistry::ComponentThreadEntry::operator = ( const NERegistry::ComponentThreadEntry & src )
 {
-    mThreadName = src.mThreadName;
-    mComponents = src.mComponents;
+    mThreadName         = src.mThreadName;
+    mComponents         = src.mComponents;
+    mThreadAttributes   = src.mThreadAttributes;
     
     return (*this);
 }
 
 NERegistry::ComponentThreadEntry & NERegistry::ComponentThreadEntry::operator = ( NERegistry::ComponentThreadEntry && src ) noexcept
 {
-    mThreadName = std::move(src.mThreadName);
-    mComponents = std::move(src.mComponents);
+    mThreadName         = std::move(src.mThreadName);
+    mComponents         = std::move(src.mComponents);
+    mThreadAttributes   = src.mThreadAttributes;
     
     return (*this);
 }
@@ -21,6 +21,7 @@
 #include "areg/component/ServiceRequestEvent.hpp"
 #include "areg/component/DispatcherThread.hpp"
 #include "areg/component/StubAddress.hpp"
+#include "areg/component/private/ServiceAddressTable.hpp"
 
 #include <string_view>
 #include <utility>
@@ -79,6 +80,7 @@ ProxyAddress::ProxyAddress( void )
     : ServiceAddress( ServiceItem(), INVALID_PROXY_NAME.data() )
     , mThreadName   ( ThreadAddress::INVALID_THREAD_ADDRESS.getThreadName() )
     , mChannel      ( )
+    , mHandle       ( NEService::HANDLE_INVALID )
     , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
 {
 }
@@ -87,6 +89,7 @@ ProxyAddress::ProxyAddress( const char * serviceName, const Version & serviceVer
     : ServiceAddress( serviceName, serviceVersion, serviceType, roleName )
     , mThreadName   ( threadName )
     , mChannel      ( )
+    , mHandle       ( NEService::HANDLE_INVALID )
     , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
 {
     setThread( threadName );
@@ -98,6 +101,7 @@ ProxyAddress::ProxyAddress( const ServiceItem & service, const char * roleName,
     : ServiceAddress( service, roleName )
     , mThreadName   ( "" )
     , mChannel      ( )
+    , mHandle       ( NEService::HANDLE_INVALID )
     , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
 {
     setThread( threadName );
@@ -109,6 +113,7 @@ ProxyAddress::ProxyAddress(const NEService::SInterfaceData & siData, const char
     : ServiceAddress( siData.idServiceName, siData.idVersion, siData.idServiceType, roleName )
     , mThreadName   ( "" )
     , mChannel      ( )
+    , mHandle       ( NEService::HANDLE_INVALID )
     , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
 {
     setThread(threadName);
@@ -120,6 +125,7 @@ ProxyAddress::ProxyAddress( const ProxyAddress & source )
     : ServiceAddress( static_cast<const ServiceAddress &>(source) )
     , mThreadName   ( source.mThreadName )
     , mChannel      ( source.mChannel )
+    , mHandle       ( source.mHandle )
     , mMagicNum     ( source.mMagicNum )
 {
 }
@@ -128,6 +134,7 @@ ProxyAddress::ProxyAddress( ProxyAddress && source ) noexcept
     : ServiceAddress( static_cast<ServiceAddress &&>(source) )
     , mThreadName   ( std::move(source.mThreadName) )
     , mChannel      ( std::move(source.mChannel) )
+    , mHandle       ( source.mHandle )
     , mMagicNum     ( source.mMagicNum )
 {
 }
@@ -136,10 +143,12 @@ ProxyAddress::ProxyAddress( const IEInStream & stream )
     : ServiceAddress( stream )
     , mThreadName   ( stream )
     , mChannel      ( )
+    , mHandle       ( NEService::HANDLE_INVALID )
     , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
 {
     ITEM_ID cookie = NEService::COOKIE_LOCAL;
     stream >> cookie;
+    stream >> mHandle;
     if ( ServiceAddress::isValid() )
         mChannel.setCookie(cookie);
 
@@ -269,12 +278,48 @@ bool ProxyAddress::isValidated(void) const
     return ServiceAddress::isValidated() && (mThreadName.isEmpty() == false) && (mThreadName != ThreadAddress::INVALID_THREAD_ADDRESS.getThreadName());
 }
 
+void ProxyAddress::writeInterned( IEOutStream & stream, bool complete /*= false*/ ) const
+{
+    if ( complete || (mHandle == NEService::HANDLE_INVALID) )
+    {
+        // the invalid handle means that the complete address follows.
+        constexpr unsigned int handle{ NEService::HANDLE_INVALID };
+        stream << handle;
+        stream << *this;
+    }
+    else
+    {
+        stream << mHandle;
+        stream << ServiceAddressTable::getOwnerCookie( mChannel.getCookie() );
+    }
+}
+
+void ProxyAddress::readInterned( const IEInStream & stream )
+{
+    unsigned int handle = NEService::HANDLE_INVALID;
+    stream >> handle;
+    if ( handle != NEService::HANDLE_INVALID )
+    {
+        ITEM_ID cookie = NEService::COOKIE_UNKNOWN;
+        stream >> cookie;
+        if ( ServiceAddressTable::findProxy( cookie, handle, *this ) == false )
+        {
+            *this = ProxyAddress::INVALID_PROXY_ADDRESS;
+        }
+    }
+    else
+    {
+        stream >> *this;
+    }
+}
+
 AREG_API const IEInStream & operator >> ( const IEInStream & stream, ProxyAddress & input )
 {
     ITEM_ID cookie = NEService::COOKIE_LOCAL;
     stream >> static_cast<ServiceAddress &>(input);
     stream >> input.mThreadName;
     stream >> cookie;
+    stream >> input.mHandle;
 
     input.setCookie(cookie);
     input.mMagicNum = ProxyAddress::_magicNumber(input);
@@ -287,6 +332,7 @@ AREG_API IEOutStream & operator << ( IEOutStream & stream, const ProxyAddress &
     stream << static_cast<const ServiceAddress &>(output);
     stream << output.mThreadName;
     stream << output.mChannel.getCookie();
+    stream << output.mHandle;
     
     return stream;
 }
@@ -23,9 +23,12 @@
 #include "areg/component/ServiceRequestEvent.hpp"
 #include "areg/component/NotificationEvent.hpp"
 #include "areg/component/IEProxyListener.hpp"
+#include "areg/component/StubBase.hpp"
+#include "areg/component/ComponentThread.hpp"
 
 #include "areg/component/private/ProxyConnectEvent.hpp"
 #include "areg/component/private/ComponentInfo.hpp"
+#include "areg/component/private/ServiceAddressTable.hpp"
 #include "areg/component/private/ServiceManager.hpp"
 
 #include "areg/trace/GETrace.h"
@@ -272,6 +275,7 @@ ProxyBase::ProxyBase(const char* roleName, const NEService::SInterfaceData & ser
     , mListConnect      (   )
     , mIsConnected      ( false )
     , mIsStopped        ( false )
+    , mDirectCall       ( false )
 
     , mProxyData        ( serviceIfData )
 
@@ -280,6 +284,9 @@ ProxyBase::ProxyBase(const char* roleName, const NEService::SInterfaceData & ser
     , mProxyInstCount   ( 0 )
 {
     ASSERT(mDispatcherThread.isValid());
+    mProxyAddress.setHandle( ServiceAddressTable::createHandle() );
+    ServiceAddressTable::registerProxy( NEService::COOKIE_LOCAL, mProxyAddress );
+
     _mapRegisteredProxies.registerResourceObject(mProxyAddress, this);
     _mapThreadProxies.registerResourceObject(mDispatcherThread.getName(), this);
 }
@@ -288,6 +295,7 @@ ProxyBase::~ProxyBase( void )
 {
     _mapRegisteredProxies.unregisterResourceObject(mProxyAddress);
     _mapThreadProxies.unregisterResourceObject(mDispatcherThread.getName(), this, true);
+    ServiceAddressTable::unregisterProxy( NEService::COOKIE_LOCAL, mProxyAddress.getHandle() );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -362,12 +370,15 @@ void ProxyBase::serviceConnectionUpdated( const StubAddress & server, const Chan
         mProxyAddress.setChannel(channel);
         if ( status == NEService::eServiceConnection::ServiceConnected )
         {
+            StubBase * stub = server.isLocalAddress() && (static_cast<id_type>(server.getSource()) == mDispatcherThread.getId()) ? StubBase::findStubByAddress(server) : nullptr;
             mIsConnected = true;
+            mDirectCall  = (stub != nullptr) && stub->isDirectCall();
             mStubAddress = server;
         }
         else
         {
             mIsConnected = false;
+            mDirectCall  = false;
             mStubAddress = StubAddress::INVALID_STUB_ADDRESS;
             mProxyData.resetStates();
         }
@@ -566,7 +577,7 @@ void ProxyBase::sendRequestEvent( unsigned int reqId, const EventDataStream& arg
             evenElem->setSequenceNumber(mSequenceCount);
         }
 
-        mProxyAddress.deliverServiceEvent(*evenElem);
+        _deliverRequestEvent(*evenElem);
     }
 }
 
@@ -575,7 +586,32 @@ void ProxyBase::sendNotificationRequestEvent( unsigned int msgId, NEService::eRe
     ServiceRequestEvent* notifyEvent = createNotificationRequestEvent(msgId, reqType);
     if (notifyEvent != nullptr)
     {
-        mProxyAddress.deliverServiceEvent( *notifyEvent );
+        _deliverRequestEvent( *notifyEvent );
+    }
+}
+
+void ProxyBase::_deliverRequestEvent( ServiceRequestEvent & eventElem )
+{
+    // The request is processed in the context of the call only if no other event
+    // can be overtaken and no stub is processing a request, so that stubs are never re-entered.
+    StubBase * stub = nullptr;
+    if (   mDirectCall
+        && (Thread::getCurrentThreadId() == mDispatcherThread.getId())
+        && (ComponentThread::getCurrentComponent() == nullptr)
+        && (mDispatcherThread.hasPendingEvents() == false) )
+    {
+        stub = StubBase::findStubByAddress( mStubAddress );
+    }
+
+    if ( stub != nullptr )
+    {
+        eventElem.registerForThread( &mDispatcherThread );
+        eventElem.dispatchSelf( static_cast<IEEventConsumer *>(stub) );
+        eventElem.destroy( );
+    }
+    else
+    {
+        mProxyAddress.deliverServiceEvent( eventElem );
     }
 }
 
@@ -646,6 +682,7 @@ void ProxyBase::stopProxy(void)
         ServiceManager::requestUnregisterClient( getProxyAddress( ) );
         mDispatcherThread.removeConsumer( *this );
 
+        mDirectCall  = false;
         mStubAddress = StubAddress::INVALID_STUB_ADDRESS;
         mProxyData.resetStates();
         mProxyAddress.setChannel(Channel::INVALID_CHANNEL);
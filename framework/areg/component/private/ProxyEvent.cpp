@@ -40,8 +40,9 @@ ProxyEvent::ProxyEvent( const ProxyAddress & targetProxy, Event::eEventType even
 
 ProxyEvent::ProxyEvent( const IEInStream & stream )
     : StreamableEvent       ( stream )
-    , mTargetProxyAddress   ( stream )
+    , mTargetProxyAddress   ( )
 {
+    mTargetProxyAddress.readInterned(stream);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -68,14 +69,14 @@ void ProxyEvent::deliverEvent( void )
 const IEInStream & ProxyEvent::readStream( const IEInStream & stream )
 {
     StreamableEvent::readStream(stream);
-    stream >> mTargetProxyAddress;
+    mTargetProxyAddress.readInterned(stream);
     return stream;
 }
 
 IEOutStream & ProxyEvent::writeStream( IEOutStream & stream ) const
 {
     StreamableEvent::writeStream(stream);
-    stream << mTargetProxyAddress;
+    mTargetProxyAddress.writeInterned(stream);
     return stream;
 }
 
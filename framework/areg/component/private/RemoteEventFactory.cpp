@@ -26,6 +26,7 @@
 
 #include "areg/trace/GETrace.h"
 DEF_TRACE_SCOPE(areg_component_RemoteEventFactory_createEventFromStream);
+DEF_TRACE_SCOPE(areg_component_RemoteEventFactory_createEventsFromMulticast);
 DEF_TRACE_SCOPE(areg_component_RemoteEventFactory_createStreamFromEvent);
 DEF_TRACE_SCOPE(areg_component_RemoteEventFactory_createRequestFailedEvent);
 
@@ -44,7 +45,7 @@ StreamableEvent * RemoteEventFactory::createEventFromStream( const RemoteMessage
     case Event::eEventType::EventRemoteServiceRequest:
         {
             StubAddress addrStub;
-            stream >> addrStub;
+            addrStub.readInterned(stream);
             if ( comChannel.getCookie() == addrStub.getCookie() )
             {
                 addrStub.setCookie( NEService::COOKIE_LOCAL );
@@ -77,7 +78,7 @@ StreamableEvent * RemoteEventFactory::createEventFromStream( const RemoteMessage
     case Event::eEventType::EventRemoteNotifyRequest:
         {
             StubAddress addrStub;
-            stream >> addrStub;
+            addrStub.readInterned(stream);
             if ( comChannel.getCookie() == addrStub.getCookie() )
             {
                 addrStub.setCookie( NEService::COOKIE_LOCAL );
@@ -110,7 +111,7 @@ StreamableEvent * RemoteEventFactory::createEventFromStream( const RemoteMessage
     case Event::eEventType::EventRemoteServiceResponse:
         {
             ProxyAddress addrProxy;
-            stream >> addrProxy;
+            addrProxy.readInterned(stream);
             if ( comChannel.getCookie() == addrProxy.getCookie() )
                 addrProxy.setCookie( NEService::COOKIE_LOCAL );
             ProxyBase * proxy = ProxyBase::findProxyByAddress(addrProxy);
@@ -169,6 +170,56 @@ StreamableEvent * RemoteEventFactory::createEventFromStream( const RemoteMessage
     return result;
 }
 
+int RemoteEventFactory::createEventsFromMulticast( const RemoteMessage & stream, const Channel & comChannel, TEArrayList<StreamableEvent *, StreamableEvent *> & OUT out_listEvents )
+{
+    TRACE_SCOPE(areg_component_RemoteEventFactory_createEventsFromMulticast);
+
+    // the message contains the addresses of all proxies to notify, followed by event data.
+    ServiceResponseEvent::ListTargets listTargets;
+    stream.moveToBegin();
+    stream >> listTargets;
+    unsigned int position = stream.getPosition();
+
+    Event::eEventType eventType;
+    stream >> eventType;
+
+    if ( eventType == Event::eEventType::EventRemoteServiceResponse )
+    {
+        // notify only the listed proxies of this process, the other proxies of the service have not subscribed.
+        for ( int i = 0; i < listTargets.getSize(); ++ i )
+        {
+            ProxyAddress addrProxy( listTargets[i] );
+            if ( comChannel.getCookie() != addrProxy.getCookie() )
+                continue;
+
+            addrProxy.setCookie( NEService::COOKIE_LOCAL );
+            ProxyBase * proxy = ProxyBase::findProxyByAddress(addrProxy);
+            if ( proxy != nullptr )
+            {
+                stream.setPosition( static_cast<int>(position), IECursorPosition::eCursorPosition::PositionBegin );
+                RemoteResponseEvent * eventResponse = proxy->createRemoteResponseEvent(stream);
+                if ( eventResponse != nullptr )
+                {
+                    eventResponse->setTargetProxy( proxy->getProxyAddress() );
+                    out_listEvents.add( static_cast<StreamableEvent *>(eventResponse) );
+                }
+            }
+        }
+
+        TRACE_DBG("Created [ %d ] events of multicast message [ 0x%X ] with [ %d ] targets received via channel [ %s ]"
+                    , out_listEvents.getSize()
+                    , static_cast<uint32_t>(stream.getMessageId())
+                    , listTargets.getSize()
+                    , comChannel.convToString().getString());
+    }
+    else
+    {
+        TRACE_ERR("Unexpected multicast event [ %s ], ignoring message", Event::getString(eventType));
+    }
+
+    return out_listEvents.getSize();
+}
+
 bool RemoteEventFactory::createStreamFromEvent( RemoteMessage & stream, const StreamableEvent & eventStreamable, const Channel & comChannel )
 {
     bool result = false;
@@ -229,12 +280,26 @@ bool RemoteEventFactory::createStreamFromEvent( RemoteMessage & stream, const St
             const ServiceResponseEvent * proxyEvent = RUNTIME_CONST_CAST(&eventStreamable, ServiceResponseEvent);
             if ( proxyEvent != nullptr )
             {
+                if ( proxyEvent->isMulticast() )
+                {
+                    // the router removes the list of cookies, the receivers get the addresses of proxies to notify.
+                    const ServiceResponseEvent::ListTargets & listTargets = proxyEvent->getMulticastTargets();
+                    TEArrayList<ITEM_ID, ITEM_ID> listCookies;
+                    for ( int i = 0; i < listTargets.getSize(); ++ i )
+                    {
+                        listCookies.addUnique( listTargets[i].getCookie() );
+                    }
+
+                    stream << listCookies;
+                    stream << listTargets;
+                }
+
                 eventStreamable.writeStream(stream);
                 if ( stream.isValid() )
                 {
                     result = true;
                     stream.setSource( comChannel.getCookie() );
-                    stream.setTarget( proxyEvent->getTargetProxy().getCookie() );
+                    stream.setTarget( proxyEvent->isMulticast() ? NEService::TARGET_MULTICAST : proxyEvent->getTargetProxy().getCookie() );
                     stream.setMessageId( proxyEvent->getResponseId() );
                     stream.setResult( NEMemory::MESSAGE_SUCCESS );
                     stream.setSequenceNr( proxyEvent->getSequenceNumber() );
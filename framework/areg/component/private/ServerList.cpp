@@ -44,44 +44,34 @@ MAPPOS ServerList::findServer( const StubAddress & whichServer ) const
 
     ServerInfo server(whichServer);
 
-    const unsigned int hash = getHashKey(server);
-    ServiceBlock** block    = &mHashTable[hash % mHashTableSize];
-
-    for ( ; *block != nullptr; block = &(*block)->mNext)
+    MAPPOS pos = firstHashPosition( getHashKey(server) );
+    for ( ; pos != nullptr; pos = nextHashPosition(pos) )
     {
-        if ( hash == (*block)->mHash )
+        if ( static_cast<const ServiceAddress &>(whichServer) == static_cast<const ServiceAddress &>(keyAtPosition(pos).getAddress()) )
         {
-            if ( static_cast<const ServiceAddress &>(whichServer) == static_cast<const ServiceAddress &>((*block)->mKey.getAddress()) )
-            {
-                break;
-            }
+            break;
         }
     }
 
-    TRACE_DBG("[ %s ] server [ %s ] in the list", (*block ) != nullptr ? "FOUND" : "DID NOT FIND", StubAddress::convAddressToPath(whichServer).getString());
+    TRACE_DBG("[ %s ] server [ %s ] in the list", pos != nullptr ? "FOUND" : "DID NOT FIND", StubAddress::convAddressToPath(whichServer).getString());
 
-    return (*block);
+    return pos;
 }
 
 MAPPOS ServerList::findServer( const ProxyAddress & whichClient ) const
 {
     ServerInfo server(whichClient);
 
-    const unsigned int hash = getHashKey(server);
-    ServiceBlock** block    = &mHashTable[hash % mHashTableSize];
-
-    for ( ; *block != nullptr; block = &(*block)->mNext)
+    MAPPOS pos = firstHashPosition( getHashKey(server) );
+    for ( ; pos != nullptr; pos = nextHashPosition(pos) )
     {
-        if ( hash == (*block)->mHash )
+        if ( static_cast<const ServiceAddress &>(whichClient) == static_cast<const ServiceAddress &>(keyAtPosition(pos).getAddress()) )
         {
-            if ( static_cast<const ServiceAddress &>(whichClient) == static_cast<const ServiceAddress &>((*block)->mKey.getAddress()) )
-            {
-                break;
-            }
+            break;
         }
     }
     
-    return (*block);
+    return pos;
 }
 
 const ServerInfo & ServerList::registerClient( const ProxyAddress & whichClient, ClientInfo & out_client )
@@ -35,7 +35,7 @@ class ProxyAddress;
 /**
  * \brief   Server List helper class.
  **/
-using ImplServerList    = TEHashMapImpl<const ServerInfo &, const ClientList &>;
+using ImplServerList    = TEOpenHashMapImpl<const ServerInfo &, const ClientList &>;
 
 /**
  * \brief   Server List is a Hash Map class containing information
@@ -38,7 +38,7 @@ ServiceAddress ServiceAddress::convPathToAddress( const char * pathService, cons
 
 ServiceAddress::ServiceAddress( void )
     : ServiceItem   ( )
-    , mRoleName     ( String::EmptyString.data(), 0 )
+    , mRoleName     ( )
     , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
 {
 }
@@ -48,19 +48,17 @@ ServiceAddress::ServiceAddress( const char * serviceName
                               , NEService::eServiceType serviceType
                               , const char * roleName )
     : ServiceItem   ( serviceName, serviceVersion, serviceType )
-    , mRoleName     ( roleName )
+    , mRoleName     ( roleName, NEUtilities::ITEM_NAMES_MAX_LENGTH )
     , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
 {
-    mRoleName.truncate( NEUtilities::ITEM_NAMES_MAX_LENGTH );
     mMagicNum = ServiceAddress::_magicNumber(*this);
 }
 
 ServiceAddress::ServiceAddress( const ServiceItem & serviceItem, const char * roleName )
     : ServiceItem   ( serviceItem )
-    , mRoleName     ( roleName )
+    , mRoleName     ( roleName, NEUtilities::ITEM_NAMES_MAX_LENGTH )
     , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
 {
-    mRoleName.truncate( NEUtilities::ITEM_NAMES_MAX_LENGTH );
     mMagicNum = ServiceAddress::_magicNumber(*this);
 }
 
@@ -0,0 +1,181 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/component/private/ServiceAddressTable.cpp
+ * \ingroup     AREG SDK, Asynchronous Event Generator Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, The table of interned service addresses.
+ *
+ ************************************************************************/
+#include "areg/component/private/ServiceAddressTable.hpp"
+
+#include "areg/base/TEArrayList.hpp"
+#include "areg/component/NEService.hpp"
+
+//////////////////////////////////////////////////////////////////////////
+// ServiceAddressTable class implementation
+//////////////////////////////////////////////////////////////////////////
+
+ServiceAddressTable & ServiceAddressTable::_getTable( void )
+{
+    static ServiceAddressTable _table;
+    return _table;
+}
+
+ServiceAddressTable::ServiceAddressTable( void )
+    : mHandleGenerator  ( NEService::HANDLE_INVALID )
+    , mLocalCookie      ( NEService::COOKIE_UNKNOWN )
+    , mProxies          ( )
+    , mStubs            ( )
+    , mLock             ( )
+{
+}
+
+inline uint64_t ServiceAddressTable::_getKey( ITEM_ID cookie, unsigned int handle ) const
+{
+    // the cookies are generated by the routing service and fit in 32-bits.
+    ITEM_ID owner = (cookie == mLocalCookie) ? NEService::COOKIE_LOCAL : cookie;
+    return ((static_cast<uint64_t>(owner) << 32) | static_cast<uint64_t>(handle));
+}
+
+inline bool ServiceAddressTable::_canUpdate( ITEM_ID cookie ) const
+{
+    // the routing service notifies the registration of local objects as well, ignore them.
+    return (cookie == NEService::COOKIE_LOCAL) || (cookie != mLocalCookie);
+}
+
+template<class MapAddresses>
+void ServiceAddressTable::_removeRemote( MapAddresses & addresses )
+{
+    constexpr uint64_t keyLocal{ static_cast<uint64_t>(NEService::COOKIE_LOCAL) << 32 };
+
+    TEArrayList<uint64_t> listRemote;
+    for ( MAPPOS pos = addresses.firstPosition( ); pos != nullptr; pos = addresses.nextPosition( pos ) )
+    {
+        uint64_t key = addresses.keyAtPosition( pos );
+        if ( (key & 0xFFFFFFFF00000000ull) != keyLocal )
+        {
+            listRemote.add( key );
+        }
+    }
+
+    for ( int i = 0; i < listRemote.getSize( ); ++ i )
+    {
+        addresses.removeAt( listRemote[i] );
+    }
+}
+
+unsigned int ServiceAddressTable::createHandle( void )
+{
+    ServiceAddressTable & table = _getTable( );
+    unsigned int result = ++ table.mHandleGenerator;
+    // skip invalid handle when the counter overflows.
+    return (result != NEService::HANDLE_INVALID ? result : ++ table.mHandleGenerator);
+}
+
+void ServiceAddressTable::setLocalCookie( ITEM_ID cookie )
+{
+    ServiceAddressTable & table = _getTable( );
+    Lock lock( table.mLock );
+    table.mLocalCookie.store( cookie, std::memory_order_release );
+}
+
+ITEM_ID ServiceAddressTable::getOwnerCookie( ITEM_ID cookie )
+{
+    // called for every streamed address, read the cookie without locking the table.
+    ITEM_ID localCookie = _getTable( ).mLocalCookie.load( std::memory_order_acquire );
+    return ((cookie == NEService::COOKIE_LOCAL) && (localCookie != NEService::COOKIE_UNKNOWN) ? localCookie : cookie);
+}
+
+void ServiceAddressTable::registerProxy( ITEM_ID cookie, const ProxyAddress & proxy )
+{
+    if ( proxy.getHandle( ) != NEService::HANDLE_INVALID )
+    {
+        ServiceAddressTable & table = _getTable( );
+        Lock lock( table.mLock );
+        if ( table._canUpdate( cookie ) )
+        {
+            table.mProxies.setAt( table._getKey( cookie, proxy.getHandle( ) ), proxy );
+        }
+    }
+}
+
+void ServiceAddressTable::unregisterProxy( ITEM_ID cookie, unsigned int handle )
+{
+    ServiceAddressTable & table = _getTable( );
+    Lock lock( table.mLock );
+    if ( table._canUpdate( cookie ) )
+    {
+        table.mProxies.removeAt( table._getKey( cookie, handle ) );
+    }
+}
+
+bool ServiceAddressTable::findProxy( ITEM_ID cookie, unsigned int handle, ProxyAddress & out_proxy )
+{
+    ServiceAddressTable & table = _getTable( );
+    Lock lock( table.mLock );
+
+    bool result = table.mProxies.find( table._getKey( cookie, handle ), out_proxy );
+    if ( result )
+    {
+        // the same as streamed address, only the cookie of the channel is set.
+        out_proxy.setChannel( Channel( ) );
+        out_proxy.setCookie( cookie );
+    }
+
+    return result;
+}
+
+void ServiceAddressTable::registerStub( ITEM_ID cookie, const StubAddress & stub )
+{
+    if ( stub.getHandle( ) != NEService::HANDLE_INVALID )
+    {
+        ServiceAddressTable & table = _getTable( );
+        Lock lock( table.mLock );
+        if ( table._canUpdate( cookie ) )
+        {
+            table.mStubs.setAt( table._getKey( cookie, stub.getHandle( ) ), stub );
+        }
+    }
+}
+
+void ServiceAddressTable::unregisterStub( ITEM_ID cookie, unsigned int handle )
+{
+    ServiceAddressTable & table = _getTable( );
+    Lock lock( table.mLock );
+    if ( table._canUpdate( cookie ) )
+    {
+        table.mStubs.removeAt( table._getKey( cookie, handle ) );
+    }
+}
+
+bool ServiceAddressTable::findStub( ITEM_ID cookie, unsigned int handle, StubAddress & out_stub )
+{
+    ServiceAddressTable & table = _getTable( );
+    Lock lock( table.mLock );
+
+    bool result = table.mStubs.find( table._getKey( cookie, handle ), out_stub );
+    if ( result )
+    {
+        // the same as streamed address, only the cookie of the channel is set.
+        out_stub.setChannel( Channel( ) );
+        out_stub.setCookie( cookie );
+    }
+
+    return result;
+}
+
+void ServiceAddressTable::removeRemoteAddresses( void )
+{
+    ServiceAddressTable & table = _getTable( );
+    Lock lock( table.mLock );
+
+    ServiceAddressTable::_removeRemote<MapProxies>( table.mProxies );
+    ServiceAddressTable::_removeRemote<MapStubs>( table.mStubs );
+}
@@ -0,0 +1,212 @@
+#pragma once
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/component/private/ServiceAddressTable.hpp
+ * \ingroup     AREG SDK, Asynchronous Event Generator Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, The table of interned service addresses.
+ *
+ ************************************************************************/
+
+/************************************************************************
+ * Includes
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/TEHashMap.hpp"
+#include "areg/base/SynchObjects.hpp"
+#include "areg/component/ProxyAddress.hpp"
+#include "areg/component/StubAddress.hpp"
+
+#include <atomic>
+
+//////////////////////////////////////////////////////////////////////////
+// ServiceAddressTable class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The table of interned proxy and stub addresses of the process.
+ *          Every proxy and stub object gets the handle, which is unique
+ *          in the process, and the handle is sent to the routing service
+ *          in the registration message. The routing service forwards the
+ *          handles with the registered addresses, so that the address is
+ *          identified by the cookie of the owner process and the handle.
+ *          The remote events send only the handle and the cookie of address
+ *          and the receiver finds the address in the table without parsing
+ *          strings and calculating the magic numbers.
+ *
+ *          The addresses of local objects are registered with the cookie
+ *          NEService::COOKIE_LOCAL. The addresses of remote objects are
+ *          registered when the routing service notifies the registration.
+ *          The table is thread safe.
+ **/
+class ServiceAddressTable
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The hash map helper of proxy addresses, the key is the combination of cookie and handle.
+    using ImplMapProxies    = TEHashMapImpl<uint64_t, const ProxyAddress &>;
+    //!< The hash map of proxy addresses.
+    using MapProxies        = TEHashMap<uint64_t, ProxyAddress, uint64_t, const ProxyAddress &, ImplMapProxies>;
+    //!< The hash map helper of stub addresses, the key is the combination of cookie and handle.
+    using ImplMapStubs      = TEHashMapImpl<uint64_t, const StubAddress &>;
+    //!< The hash map of stub addresses.
+    using MapStubs          = TEHashMap<uint64_t, StubAddress, uint64_t, const StubAddress &, ImplMapStubs>;
+
+//////////////////////////////////////////////////////////////////////////
+// Static methods
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Generates new handle of the address, unique in the process.
+     **/
+    static unsigned int createHandle( void );
+
+    /**
+     * \brief   Sets the cookie of the process, given by the routing service.
+     *          The addresses with this cookie are searched among local addresses.
+     * \param   cookie  The cookie of the process or NEService::COOKIE_UNKNOWN if disconnected.
+     **/
+    static void setLocalCookie( ITEM_ID cookie );
+
+    /**
+     * \brief   Returns the cookie to stream with the handle of address. The local objects
+     *          have NEService::COOKIE_LOCAL, which is replaced by the cookie of the process,
+     *          so that other processes can find the address.
+     * \param   cookie  The cookie of the address channel.
+     **/
+    static ITEM_ID getOwnerCookie( ITEM_ID cookie );
+
+    /**
+     * \brief   Registers the proxy address with the given cookie of the owner process.
+     *          Nothing happens if the address has no handle.
+     * \param   cookie  The cookie of the owner process. It is NEService::COOKIE_LOCAL for local proxies.
+     * \param   proxy   The proxy address to register.
+     **/
+    static void registerProxy( ITEM_ID cookie, const ProxyAddress & proxy );
+
+    /**
+     * \brief   Unregisters the proxy address of given cookie and handle.
+     * \param   cookie  The cookie of the owner process. It is NEService::COOKIE_LOCAL for local proxies.
+     * \param   handle  The handle of the proxy address.
+     **/
+    static void unregisterProxy( ITEM_ID cookie, unsigned int handle );
+
+    /**
+     * \brief   Searches the proxy address by cookie and handle.
+     * \param   cookie      The cookie of the owner process.
+     * \param   handle      The handle of the proxy address.
+     * \param   out_proxy   On output, contains the proxy address, which cookie is set to the given cookie.
+     * \return  Returns true if found the address.
+     **/
+    static bool findProxy( ITEM_ID cookie, unsigned int handle, ProxyAddress & out_proxy );
+
+    /**
+     * \brief   Registers the stub address with the given cookie of the owner process.
+     *          Nothing happens if the address has no handle.
+     * \param   cookie  The cookie of the owner process. It is NEService::COOKIE_LOCAL for local stubs.
+     * \param   stub    The stub address to register.
+     **/
+    static void registerStub( ITEM_ID cookie, const StubAddress & stub );
+
+    /**
+     * \brief   Unregisters the stub address of given cookie and handle.
+     * \param   cookie  The cookie of the owner process. It is NEService::COOKIE_LOCAL for local stubs.
+     * \param   handle  The handle of the stub address.
+     **/
+    static void unregisterStub( ITEM_ID cookie, unsigned int handle );
+
+    /**
+     * \brief   Searches the stub address by cookie and handle.
+     * \param   cookie      The cookie of the owner process.
+     * \param   handle      The handle of the stub address.
+     * \param   out_stub    On output, contains the stub address, which cookie is set to the given cookie.
+     * \return  Returns true if found the address.
+     **/
+    static bool findStub( ITEM_ID cookie, unsigned int handle, StubAddress & out_stub );
+
+    /**
+     * \brief   Removes the addresses of all remote processes. Called when the connection
+     *          with the routing service is started or lost.
+     **/
+    static void removeRemoteAddresses( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Returns the singleton instance of the table.
+     **/
+    static ServiceAddressTable & _getTable( void );
+
+    /**
+     * \brief   Returns the key of the address in the table.
+     *          The local cookie is replaced by NEService::COOKIE_LOCAL.
+     * \param   cookie  The cookie of the owner process.
+     * \param   handle  The handle of the address.
+     **/
+    inline uint64_t _getKey( ITEM_ID cookie, unsigned int handle ) const;
+
+    /**
+     * \brief   Returns true if the entry of given cookie can be registered or unregistered.
+     *          The local objects register and unregister the addresses with the cookie
+     *          NEService::COOKIE_LOCAL, the notifications of the routing service about
+     *          local objects are ignored.
+     * \param   cookie  The cookie of the owner process.
+     **/
+    inline bool _canUpdate( ITEM_ID cookie ) const;
+
+    /**
+     * \brief   Removes the entries of the map, which keys are not local.
+     * \param   addresses   The map of addresses to remove remote entries.
+     **/
+    template<class MapAddresses>
+    static void _removeRemote( MapAddresses & addresses );
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor. Hidden
+//////////////////////////////////////////////////////////////////////////
+private:
+    ServiceAddressTable( void );
+    ~ServiceAddressTable( void ) = default;
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The generator of handles.
+     **/
+    std::atomic_uint        mHandleGenerator;
+    /**
+     * \brief   The cookie of the process given by the routing service.
+     *          Modified under the lock, read without lock when streaming addresses.
+     **/
+    std::atomic<ITEM_ID>    mLocalCookie;
+    /**
+     * \brief   The registered proxy addresses.
+     **/
+    MapProxies              mProxies;
+    /**
+     * \brief   The registered stub addresses.
+     **/
+    MapStubs                mStubs;
+    /**
+     * \brief   The synchronization object of the table.
+     **/
+    mutable ResourceLock    mLock;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    DECLARE_NOCOPY_NOMOVE( ServiceAddressTable );
+};
@@ -40,22 +40,20 @@ ServiceItem::ServiceItem( void )
 }
 
 ServiceItem::ServiceItem(const char * serviceName)
-    : mServiceName      ( serviceName != nullptr ? serviceName : "")
+    : mServiceName      ( serviceName != nullptr ? serviceName : "", NEUtilities::ITEM_NAMES_MAX_LENGTH)
     , mServiceVersion   ( Version::INVALID_VERSION )
     , mServiceType      ( NEService::eServiceType::ServiceLocal )
     , mMagicNum         ( NEMath::CHECKSUM_IGNORE )
 {
-    mServiceName.truncate(NEUtilities::ITEM_NAMES_MAX_LENGTH);
     mMagicNum = ServiceItem::_magicNumber(*this);
 }
 
 ServiceItem::ServiceItem( const char * serviceName, const Version & serviceVersion, NEService::eServiceType serviceType )
-    : mServiceName      ( serviceName != nullptr ? serviceName : "")
+    : mServiceName      ( serviceName != nullptr ? serviceName : "", NEUtilities::ITEM_NAMES_MAX_LENGTH)
     , mServiceVersion   ( serviceVersion )
     , mServiceType      ( serviceType )
     , mMagicNum         ( NEMath::CHECKSUM_IGNORE )
 {
-    mServiceName.truncate(NEUtilities::ITEM_NAMES_MAX_LENGTH);
     mMagicNum = ServiceItem::_magicNumber(*this);
 }
 
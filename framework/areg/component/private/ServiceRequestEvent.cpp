@@ -43,11 +43,12 @@ ServiceRequestEvent::ServiceRequestEvent( const ProxyAddress & proxyAddress
 
 ServiceRequestEvent::ServiceRequestEvent(const IEInStream & stream)
     : StubEvent     (stream)
-    , mProxySource  (stream)
+    , mProxySource  ( )
     , mMessageId    (NEService::INVALID_MESSAGE_ID)
     , mRequestType  (NEService::eRequestType::Unprocessed)
     , mSequenceNr   (NEService::SEQUENCE_NUMBER_NOTIFY)
 {
+    mProxySource.readInterned(stream);
     stream >> mMessageId;
     stream >> mRequestType;
     stream >> mSequenceNr;
@@ -56,7 +57,7 @@ ServiceRequestEvent::ServiceRequestEvent(const IEInStream & stream)
 const IEInStream & ServiceRequestEvent::readStream(const IEInStream & stream)
 {
     StubEvent::readStream(stream);
-    stream >> mProxySource;
+    mProxySource.readInterned(stream);
     stream >> mMessageId;
     stream >> mRequestType;
     stream >> mSequenceNr;
@@ -66,7 +67,7 @@ const IEInStream & ServiceRequestEvent::readStream(const IEInStream & stream)
 IEOutStream & ServiceRequestEvent::writeStream(IEOutStream & stream) const
 {
     StubEvent::writeStream(stream);
-    stream << mProxySource;
+    mProxySource.writeInterned(stream);
     stream << mMessageId;
     stream << mRequestType;
     stream << mSequenceNr;
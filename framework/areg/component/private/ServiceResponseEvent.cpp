@@ -27,6 +27,7 @@ ServiceResponseEvent::ServiceResponseEvent( const ProxyAddress & target
     , mResponseId   (responseId)
     , mResult       (result)
     , mSequenceNr   (seqNr)
+    , mMulticastTargets ( )
 {
 }
 
@@ -35,6 +36,7 @@ ServiceResponseEvent::ServiceResponseEvent( const ProxyAddress& target, const Se
     , mResponseId   (src.mResponseId)
     , mResult       (src.mResult)
     , mSequenceNr   (src.mSequenceNr)
+    , mMulticastTargets ( )
 {
 }
 
@@ -43,6 +45,7 @@ ServiceResponseEvent::ServiceResponseEvent(const IEInStream & stream)
     , mResponseId   ( NEService::INVALID_MESSAGE_ID )
     , mResult       ( NEService::eResultType::Undefined )
     , mSequenceNr   ( NEService::SEQUENCE_NUMBER_ANY )
+    , mMulticastTargets ( )
 {
     stream >> mResponseId;
     stream >> mResult;
@@ -66,7 +69,9 @@ const IEInStream & ServiceResponseEvent::readStream( const IEInStream & stream )
 
 IEOutStream & ServiceResponseEvent::writeStream( IEOutStream & stream ) const
 {
-    ProxyEvent::writeStream(stream);
+    // the multicast message is delivered to the proxies of different processes, write complete address.
+    StreamableEvent::writeStream(stream);
+    mTargetProxyAddress.writeInterned(stream, isMulticast());
     stream << mResponseId;
     stream << mResult;
     stream << mSequenceNr;
@@ -18,6 +18,7 @@
 #include "areg/component/ServiceRequestEvent.hpp"
 #include "areg/component/DispatcherThread.hpp"
 #include "areg/component/ProxyAddress.hpp"
+#include "areg/component/private/ServiceAddressTable.hpp"
 #include "areg/base/ThreadAddress.hpp"
 #include "areg/base/IEIOStream.hpp"
 #include "areg/base/NEUtilities.hpp"
@@ -76,6 +77,7 @@ StubAddress::StubAddress( void )
     : ServiceAddress( ServiceItem(), INVALID_STUB_NAME.data() )
     , mThreadName   ( ThreadAddress::INVALID_THREAD_ADDRESS.getThreadName() )
     , mChannel      ( )
+    , mHandle       ( NEService::HANDLE_INVALID )
     , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
 {
 }
@@ -86,11 +88,11 @@ StubAddress::StubAddress( const char * serviceName
                         , const char * roleName
                         , const char * threadName   /*= nullptr*/ )
     : ServiceAddress( serviceName, serviceVersion, serviceType, roleName )
-    , mThreadName   ( threadName )
+    , mThreadName   ( threadName, NEUtilities::ITEM_NAMES_MAX_LENGTH )
     , mChannel      ( )
+    , mHandle       ( NEService::HANDLE_INVALID )
     , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
 {
-    mThreadName.truncate( NEUtilities::ITEM_NAMES_MAX_LENGTH );
     if ( ServiceAddress::isValid() )
         mChannel.setCookie(NEService::COOKIE_LOCAL);
 
@@ -99,11 +101,11 @@ StubAddress::StubAddress( const char * serviceName
 
 StubAddress::StubAddress(const ServiceItem & service, const char * roleName, const char * threadName /*= nullptr */)
     : ServiceAddress( service, roleName )
-    , mThreadName   ( threadName )
+    , mThreadName   ( threadName, NEUtilities::ITEM_NAMES_MAX_LENGTH )
     , mChannel      ( )
+    , mHandle       ( NEService::HANDLE_INVALID )
     , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
 {
-    mThreadName.truncate( NEUtilities::ITEM_NAMES_MAX_LENGTH );
     if ( ServiceAddress::isValid() )
         mChannel.setCookie(NEService::COOKIE_LOCAL);
 
@@ -112,8 +114,9 @@ StubAddress::StubAddress(const ServiceItem & service, const char * roleName, con
 
 StubAddress::StubAddress(const NEService::SInterfaceData & siData, const char * roleName, const char * threadName /*= nullptr */)
     : ServiceAddress( siData.idServiceName, siData.idVersion, siData.idServiceType, roleName )
-    , mThreadName   ( String::EmptyString.data(), 0 )
+    , mThreadName   ( )
     , mChannel      ( )
+    , mHandle       ( NEService::HANDLE_INVALID )
     , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
 {
     setThread(threadName);
@@ -127,6 +130,7 @@ StubAddress::StubAddress( const StubAddress & source )
     : ServiceAddress( static_cast<const ServiceAddress &>(source) )
     , mThreadName   ( source.mThreadName )
     , mChannel      ( source.mChannel )
+    , mHandle       ( source.mHandle )
     , mMagicNum     ( source.mMagicNum )
 {
 }
@@ -135,6 +139,7 @@ StubAddress::StubAddress( StubAddress && source ) noexcept
     : ServiceAddress( static_cast<ServiceAddress &&>(source) )
     , mThreadName   ( std::move(source.mThreadName) )
     , mChannel      ( std::move(source.mChannel) )
+    , mHandle       ( source.mHandle )
     , mMagicNum     ( source.mMagicNum )
 {
 }
@@ -143,10 +148,12 @@ StubAddress::StubAddress( const IEInStream & stream )
     : ServiceAddress( stream )
     , mThreadName   ( stream )
     , mChannel      ( )
+    , mHandle       ( NEService::HANDLE_INVALID )
     , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
 {
     ITEM_ID cookie = NEService::COOKIE_LOCAL;
     stream >> cookie;
+    stream >> mHandle;
     if ( ServiceAddress::isValid() )
         mChannel.setCookie(cookie);
 
@@ -266,12 +273,48 @@ bool StubAddress::isValidated(void) const
     return ServiceAddress::isValidated() && (mThreadName.isEmpty() == false) && (mThreadName != ThreadAddress::INVALID_THREAD_ADDRESS.getThreadName());
 }
 
+void StubAddress::writeInterned( IEOutStream & stream, bool complete /*= false*/ ) const
+{
+    if ( complete || (mHandle == NEService::HANDLE_INVALID) )
+    {
+        // the invalid handle means that the complete address follows.
+        constexpr unsigned int handle{ NEService::HANDLE_INVALID };
+        stream << handle;
+        stream << *this;
+    }
+    else
+    {
+        stream << mHandle;
+        stream << ServiceAddressTable::getOwnerCookie( mChannel.getCookie() );
+    }
+}
+
+void StubAddress::readInterned( const IEInStream & stream )
+{
+    unsigned int handle = NEService::HANDLE_INVALID;
+    stream >> handle;
+    if ( handle != NEService::HANDLE_INVALID )
+    {
+        ITEM_ID cookie = NEService::COOKIE_UNKNOWN;
+        stream >> cookie;
+        if ( ServiceAddressTable::findStub( cookie, handle, *this ) == false )
+        {
+            *this = StubAddress::INVALID_STUB_ADDRESS;
+        }
+    }
+    else
+    {
+        stream >> *this;
+    }
+}
+
 AREG_API const IEInStream & operator >> ( const IEInStream & stream, StubAddress & input )
 {
     ITEM_ID cookie = NEService::COOKIE_LOCAL;
     stream >> static_cast<ServiceAddress &>(input);
     stream >> input.mThreadName;
     stream >> cookie;
+    stream >> input.mHandle;
 
     input.setCookie(cookie);
     input.mMagicNum = StubAddress::_magicNumber(input);
@@ -284,5 +327,6 @@ AREG_API IEOutStream & operator << ( IEOutStream & stream, const StubAddress & o
     stream << static_cast<const ServiceAddress &>(output);
     stream << output.mThreadName;
     stream << output.mChannel.getCookie();
+    stream << output.mHandle;
     return stream;
 }
@@ -20,7 +20,10 @@
 #include "areg/component/EventDataStream.hpp"
 #include "areg/component/ComponentThread.hpp"
 #include "areg/component/Component.hpp"
+#include "areg/component/ComponentLoader.hpp"
+#include "areg/component/ProxyBase.hpp"
 #include "areg/component/private/StubConnectEvent.hpp"
+#include "areg/component/private/ServiceAddressTable.hpp"
 
 //////////////////////////////////////////////////////////////////////////
 // StubBase class implementation
@@ -72,8 +75,12 @@ StubBase::StubBase( Component & masterComp, const NEService::SInterfaceData & si
     , mListListener         ( )
     , mCurrListener         (nullptr)
     , mSessionId            (0)
+    , mDirectCall           (StubBase::_isDirectCallService(masterComp, siData))
     , mMapSessions          ( )
 {
+    mAddress.setHandle( ServiceAddressTable::createHandle() );
+    ServiceAddressTable::registerStub( NEService::COOKIE_LOCAL, mAddress );
+
     _mapRegisteredStubs.registerResourceObject(mAddress, this);
     masterComp.registerServerItem(self());
 }
@@ -81,6 +88,7 @@ StubBase::StubBase( Component & masterComp, const NEService::SInterfaceData & si
 StubBase::~StubBase( void )
 {
     _mapRegisteredStubs.unregisterResourceObject(mAddress);
+    ServiceAddressTable::unregisterStub( NEService::COOKIE_LOCAL, mAddress.getHandle() );
 }
 
 const StubAddress & StubBase::getAddress( void ) const
@@ -228,18 +236,66 @@ void StubBase::sendErrorNotification( const StubListenerList & whichListeners, c
 
 void StubBase::sendUpdateNotification( const StubListenerList & whichListeners, const ServiceResponseEvent & masterEvent ) const
 {
+    ServiceResponseEvent::ListTargets remoteTargets;
+
     for (LISTPOS pos = whichListeners.firstPosition(); pos != nullptr; pos = whichListeners.nextPosition(pos))
     {
         const StubBase::Listener& listener = whichListeners[pos];
-        ServiceResponseEvent* eventResp = masterEvent.cloneForTarget(listener.mProxy);
+        if ( listener.mProxy.isRemoteAddress() )
+        {
+            // the remote listeners are notified by one message, which the router forwards to all connections.
+            remoteTargets.addUnique(listener.mProxy);
+        }
+        else
+        {
+            ServiceResponseEvent* eventResp = masterEvent.cloneForTarget(listener.mProxy);
+            if (eventResp != nullptr)
+                sendServiceResponse(*eventResp);
+        }
+    }
+
+    if ( remoteTargets.isEmpty() == false )
+    {
+        ServiceResponseEvent* eventResp = masterEvent.cloneForTarget(remoteTargets[0]);
         if (eventResp != nullptr)
+        {
+            if ( remoteTargets.getSize() > 1 )
+            {
+                eventResp->setMulticastTargets(remoteTargets);
+            }
+
             sendServiceResponse(*eventResp);
+        }
     }
 }
 
 void StubBase::sendServiceResponse( ServiceResponseEvent & eventElem ) const
 {
-    eventElem.getTargetProxy().deliverServiceEvent(eventElem);
+    const ProxyAddress & target = eventElem.getTargetProxy();
+    ComponentThread & dispatcher= getComponentThread();
+
+    // The proxy only updates the data and queues the notifications of the clients.
+    // It processes the response in the context of the call, if no other event can be overtaken.
+    ProxyBase * proxy = nullptr;
+    if (   mDirectCall
+        && target.isLocalAddress()
+        && (static_cast<id_type>(target.getSource()) == dispatcher.getId())
+        && (Thread::getCurrentThreadId() == dispatcher.getId())
+        && (dispatcher.hasPendingEvents() == false) )
+    {
+        proxy = ProxyBase::findProxyByAddress( target );
+    }
+
+    if ( proxy != nullptr )
+    {
+        eventElem.registerForThread( &dispatcher );
+        eventElem.dispatchSelf( static_cast<IEEventConsumer *>(proxy) );
+        eventElem.destroy( );
+    }
+    else
+    {
+        target.deliverServiceEvent( eventElem );
+    }
 }
 
 void StubBase::cancelCurrentRequest( void )
@@ -257,6 +313,13 @@ StubBase* StubBase::findStubByAddress( const StubAddress& address )
     return _mapRegisteredStubs.findResourceObject(address);
 }
 
+bool StubBase::_isDirectCallService( Component & masterComp, const NEService::SInterfaceData & siData )
+{
+    const NERegistry::ComponentEntry & entry = ComponentLoader::findComponentEntry( masterComp.getRoleName( ), masterComp.getMasterThread( ).getName( ) );
+    int index = entry.findSupportedService( siData.idServiceName );
+    return ((index >= 0) && entry.getSupportedServices( ).getAt( index ).mDirectCall);
+}
+
 void StubBase::startupServiceInterface( Component&  holder )
 {
     StubConnectEvent::addListener( static_cast<IEStubEventConsumer &>(self()), holder.getMasterThread() );
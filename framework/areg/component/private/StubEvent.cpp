@@ -42,8 +42,9 @@ StubEvent::StubEvent( const StubAddress& toTarget, Event::eEventType eventType )
 
 StubEvent::StubEvent( const IEInStream & stream  )
     : StreamableEvent   (stream)
-    , mTargetStubAddress(stream)
+    , mTargetStubAddress( )
 {
+    mTargetStubAddress.readInterned(stream);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -52,14 +53,14 @@ StubEvent::StubEvent( const IEInStream & stream  )
 const IEInStream & StubEvent::readStream( const IEInStream & stream )
 {
     StreamableEvent::readStream(stream);
-    stream >> mTargetStubAddress;
+    mTargetStubAddress.readInterned(stream);
     return stream;
 }
 
 IEOutStream & StubEvent::writeStream( IEOutStream & stream ) const
 {
     StreamableEvent::writeStream(stream);
-    stream << mTargetStubAddress;
+    mTargetStubAddress.writeInterned(stream);
     return stream;
 }
 
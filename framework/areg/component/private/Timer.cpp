@@ -45,6 +45,7 @@ Timer::Timer(IETimerConsumer& timerConsumer, const char* timerName /*= nullptr*/
     , mName             (NEUtilities::generateName(timerName))
     , mTimeoutInMs      (Timer::INVALID_TIMEOUT)
     , mEventsCount      (0)
+    , mSlackInMs        (Timer::NO_SLACK)
     , mNextFire         (0)
     , mLastFired        (0)
 
@@ -59,12 +60,12 @@ Timer::Timer(IETimerConsumer& timerConsumer, const char* timerName /*= nullptr*/
 //////////////////////////////////////////////////////////////////////////
 // Operations
 //////////////////////////////////////////////////////////////////////////
-bool Timer::startTimer( unsigned int timeoutInMs, unsigned int eventCount /*= Timer::CONTINUOUSLY*/ )
+bool Timer::startTimer( unsigned int timeoutInMs, unsigned int eventCount /*= Timer::CONTINUOUSLY*/, unsigned int slackInMs /*= Timer::NO_SLACK*/ )
 {
-    return startTimer(timeoutInMs, DispatcherThread::getCurrentDispatcherThread(), eventCount);
+    return startTimer(timeoutInMs, DispatcherThread::getCurrentDispatcherThread(), eventCount, slackInMs);
 }
 
-bool Timer::startTimer(unsigned int timeoutInMs, DispatcherThread & whichThread, unsigned int eventCount /*= Timer::CONTINUOUSLY*/)
+bool Timer::startTimer(unsigned int timeoutInMs, DispatcherThread & whichThread, unsigned int eventCount /*= Timer::CONTINUOUSLY*/, unsigned int slackInMs /*= Timer::NO_SLACK*/)
 {
     TRACE_SCOPE(areg_component_Timer_startTimer);
 
@@ -76,10 +77,11 @@ bool Timer::startTimer(unsigned int timeoutInMs, DispatcherThread & whichThread,
         TimerManager::stopTimer(self());
     }
 
-    TRACE_DBG("Starting [ %s ] with timeout [ %u ] ms and event count [ %d ]", getName().getString(), timeoutInMs, eventCount);
+    TRACE_DBG("Starting [ %s ] with timeout [ %u ] ms, slack [ %u ] ms and event count [ %d ]", getName().getString(), timeoutInMs, slackInMs, eventCount);
 
     mTimeoutInMs    = timeoutInMs;
     mEventsCount    = eventCount;
+    mSlackInMs      = slackInMs;
     mNextFire       = Timer::getTickCount() + timeoutInMs;
     mLastFired      = 0;
     mCurrentQueued  = 0;
@@ -101,6 +103,7 @@ void Timer::stopTimer( void )
     mCurrentQueued  = 0;
     mTimeoutInMs    = Timer::INVALID_TIMEOUT;
     mEventsCount    = 0;
+    mSlackInMs      = Timer::NO_SLACK;
     mNextFire       = Timer::getTickCount();
     mLastFired      = 0;
 }
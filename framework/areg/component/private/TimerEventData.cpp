@@ -25,6 +25,7 @@
 // TimerEvent class, implement Runtime
 //////////////////////////////////////////////////////////////////////////
 IMPLEMENT_RUNTIME(TimerEvent, TimerEventBase)
+IMPLEMENT_RUNTIME(TimerBatchEvent, Event)
 
 //////////////////////////////////////////////////////////////////////////
 // TimerEvent class, constructor / destructor
@@ -90,3 +91,50 @@ bool TimerEvent::sendEvent(Timer & timer, DispatcherThread & dispatchThread)
 
     return result;
 }
+
+//////////////////////////////////////////////////////////////////////////
+// TimerBatchEvent class implementation
+//////////////////////////////////////////////////////////////////////////
+
+TimerBatchEvent::TimerBatchEvent( DispatcherThread & target )
+    : Event     ( Event::eEventType::EventCustomExternal )
+    , mTargetId ( target.getId() )
+    , mTimers   ( )
+    , mCurrent  ( 0 )
+{
+    ASSERT(target.isRunning());
+    registerForThread(&target);
+}
+
+TimerBatchEvent::~TimerBatchEvent( void )
+{
+    // the timers, which are not processed, are still queued.
+    for ( ; mCurrent < mTimers.getSize(); ++ mCurrent )
+    {
+        mTimers[mCurrent]->unqueueTimer();
+    }
+
+    mTimers.removeAll();
+}
+
+void TimerBatchEvent::addTimer( Timer & timer )
+{
+    if ( getEventConsumer() == nullptr )
+    {
+        // the dispatcher requires consumer, the timers are dispatched to own consumers.
+        setEventConsumer(static_cast<IEEventConsumer *>(&timer.getConsumer()));
+    }
+
+    mTimers.add(&timer);
+    timer.queueTimer();
+}
+
+void TimerBatchEvent::dispatchSelf( IEEventConsumer * /*consumer*/ )
+{
+    for ( ; mCurrent < mTimers.getSize(); ++ mCurrent )
+    {
+        Timer * timer = mTimers[mCurrent];
+        Event::dispatchSelf(static_cast<IEEventConsumer *>(&timer->getConsumer()));
+        timer->unqueueTimer();
+    }
+}
@@ -19,12 +19,14 @@
  ************************************************************************/
 #include "areg/base/GEGlobal.h"
 #include "areg/component/TEEvent.hpp"
+#include "areg/base/TEArrayList.hpp"
 
 /************************************************************************
  * Declared classes
  ************************************************************************/
 class TimerEventData;
 class TimerEvent;
+class TimerBatchEvent;
 
 /************************************************************************
  * Dependencies
@@ -184,6 +186,100 @@ private:
     DECLARE_NOCOPY_NOMOVE( TimerEvent );
 };
 
+//////////////////////////////////////////////////////////////////////////
+// TimerBatchEvent class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   TimerBatchEvent class contains the list of timers, which are
+ *          expired at once and should be processed in the same dispatcher thread.
+ *          It is created by Timer Manager to deliver expired timers as one event.
+ *          When dispatched, the timers are processed one by one in the order
+ *          they are added, each by its own Timer Consumer.
+ **/
+class TimerBatchEvent : public Event
+{
+//////////////////////////////////////////////////////////////////////////
+// Declare Runtime
+//////////////////////////////////////////////////////////////////////////
+    DECLARE_RUNTIME(TimerBatchEvent)
+
+//////////////////////////////////////////////////////////////////////////
+// Constructors / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Initializes empty batch of timers and registers for specified
+     *          target thread. The target thread should be valid and running.
+     * \param   target  The target dispatching thread to process event.
+     **/
+    explicit TimerBatchEvent( DispatcherThread & target );
+    /**
+     * \brief   Destructor. Unqueues the timers, which are not processed.
+     **/
+    virtual ~TimerBatchEvent( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns the ID of target dispatcher thread.
+     **/
+    inline id_type getTargetThreadId( void ) const;
+
+    /**
+     * \brief   Returns the number of timers in the batch.
+     **/
+    inline int getTimerCount( void ) const;
+
+    /**
+     * \brief   Returns the timer, which is currently processed.
+     *          Returns nullptr if all timers of batch are processed.
+     **/
+    inline Timer * getCurrentTimer( void ) const;
+
+    /**
+     * \brief   Adds expired timer to the end of batch.
+     * \param   timer   The expired timer to add.
+     **/
+    void addTimer( Timer & timer );
+
+//////////////////////////////////////////////////////////////////////////
+// Overrides
+//////////////////////////////////////////////////////////////////////////
+protected:
+    /**
+     * \brief   Dispatches the timers of batch one by one to their Timer Consumers.
+     *          The passed consumer parameter is ignored.
+     * \param   consumer    Ignored. Each timer is processed by own consumer.
+     **/
+    virtual void dispatchSelf( IEEventConsumer * consumer ) override;
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The ID of target dispatcher thread.
+     **/
+    const id_type               mTargetId;
+    /**
+     * \brief   The list of expired timers.
+     **/
+    TEArrayList<Timer *>        mTimers;
+    /**
+     * \brief   The index of currently processed timer. All timers with smaller index are processed.
+     **/
+    int                         mCurrent;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    TimerBatchEvent( void ) = delete;
+    DECLARE_NOCOPY_NOMOVE( TimerBatchEvent );
+};
+
 //////////////////////////////////////////////////////////////////////////
 // TimerEventData class inline function implementation
 //////////////////////////////////////////////////////////////////////////
@@ -230,3 +326,22 @@ inline TimerEventData & TimerEventData::operator = ( TimerEventData && src ) noe
 
     return (*this);
 }
+
+//////////////////////////////////////////////////////////////////////////
+// TimerBatchEvent class inline function implementation
+//////////////////////////////////////////////////////////////////////////
+
+inline id_type TimerBatchEvent::getTargetThreadId( void ) const
+{
+    return mTargetId;
+}
+
+inline int TimerBatchEvent::getTimerCount( void ) const
+{
+    return mTimers.getSize();
+}
+
+inline Timer * TimerBatchEvent::getCurrentTimer( void ) const
+{
+    return ((mCurrent >= 0) && (mCurrent < mTimers.getSize()) ? mTimers.getAt(mCurrent) : nullptr);
+}
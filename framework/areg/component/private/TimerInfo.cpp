@@ -242,78 +242,31 @@ int ExpiredTimers::removeAllTimers( Timer * whichTimer )
 
 void MapTimerTable::registerObject(const Timer * key, const TimerInfo & object)
 {
-    ASSERT(mHashTable != nullptr);
-
-    unsigned int hash = NECommon::MAP_INVALID_HASH;
-    TEHashMap<Timer *, TimerInfo, const Timer *, const TimerInfo &, ImplTimerTable>::Block* block = TEHashMap<Timer *, TimerInfo, const Timer *, const TimerInfo &, ImplTimerTable>::blockAt(key, hash);
-    if (block == nullptr)
-    {
-        ASSERT(hash != NECommon::MAP_INVALID_HASH);
-
-        // it doesn't exist, add a new Block
-        int idx     = static_cast<int>(hash % mHashTableSize);
-        block       = initNewBlock();
-        block->mHash= hash;
-        block->mKey	= const_cast<Timer *>(key);
-        block->mNext= mHashTable[idx];
-        mHashTable[idx]= block;
-    }
-
-    block->mValue= object;
+    TEHashMap<Timer *, TimerInfo, Timer *, const TimerInfo &, ImplTimerTable>::setAt(const_cast<Timer *>(key), object);
 }
 
 bool MapTimerTable::updateObject(const Timer * key, const TimerInfo & object)
 {
-    bool result = false;
-    ASSERT( mHashTable != nullptr );
-
-    unsigned int hash = NECommon::MAP_INVALID_HASH;
-    TEHashMap<Timer *, TimerInfo, const Timer *, const TimerInfo &, ImplTimerTable>::Block* block = TEHashMap<Timer *, TimerInfo, const Timer *, const TimerInfo &, ImplTimerTable>::blockAt(key, hash);
-    if (block != nullptr)
-    {
-        block->mValue= object;
-        result = false;
-    }
-
-    return result;
+    return (TEHashMap<Timer *, TimerInfo, Timer *, const TimerInfo &, ImplTimerTable>::updateAt(const_cast<Timer *>(key), object) != nullptr);
 }
 
 bool MapTimerTable::unregisterObject(const Timer * key)
 {
-    bool result = false;
-    TEHashMap<Timer *, TimerInfo, const Timer *, const TimerInfo &, ImplTimerTable>::Block** block = blockAtRef(key);
-    if ((block != nullptr) && (*block != nullptr))
-    {
-        removeBlock(block);
-        result = true;
-    }
-
-    return result;
+    return TEHashMap<Timer *, TimerInfo, Timer *, const TimerInfo &, ImplTimerTable>::removeAt(const_cast<Timer *>(key));
 }
 
 bool MapTimerTable::unregisterObject(const Timer * key, TimerInfo & OUT object)
 {
-    bool result = false;
-    TEHashMap<Timer *, TimerInfo, const Timer *, const TimerInfo &, ImplTimerTable>::Block** block = blockAtRef(key);
-    if ((block != nullptr) && (*block != nullptr))
-    {
-        object = (*block)->mValue;
-        removeBlock(block);
-        result = true;
-    }
-
-    return result;
+    return TEHashMap<Timer *, TimerInfo, Timer *, const TimerInfo &, ImplTimerTable>::removeAt(const_cast<Timer *>(key), object);
 }
 
 bool MapTimerTable::unregisterFirstObject(Timer * & OUT key, TimerInfo & OUT object)
 {
     bool result = false;
-    TEHashMap<Timer *, TimerInfo, const Timer *, const TimerInfo &, ImplTimerTable>::Block* block = firstValidBlock();
-    if (block != nullptr)
+    MAPPOS pos  = TEHashMap<Timer *, TimerInfo, Timer *, const TimerInfo &, ImplTimerTable>::firstPosition();
+    if (pos != nullptr)
     {
-        key     = block->mKey;
-        object  = block->mValue;
-        removeBlock(blockReference(*block));
+        TEHashMap<Timer *, TimerInfo, Timer *, const TimerInfo &, ImplTimerTable>::removePosition(pos, key, object);
         result = true;
     }
 
@@ -322,12 +275,6 @@ bool MapTimerTable::unregisterFirstObject(Timer * & OUT key, TimerInfo & OUT obj
 
 bool MapTimerTable::resetActiveTimerState(const Timer * key)
 {
-    bool result = false;
-    TEHashMap<Timer *, TimerInfo, const Timer *, const TimerInfo &, ImplTimerTable>::Block** block = blockAtRef(key);
-    if ((block != nullptr) && (*block != nullptr))
-    {
-        result = (*block)->mValue.resetActiveTimer();
-    }
-
-    return result;
+    MAPPOS pos = TEHashMap<Timer *, TimerInfo, Timer *, const TimerInfo &, ImplTimerTable>::find(const_cast<Timer *>(key));
+    return (pos != nullptr ? TEHashMap<Timer *, TimerInfo, Timer *, const TimerInfo &, ImplTimerTable>::getPosition(pos).resetActiveTimer() : false);
 }
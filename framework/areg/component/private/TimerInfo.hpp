@@ -330,8 +330,10 @@ public:
 //////////////////////////////////////////////////////////////////////////
 /**
  * \brief   Overrides methods required by Time Table hash map object.
+ *          The timers are kept in the open-addressing table, which has no
+ *          allocation per registered timer.
  **/
-using ImplTimerTable    = TEPointerHashMapImpl<const Timer *, const TimerInfo &>;
+using ImplTimerTable    = TEOpenPointerHashMapImpl<Timer *, const TimerInfo &>;
 
 /**
  * \brief   Timer Table Hash Map contains list of registered timers. 
@@ -340,7 +342,7 @@ using ImplTimerTable    = TEPointerHashMapImpl<const Timer *, const TimerInfo &>
  *          no longer active (i.e. no more needed to be fired).
  *          The Continuous timers are remaining active until they are not stopped.
  **/
-class MapTimerTable    : private TEHashMap<Timer *, TimerInfo, const Timer *, const TimerInfo &, ImplTimerTable>
+class MapTimerTable    : private TEHashMap<Timer *, TimerInfo, Timer *, const TimerInfo &, ImplTimerTable>
 {
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
@@ -553,49 +555,33 @@ private:
 
 inline bool MapTimerTable::isEmpty(void) const
 {
-    return TEHashMap<Timer *, TimerInfo, const Timer *, const TimerInfo &, ImplTimerTable>::isEmpty();
+    return TEHashMap<Timer *, TimerInfo, Timer *, const TimerInfo &, ImplTimerTable>::isEmpty();
 }
 
 inline int MapTimerTable::getSize(void) const
 {
-    return TEHashMap<Timer *, TimerInfo, const Timer *, const TimerInfo &, ImplTimerTable>::getSize();
+    return TEHashMap<Timer *, TimerInfo, Timer *, const TimerInfo &, ImplTimerTable>::getSize();
 }
 
 inline bool MapTimerTable::keyExists(const Timer * key) const
 {
-    TEHashMap<Timer *, TimerInfo, const Timer *, const TimerInfo &, ImplTimerTable>::Block** block = blockAtRef(key);
-    return (block != nullptr) && (*block != nullptr);
+    return (TEHashMap<Timer *, TimerInfo, Timer *, const TimerInfo &, ImplTimerTable>::find(const_cast<Timer *>(key)) != nullptr);
 }
 
 inline bool MapTimerTable::findObject(const Timer * key, TimerInfo & OUT object) const
 {
-    bool result = false;
-
-    TEHashMap<Timer *, TimerInfo, const Timer *, const TimerInfo &, ImplTimerTable>::Block** block = blockAtRef(key);
-    if ( (block != nullptr) && (*block != nullptr) )
-    {
-        object = (*block)->mValue;
-        result = true;
-    }
-
-    return result;
+    return TEHashMap<Timer *, TimerInfo, Timer *, const TimerInfo &, ImplTimerTable>::find(const_cast<Timer *>(key), object);
 }
 
 inline TimerInfo * MapTimerTable::findObject(const Timer * key)
 {
-    TimerInfo * result = nullptr;
-    TEHashMap<Timer *, TimerInfo, const Timer *, const TimerInfo &, ImplTimerTable>::Block** block = blockAtRef(key);
-    if ( (block != nullptr) && (*block != nullptr) )
-    {
-        result = &((*block)->mValue);
-    }
-
-    return result;
+    MAPPOS pos = TEHashMap<Timer *, TimerInfo, Timer *, const TimerInfo &, ImplTimerTable>::find(const_cast<Timer *>(key));
+    return (pos != nullptr ? &TEHashMap<Timer *, TimerInfo, Timer *, const TimerInfo &, ImplTimerTable>::getPosition(pos) : nullptr);
 }
 
 inline void MapTimerTable::removeAll(void)
 {
-    TEHashMap<Timer *, TimerInfo, const Timer *, const TimerInfo &, ImplTimerTable>::removeAll();
+    TEHashMap<Timer *, TimerInfo, Timer *, const TimerInfo &, ImplTimerTable>::removeAll();
 }
 
 //////////////////////////////////////////////////////////////////////////
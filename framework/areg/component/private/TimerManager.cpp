@@ -30,6 +30,8 @@ DEF_TRACE_SCOPE(areg_component_private_TimerManager_startTimer);
 DEF_TRACE_SCOPE(areg_component_private_TimerManager_processEvent);
 DEF_TRACE_SCOPE(areg_component_private_TimerManager__registerTimer);
 DEF_TRACE_SCOPE(areg_component_private_TimerManager__processExpiredTimers);
+DEF_TRACE_SCOPE(areg_component_private_TimerManager__batchExpiredTimer);
+DEF_TRACE_SCOPE(areg_component_private_TimerManager__sendTimerBatches);
 DEF_TRACE_SCOPE(areg_component_private_TimerManager__startSystemTimer);
 
 //////////////////////////////////////////////////////////////////////////
@@ -111,6 +113,8 @@ TimerManager::TimerManager( void )
     , mTimerTable   ( )
     , mExpiredTimers( )
     , mTimerResource( )
+    , mTimerWheel   ( )
+    , mTimerBatches ( )
     , mLock         ( false )
 {
 }
@@ -250,50 +254,91 @@ void TimerManager::processEvent( const TimerManagingEventData & data )
 
 void TimerManager::_processExpiredTimers( void )
 {
-    do 
-    {
-        TRACE_SCOPE(areg_component_private_TimerManager__processExpiredTimers);
-        Thread::switchThread();
-        Lock lock(mLock);
+    TRACE_SCOPE(areg_component_private_TimerManager__processExpiredTimers);
+    Lock lock(mLock);
 
-        TRACE_DBG("There are [ %d ] expired timers in the list to process", mExpiredTimers.getSize());
+    TRACE_DBG("There are [ %d ] expired timers in the list to process", mExpiredTimers.getSize());
 
-        if (mExpiredTimers.isEmpty())
+    // take all expired timers at once, the timers of the same thread are sent in one event.
+    while ( mExpiredTimers.isEmpty() == false )
+    {
+        ExpiredTimerInfo expiredTime = mExpiredTimers.popTimer();
+        if ( _batchExpiredTimer(expiredTime) == false )
         {
-            TRACE_INFO("No more expired timer, finishing the job.");
-            break; // exit loop!!!
+            TRACE_WARN("Invalid timer in the list of [%d ] expired timers. Cannot get timer [ %p ] information from map of size [ %d ] entries"
+                            , mExpiredTimers.getSize()
+                            , expiredTime.mTimer
+                            , mTimerTable.getSize());
         }
+    }
 
-        ExpiredTimerInfo expiredTime = mExpiredTimers.popTimer();
-        Timer * currTimer     = expiredTime.mTimer;
-        TimerInfo * timerInfo = currTimer != nullptr ? mTimerTable.findObject(currTimer) : nullptr;
+    _sendTimerBatches();
+}
+
+bool TimerManager::_batchExpiredTimer( const ExpiredTimerInfo & expiredTimer )
+{
+    TRACE_SCOPE(areg_component_private_TimerManager__batchExpiredTimer);
+
+    Timer * currTimer     = expiredTimer.mTimer;
+    TimerInfo * timerInfo = currTimer != nullptr ? mTimerTable.findObject(currTimer) : nullptr;
+
+    if (timerInfo != nullptr)
+    {
+        ASSERT(currTimer != nullptr);
+        id_type threadId = timerInfo->mOwnThreadId;
+
+        if ( timerInfo->canContinueTimer(expiredTimer))
+        {
+            TRACE_DBG("Batch timer [ %s ] event to target [ %u ], continuing timer", currTimer->getName().getString(), static_cast<unsigned int>(threadId));
+        }
+        else
+        {
+            TRACE_WARN("Either the Timer [ %s ] is not active or cannot send anymore. Going to unregister", currTimer->getName().getString());
+            _unregisterTimer(currTimer);
+        }
 
-        if (timerInfo != nullptr)
+        // there are few owner threads, search the batch linear.
+        TimerBatchEvent * batch = nullptr;
+        for ( int i = 0; (batch == nullptr) && (i < mTimerBatches.getSize()); ++ i )
         {
-            ASSERT(currTimer != nullptr);
-            id_type threadId = timerInfo->mOwnThreadId;
+            batch = mTimerBatches[i]->getTargetThreadId() == threadId ? mTimerBatches[i] : nullptr;
+        }
 
-            if ( timerInfo->canContinueTimer(expiredTime))
+        if ( batch == nullptr )
+        {
+            DispatcherThread & dispatchThread = DispatcherThread::getDispatcherThread(threadId);
+            batch = dispatchThread.isRunning() ? DEBUG_NEW TimerBatchEvent(dispatchThread) : nullptr;
+            if ( batch != nullptr )
             {
-                TRACE_DBG("Send timer [ %s ] event to target [ %u ], continuing timer", currTimer->getName().getString(), static_cast<unsigned int>(timerInfo->mOwnThreadId));
+                mTimerBatches.add(batch);
             }
             else
             {
-                TRACE_WARN("Either the Timer [ %s ] is not active or cannot send anymore. Going to unregister", currTimer->getName().getString());
-                _unregisterTimer(currTimer);
+                TRACE_ERR("Invalid Dispatcher Thread [ %u ]. Ignoring sending timer [ %s ] event", static_cast<unsigned int>(threadId), currTimer->getName().getString());
             }
-
-            TimerEvent::sendEvent( *currTimer, threadId );
         }
-        else
+
+        if ( batch != nullptr )
         {
-            TRACE_WARN("Invalid timer in the list of [%d ] expired timers. Cannot get timer [ %p ] information from map of size [ %d ] entries"
-                            , mExpiredTimers.getSize()
-                            , currTimer
-                            , mTimerTable.getSize());
-            break;
+            batch->addTimer(*currTimer);
         }
-    } while (true);
+    }
+
+    return (timerInfo != nullptr);
+}
+
+void TimerManager::_sendTimerBatches( void )
+{
+    TRACE_SCOPE(areg_component_private_TimerManager__sendTimerBatches);
+
+    for ( int i = 0; i < mTimerBatches.getSize(); ++ i )
+    {
+        TimerBatchEvent * batch = mTimerBatches[i];
+        TRACE_DBG("Send batch of [ %d ] timer events to target [ %u ]", batch->getTimerCount(), static_cast<unsigned int>(batch->getTargetThreadId()));
+        static_cast<Event *>(batch)->deliverEvent();
+    }
+
+    mTimerBatches.removeAll();
 }
 
 void TimerManager::_timerExpired( Timer* whichTimer, unsigned int highValue, unsigned int lowValue )
@@ -379,6 +424,51 @@ bool TimerManager::postEvent( Event& eventElem )
 
 bool TimerManager::runDispatcher( void )
 {
+#if defined(AREG_TIMER_WHEEL)
+
+    const ExitEvent& exitEvent = ExitEvent::getExitEvent();
+    bool hasExit = false;
+
+    readyForEvents(true);
+    do
+    {
+        if ( mTimerWheel.waitExpiration() )
+        {
+            _expireWheelTimers();
+        }
+
+        // the thread is woken up once for any number of queued events.
+        Event * eventElem = pickEvent();
+        while ( eventElem != nullptr )
+        {
+            if ( static_cast<const Event *>(eventElem) != static_cast<const Event *>(&exitEvent) )
+            {
+                TRACE_SCOPE(areg_component_private_TimerManager_runDispatcher);
+                if (prepareDispatchEvent(eventElem))
+                {
+                    dispatchEvent(*eventElem);
+                }
+
+                postDispatchEvent(eventElem);
+                eventElem = pickEvent();
+            }
+            else
+            {
+                OUTPUT_DBG("Received exit event. Going to exit System Timer Thread!");
+                hasExit = true;
+                eventElem = nullptr;
+            }
+        }
+
+    } while (hasExit == false);
+
+    readyForEvents(false);
+    removeAllEvents( );
+
+    return hasExit;
+
+#else   // !defined(AREG_TIMER_WHEEL)
+
     IESynchObject* synchObjects[] = {&mEventExit, &mEventQueue};
     MultiLock multiLock(synchObjects, 2, false);
 
@@ -420,8 +510,23 @@ bool TimerManager::runDispatcher( void )
     ASSERT(static_cast<EventQueue &>(mInternalEvents).isEmpty());
 
     return (whichEvent == static_cast<int>(EventDispatcherBase::eEventOrder::EventExit));
+
+#endif  // defined(AREG_TIMER_WHEEL)
 }
 
+#if defined(AREG_TIMER_WHEEL)
+
+void TimerManager::signalEvent( int eventCount )
+{
+    DispatcherThread::signalEvent(eventCount);
+    if ( eventCount > 0 )
+    {
+        mTimerWheel.wakeUp();
+    }
+}
+
+#endif  // defined(AREG_TIMER_WHEEL)
+
 void TimerManager::readyForEvents( bool isReady )
 {
     if (isReady)
@@ -447,7 +552,11 @@ bool TimerManager::_startTimerManagerThread( void )
     if ( isReady() == false )
     {
         ASSERT(isRunning() == false);
+#if defined(AREG_TIMER_WHEEL)
+        result = mTimerWheel.create() && createThread(NECommon::WAIT_INFINITE) && waitForDispatcherStart(NECommon::WAIT_INFINITE);
+#else   // !defined(AREG_TIMER_WHEEL)
         result = createThread(NECommon::WAIT_INFINITE) && waitForDispatcherStart(NECommon::WAIT_INFINITE);
+#endif  // defined(AREG_TIMER_WHEEL)
 #ifdef _DEBUG
         if ( result == false )
         {
@@ -466,4 +575,7 @@ bool TimerManager::_startTimerManagerThread( void )
 void TimerManager::_stopTimerManagerThread( void )
 {
     destroyThread(NECommon::WAIT_INFINITE);
+#if defined(AREG_TIMER_WHEEL)
+    mTimerWheel.release();
+#endif  // defined(AREG_TIMER_WHEEL)
 }
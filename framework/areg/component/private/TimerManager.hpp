@@ -25,7 +25,9 @@
 
 #include "areg/base/SynchObjects.hpp"
 #include "areg/base/TEResourceMap.hpp"
+#include "areg/base/TEArrayList.hpp"
 #include "areg/component/private/TimerInfo.hpp"
+#include "areg/component/private/TimerWheel.hpp"
 
 #include <string_view>
 
@@ -34,6 +36,7 @@
  ************************************************************************/
 class Timer;
 class DispatcherThread;
+class TimerBatchEvent;
 
 //////////////////////////////////////////////////////////////////////////
 // TimerManager class declaration
@@ -55,6 +58,14 @@ class DispatcherThread;
  *              and the object is generating Timer Event and sends to
  *              the queue of Timer Consumer Thread.
  *
+ *          If compiled with ENABLE_TIMER_WHEEL on Linux, the Timer Manager
+ *          does not create system timer per timer. The timers are scheduled
+ *          in the timing wheel, which is driven by single system timer,
+ *          and the Timer Thread collects all expired timers at once.
+ *
+ *          The timers, which are expired at once and should be processed
+ *          in the same thread, are delivered as one batch event.
+ *
  **/
 class TimerManager  : protected DispatcherThread
                     , protected IETimerManagingEventConsumer
@@ -78,6 +89,7 @@ private:
     using ImplHandleHashMap = TEPointerHashMapImpl<TIMERHANDLE, Timer*>;
     using MapTimerResource  = TEHashMap<TIMERHANDLE, Timer*, TIMERHANDLE, Timer*, ImplHandleHashMap>;
     using TimerResource     = TELockResourceMap<TIMERHANDLE, Timer, MapTimerResource>;
+    using TimerBatchList    = TEArrayList<TimerBatchEvent *>;
 
 //////////////////////////////////////////////////////////////////////////
 // Static members
@@ -220,6 +232,17 @@ protected:
      **/
     virtual void readyForEvents( bool isReady ) override;
 
+#if defined(AREG_TIMER_WHEEL)
+
+    /**
+     * \brief	Triggered when the event is pushed in the queue or the queue is empty.
+     *          Wakes up the Timer Thread waiting for expired timers.
+     * \param	eventCount	The number of events in the queue.
+     **/
+    virtual void signalEvent( int eventCount ) override;
+
+#endif  // defined(AREG_TIMER_WHEEL)
+
 //////////////////////////////////////////////////////////////////////////
 // Hidden operations. Called from Timer Thread.
 //////////////////////////////////////////////////////////////////////////
@@ -229,6 +252,31 @@ private:
      **/
     void _processExpiredTimers( void );
 
+    /**
+     * \brief   Adds the expired timer to the batch of timer events of owner thread.
+     *          If the timer should not continue, unregisters the timer.
+     *          The timer lock should be already acquired.
+     * \param   expiredTimer    The expired timer information.
+     * \return  Returns false if the expired timer is not registered anymore.
+     **/
+    bool _batchExpiredTimer( const ExpiredTimerInfo & expiredTimer );
+
+    /**
+     * \brief   Sends the batches of timer events to the owner threads and empties the list of batches.
+     *          The timer lock should be already acquired.
+     **/
+    void _sendTimerBatches( void );
+
+#if defined(AREG_TIMER_WHEEL)
+
+    /**
+     * \brief   Called when the timing wheel timer expired. Takes all expired timers
+     *          of the timing wheel and sends the batches of timer events at once.
+     **/
+    void _expireWheelTimers( void );
+
+#endif  // defined(AREG_TIMER_WHEEL)
+
     /**
      * \brief   Stops and removes all timers, i.e. unregisters all timers.
      **/
@@ -351,6 +399,14 @@ private:
      * \brief   Timer resource handler; 
      **/
     TimerResource	mTimerResource;
+    /**
+     * \brief   The timing wheel of timers. Used only if compiled with ENABLE_TIMER_WHEEL.
+     **/
+    TimerWheel      mTimerWheel;
+    /**
+     * \brief   The batches of timer events per owner thread, which are not sent yet.
+     **/
+    TimerBatchList  mTimerBatches;
     /**
      * \brief   Synchronization object.
      **/
@@ -0,0 +1,261 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/component/private/TimerWheel.cpp
+ * \ingroup     AREG SDK, Asynchronous Event Generator Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, The hierarchical timing wheel of Timer Manager.
+ *              OS independent part of implementation.
+ *
+ ************************************************************************/
+#include "areg/component/private/TimerWheel.hpp"
+
+#include "areg/component/Timer.hpp"
+
+//////////////////////////////////////////////////////////////////////////
+// TimerWheel class implementation
+//////////////////////////////////////////////////////////////////////////
+
+TimerWheel::TimerWheel( void )
+    : mRootSlots    { }
+    , mLevelSlots   { }
+    , mCurrentTick  ( 0 )
+    , mExpireTick   ( 0 )
+    , mTimerTick    ( TimerWheel::INVALID_TICK )
+    , mEntryCount   ( 0 )
+    , mRootCount    ( 0 )
+    , mTimerHandle  ( -1 )
+    , mWakeUpHandle ( -1 )
+{
+}
+
+TimerWheel::~TimerWheel( void )
+{
+    release( );
+}
+
+bool TimerWheel::startEntry( sWheelEntry & entry, Timer & timer, unsigned int timeout, unsigned int eventCount, unsigned int slack )
+{
+    bool result = false;
+    _removeEntry( entry );
+
+    if ( (timeout != 0) && (eventCount != 0) )
+    {
+        // round up to not expire earlier than the timeout.
+        uint64_t now = TimerWheel::_osGetTickCount( true );
+        if ( mEntryCount == 0 )
+        {
+            // the empty wheel does not need to go through the passed ticks.
+            mCurrentTick = MACRO_MAX( mCurrentTick, now );
+        }
+
+        entry.weTimer   = &timer;
+        entry.wePeriod  = timeout;
+        entry.weCount   = eventCount;
+        entry.weSlack   = slack;
+        entry.weExpires = now + timeout;
+        _insertEntry( entry );
+
+        uint64_t fires  = TimerWheel::_fireTick( entry );
+        if ( fires < mTimerTick )
+        {
+            _osSetTimer( fires );
+        }
+
+        result = true;
+    }
+
+    return result;
+}
+
+void TimerWheel::stopEntry( sWheelEntry & entry )
+{
+    _removeEntry( entry );
+}
+
+void TimerWheel::expireEntries( void )
+{
+    mExpireTick = TimerWheel::_osGetTickCount( false );
+}
+
+TimerWheel::sWheelEntry * TimerWheel::popExpired( void )
+{
+    sWheelEntry * result = nullptr;
+
+    while ( (result == nullptr) && (mCurrentTick <= mExpireTick) )
+    {
+        sWheelEntry * entry = mRootSlots[mCurrentTick & (ROOT_SIZE - 1)];
+        if ( entry != nullptr )
+        {
+            _removeEntry( *entry );
+            if ( (entry->weCount == Timer::CONTINUOUSLY) || (-- entry->weCount != 0) )
+            {
+                // keep the period of timer, the missed expirations are skipped.
+                uint64_t expires = entry->weExpires + entry->wePeriod;
+                if ( expires <= mExpireTick )
+                {
+                    expires += ((mExpireTick - expires) / entry->wePeriod + 1) * entry->wePeriod;
+                }
+
+                entry->weExpires = expires;
+                _insertEntry( *entry );
+            }
+
+            result = entry;
+        }
+        else if ( mEntryCount == 0 )
+        {
+            mCurrentTick = mExpireTick + 1;
+        }
+        else if ( mRootCount == 0 )
+        {
+            // nothing expires until the root level turns around.
+            _moveToTick( MACRO_MIN( mExpireTick + 1, (mCurrentTick | (ROOT_SIZE - 1)) + 1 ) );
+        }
+        else
+        {
+            _moveToTick( mCurrentTick + 1 );
+        }
+    }
+
+    return result;
+}
+
+void TimerWheel::scheduleExpiration( void )
+{
+    _osSetTimer( _nextExpirationTick( ) );
+}
+
+void TimerWheel::_insertEntry( sWheelEntry & entry )
+{
+    ASSERT( entry.weSlot == nullptr );
+
+    uint64_t fires = TimerWheel::_fireTick( entry );
+    uint64_t delta = fires > mCurrentTick ? fires - mCurrentTick : 0;
+    sWheelEntry ** slot = nullptr;
+    if ( delta < ROOT_SIZE )
+    {
+        // the entry, which is already due, expires with the current tick.
+        slot = &mRootSlots[(delta != 0 ? fires : mCurrentTick) & (ROOT_SIZE - 1)];
+        ++ mRootCount;
+    }
+    else
+    {
+        // the entry beyond the range of wheel is placed in the last slot and moved down later.
+        delta = MACRO_MIN( delta, static_cast<uint64_t>(0xFFFFFFFFu) );
+        uint64_t expires    = mCurrentTick + delta;
+        unsigned int level  = 0;
+        unsigned int shift  = ROOT_BITS;
+        while ( (level + 1 < LEVEL_COUNT) && (delta >= (static_cast<uint64_t>(1) << (shift + LEVEL_BITS))) )
+        {
+            ++ level;
+            shift += LEVEL_BITS;
+        }
+
+        slot = &mLevelSlots[level][static_cast<unsigned int>(expires >> shift) & (LEVEL_SIZE - 1)];
+    }
+
+    entry.weSlot    = slot;
+    entry.wePrev    = nullptr;
+    entry.weNext    = *slot;
+    if ( entry.weNext != nullptr )
+    {
+        entry.weNext->wePrev = &entry;
+    }
+
+    *slot = &entry;
+    ++ mEntryCount;
+}
+
+void TimerWheel::_removeEntry( sWheelEntry & entry )
+{
+    if ( entry.weSlot != nullptr )
+    {
+        if ( entry.wePrev != nullptr )
+        {
+            entry.wePrev->weNext = entry.weNext;
+        }
+        else
+        {
+            *entry.weSlot = entry.weNext;
+        }
+
+        if ( entry.weNext != nullptr )
+        {
+            entry.weNext->wePrev = entry.wePrev;
+        }
+
+        // the root slots are declared before the slots of upper levels.
+        if ( entry.weSlot < &mLevelSlots[0][0] )
+        {
+            -- mRootCount;
+        }
+
+        entry.weSlot    = nullptr;
+        entry.wePrev    = nullptr;
+        entry.weNext    = nullptr;
+        -- mEntryCount;
+    }
+}
+
+void TimerWheel::_moveToTick( uint64_t tick )
+{
+    mCurrentTick = tick;
+
+    // when the lower level turns around, the entries of next slot of upper level are moved down.
+    bool turned         = (tick & (ROOT_SIZE - 1)) == 0;
+    unsigned int shift  = ROOT_BITS;
+    for ( unsigned int level = 0; turned && (level < LEVEL_COUNT); ++ level, shift += LEVEL_BITS )
+    {
+        unsigned int index  = static_cast<unsigned int>(tick >> shift) & (LEVEL_SIZE - 1);
+        sWheelEntry * entry = mLevelSlots[level][index];
+        mLevelSlots[level][index] = nullptr;
+
+        while ( entry != nullptr )
+        {
+            sWheelEntry * next = entry->weNext;
+            entry->weSlot = nullptr;
+            -- mEntryCount;
+            _insertEntry( *entry );
+            entry = next;
+        }
+
+        turned = (index == 0);
+    }
+}
+
+uint64_t TimerWheel::_nextExpirationTick( void ) const
+{
+    uint64_t result = TimerWheel::INVALID_TICK;
+
+    for ( unsigned int i = 0; (mRootCount != 0) && (result == TimerWheel::INVALID_TICK) && (i < ROOT_SIZE); ++ i )
+    {
+        if ( mRootSlots[(mCurrentTick + i) & (ROOT_SIZE - 1)] != nullptr )
+        {
+            result = mCurrentTick + i;
+        }
+    }
+
+    unsigned int shift = ROOT_BITS;
+    for ( unsigned int level = 0; (mEntryCount > mRootCount) && (level < LEVEL_COUNT); ++ level, shift += LEVEL_BITS )
+    {
+        // the slot of current tick is already moved down, start with the next turn of lower level.
+        uint64_t span = static_cast<uint64_t>(1) << shift;
+        uint64_t tick = (mCurrentTick | (span - 1)) + 1;
+        for ( unsigned int i = 0; (tick < result) && (i < LEVEL_SIZE); ++ i, tick += span )
+        {
+            if ( mLevelSlots[level][static_cast<unsigned int>(tick >> shift) & (LEVEL_SIZE - 1)] != nullptr )
+            {
+                result = tick;
+            }
+        }
+    }
+
+    return result;
+}
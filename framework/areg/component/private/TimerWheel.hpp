@@ -0,0 +1,328 @@
+#pragma once
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/component/private/TimerWheel.hpp
+ * \ingroup     AREG SDK, Asynchronous Event Generator Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, The hierarchical timing wheel of Timer Manager.
+ *
+ ************************************************************************/
+
+/************************************************************************
+ * Include files
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+
+/**
+ * \brief   AREG_TIMER_WHEEL is defined if the Timer Manager runs timers in the
+ *          hierarchical timing wheel driven by single Linux timerfd instead of
+ *          creating POSIX timer per Timer object. It is enabled by
+ *          ENABLE_TIMER_WHEEL preprocessor define.
+ **/
+#if defined(__linux__) && (defined(ENABLE_TIMER_WHEEL) || defined(_ENABLE_TIMER_WHEEL))
+    #define AREG_TIMER_WHEEL
+#endif  // defined(__linux__) && (defined(ENABLE_TIMER_WHEEL) || defined(_ENABLE_TIMER_WHEEL))
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+class Timer;
+
+//////////////////////////////////////////////////////////////////////////
+// TimerWheel class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The hierarchical timing wheel with millisecond resolution.
+ *          The root level has 256 slots of 1 millisecond, each of 4 upper
+ *          levels has 64 slots, which cover 64 times longer period than
+ *          the slots of lower level. So that, the wheel covers the full
+ *          range of 32-bit timeouts. The entries of upper levels are moved
+ *          to the lower levels when the root level turns around.
+ *          The entries are linked in the lists of slots, so that starting and
+ *          stopping the entry does not depend on the number of entries.
+ *
+ *          The wheel is driven by single system timer, which is set to the
+ *          time of next expiration or next move of upper level entries.
+ *          The thread waits for the timer and collects all due entries at once.
+ *          The system timer is supported only on Linux (timerfd on monotonic clock).
+ *
+ *          The entry with slack is placed in the slot of tick aligned to the
+ *          granularity of slack, so that the entries with nearby expiration
+ *          times expire together with one wake up of the thread.
+ *
+ *          The wheel entries are not synchronized, the caller should use
+ *          the lock. The waiting and waking up the thread are thread safe,
+ *          but only one thread should wait for expiration.
+ **/
+class TimerWheel
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   TimerWheel::sWheelEntry
+     *          The entry of timing wheel, which is created per timer.
+     **/
+    typedef struct S_WheelEntry
+    {
+        //!< The next entry in the slot.
+        S_WheelEntry *  weNext;
+        //!< The previous entry in the slot.
+        S_WheelEntry *  wePrev;
+        //!< The slot where the entry is linked, nullptr if the entry is not scheduled.
+        S_WheelEntry ** weSlot;
+        //!< The tick in milliseconds when the entry expires.
+        uint64_t        weExpires;
+        //!< The timer object of entry.
+        Timer *         weTimer;
+        //!< The timeout in milliseconds to repeat the entry.
+        unsigned int    wePeriod;
+        //!< The remaining number of expirations, Timer::CONTINUOUSLY if endless.
+        unsigned int    weCount;
+        //!< The allowed delay in milliseconds to coalesce the entry with other entries.
+        unsigned int    weSlack;
+    } sWheelEntry;
+
+    /**
+     * \brief   TimerWheel::ROOT_BITS
+     *          The number of bits of tick to index the root level slots.
+     **/
+    static constexpr unsigned int   ROOT_BITS       { 8 };
+    /**
+     * \brief   TimerWheel::ROOT_SIZE
+     *          The number of slots in the root level.
+     **/
+    static constexpr unsigned int   ROOT_SIZE       { 1u << ROOT_BITS };
+    /**
+     * \brief   TimerWheel::LEVEL_BITS
+     *          The number of bits of tick to index the upper level slots.
+     **/
+    static constexpr unsigned int   LEVEL_BITS      { 6 };
+    /**
+     * \brief   TimerWheel::LEVEL_SIZE
+     *          The number of slots in the upper level.
+     **/
+    static constexpr unsigned int   LEVEL_SIZE      { 1u << LEVEL_BITS };
+    /**
+     * \brief   TimerWheel::LEVEL_COUNT
+     *          The number of upper levels.
+     **/
+    static constexpr unsigned int   LEVEL_COUNT     { 4 };
+    /**
+     * \brief   TimerWheel::INVALID_TICK
+     *          Indicates that there is no tick to expire.
+     **/
+    static constexpr uint64_t       INVALID_TICK    { ~static_cast<uint64_t>(0) };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Initializes empty wheel. The system timer is not created.
+     **/
+    TimerWheel( void );
+
+    /**
+     * \brief   Destructor. Releases the system timer.
+     **/
+    ~TimerWheel( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Operations and attributes
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns true if the system timer of wheel is created and valid.
+     **/
+    inline bool isValid( void ) const;
+
+    /**
+     * \brief   Returns the number of scheduled entries.
+     **/
+    inline int getEntryCount( void ) const;
+
+    /**
+     * \brief   Creates the system timer. Returns true if succeeded or the timer was already created.
+     *          Returns false if failed or the system timer is not supported by the platform.
+     **/
+    bool create( void );
+
+    /**
+     * \brief   Releases the system timer. Should be called when no thread waits for expiration.
+     **/
+    void release( void );
+
+    /**
+     * \brief   Schedules the entry to expire after the timeout. If the entry is scheduled,
+     *          it is rescheduled. The expired entry is scheduled again if it should repeat.
+     * \param   entry       The wheel entry to schedule.
+     * \param   timer       The timer object of entry.
+     * \param   timeout     The timeout in milliseconds, should not be zero.
+     * \param   eventCount  The number of expirations, Timer::CONTINUOUSLY if endless.
+     * \param   slack       The allowed delay in milliseconds to coalesce the entry with other entries.
+     * \return  Returns true if the entry is scheduled.
+     **/
+    bool startEntry( sWheelEntry & entry, Timer & timer, unsigned int timeout, unsigned int eventCount, unsigned int slack );
+
+    /**
+     * \brief   Removes the entry from the wheel. Does nothing if the entry is not scheduled.
+     **/
+    void stopEntry( sWheelEntry & entry );
+
+    /**
+     * \brief   Marks the entries due at current time as expired.
+     *          The expired entries are taken by popExpired() call.
+     **/
+    void expireEntries( void );
+
+    /**
+     * \brief   Removes the next expired entry from the wheel and returns it.
+     *          If the entry should repeat, it is scheduled again.
+     * \return  Returns the next expired entry or nullptr if there are no more expired entries.
+     **/
+    sWheelEntry * popExpired( void );
+
+    /**
+     * \brief   Sets the system timer to the time of next expiration.
+     *          Should be called when the expired entries are taken.
+     **/
+    void scheduleExpiration( void );
+
+    /**
+     * \brief   Blocks the calling thread until either the system timer expires
+     *          or the thread is woken up.
+     * \return  Returns true if the system timer expired. Returns false if woken up or failed.
+     **/
+    bool waitExpiration( void );
+
+    /**
+     * \brief   Wakes up the thread waiting for expiration. Can be called by any thread.
+     **/
+    void wakeUp( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Links the entry in the slot matching its expiration tick.
+     **/
+    void _insertEntry( sWheelEntry & entry );
+
+    /**
+     * \brief   Unlinks the entry from the slot.
+     **/
+    void _removeEntry( sWheelEntry & entry );
+
+    /**
+     * \brief   Returns the tick when the entry is fired. If the entry has slack, the expiration
+     *          tick is rounded up to the biggest power of 2 milliseconds, which is not bigger than slack.
+     **/
+    static inline uint64_t _fireTick( const sWheelEntry & entry );
+
+    /**
+     * \brief   Moves the current tick. When the root level turns around,
+     *          moves the entries of upper levels to the lower levels.
+     * \param   tick    The new current tick.
+     **/
+    void _moveToTick( uint64_t tick );
+
+    /**
+     * \brief   Returns the tick of next expiration or next move of upper level entries.
+     *          Returns INVALID_TICK if the wheel is empty.
+     **/
+    uint64_t _nextExpirationTick( void ) const;
+
+    /**
+     * \brief   Returns the system tick in milliseconds. OS specific implementation.
+     * \param   roundUp     If true, the fraction of millisecond is rounded up.
+     **/
+    static uint64_t _osGetTickCount( bool roundUp );
+
+    /**
+     * \brief   Sets the system timer to expire at the given tick. OS specific implementation.
+     * \param   tick    The tick to expire. If INVALID_TICK, the system timer is stopped.
+     **/
+    void _osSetTimer( uint64_t tick );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The slots of root level.
+     **/
+    sWheelEntry *   mRootSlots[ROOT_SIZE];
+    /**
+     * \brief   The slots of upper levels.
+     **/
+    sWheelEntry *   mLevelSlots[LEVEL_COUNT][LEVEL_SIZE];
+    /**
+     * \brief   The current tick, which is not processed yet.
+     **/
+    uint64_t        mCurrentTick;
+    /**
+     * \brief   The last tick of expired entries.
+     **/
+    uint64_t        mExpireTick;
+    /**
+     * \brief   The tick the system timer is set to expire.
+     **/
+    uint64_t        mTimerTick;
+    /**
+     * \brief   The number of scheduled entries.
+     **/
+    int             mEntryCount;
+    /**
+     * \brief   The number of entries in the root level.
+     **/
+    int             mRootCount;
+    /**
+     * \brief   The handle of system timer.
+     **/
+    int             mTimerHandle;
+    /**
+     * \brief   The handle of object to wake up the waiting thread.
+     **/
+    int             mWakeUpHandle;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    DECLARE_NOCOPY_NOMOVE( TimerWheel );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// TimerWheel class inline functions
+//////////////////////////////////////////////////////////////////////////
+
+inline bool TimerWheel::isValid( void ) const
+{
+    return (mTimerHandle != -1);
+}
+
+inline int TimerWheel::getEntryCount( void ) const
+{
+    return mEntryCount;
+}
+
+inline uint64_t TimerWheel::_fireTick( const sWheelEntry & entry )
+{
+    uint64_t granularity = 1;
+    while ( (granularity << 1) <= static_cast<uint64_t>(entry.weSlack) )
+    {
+        granularity <<= 1;
+    }
+
+    return ((entry.weExpires + granularity - 1) & ~(granularity - 1));
+}
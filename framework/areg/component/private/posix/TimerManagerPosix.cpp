@@ -29,6 +29,120 @@
 #include <errno.h>
 
 DEF_TRACE_SCOPE(areg_component_private_posix_TimerManager__createSystemTimer);
+
+#if defined(AREG_TIMER_WHEEL)
+
+DEF_TRACE_SCOPE(areg_component_private_posix_TimerManager__expireWheelTimers);
+
+//////////////////////////////////////////////////////////////////////////
+// Linux specific methods, timers in the timing wheel
+//////////////////////////////////////////////////////////////////////////
+
+TIMERHANDLE TimerManager::_createWaitableTimer( const char * /* timerName */ )
+{
+    return static_cast<TIMERHANDLE>(DEBUG_NEW TimerWheel::sWheelEntry { });
+}
+
+void TimerManager::_stopSystemTimer( TIMERHANDLE timerHandle )
+{
+    TimerWheel::sWheelEntry * entry = reinterpret_cast<TimerWheel::sWheelEntry *>(timerHandle);
+    if ( entry != nullptr )
+    {
+        TimerManager::getInstance().mTimerWheel.stopEntry( *entry );
+    }
+}
+
+void TimerManager::_destroyWaitableTimer( TIMERHANDLE timerHandle, bool cancelTimer )
+{
+    TimerWheel::sWheelEntry * entry = reinterpret_cast<TimerWheel::sWheelEntry *>(timerHandle);
+    if ( entry != nullptr )
+    {
+        if ( cancelTimer )
+        {
+            TimerManager::getInstance().mTimerWheel.stopEntry( *entry );
+        }
+
+        // the unregistered timer is already removed from the wheel.
+        ASSERT( entry->weSlot == nullptr );
+        delete entry;
+    }
+}
+
+bool TimerManager::_createSystemTimer( TimerInfo & timerInfo, MapTimerTable & timerTable )
+{
+    TRACE_SCOPE(areg_component_private_posix_TimerManager__createSystemTimer);
+
+    bool result = false;
+    TimerWheel::sWheelEntry * entry = reinterpret_cast<TimerWheel::sWheelEntry *>(timerInfo.getHandle());
+    Timer * whichTimer              = timerInfo.getTimer();
+    if ((entry != nullptr) && (whichTimer != nullptr))
+    {
+        struct timespec ts;
+        clock_gettime(CLOCK_REALTIME, &ts);
+        timerInfo.timerStarting( static_cast<unsigned int>(ts.tv_sec), static_cast<unsigned int>(ts.tv_nsec));
+        timerTable.registerObject( whichTimer, timerInfo );
+
+        TimerWheel & timerWheel = TimerManager::getInstance().mTimerWheel;
+        result = timerWheel.startEntry( *entry, *whichTimer, whichTimer->getFireTime(), whichTimer->getEventCount(), whichTimer->getSlack() );
+        if ( result )
+        {
+            TRACE_DBG("Started timer [ %s ] with timeout [ %u ] ms, there are [ %d ] timers in the timing wheel"
+                        , whichTimer->getName().getString()
+                        , whichTimer->getFireTime()
+                        , timerWheel.getEntryCount());
+        }
+        else
+        {
+            TRACE_ERR("Failed to start timer [ %s ] in period [ %u ] ms and event count [ %u ]"
+                        , whichTimer->getName().getString()
+                        , whichTimer->getFireTime()
+                        , whichTimer->getEventCount());
+
+            timerInfo.mTimerState   = TimerInfo::eTimerState::TimerIdle;
+            timerTable.updateObject( whichTimer, timerInfo );
+        }
+    }
+    else
+    {
+        TRACE_ERR("Either timing wheel entry [ %p ], or the timer [ %p ] object are null", entry, whichTimer);
+    }
+
+    return result;
+}
+
+void TimerManager::_expireWheelTimers( void )
+{
+    TRACE_SCOPE(areg_component_private_posix_TimerManager__expireWheelTimers);
+
+    Lock lock(mLock);
+
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    unsigned int highValue  = static_cast<unsigned int>(ts.tv_sec );
+    unsigned int lowValue   = static_cast<unsigned int>(ts.tv_nsec);
+
+    // the expired timers are sent at once, one batch per owner thread.
+    int count = 0;
+    mTimerWheel.expireEntries();
+    for ( TimerWheel::sWheelEntry * entry = mTimerWheel.popExpired(); entry != nullptr; entry = mTimerWheel.popExpired() )
+    {
+        ExpiredTimerInfo expiredTimer(entry->weTimer, highValue, lowValue);
+        if ( _batchExpiredTimer(expiredTimer) == false )
+        {
+            TRACE_WARN("The expired timer [ %p ] is not registered anymore, ignoring", entry->weTimer);
+        }
+
+        ++ count;
+    }
+
+    _sendTimerBatches();
+    mTimerWheel.scheduleExpiration();
+
+    TRACE_DBG("Processed [ %d ] expired timers, there are [ %d ] timers in the timing wheel", count, mTimerWheel.getEntryCount());
+}
+
+#else   // !defined(AREG_TIMER_WHEEL)
+
 DEF_TRACE_SCOPE(areg_component_private_posix_TimerManager__defaultPosixTimerExpiredRoutine);
 
 //////////////////////////////////////////////////////////////////////////
@@ -137,4 +251,6 @@ void TimerManager::_defaultPosixTimerExpiredRoutine( union sigval argSig )
     }
 }
 
+#endif  // defined(AREG_TIMER_WHEEL)
+
 #endif  // defined(_POSIX) || defined(POSIX)
@@ -0,0 +1,182 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/component/private/posix/TimerWheelPosix.cpp
+ * \ingroup     AREG SDK, Asynchronous Event Generator Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, The hierarchical timing wheel of Timer Manager.
+ *              POSIX specific implementation, uses timerfd on Linux.
+ *
+ ************************************************************************/
+#include "areg/component/private/TimerWheel.hpp"
+
+#if defined(_POSIX) || defined(POSIX)
+
+#include "areg/trace/GETrace.h"
+
+#include <time.h>
+
+uint64_t TimerWheel::_osGetTickCount( bool roundUp )
+{
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    uint64_t nanosec = static_cast<uint64_t>(ts.tv_nsec) + (roundUp ? 999999u : 0u);
+    return (static_cast<uint64_t>(ts.tv_sec) * 1000u + nanosec / 1000000u);
+}
+
+#if defined(__linux__)
+
+#include <unistd.h>
+#include <errno.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+
+DEF_TRACE_SCOPE(areg_component_private_posix_TimerWheel_create);
+DEF_TRACE_SCOPE(areg_component_private_posix_TimerWheel_waitExpiration);
+
+bool TimerWheel::create( void )
+{
+    TRACE_SCOPE(areg_component_private_posix_TimerWheel_create);
+
+    if ( mTimerHandle == -1 )
+    {
+        mTimerHandle    = timerfd_create( CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK );
+        mWakeUpHandle   = mTimerHandle != -1 ? eventfd( 0, EFD_CLOEXEC | EFD_NONBLOCK ) : -1;
+        mTimerTick      = TimerWheel::INVALID_TICK;
+
+        if ( mWakeUpHandle == -1 )
+        {
+            TRACE_ERR("Failed to create timing wheel timer, error code [ %p ]", static_cast<id_type>(errno));
+            release( );
+        }
+        else
+        {
+            TRACE_DBG("Created timing wheel timer [ %d ]", mTimerHandle);
+        }
+    }
+
+    return (mTimerHandle != -1);
+}
+
+void TimerWheel::release( void )
+{
+    if ( mWakeUpHandle != -1 )
+    {
+        close( mWakeUpHandle );
+        mWakeUpHandle = -1;
+    }
+
+    if ( mTimerHandle != -1 )
+    {
+        close( mTimerHandle );
+        mTimerHandle = -1;
+    }
+}
+
+bool TimerWheel::waitExpiration( void )
+{
+    TRACE_SCOPE(areg_component_private_posix_TimerWheel_waitExpiration);
+
+    bool result = false;
+    if ( mTimerHandle != -1 )
+    {
+        struct pollfd fds[2];
+        fds[0].fd       = mTimerHandle;
+        fds[0].events   = POLLIN;
+        fds[0].revents  = 0;
+        fds[1].fd       = mWakeUpHandle;
+        fds[1].events   = POLLIN;
+        fds[1].revents  = 0;
+
+        int count = -1;
+        do
+        {
+            count = poll( fds, 2, -1 );
+        } while ( (count < 0) && (errno == EINTR) );
+
+        uint64_t value = 0;
+        if ( count < 0 )
+        {
+            TRACE_ERR("Failed to wait for timing wheel timer, error code [ %p ]", static_cast<id_type>(errno));
+        }
+
+        if ( (count > 0) && ((fds[1].revents & POLLIN) != 0) )
+        {
+            ssize_t received = read( mWakeUpHandle, &value, sizeof(uint64_t) );
+            static_cast<void>(received);
+        }
+
+        if ( (count > 0) && ((fds[0].revents & POLLIN) != 0) )
+        {
+            // the timer is not blocking, it is reset if it was set again after poll.
+            ssize_t received = read( mTimerHandle, &value, sizeof(uint64_t) );
+            static_cast<void>(received);
+            result = true;
+        }
+    }
+
+    return result;
+}
+
+void TimerWheel::wakeUp( void )
+{
+    if ( mWakeUpHandle != -1 )
+    {
+        uint64_t value = 1;
+        ssize_t written = write( mWakeUpHandle, &value, sizeof(uint64_t) );
+        static_cast<void>(written);
+    }
+}
+
+void TimerWheel::_osSetTimer( uint64_t tick )
+{
+    mTimerTick = tick;
+    if ( mTimerHandle != -1 )
+    {
+        // the zero value stops the timer.
+        struct itimerspec interval { };
+        if ( tick != TimerWheel::INVALID_TICK )
+        {
+            interval.it_value.tv_sec    = static_cast<time_t>(tick / 1000u);
+            interval.it_value.tv_nsec   = static_cast<long>(tick % 1000u) * 1000000l;
+        }
+
+        timerfd_settime( mTimerHandle, TFD_TIMER_ABSTIME, &interval, nullptr );
+    }
+}
+
+#else   // !defined(__linux__)
+
+bool TimerWheel::create( void )
+{
+    return false;
+}
+
+void TimerWheel::release( void )
+{
+}
+
+bool TimerWheel::waitExpiration( void )
+{
+    return false;
+}
+
+void TimerWheel::wakeUp( void )
+{
+}
+
+void TimerWheel::_osSetTimer( uint64_t tick )
+{
+    mTimerTick = tick;
+}
+
+#endif  // defined(__linux__)
+
+#endif  // defined(_POSIX) || defined(POSIX)
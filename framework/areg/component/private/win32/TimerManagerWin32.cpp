@@ -91,7 +91,15 @@ bool TimerManager::_createSystemTimer( TimerInfo & timerInfo, MapTimerTable & ti
     timeTrigger.HighPart= static_cast<  signed long>(MACRO_64_HI_BYTE32( dueTime ));
 
     timerTable.registerObject( whichTimer, timerInfo );
-    if ( ::SetWaitableTimer( timerInfo.mHandle, &timeTrigger, period, reinterpret_cast<PTIMERAPCROUTINE>(&TimerManager::_defaultWindowsTimerExpiredRoutine), static_cast<void *>(whichTimer), FALSE ) == FALSE )
+
+#if (_WIN32_WINNT >= 0x0601)
+    // the tolerable delay allows the system to coalesce the expirations of timers.
+    BOOL started = ::SetWaitableTimerEx( timerInfo.mHandle, &timeTrigger, period, reinterpret_cast<PTIMERAPCROUTINE>(&TimerManager::_defaultWindowsTimerExpiredRoutine), static_cast<void *>(whichTimer), nullptr, static_cast<ULONG>(whichTimer->getSlack()) );
+#else   // (_WIN32_WINNT < 0x0601)
+    BOOL started = ::SetWaitableTimer( timerInfo.mHandle, &timeTrigger, period, reinterpret_cast<PTIMERAPCROUTINE>(&TimerManager::_defaultWindowsTimerExpiredRoutine), static_cast<void *>(whichTimer), FALSE );
+#endif  // (_WIN32_WINNT >= 0x0601)
+
+    if ( started == FALSE )
     {
         OUTPUT_ERR( "System Failed to start timer in period [ %d ] ms, timer name [ %s ]. System Error [ %p ]"
                         , whichTimer->getFireTime( )
@@ -0,0 +1,52 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/component/private/win32/TimerWheelWin32.cpp
+ * \ingroup     AREG SDK, Asynchronous Event Generator Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, The hierarchical timing wheel of Timer Manager.
+ *              Windows OS specific implementation. The system timer of
+ *              wheel is not supported and the Timer Manager uses waitable timers.
+ *
+ ************************************************************************/
+#include "areg/component/private/TimerWheel.hpp"
+
+#ifdef  _WINDOWS
+
+#include <windows.h>
+
+uint64_t TimerWheel::_osGetTickCount( bool /*roundUp*/ )
+{
+    return static_cast<uint64_t>(::GetTickCount64());
+}
+
+bool TimerWheel::create( void )
+{
+    return false;
+}
+
+void TimerWheel::release( void )
+{
+}
+
+bool TimerWheel::waitExpiration( void )
+{
+    return false;
+}
+
+void TimerWheel::wakeUp( void )
+{
+}
+
+void TimerWheel::_osSetTimer( uint64_t tick )
+{
+    mTimerTick = tick;
+}
+
+#endif  // _WINDOWS
@@ -69,6 +69,12 @@ private:
         , PropertyName          //!< Index of property remote connection service name
         , PropertyHost          //!< Index of property remote connection host address
         , PropertyPort          //!< Index of property remote connection port number
+        , PropertyWorkers       //!< Index of property number of connection I/O worker threads
+        , PropertySharedMemory  //!< Index of property size of shared memory ring of local connection
+        , PropertyDirect        //!< Index of property direct connections between applications are enabled / disabled
+        , PropertySendHigh      //!< Index of property high watermark in bytes of messages queued to a connection
+        , PropertySendLow       //!< Index of property low watermark in bytes of messages queued to a connection
+        , PropertySendLimit     //!< Index of property limit in bytes of messages queued to a connection
 
         , PropertyLen           //!< Total length of connection properties list. Not used as property index.
 
@@ -89,7 +95,7 @@ public:
     /**
      * \brief   Initializes connection configuration object and internals.
      **/
-    ConnectionConfiguration( void ) = default;
+    ConnectionConfiguration( void );
     /**
      * \brief   Destructor.
      **/
@@ -155,6 +161,81 @@ public:
      **/
     String getConnectionHost( NERemoteService::eServiceConnection section = NERemoteService::eServiceConnection::ConnectionTcpip ) const;
 
+    /**
+     * \brief   Returns the number of I/O worker threads of given connection section. The property is optional
+     *          and is used by message router to distribute accepted connections between worker threads.
+     * \param   section     The connection section, which property is requested.
+     *                      By default, it is NERemoteService::ConnectionTcpip section, which is simple TCP/IP connection.
+     * \return  Returns the number of I/O worker threads of specified connection section.
+     *          Returns NEConnection::DEFAULT_SERVER_WORKERS, if the property of specified connection does not exist, i.e. invalid.
+     **/
+    unsigned int getConnectionWorkers( NERemoteService::eServiceConnection section = NERemoteService::eServiceConnection::ConnectionTcpip ) const;
+
+    /**
+     * \brief   Returns the size in bytes of the shared memory ring of given connection section.
+     *          The property is optional and is used only by local connections (Unix domain socket)
+     *          to pass bulk payloads between processes on the same host without copying them
+     *          through the socket.
+     * \param   section     The connection section, which property is requested.
+     *                      By default, it is NERemoteService::ConnectionUnix section.
+     * \return  Returns the size in bytes of shared memory ring of each direction.
+     *          Returns 0, if the property does not exist or shared memory transport is disabled.
+     **/
+    unsigned int getConnectionSharedMemory( NERemoteService::eServiceConnection section = NERemoteService::eServiceConnection::ConnectionUnix ) const;
+
+    /**
+     * \brief   Returns true if direct connections between applications are enabled in given connection section.
+     *          The property is optional and is used only by TCP/IP connections. When enabled, the message
+     *          router is used to discover services and the applications exchange the messages of
+     *          remote calls via direct connections. To work, it should be enabled in the router and
+     *          in both applications. The direct connections are accepted only on loopback address,
+     *          i.e. only between the applications of the same host with the router.
+     * \param   section     The connection section, which property is requested.
+     *                      By default, it is NERemoteService::ConnectionTcpip section.
+     * \return  Returns true if direct connections are enabled. Returns false, if the property does not exist.
+     **/
+    bool getConnectionDirect( NERemoteService::eServiceConnection section = NERemoteService::eServiceConnection::ConnectionTcpip ) const;
+
+    /**
+     * \brief   Returns the high watermark in bytes of messages queued by message router to a connection.
+     *          The property is optional. When the queue of connection reaches the high watermark,
+     *          the message router notifies the sources of messages that the target is congested.
+     * \param   section     The connection section, which property is requested.
+     *                      By default, it is NERemoteService::ConnectionTcpip section.
+     * \return  Returns the high watermark in bytes. Returns NEConnection::DEFAULT_SEND_HIGH_WATERMARK,
+     *          if the property does not exist.
+     **/
+    unsigned int getConnectionSendHighMark( NERemoteService::eServiceConnection section = NERemoteService::eServiceConnection::ConnectionTcpip ) const;
+
+    /**
+     * \brief   Returns the low watermark in bytes of messages queued by message router to a connection.
+     *          The property is optional. When the queue of congested connection drops to the low watermark,
+     *          the message router notifies the sources of messages that the target is recovered.
+     * \param   section     The connection section, which property is requested.
+     *                      By default, it is NERemoteService::ConnectionTcpip section.
+     * \return  Returns the low watermark in bytes. Returns NEConnection::DEFAULT_SEND_LOW_WATERMARK,
+     *          if the property does not exist.
+     **/
+    unsigned int getConnectionSendLowMark( NERemoteService::eServiceConnection section = NERemoteService::eServiceConnection::ConnectionTcpip ) const;
+
+    /**
+     * \brief   Returns the maximum size in bytes of messages queued by message router to a connection.
+     *          The property is optional. When the queue of connection exceeds the limit, the message router
+     *          closes the connection.
+     * \param   section     The connection section, which property is requested.
+     *                      By default, it is NERemoteService::ConnectionTcpip section.
+     * \return  Returns the limit in bytes. Returns NEConnection::DEFAULT_SEND_QUEUE_LIMIT,
+     *          if the property does not exist.
+     **/
+    unsigned int getConnectionSendLimit( NERemoteService::eServiceConnection section = NERemoteService::eServiceConnection::ConnectionTcpip ) const;
+
+    /**
+     * \brief   Returns the type of connection to use. This is the first enabled connection section
+     *          listed in the configuration file. If no section is enabled, returns
+     *          NERemoteService::ConnectionTcpip section.
+     **/
+    inline NERemoteService::eServiceConnection getConnectionType( void ) const;
+
     /**
      * \brief   Returns byte sets of connection host IP address of given connection section.
      * \param   section     The connection section, which property is requested.
@@ -213,6 +294,8 @@ private:
 private:
     String            mConfigFile;    //!< The full path of configuration file
 
+    NERemoteService::eServiceConnection mConnectionType;    //!< The first enabled connection type in configuration file.
+
 #if defined(_MSC_VER) && (_MSC_VER > 1200)
     #pragma warning(disable: 4251)
 #endif  // _MSC_VER
@@ -235,3 +318,8 @@ inline const String & ConnectionConfiguration::getConfigFileName( void ) const
 {
     return mConfigFile;
 }
+
+inline NERemoteService::eServiceConnection ConnectionConfiguration::getConnectionType( void ) const
+{
+    return mConnectionType;
+}
@@ -19,6 +19,7 @@
  ************************************************************************/
 #include "areg/base/GEGlobal.h"
 #include "areg/base/NEMemory.hpp"
+#include "areg/base/NESocket.hpp"
 #include "areg/component/Timer.hpp"
 #include "areg/appbase/NEApplication.hpp"
 #include "areg/ipc/NERemoteService.hpp"
@@ -82,6 +83,11 @@ namespace NEConnection
      *          Fixed message to register notification
      **/
     extern AREG_API const NEMemory::sRemoteMessage      MessageRegisterNotify;
+    /**
+     * \brief   NEConnection::MessageCongestionNotify
+     *          Fixed message to notify the source about congested or recovered target
+     **/
+    extern AREG_API const NEMemory::sRemoteMessage      MessageCongestionNotify;
 
     /**
      * \brief   NEConnection::CLIENT_SEND_MESSAGE_THREAD
@@ -98,6 +104,11 @@ namespace NEConnection
      *          Fixed name of client message dispatcher thread
      **/
     constexpr std::string_view  CLIENT_DISPATCH_MESSAGE_THREAD  { "CLIENT_DISPATCH_MESSAGE_THREAD" };
+    /**
+     * \brief   NEConnection::CLIENT_DIRECT_MESSAGE_THREAD
+     *          Fixed name of client thread receiving messages of direct connections
+     **/
+    constexpr std::string_view  CLIENT_DIRECT_MESSAGE_THREAD    { "CLIENT_DIRECT_MESSAGE_THREAD" };
     /**
      * \brief   NEConnection::SERVER_SEND_MESSAGE_THREAD
      *          Fixed name of server message sender thread
@@ -146,12 +157,86 @@ namespace NEConnection
      *          The default values are used if failed to read and parse router configuration file.
      **/
     constexpr  bool              DEFAULT_REMOVE_SERVICE_ENABLED  { true };
+    /**
+     * \brief   NEConnection::DEFAULT_SERVER_WORKERS
+     *          The default number of I/O worker threads of message router.
+     *          The default values are used if failed to read and parse router configuration file.
+     **/
+    constexpr unsigned int      DEFAULT_SERVER_WORKERS          { 1 };
+    /**
+     * \brief   NEConnection::MAXIMUM_SERVER_WORKERS
+     *          The maximum number of I/O worker threads of message router.
+     **/
+    constexpr unsigned int      MAXIMUM_SERVER_WORKERS          { 64 };
+    /**
+     * \brief   NEConnection::MAXIMUM_SEND_MESSAGES
+     *          The maximum number of queued messages, which the sending thread
+     *          coalesces and sends with single vectored write call.
+     **/
+    constexpr int               MAXIMUM_SEND_MESSAGES           { 32 };
+    /**
+     * \brief   NEConnection::DEFAULT_SEND_HIGH_WATERMARK
+     *          The default size in bytes of messages queued to a connection, when the message
+     *          router notifies the sources that the target connection is congested.
+     **/
+    constexpr unsigned int      DEFAULT_SEND_HIGH_WATERMARK     { 4 * 1024 * 1024 };
+    /**
+     * \brief   NEConnection::DEFAULT_SEND_LOW_WATERMARK
+     *          The default size in bytes of messages queued to a congested connection, when
+     *          the message router notifies the sources that the target connection is recovered.
+     **/
+    constexpr unsigned int      DEFAULT_SEND_LOW_WATERMARK      { 1024 * 1024 };
+    /**
+     * \brief   NEConnection::DEFAULT_SEND_QUEUE_LIMIT
+     *          The default maximum size in bytes of messages queued to a connection.
+     *          If exceeds, the message router closes the connection.
+     **/
+    constexpr unsigned int      DEFAULT_SEND_QUEUE_LIMIT        { 64 * 1024 * 1024 };
+    /**
+     * \brief   NEConnection::SEND_RETRY_TIMEOUT
+     *          The timeout in milliseconds to retry sending the messages queued to the
+     *          connections, which could not accept data.
+     **/
+    constexpr unsigned int      SEND_RETRY_TIMEOUT              { 5 };
+    /**
+     * \brief   NEConnection::SEND_RETRY_MAXIMUM
+     *          The maximum timeout in milliseconds to retry sending the queued messages.
+     *          The retry timeout is doubled every time when the connections accept no data.
+     **/
+    constexpr unsigned int      SEND_RETRY_MAXIMUM              { Timer::TIMEOUT_100_MS };  // 100 ms
+    /**
+     * \brief   NEConnection::DIRECT_CONNECT_TIMEOUT
+     *          The timeout in milliseconds to complete the direct connection to other
+     *          application. If expires, the messages to the application are routed.
+     **/
+    constexpr unsigned int      DIRECT_CONNECT_TIMEOUT          { Timer::TIMEOUT_100_MS };  // 100 ms
+    /**
+     * \brief   NEConnection::DIRECT_CONNECT_RETRY
+     *          The timeout in milliseconds to check again the direct connections, which
+     *          are not completed yet. Meanwhile the messages to the applications are queued.
+     **/
+    constexpr unsigned int      DIRECT_CONNECT_RETRY            { 1 };
+
+    /**
+     * \brief   NEConnection::getWorkerThreadName
+     *          Returns the name of I/O worker thread of server connection. The first worker
+     *          has the base name, other workers have the base name with index suffix.
+     * \param   baseName    The base name of thread, for example SERVER_RECEIVE_MESSAGE_THREAD.
+     * \param   worker      The index of I/O worker.
+     **/
+    AREG_API String getWorkerThreadName( const std::string_view & baseName, int worker );
 
     /**
      * \brief   NEConnection::CreateConnectRequest
      *          Initializes connection request message.
+     * \param   skipChecksum    If true, the client requests to skip checksums of messages.
+     *                          The routing service accepts it only for the connections of local host.
+     * \param   sharedMemory    The name of shared memory ring created by client of local connection
+     *                          or empty string if the client does not use shared memory.
+     * \param   directPort      The port number, where the client accepts direct connections of
+     *                          other applications or NESocket::InvalidPort if direct connections are disabled.
      **/
-    AREG_API RemoteMessage createConnectRequest( void );
+    AREG_API RemoteMessage createConnectRequest( bool skipChecksum, const String & sharedMemory, unsigned short directPort );
     /**
      * \brief   NEConnection::CreateDisconnectRequest
      *          Initializes disconnect request message.
@@ -160,10 +245,13 @@ namespace NEConnection
     AREG_API RemoteMessage createDisconnectRequest( ITEM_ID cookie );
     /**
      * \brief   NEConnection::CreateConnectNotify
-     *          Initializes connection notification message
-     * \param   cookie  The cookie set by routing service for the client, which is set in message
+     *          Initializes connection notification message. The message always contains the checksum,
+     *          because the client starts to skip checksums only after receiving this message.
+     * \param   cookie          The cookie set by routing service for the client, which is set in message
+     * \param   skipChecksum    The flag, indicating whether the routing service accepted to skip checksums.
+     * \param   sharedMemory    The flag, indicating whether the routing service opened the shared memory ring of client.
      **/
-    AREG_API RemoteMessage createConnectNotify( ITEM_ID cookie );
+    AREG_API RemoteMessage createConnectNotify( ITEM_ID cookie, bool skipChecksum, bool sharedMemory );
     /**
      * \brief   NEConnection::CreateRejectNotify
      *          Initializes connection rejected message
@@ -176,6 +264,16 @@ namespace NEConnection
      * \param   cookie  The cookie set by routing service for the client, which is set in message
      **/
     AREG_API RemoteMessage createDisconnectNotify( ITEM_ID cookie );
+    /**
+     * \brief   NEConnection::createCongestionNotify
+     *          Initializes the message sent by routing service to the source of messages,
+     *          which notifies that the target connection is congested or recovered.
+     * \param   source      The cookie of the source connection to notify.
+     * \param   target      The cookie of congested or recovered target connection.
+     * \param   congested   If true, the messages queued to the target reached the high watermark.
+     *                      If false, the queued messages dropped to the low watermark.
+     **/
+    AREG_API RemoteMessage createCongestionNotify( ITEM_ID source, ITEM_ID target, bool congested );
     /**
      * \brief   NEConnection::createRouterRegisterService
      *          Initializes Stub register message at router.
@@ -215,12 +313,15 @@ namespace NEConnection
     /**
      * \brief   NEConnection::createServiceRegisteredNotification
      *          Initializes Stub registered notification message to broadcast.
-     * \param   stub    The address of remote Stub to notify registering.
-     * \param   target  The ID of target to notify message.
+     *          The message contains the address of direct connection of Stub application.
+     * \param   stub        The address of remote Stub to notify registering.
+     * \param   target      The ID of target to notify message.
+     * \param   addrDirect  The address, where the Stub application accepts direct connections.
+     *                      Invalid, if the target should communicate with Stub via routing service.
      * \return  Returns registered stub notification message to broadcast.
      * \see     createServiceUnregisteredNotification
      **/
-    AREG_API RemoteMessage createServiceRegisteredNotification( const StubAddress & stub, ITEM_ID target );
+    AREG_API RemoteMessage createServiceRegisteredNotification( const StubAddress & stub, ITEM_ID target, const NESocket::SocketAddress & addrDirect );
     /**
      * \brief   NEConnection::createServiceUnregisteredNotification
      *          Initializes Stub service unregistering notification message to broadcast.
@@ -233,12 +334,15 @@ namespace NEConnection
     /**
      * \brief   NEConnection::createServiceClientRegisteredNotification
      *          Initializes service proxy registering notification message to broadcast.
-     * \param   proxy   The address of remote Proxy to notify registering.
-     * \param   target  The ID of target to notify message.
+     *          The message contains the address of direct connection of Proxy application.
+     * \param   proxy       The address of remote Proxy to notify registering.
+     * \param   target      The ID of target to notify message.
+     * \param   addrDirect  The address, where the Proxy application accepts direct connections.
+     *                      Invalid, if the target should communicate with Proxy via routing service.
      * \return  Returns service proxy registering notification message to broadcast.
      * \see     createServiceClientUnregisteredNotification
      **/
-    AREG_API RemoteMessage createServiceClientRegisteredNotification( const ProxyAddress & proxy, ITEM_ID target );
+    AREG_API RemoteMessage createServiceClientRegisteredNotification( const ProxyAddress & proxy, ITEM_ID target, const NESocket::SocketAddress & addrDirect );
     /**
      * \brief   NEConnection::createServiceClientUnregisteredNotification
      *          Initializes service proxy unregistering notification message to broadcast.
@@ -38,6 +38,7 @@ namespace NERemoteService
     typedef enum class E_ServiceConnection
     {
           ConnectionTcpip       = 0 //!< Connection type open TCP/IP
+        , ConnectionUnix            //!< Connection type local Unix domain socket
         , ConnectionUndefined       //!< Connection type undefined
     } eServiceConnection;
 
@@ -61,6 +62,11 @@ namespace NERemoteService
      *          String value of TCP/IP connection type
      **/
     constexpr std::string_view  STR_CONNECTION_TYPE_TCPIP   { "tcpip" };
+    /**
+     * \brief   NERemoteService::STR_CONNECTION_TYPE_UNIX
+     *          String value of local Unix domain socket connection type
+     **/
+    constexpr std::string_view  STR_CONNECTION_TYPE_UNIX    { "unix" };
 
     /**
      * \brief   NERemoteService::MAXLEN_PROPERTY_NAME
@@ -108,6 +114,36 @@ namespace NERemoteService
      *          The name of property for connection port
      **/
     constexpr std::string_view  CONFIG_KEY_PROP_PORT        { "port" };
+    /**
+     * \brief   NERemoteService::CONFIG_KEY_PROP_WORKERS
+     *          The name of property for the number of connection I/O worker threads
+     **/
+    constexpr std::string_view  CONFIG_KEY_PROP_WORKERS     { "workers" };
+    /**
+     * \brief   NERemoteService::CONFIG_KEY_PROP_SHMEM
+     *          The name of property for the size of shared memory ring used by local connections
+     **/
+    constexpr std::string_view  CONFIG_KEY_PROP_SHMEM       { "shmem" };
+    /**
+     * \brief   NERemoteService::CONFIG_KEY_PROP_DIRECT
+     *          The name of property to enable direct connections between applications
+     **/
+    constexpr std::string_view  CONFIG_KEY_PROP_DIRECT      { "direct" };
+    /**
+     * \brief   NERemoteService::CONFIG_KEY_PROP_SENDHIGH
+     *          The name of property for the high watermark in bytes of messages queued to a connection
+     **/
+    constexpr std::string_view  CONFIG_KEY_PROP_SENDHIGH    { "sendhigh" };
+    /**
+     * \brief   NERemoteService::CONFIG_KEY_PROP_SENDLOW
+     *          The name of property for the low watermark in bytes of messages queued to a connection
+     **/
+    constexpr std::string_view  CONFIG_KEY_PROP_SENDLOW     { "sendlow" };
+    /**
+     * \brief   NERemoteService::CONFIG_KEY_PROP_SENDLIMIT
+     *          The name of property for the limit in bytes of messages queued to a connection
+     **/
+    constexpr std::string_view  CONFIG_KEY_PROP_SENDLIMIT   { "sendlimit" };
 
     /**
      * \brief   NERemoteService::GetServiceConnectionTypeString
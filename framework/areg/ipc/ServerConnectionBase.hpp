@@ -22,9 +22,14 @@
 #include "areg/base/SynchObjects.hpp"
 #include "areg/base/SocketServer.hpp"
 #include "areg/base/SocketAccepted.hpp"
+#include "areg/base/SocketPoller.hpp"
 #include "areg/base/TEHashMap.hpp"
 #include "areg/base/TEArrayList.hpp"
 #include "areg/component/NEService.hpp"
+#include "areg/ipc/SharedMemoryRing.hpp"
+
+#include <atomic>
+#include <memory>
 
 //////////////////////////////////////////////////////////////////////////
 // ServerConnectionBase class declaration.
@@ -40,8 +45,15 @@
  *          Connection accepting, sending and receiving data are running
  *          in blocking mode. For this reason, it makes sens to run all these
  *          functionalities in separate threads.
- *          Server socket is using only TCP/IP connection. All other types
- *          and protocols are out of scope of this class and are not considered.
+ *          Server socket is using either TCP/IP connection or, on POSIX systems,
+ *          local Unix domain socket. All other types and protocols are out of
+ *          scope of this class and are not considered.
+ *          On Linux, if compiled with ENABLE_SOCKET_EPOLL, the connection events
+ *          are waited by epoll in edge-triggered mode, which does not limit
+ *          the number of accepted connections. Otherwise, select is used.
+ *          With epoll the accepted connections can be distributed between
+ *          several I/O worker threads, where every worker waits for events
+ *          of own connections. The first worker accepts new connections.
  **/
 class AREG_API ServerConnectionBase
 {
@@ -58,15 +70,27 @@ protected:
     /**
      * \brief   The container of socket handles where the keys are cookie values.
      **/
-    using ImplMapCookieToSocket	= TEHashMapImpl<ITEM_ID, SOCKETHANDLE>;
+    using ImplMapCookieToSocket	= TEOpenHashMapImpl<ITEM_ID, SOCKETHANDLE>;
     using MapCookieToSocket		= TEHashMap<ITEM_ID, SOCKETHANDLE, ITEM_ID, SOCKETHANDLE, ImplMapCookieToSocket>;
 
     /**
      * \brief   The container of cookie values where the keys are socket handles.
      **/
-    using ImplMapSocketToCookie	= TEHashMapImpl<SOCKETHANDLE, ITEM_ID>;
+    using ImplMapSocketToCookie	= TEOpenHashMapImpl<SOCKETHANDLE, ITEM_ID>;
     using MapSocketToCookie		= TEHashMap<SOCKETHANDLE, ITEM_ID, SOCKETHANDLE, ITEM_ID, ImplMapSocketToCookie>;
 
+    /**
+     * \brief   The container of sockets, which messages are sent and received without checksums.
+     **/
+    using ImplMapSocketToFlag	= TEHashMapImpl<SOCKETHANDLE, bool>;
+    using MapSocketToFlag		= TEHashMap<SOCKETHANDLE, bool, SOCKETHANDLE, bool, ImplMapSocketToFlag>;
+
+    /**
+     * \brief   The container of shared memory rings of local connections.
+     **/
+    using ImplMapSocketToMemory	= TEHashMapImpl<SOCKETHANDLE, const std::shared_ptr<SharedMemoryRing> &>;
+    using MapSocketToMemory		= TEHashMap<SOCKETHANDLE, std::shared_ptr<SharedMemoryRing>, SOCKETHANDLE, const std::shared_ptr<SharedMemoryRing> &, ImplMapSocketToMemory>;
+
     /**
      * \brief   The list of accepted sockets.
      **/
@@ -113,7 +137,7 @@ public:
     /**
      * \brief   Destructor.
      **/
-    virtual ~ServerConnectionBase( void ) = default;
+    virtual ~ServerConnectionBase( void );
 
 //////////////////////////////////////////////////////////////////////////
 // Attributes
@@ -178,6 +202,36 @@ public:
      **/
     inline ITEM_ID getCookie( SOCKETHANDLE socketHandle ) const;
 
+    /**
+     * \brief   Sets the flag, indicating whether the messages of accepted client connection
+     *          are sent and received without checksums. The flag is reset when the connection is closed.
+     * \param   socketHandle    Socket handle of accepted client connection.
+     * \param   skipChecksum    If true, the checksums of messages are skipped.
+     **/
+    inline void setChecksumSkipped( SOCKETHANDLE socketHandle, bool skipChecksum );
+
+    /**
+     * \brief   Returns true if the messages of accepted client connection are sent
+     *          and received without checksums.
+     * \param   socketHandle    Socket handle of accepted client connection.
+     **/
+    inline bool isChecksumSkipped( SOCKETHANDLE socketHandle ) const;
+
+    /**
+     * \brief   Sets the shared memory ring of accepted local client connection.
+     *          The ring is released when the connection is closed.
+     * \param   socketHandle    Socket handle of accepted client connection.
+     * \param   sharedMemory    The opened shared memory ring. If empty, the ring of connection is removed.
+     **/
+    inline void setSharedMemory( SOCKETHANDLE socketHandle, const std::shared_ptr<SharedMemoryRing> & sharedMemory );
+
+    /**
+     * \brief   Returns the shared memory ring of accepted client connection.
+     *          Returns empty pointer if the connection has no shared memory.
+     * \param   socketHandle    Socket handle of accepted client connection.
+     **/
+    inline std::shared_ptr<SharedMemoryRing> getSharedMemory( SOCKETHANDLE socketHandle ) const;
+
     /**
      * \brief   Returns accepted socket object, which is matching passed cookie.
      *          If client cookie is valid, the return accepted socket object is valid.
@@ -198,6 +252,32 @@ public:
      **/
     inline SocketAccepted getClientByHandle( SOCKETHANDLE clientSocket ) const;
 
+    /**
+     * \brief   Sets the number of I/O worker threads to distribute accepted connections.
+     *          Should be called before socket is created. The number of workers is applied
+     *          when socket is created and it is reset to 1 if the event poller is not available.
+     * \param   count   The number of I/O workers. It is limited by NEConnection::MAXIMUM_SERVER_WORKERS.
+     **/
+    void setWorkerCount( unsigned int count );
+
+    /**
+     * \brief   Returns the number of I/O worker threads to distribute accepted connections.
+     **/
+    inline int getWorkerCount( void ) const;
+
+    /**
+     * \brief   Returns the version of accepted connections, which is changed every time
+     *          a connection is accepted or closed. The threads caching accepted connections
+     *          by cookie should drop the cache when the version changes.
+     **/
+    inline unsigned int getConnectionsVersion( void ) const;
+
+    /**
+     * \brief   Returns the index of I/O worker, which handles the connection of specified cookie.
+     * \param   cookie  The cookie of accepted connection.
+     **/
+    inline int getConnectionWorker( ITEM_ID cookie ) const;
+
 //////////////////////////////////////////////////////////////////////////
 // Operations
 //////////////////////////////////////////////////////////////////////////
@@ -249,11 +329,22 @@ public:
      *                              contain address of new accepted socket. In all other cases,
      *                              when client sends data or close socket, this parameter
      *                              remains unchanged.
+     * \param   worker              The index of I/O worker waiting for connection event. Only the
+     *                              first worker waits for new connections, every worker waits
+     *                              for the events of connections assigned to it.
      * \return  If function succeeds, the function returns valid socket handle. For new connections,
      *          out_addrNewAccepted parameter contains address of accepted socket.
      *          If function fails, returns invalid socket handle.
      **/
-    SOCKETHANDLE waitForConnectionEvent(NESocket::SocketAddress & out_addrNewAccepted);
+    SOCKETHANDLE waitForConnectionEvent(NESocket::SocketAddress & out_addrNewAccepted, int worker = 0);
+
+    /**
+     * \brief   Returns true if connection events are waited by event poller in edge-triggered mode.
+     *          In this mode, the socket returned by waitForConnectionEvent() is reported only once
+     *          when new data arrives, so that the receiver should drain the socket without blocking.
+     *          The reported socket might have no data, if it was drained when processing previous event.
+     **/
+    inline bool isEdgeTriggered( void ) const;
 
     /**
      * \brief   Call to accept connection. Nothing will happen if connection was already accepted.
@@ -315,6 +406,14 @@ protected:
      * \brief   The hash map of cookie values, where the key are socket handles.
      **/
     MapSocketToCookie   mSocketToCookie;
+    /**
+     * \brief   The hash map of sockets, which messages are sent and received without checksums.
+     **/
+    MapSocketToFlag     mChecksumSkipped;
+    /**
+     * \brief   The hash map of shared memory rings of local connections.
+     **/
+    MapSocketToMemory   mSharedMemory;
     /**
      * \brief   The list of accepted sockets.
      **/
@@ -327,6 +426,51 @@ protected:
      * \brief   Synchronization object for data sharing
      **/
     mutable ResourceLock    mLock;
+    /**
+     * \brief   The list of pollers to wait for connection events, one per I/O worker.
+     *          Valid only if the server socket is created and the poller is enabled.
+     **/
+    SocketPoller *          mPollers;
+    /**
+     * \brief   The number of I/O workers to distribute accepted connections.
+     **/
+    int                     mWorkerCount;
+    /**
+     * \brief   The version of accepted connections, changed when a connection is accepted or closed.
+     **/
+    std::atomic_uint        mConnectionsVersion;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Waits for connection event using event poller of the worker. Accepts new connections
+     *          and skips events of sockets, which are already closed or handled by other worker.
+     * \param   out_addrNewAccepted On output, contains the address of new accepted socket.
+     * \param   worker              The index of I/O worker waiting for connection event.
+     * \return  Returns valid socket handle if succeeded. Returns invalid socket handle if the
+     *          poller is woken up or failed.
+     **/
+    SOCKETHANDLE _waitPollerEvent( NESocket::SocketAddress & out_addrNewAccepted, int worker );
+
+    /**
+     * \brief   Creates event pollers of I/O workers. If pollers are not available,
+     *          the connection events are waited by select and there is only one worker.
+     **/
+    void _createPollers( void );
+
+    /**
+     * \brief   Releases event pollers of I/O workers.
+     **/
+    void _releasePollers( void );
+
+    /**
+     * \brief   Returns the index of I/O worker of accepted socket or -1 if socket is not accepted.
+     *          The data should be locked.
+     **/
+    inline int _getSocketWorker( SOCKETHANDLE hSocket ) const;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
 //////////////////////////////////////////////////////////////////////////
@@ -368,6 +512,32 @@ inline SOCKETHANDLE ServerConnectionBase::getSocketHandle( void ) const
     return mServerSocket.getHandle();
 }
 
+inline bool ServerConnectionBase::isEdgeTriggered( void ) const
+{
+    return (mPollers != nullptr);
+}
+
+inline int ServerConnectionBase::getWorkerCount( void ) const
+{
+    return mWorkerCount;
+}
+
+inline unsigned int ServerConnectionBase::getConnectionsVersion( void ) const
+{
+    return mConnectionsVersion.load( std::memory_order_acquire );
+}
+
+inline int ServerConnectionBase::getConnectionWorker( ITEM_ID cookie ) const
+{
+    return static_cast<int>(cookie % static_cast<ITEM_ID>(mWorkerCount));
+}
+
+inline int ServerConnectionBase::_getSocketWorker( SOCKETHANDLE hSocket ) const
+{
+    MAPPOS pos = mSocketToCookie.find( hSocket );
+    return (pos != nullptr ? getConnectionWorker( mSocketToCookie.valueAtPosition(pos) ) : -1);
+}
+
 inline bool ServerConnectionBase::isConnectionAccepted( SOCKETHANDLE connection ) const
 {
     Lock lock(mLock);
@@ -387,6 +557,45 @@ inline ITEM_ID ServerConnectionBase::getCookie(SOCKETHANDLE socketHandle) const
     return ( pos != nullptr ? mSocketToCookie.valueAtPosition(pos) : NEService::COOKIE_UNKNOWN );
 }
 
+inline void ServerConnectionBase::setChecksumSkipped( SOCKETHANDLE socketHandle, bool skipChecksum )
+{
+    Lock lock( mLock );
+    if ( skipChecksum )
+    {
+        mChecksumSkipped.setAt( socketHandle, true );
+    }
+    else
+    {
+        mChecksumSkipped.removeAt( socketHandle );
+    }
+}
+
+inline bool ServerConnectionBase::isChecksumSkipped( SOCKETHANDLE socketHandle ) const
+{
+    Lock lock( mLock );
+    return (mChecksumSkipped.find( socketHandle ) != nullptr);
+}
+
+inline void ServerConnectionBase::setSharedMemory( SOCKETHANDLE socketHandle, const std::shared_ptr<SharedMemoryRing> & sharedMemory )
+{
+    Lock lock( mLock );
+    if ( sharedMemory != nullptr )
+    {
+        mSharedMemory.setAt( socketHandle, sharedMemory );
+    }
+    else
+    {
+        mSharedMemory.removeAt( socketHandle );
+    }
+}
+
+inline std::shared_ptr<SharedMemoryRing> ServerConnectionBase::getSharedMemory( SOCKETHANDLE socketHandle ) const
+{
+    Lock lock( mLock );
+    MAPPOS pos = mSharedMemory.find( socketHandle );
+    return (pos != nullptr ? mSharedMemory.valueAtPosition( pos ) : std::shared_ptr<SharedMemoryRing>());
+}
+
 inline SocketAccepted ServerConnectionBase::getClientByCookie(ITEM_ID clientCookie) const
 {
     Lock lock( mLock );
@@ -0,0 +1,311 @@
+#pragma once
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/SharedMemoryRing.hpp
+ * \ingroup     AREG Asynchronous Event-Driven Communication Framework
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the shared memory rings of local connection
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/String.hpp"
+#include "areg/base/SynchObjects.hpp"
+
+#include <atomic>
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+class RemoteMessage;
+
+//////////////////////////////////////////////////////////////////////////
+// SharedMemoryRing class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The named shared memory segment with two single producer single
+ *          consumer rings of bytes, one for each direction of local connection.
+ *          The client creates the segment and passes the name to the routing
+ *          service when connects. The routing service opens the segment.
+ *          The client writes in the first ring and reads the second, the
+ *          routing service does the opposite.
+ *
+ *          The messages with large data are written in the ring and instead
+ *          of the message, the sender sends via socket a short message with
+ *          the ID NEService::eFuncIdRange::ServiceRouterSharedData. When the
+ *          receiver gets it, it reads the next message from the ring. Since
+ *          the messages are read in the same order as the notifications are
+ *          received, the order of messages is kept even if some messages are
+ *          sent via socket, because the ring is full.
+ *
+ *          The messages are written by any thread, which sends messages,
+ *          and read only by the thread, which receives the data of connection.
+ **/
+class AREG_API SharedMemoryRing
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   SharedMemoryRing::MINIMUM_RING_SIZE
+     *          The minimum size in bytes of ring of one direction.
+     **/
+    static constexpr unsigned int   MINIMUM_RING_SIZE   { 64 * 1024 };
+    /**
+     * \brief   SharedMemoryRing::MAXIMUM_RING_SIZE
+     *          The maximum size in bytes of ring of one direction.
+     **/
+    static constexpr unsigned int   MAXIMUM_RING_SIZE   { 256 * 1024 * 1024 };
+    /**
+     * \brief   SharedMemoryRing::MINIMUM_DATA_SIZE
+     *          The minimum size in bytes of message data to pass via ring.
+     *          The smaller messages are sent via socket.
+     **/
+    static constexpr unsigned int   MINIMUM_DATA_SIZE   { 4 * 1024 };
+
+private:
+    /**
+     * \brief   The size in bytes of a cache line. The positions of the producer
+     *          and the consumer are placed in different cache lines.
+     **/
+    static constexpr unsigned int   CACHE_LINE_SIZE     { 64 };
+
+    /**
+     * \brief   SharedMemoryRing::sRingControl
+     *          The positions of one ring in the segment.
+     **/
+    typedef struct S_RingControl
+    {
+        std::atomic_uint    rcWrite;    //!< The position to write next record, modified by the producer.
+        unsigned char       rcPadWrite[CACHE_LINE_SIZE - sizeof(std::atomic_uint)];
+        std::atomic_uint    rcRead;     //!< The position to read next record, modified by the consumer.
+        unsigned char       rcPadRead[CACHE_LINE_SIZE - sizeof(std::atomic_uint)];
+    } sRingControl;
+
+    /**
+     * \brief   SharedMemoryRing::sSegmentHeader
+     *          The header at the beginning of shared memory segment.
+     *          The data of rings follow the header.
+     **/
+    typedef struct S_SegmentHeader
+    {
+        uint32_t            shMagic;    //!< The magic number to validate the segment.
+        uint32_t            shRingSize; //!< The size in bytes of ring of one direction.
+        unsigned char       shPad[CACHE_LINE_SIZE - 2 * sizeof(uint32_t)];
+        sRingControl        shRings[2]; //!< The positions of rings.
+    } sSegmentHeader;
+
+    /**
+     * \brief   The magic number of the segment.
+     **/
+    static constexpr uint32_t       SEGMENT_MAGIC       { 0x52474D53 };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Initializes the object without shared memory segment.
+     **/
+    SharedMemoryRing( void );
+
+    /**
+     * \brief   Unmaps the segment. If the segment was created and the name was not removed, removes it.
+     **/
+    ~SharedMemoryRing( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Called by the client to create new named segment with the rings of given size.
+     *          The size is rounded up to the power of 2 and fit to the valid range.
+     * \param   ringSize    The size in bytes of ring of one direction.
+     * \return  Returns true if succeeded to create and map the segment.
+     **/
+    bool createRing( unsigned int ringSize );
+
+    /**
+     * \brief   Called by the routing service to open the segment created by the client.
+     * \param   ringName    The name of segment passed by client.
+     * \return  Returns true if succeeded to open, map and validate the segment.
+     **/
+    bool openRing( const String & ringName );
+
+    /**
+     * \brief   Unmaps the segment. If the segment was created and the name was not removed, removes it.
+     **/
+    void closeRing( void );
+
+    /**
+     * \brief   Called by the client to remove the name of segment, when the routing service
+     *          either opened the segment or rejected it. The mapped segment remains valid.
+     **/
+    void unlinkRing( void );
+
+    /**
+     * \brief   Returns true if the segment is mapped.
+     **/
+    inline bool isValid( void ) const;
+
+    /**
+     * \brief   Returns the name of segment.
+     **/
+    inline const String & getName( void ) const;
+
+    /**
+     * \brief   Returns the size in bytes of ring of one direction.
+     **/
+    inline unsigned int getRingSize( void ) const;
+
+    /**
+     * \brief   Returns true if the message should be passed via ring, i.e. the data is large enough.
+     * \param   message     The message to check.
+     **/
+    static bool isBulkMessage( const RemoteMessage & message );
+
+    /**
+     * \brief   Writes the header and the data of message in the ring of outgoing messages.
+     *          The call can be made by any thread.
+     * \param   message     The message to write.
+     * \return  Returns true if the message is written. Returns false if the message does not fit
+     *          the free space of the ring. In this case the message should be sent via socket.
+     **/
+    bool writeMessage( const RemoteMessage & message );
+
+    /**
+     * \brief   Reads the next message from the ring of incoming messages.
+     *          The call should be made only by the thread receiving data of connection.
+     * \param   out_message     On output, contains the read message.
+     * \return  Returns true if succeeded to read the message. Returns false if the ring is empty.
+     **/
+    bool readMessage( RemoteMessage & out_message );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Sets the pointers to the rings of mapped segment.
+     * \param   isCreator   If true, the segment is created by this object and it writes in the first ring.
+     **/
+    void _initRings( bool isCreator );
+
+    /**
+     * \brief   Copies data in the ring of outgoing messages at given position, wraps if needed.
+     **/
+    inline void _copyIn( unsigned int position, const void * data, unsigned int length );
+
+    /**
+     * \brief   Copies data from the ring of incoming messages at given position, wraps if needed.
+     **/
+    inline void _copyOut( unsigned int position, void * data, unsigned int length ) const;
+
+    /**
+     * \brief   OS specific implementation to create and map the named segment of given size.
+     * \return  Returns the address of mapped segment or nullptr if failed.
+     **/
+    unsigned char * _osCreateSegment( const char * segmentName, unsigned int segmentSize );
+
+    /**
+     * \brief   OS specific implementation to open and map the existing named segment.
+     * \param   out_segmentSize     On output, contains the size of mapped segment.
+     * \return  Returns the address of mapped segment or nullptr if failed.
+     **/
+    unsigned char * _osOpenSegment( const char * segmentName, unsigned int & out_segmentSize );
+
+    /**
+     * \brief   OS specific implementation to unmap the segment.
+     **/
+    void _osCloseSegment( void );
+
+    /**
+     * \brief   OS specific implementation to remove the name of segment.
+     **/
+    void _osUnlinkSegment( const char * segmentName );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The name of segment.
+     **/
+    String              mName;
+    /**
+     * \brief   The address of mapped segment.
+     **/
+    unsigned char *     mSegment;
+    /**
+     * \brief   The size in bytes of mapped segment.
+     **/
+    unsigned int        mSegmentSize;
+    /**
+     * \brief   The size in bytes of ring of one direction, power of 2.
+     **/
+    unsigned int        mRingSize;
+    /**
+     * \brief   The positions of the ring of outgoing messages.
+     **/
+    sRingControl *      mWriteControl;
+    /**
+     * \brief   The data of the ring of outgoing messages.
+     **/
+    unsigned char *     mWriteData;
+    /**
+     * \brief   The positions of the ring of incoming messages.
+     **/
+    sRingControl *      mReadControl;
+    /**
+     * \brief   The data of the ring of incoming messages.
+     **/
+    unsigned char *     mReadData;
+    /**
+     * \brief   The handle of mapping object, used only on Windows.
+     **/
+    void *              mMapHandle;
+    /**
+     * \brief   Flag, indicating that the name of created segment should be removed.
+     **/
+    bool                mUnlinkName;
+    /**
+     * \brief   The lock to synchronize the threads writing messages.
+     **/
+    SpinLock            mLock;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    DECLARE_NOCOPY_NOMOVE( SharedMemoryRing );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// SharedMemoryRing class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline bool SharedMemoryRing::isValid( void ) const
+{
+    return (mSegment != nullptr);
+}
+
+inline const String & SharedMemoryRing::getName( void ) const
+{
+    return mName;
+}
+
+inline unsigned int SharedMemoryRing::getRingSize( void ) const
+{
+    return mRingSize;
+}
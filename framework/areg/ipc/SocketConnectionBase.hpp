@@ -18,6 +18,7 @@
  * Include files.
  ************************************************************************/
 #include "areg/base/GEGlobal.h"
+#include "areg/base/NEMemory.hpp"
 #include "areg/base/NESocket.hpp"
 
 /************************************************************************
@@ -25,6 +26,8 @@
  ************************************************************************/
 class RemoteMessage;
 class Socket;
+class SocketReceiveBuffer;
+class SharedMemoryRing;
 
 //////////////////////////////////////////////////////////////////////////
 // SocketConnectionBase class declaration
@@ -66,11 +69,50 @@ protected:
      * \param   in_message      The instance of buffer to send. The checksum number of Remote Buffer object
      *                          will be checked before sending. If checksum is invalid, the data will not be sent.
      * \param   clientSocket    The socket object, which can be either client connection socket or accepted socket on server side
+     * \param   skipChecksum    If true, the connection agreed to skip checksums and the message is sent
+     *                          as it is. Otherwise, the checksum is calculated and sent in the header.
+     * \param   sharedMemory    The shared memory ring of local connection or nullptr if the connection
+     *                          has no shared memory. If valid, the message with large data is written in the ring
+     *                          and only the notification is sent via socket.
      * \return  Returns length in bytes of data in Remote Buffer sent to remote host. 
      *          Returns negative number if socket is not valid of failed to send.
      *          Returns zero, if checksum in Remote Buffer was not validated or Remote Buffer object is empty.
      **/
-    int sendMessage( const RemoteMessage & in_message, const Socket & clientSocket ) const;
+    int sendMessage( const RemoteMessage & in_message, const Socket & clientSocket, bool skipChecksum, SharedMemoryRing * sharedMemory = nullptr ) const;
+
+    /**
+     * \brief   If socket is valid, sends the list of messages using existing socket connection with
+     *          single vectored write call, so that the headers and data of all messages are sent
+     *          without additional system calls. The messages are sent in the order as they are listed.
+     *          If failed to send data to remote host, returns the number of messages, which were
+     *          completely sent before failure. The rest of messages are not delivered.
+     *          Note:   The call is blocking and method will not return until all data are not sent
+     *                  or if data sending fails.
+     * \param   listMessages    The list of valid messages to send.
+     * \param   count           The number of messages in the list.
+     * \param   clientSocket    The socket object, which can be either client connection socket or accepted socket on server side
+     * \param   skipChecksum    If true, the connection agreed to skip checksums and the messages are sent
+     *                          as they are. Otherwise, the checksums are calculated and sent in the headers.
+     * \param   sharedMemory    The shared memory ring of local connection or nullptr if the connection
+     *                          has no shared memory.
+     * \return  Returns the number of messages completely sent to remote host.
+     *          Returns negative number if socket is not valid.
+     **/
+    int sendMessages( const RemoteMessage * const * listMessages, int count, const Socket & clientSocket, bool skipChecksum, SharedMemoryRing * sharedMemory = nullptr ) const;
+
+    /**
+     * \brief   Prepares the header of message to send later, for example, with non-blocking
+     *          calls in several parts. The header is copied with calculated checksum, or if the data
+     *          of message is written in the shared memory ring, it is set as the notification to read
+     *          the ring. The data of message follows the header only if the used length in the
+     *          prepared header is not zero. Then the aligned length of data is sent.
+     * \param   in_message      The message to send.
+     * \param   out_header      On output, contains the header of message to send.
+     * \param   skipChecksum    If true, the connection agreed to skip checksums and the header is copied as it is.
+     * \param   sharedMemory    The shared memory ring of local connection or nullptr if the connection has no shared memory.
+     * \return  Returns the length in bytes of header and data to send.
+     **/
+    unsigned int prepareMessage( const RemoteMessage & in_message, NEMemory::sRemoteMessageHeader & out_header, bool skipChecksum, SharedMemoryRing * sharedMemory = nullptr ) const;
 
     /**
      * \brief   If socket is valid, receives data using existing socket connection and returns length in bytes
@@ -90,6 +132,47 @@ protected:
      **/
     int receiveMessage( RemoteMessage & out_message, const Socket & clientSocket ) const;
 
+    /**
+     * \brief   If socket is valid, receives in the receive buffer of connection all data, which
+     *          are available in socket, with single call. If no data is available, the call blocks
+     *          until data arrives. The received messages should be extracted from the receive buffer.
+     * \param   recvBuffer      The receive buffer of connection to receive data.
+     * \param   clientSocket    The socket object, which can be either client connection socket or accepted socket on server side
+     * \return  Returns number of bytes received from remote host.
+     *          Returns zero or negative number if socket is not valid, connection is closed or failed to receive.
+     **/
+    int receiveMessages( SocketReceiveBuffer & recvBuffer, const Socket & clientSocket ) const;
+
+    /**
+     * \brief   If socket is valid, receives in the receive buffer of connection the data, which
+     *          is already pending in socket, without blocking. Used to drain the socket.
+     *          The received messages should be extracted from the receive buffer.
+     * \param   recvBuffer      The receive buffer of connection to receive data.
+     * \param   clientSocket    The socket object, which can be either client connection socket or accepted socket on server side
+     * \return  Returns number of bytes received from remote host. Returns zero if there is no pending data.
+     *          Returns negative number if socket is not valid, connection is closed or failed to receive.
+     **/
+    int receivePendingMessages( SocketReceiveBuffer & recvBuffer, const Socket & clientSocket ) const;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Sets the buffers of message header and message data to send.
+     *          If the checksum is not skipped, the header is copied to the given header
+     *          object with calculated checksum, so that the shared message is not modified.
+     * \param   in_message      The message to send.
+     * \param   out_buffers     On output, contains the buffers to send. Should have at least 2 entries.
+     * \param   out_header      The header object to copy the header with calculated checksum.
+     *                          The object should be valid until the buffers are sent.
+     * \param   skipChecksum    If true, the message header is sent as it is, without calculating checksum.
+     * \param   sharedMemory    The shared memory ring of connection or nullptr. If the message is written
+     *                          in the ring, the header object is set as the notification to read the ring.
+     * \return  Returns the number of buffers set, which is 1 if message has no data or the data is in the ring.
+     **/
+    static int _setMessageBuffers( const RemoteMessage & in_message, NESocket::sSocketBuffer * out_buffers, NEMemory::sRemoteMessageHeader & out_header, bool skipChecksum, SharedMemoryRing * sharedMemory );
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
 //////////////////////////////////////////////////////////////////////////
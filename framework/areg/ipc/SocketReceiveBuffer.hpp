@@ -0,0 +1,240 @@
+#pragma once
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/SocketReceiveBuffer.hpp
+ * \ingroup     AREG Asynchronous Event-Driven Communication Framework
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the receive buffer of socket connection.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/RemoteMessage.hpp"
+
+#include <memory>
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+class Socket;
+class SharedMemoryRing;
+
+//////////////////////////////////////////////////////////////////////////
+// SocketReceiveBuffer class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The receive buffer of socket connection. Every connection has own
+ *          instance of receive buffer. The buffer receives as many bytes as
+ *          the socket has available in single call and then the remote messages
+ *          are extracted from the buffer one by one, until there is no more
+ *          complete message in the buffer. The incomplete message remains in
+ *          the buffer until the rest of data is received.
+ *          If a message does not fit the buffer, the data of message is received
+ *          directly in the message object.
+ *          The object is not thread safe and should be accessed only by the
+ *          thread receiving data of connection.
+ **/
+class AREG_API SocketReceiveBuffer
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   SocketReceiveBuffer::DEFAULT_BUFFER_SIZE
+     *          The default size in bytes of receive buffer.
+     **/
+    static constexpr unsigned int   DEFAULT_BUFFER_SIZE     { 64 * 1024 };
+
+    /**
+     * \brief   SocketReceiveBuffer::MAXIMUM_MESSAGE_SIZE
+     *          The maximum size in bytes of data of received message.
+     *          The larger length in the header of message is treated as invalid.
+     **/
+    static constexpr unsigned int   MAXIMUM_MESSAGE_SIZE    { 512 * 1024 * 1024 };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Initializes the receive buffer of given size.
+     * \param   bufferSize  The size of receive buffer in bytes. It cannot be
+     *                      less than the size of remote message header.
+     **/
+    explicit SocketReceiveBuffer( unsigned int bufferSize = SocketReceiveBuffer::DEFAULT_BUFFER_SIZE );
+
+    /**
+     * \brief   Destructor.
+     **/
+    ~SocketReceiveBuffer( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Receives available data of socket with single call. If there is no data
+     *          available, the call blocks until the data arrives or connection is closed.
+     * \param   clientSocket    The socket to receive data.
+     * \return  Returns number of received bytes. Returns zero or negative value if
+     *          the connection is closed or failed to receive data.
+     **/
+    int receiveData( const Socket & clientSocket );
+
+    /**
+     * \brief   Receives data, which is already pending in socket, without blocking.
+     *          Used to drain the socket reported readable by event poller.
+     * \param   clientSocket    The socket to receive data.
+     * \return  Returns number of received bytes. Returns zero if there is no pending data.
+     *          Returns negative value if the connection is closed or failed to receive data.
+     **/
+    int receivePendingData( const Socket & clientSocket );
+
+    /**
+     * \brief   Extracts next complete message from the buffer.
+     *          If the checksum of extracted message is invalid, the message is invalidated,
+     *          but the call still returns true to indicate that the data is consumed.
+     *          If the length of message in the header is invalid or failed to allocate the message,
+     *          the call returns true with invalid message, since the rest of data cannot be parsed
+     *          and the buffer should be reset.
+     * \param   out_message     On output, contains the extracted remote message.
+     * \return  Returns true if a complete message is extracted. Returns false if
+     *          the buffer does not contain complete message and more data should be received.
+     **/
+    bool extractMessage( RemoteMessage & out_message );
+
+    /**
+     * \brief   Drops all received data and makes the buffer empty.
+     *          Should be called when connection is closed or new connection is established.
+     **/
+    void reset( void );
+
+    /**
+     * \brief   Returns true if the buffer has no received data.
+     **/
+    inline bool isEmpty( void ) const;
+
+    /**
+     * \brief   Sets the flag to skip checking the checksum of received messages.
+     *          Set when both sides of the connection agreed that the transport
+     *          guarantees the integrity of data, i.e. on the loopback connection.
+     *          The flag is cleared when the buffer is reset.
+     * \param   skipChecksum    If true, the checksum of received messages is not checked.
+     **/
+    inline void setChecksumSkipped( bool skipChecksum );
+
+    /**
+     * \brief   Returns true if the checksum of received messages is not checked.
+     **/
+    inline bool isChecksumSkipped( void ) const;
+
+    /**
+     * \brief   Sets the shared memory ring of local connection. When the buffer
+     *          extracts the notification that the message is passed via shared memory,
+     *          the message is read from the ring. The ring is released when the buffer is reset.
+     * \param   sharedMemory    The shared memory ring of connection. Can be empty.
+     **/
+    inline void setSharedMemory( const std::shared_ptr<SharedMemoryRing> & sharedMemory );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Moves the unprocessed data to the beginning of buffer.
+     **/
+    inline void _compact( void );
+
+    /**
+     * \brief   Checks the checksum of received message and invalidates it if checksum does not match.
+     *          Does nothing if checking the checksum is skipped.
+     **/
+    void _checkMessage( RemoteMessage & msgReceived ) const;
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The receive buffer.
+     **/
+    unsigned char *     mBuffer;
+    /**
+     * \brief   The size of receive buffer.
+     **/
+    const unsigned int  mSize;
+    /**
+     * \brief   The position in buffer of first unprocessed byte.
+     **/
+    unsigned int        mReadPos;
+    /**
+     * \brief   The position in buffer to write next received data.
+     **/
+    unsigned int        mWritePos;
+    /**
+     * \brief   The message, which does not fit the buffer and the data of which is received directly.
+     **/
+    RemoteMessage       mLargeMessage;
+    /**
+     * \brief   The number of data bytes of large message still to receive.
+     **/
+    unsigned int        mLargeRemain;
+    /**
+     * \brief   The number of data bytes of large message, which are copied in the message buffer.
+     **/
+    unsigned int        mLargeCopied;
+    /**
+     * \brief   The flag, indicating whether the checksum of received messages is checked.
+     **/
+    bool                mChecksumSkipped;
+    /**
+     * \brief   The shared memory ring of connection to read messages with large data.
+     **/
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+    std::shared_ptr<SharedMemoryRing>   mSharedMemory;
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(default: 4251)
+#endif  // _MSC_VER
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    DECLARE_NOCOPY_NOMOVE( SocketReceiveBuffer );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// SocketReceiveBuffer class inline functions
+//////////////////////////////////////////////////////////////////////////
+
+inline bool SocketReceiveBuffer::isEmpty( void ) const
+{
+    return (mReadPos == mWritePos) && (mLargeMessage.isValid() == false);
+}
+
+inline void SocketReceiveBuffer::setChecksumSkipped( bool skipChecksum )
+{
+    mChecksumSkipped = skipChecksum;
+}
+
+inline bool SocketReceiveBuffer::isChecksumSkipped( void ) const
+{
+    return mChecksumSkipped;
+}
+
+inline void SocketReceiveBuffer::setSharedMemory( const std::shared_ptr<SharedMemoryRing> & sharedMemory )
+{
+    mSharedMemory = sharedMemory;
+}
@@ -22,6 +22,10 @@ ClientConnection::ClientConnection( void )
     : SocketConnectionBase    ( )
     , mClientSocket ( )
     , mCookie       ( NEService::COOKIE_UNKNOWN )
+    , mChecksumSkipped  ( false )
+    , mSharedMemorySize ( 0 )
+    , mPendingMemory    ( )
+    , mSharedMemory     ( )
 {
 }
 
@@ -29,6 +33,10 @@ ClientConnection::ClientConnection(const char * hostName, unsigned short portNr)
     : SocketConnectionBase    ( )
     , mClientSocket ( hostName, portNr )
     , mCookie       ( NEService::COOKIE_UNKNOWN )
+    , mChecksumSkipped  ( false )
+    , mSharedMemorySize ( 0 )
+    , mPendingMemory    ( )
+    , mSharedMemory     ( )
 {
 }
 
@@ -36,18 +44,24 @@ ClientConnection::ClientConnection(const NESocket::SocketAddress & remoteAddress
     : SocketConnectionBase    ( )
     , mClientSocket ( remoteAddress )
     , mCookie       ( NEService::COOKIE_UNKNOWN )
+    , mChecksumSkipped  ( false )
+    , mSharedMemorySize ( 0 )
+    , mPendingMemory    ( )
+    , mSharedMemory     ( )
 {
 }
 
 
 bool ClientConnection::createSocket(const char * hostName, unsigned short portNr)
 {
+    mChecksumSkipped = false;
     setCookie( mClientSocket.createSocket(hostName, portNr) ? NEService::COOKIE_LOCAL : NEService::COOKIE_UNKNOWN );
     return mClientSocket.isValid();
 }
 
 bool ClientConnection::createSocket(void)
 {
+    mChecksumSkipped = false;
     setCookie( mClientSocket.createSocket() ? NEService::COOKIE_LOCAL : NEService::COOKIE_UNKNOWN );
     return mClientSocket.isValid();
 }
@@ -55,17 +69,35 @@ bool ClientConnection::createSocket(void)
 void ClientConnection::closeSocket(void)
 {
     setCookie(NEService::COOKIE_UNKNOWN);
+    mChecksumSkipped = false;
+    std::atomic_store( &mPendingMemory, std::shared_ptr<SharedMemoryRing>() );
+    std::atomic_store( &mSharedMemory, std::shared_ptr<SharedMemoryRing>() );
     return mClientSocket.closeSocket();
 }
 
-bool ClientConnection::requestConnectServer(void)
+bool ClientConnection::requestConnectServer( unsigned short directPort /*= NESocket::InvalidPort*/ )
 {
     bool result = false;
     if ( isValid() )
     {
         if ( getCookie() == NEService::COOKIE_LOCAL )
         {
-            RemoteMessage msgHelloServer = NEConnection::createConnectRequest();
+            // the checksums are skipped only if the routing service runs on the same host.
+            // the shared memory is offered only via local connection.
+            std::shared_ptr<SharedMemoryRing> sharedMemory;
+            if ( getAddress().isLocalSocket() && (mSharedMemorySize != 0) )
+            {
+                sharedMemory = std::make_shared<SharedMemoryRing>();
+                if ( sharedMemory->createRing(mSharedMemorySize) == false )
+                {
+                    sharedMemory.reset();
+                }
+            }
+
+            std::atomic_store( &mPendingMemory, sharedMemory );
+            RemoteMessage msgHelloServer = NEConnection::createConnectRequest( getAddress().isLoopback()
+                                                                             , sharedMemory != nullptr ? sharedMemory->getName() : String()
+                                                                             , directPort );
             result = msgHelloServer.isValid() ? sendMessage(msgHelloServer) > 0 : false;
         }
         else
@@ -76,6 +108,18 @@ bool ClientConnection::requestConnectServer(void)
     return result;
 }
 
+void ClientConnection::setSharedMemoryAccepted( bool accepted )
+{
+    std::shared_ptr<SharedMemoryRing> sharedMemory = std::atomic_exchange( &mPendingMemory, std::shared_ptr<SharedMemoryRing>() );
+    if ( sharedMemory != nullptr )
+    {
+        // the routing service either opened the ring or rejected it, the name is not needed anymore.
+        sharedMemory->unlinkRing();
+    }
+
+    std::atomic_store( &mSharedMemory, accepted ? sharedMemory : std::shared_ptr<SharedMemoryRing>() );
+}
+
 bool ClientConnection::requestDisconnectServer(void)
 {
     bool result = false;
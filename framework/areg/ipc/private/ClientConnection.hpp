@@ -21,6 +21,10 @@
 #include "areg/ipc/SocketConnectionBase.hpp"
 
 #include "areg/base/SocketClient.hpp"
+#include "areg/ipc/SharedMemoryRing.hpp"
+
+#include <atomic>
+#include <memory>
 
 //////////////////////////////////////////////////////////////////////////
 // ClientConnection class declaration
@@ -30,8 +34,9 @@
  *          send and receive data. Before sending or receiving any data,
  *          the socket should be created and as soon as connection is not needed,
  *          it should be closed.
- *          Client socket is using only TCP/IP connection. All other types
- *          and protocols are out of scope of this class and are not considered.
+ *          Client socket is using either TCP/IP connection or, on POSIX systems,
+ *          local Unix domain socket. All other types and protocols are out of
+ *          scope of this class and are not considered.
  **/
 class ClientConnection   : private   SocketConnectionBase
 {
@@ -125,6 +130,37 @@ public:
      **/
     SOCKETHANDLE getSocketHandle( void ) const;
 
+    /**
+     * \brief   Sets the flag, indicating whether the routing service accepted to skip
+     *          checksums of messages. It is set when the connection is accepted.
+     **/
+    inline void setChecksumSkipped( bool skipChecksum );
+
+    /**
+     * \brief   Returns true if the messages of the connection are sent and received without checksums.
+     **/
+    inline bool isChecksumSkipped( void ) const;
+
+    /**
+     * \brief   Sets the size in bytes of shared memory ring of local connection.
+     *          If zero or the connection is not local, the shared memory is not used.
+     **/
+    inline void setSharedMemorySize( unsigned int ringSize );
+
+    /**
+     * \brief   Called when the routing service accepts the connection. If the routing service
+     *          opened the shared memory ring created by the client, the ring is used to pass
+     *          the messages with large data. Otherwise, the ring is released.
+     * \param   accepted    Flag, indicating whether the routing service opened the shared memory ring.
+     **/
+    void setSharedMemoryAccepted( bool accepted );
+
+    /**
+     * \brief   Returns the shared memory ring used by the connection or empty pointer if
+     *          the connection does not use shared memory.
+     **/
+    inline std::shared_ptr<SharedMemoryRing> getSharedMemory( void ) const;
+
 //////////////////////////////////////////////////////////////////////////
 // Operations
 //////////////////////////////////////////////////////////////////////////
@@ -175,6 +211,25 @@ public:
      **/
     int sendMessage( const RemoteMessage & in_message ) const;
 
+    /**
+     * \brief   If socket is valid, sends the list of messages with single vectored write call.
+     *          If failed to send data to remote host, the messages after the returned number are not delivered.
+     * \param   listMessages    The list of valid messages to send.
+     * \param   count           The number of messages in the list.
+     * \return  Returns the number of messages completely sent to remote host.
+     *          Returns negative number if socket is not valid.
+     **/
+    int sendMessages( const RemoteMessage * const * listMessages, int count ) const;
+
+    /**
+     * \brief   If socket is valid, receives in the receive buffer all data, which are available
+     *          in socket. The call blocks until data arrives.
+     * \param   recvBuffer  The receive buffer of connection to receive data.
+     * \return  Returns number of bytes received from remote host.
+     *          Returns zero or negative number if socket is not valid, connection is closed or failed to receive.
+     **/
+    int receiveMessages( SocketReceiveBuffer & recvBuffer ) const;
+
     /**
      * \brief   If socket is valid, receives data using existing socket connection and returns length in bytes
      *          of data in Remote Buffer. And returns negative number if either socket is invalid,
@@ -206,9 +261,11 @@ public:
 
     /**
      * \brief   Called by connection service to start connection with routing service.
+     * \param   directPort  The port number, where the application accepts direct connections
+     *                      of other applications. NESocket::InvalidPort if direct connections are disabled.
      * \return  Returns true if succeeded to connect to routing service.
      **/
-    bool requestConnectServer( void );
+    bool requestConnectServer( unsigned short directPort = NESocket::InvalidPort );
 
     /**
      * \brief   Called by connection service to disconnect from routing service.
@@ -238,6 +295,25 @@ private:
      **/
     ITEM_ID         mCookie;
 
+    /**
+     * \brief   The flag, indicating whether the messages are sent and received without checksums.
+     **/
+    std::atomic_bool mChecksumSkipped;
+    /**
+     * \brief   The size in bytes of shared memory ring of local connection. If zero, no shared memory is used.
+     **/
+    unsigned int    mSharedMemorySize;
+    /**
+     * \brief   The shared memory ring created by client, which waits the routing service to accept it.
+     *          Accessed atomically, since the connection may be closed by other thread.
+     **/
+    std::shared_ptr<SharedMemoryRing>   mPendingMemory;
+    /**
+     * \brief   The shared memory ring used by connection. Accessed atomically, since the connection
+     *          may be closed while the send and receive threads use the ring.
+     **/
+    std::shared_ptr<SharedMemoryRing>   mSharedMemory;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
 //////////////////////////////////////////////////////////////////////////
@@ -294,9 +370,41 @@ inline SOCKETHANDLE ClientConnection::getSocketHandle( void ) const
     return mClientSocket.getHandle();
 }
 
+inline void ClientConnection::setChecksumSkipped( bool skipChecksum )
+{
+    mChecksumSkipped = skipChecksum;
+}
+
+inline bool ClientConnection::isChecksumSkipped( void ) const
+{
+    return mChecksumSkipped;
+}
+
+inline void ClientConnection::setSharedMemorySize( unsigned int ringSize )
+{
+    mSharedMemorySize = ringSize;
+}
+
+inline std::shared_ptr<SharedMemoryRing> ClientConnection::getSharedMemory( void ) const
+{
+    return std::atomic_load( &mSharedMemory );
+}
+
 inline int ClientConnection::sendMessage(const RemoteMessage & in_message) const
 {
-    return SocketConnectionBase::sendMessage(in_message, mClientSocket);
+    std::shared_ptr<SharedMemoryRing> sharedMemory( getSharedMemory() );
+    return SocketConnectionBase::sendMessage(in_message, mClientSocket, mChecksumSkipped, sharedMemory.get());
+}
+
+inline int ClientConnection::sendMessages(const RemoteMessage * const * listMessages, int count) const
+{
+    std::shared_ptr<SharedMemoryRing> sharedMemory( getSharedMemory() );
+    return SocketConnectionBase::sendMessages(listMessages, count, mClientSocket, mChecksumSkipped, sharedMemory.get());
+}
+
+inline int ClientConnection::receiveMessages(SocketReceiveBuffer & recvBuffer) const
+{
+    return SocketConnectionBase::receiveMessages(recvBuffer, mClientSocket);
 }
 
 inline int ClientConnection::receiveMessage(RemoteMessage & out_message) const
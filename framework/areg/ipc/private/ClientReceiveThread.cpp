@@ -27,6 +27,7 @@ ClientReceiveThread::ClientReceiveThread( IERemoteServiceHandler & remoteService
 
     , mRemoteService    ( remoteService )
     , mConnection       ( connection )
+    , mReceiveBuffer    ( )
 {
 }
 
@@ -40,6 +41,7 @@ bool ClientReceiveThread::runDispatcher(void)
     MultiLock multiLock(syncObjects, 2, false);
 
     RemoteMessage msgReceived;
+    mReceiveBuffer.reset();
     int whichEvent  = static_cast<int>(EventDispatcherBase::eEventOrder::EventError);
     do 
     {
@@ -47,15 +49,26 @@ bool ClientReceiveThread::runDispatcher(void)
         if ( whichEvent == MultiLock::LOCK_INDEX_TIMEOUT )
         {
             whichEvent = static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue); // escape quit
-            if ( mConnection.receiveMessage(msgReceived) <= 0 )
+            // receive all available data and process every complete message in the buffer.
+            bool succeeded = mConnection.receiveMessages(mReceiveBuffer) > 0;
+            mReceiveBuffer.setChecksumSkipped(mConnection.isChecksumSkipped());
+            mReceiveBuffer.setSharedMemory(mConnection.getSharedMemory());
+            while ( succeeded && mReceiveBuffer.extractMessage(msgReceived) )
             {
+                succeeded = msgReceived.isValid();
+                mRemoteService.processReceivedMessage(msgReceived, mConnection.getAddress(), mConnection.getSocketHandle());
                 msgReceived.invalidate();
+                // the connection accept message may change the checksum mode and the shared memory of the next messages.
+                mReceiveBuffer.setChecksumSkipped(mConnection.isChecksumSkipped());
+                mReceiveBuffer.setSharedMemory(mConnection.getSharedMemory());
+            }
+
+            if ( succeeded == false )
+            {
+                mReceiveBuffer.reset();
                 mRemoteService.failedReceiveMessage( mConnection.getSocketHandle() );
                 pulseExit();
             }
-
-            mRemoteService.processReceivedMessage(msgReceived, mConnection.getAddress(), mConnection.getSocketHandle());
-            msgReceived.invalidate();
         }
         else
         {
@@ -20,6 +20,7 @@
 #include "areg/base/GEGlobal.h"
 #include "areg/component/DispatcherThread.hpp"
 #include "areg/ipc/RemoteServiceEvent.hpp"
+#include "areg/ipc/SocketReceiveBuffer.hpp"
 
 /************************************************************************
  * Dependencies
@@ -79,6 +80,10 @@ private:
      * \brief   The instance of connection to receive messages from remote routing service.
      **/
     ClientConnection &          mConnection;
+    /**
+     * \brief   The buffer to receive data of connection.
+     **/
+    SocketReceiveBuffer         mReceiveBuffer;
 
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
@@ -16,16 +16,18 @@
 
 #include "areg/ipc/NEConnection.hpp"
 #include "areg/ipc/private/ClientConnection.hpp"
+#include "areg/ipc/private/DirectConnection.hpp"
 #include "areg/ipc/IERemoteServiceHandler.hpp"
 
 #include "areg/trace/GETrace.h"
 
 DEF_TRACE_SCOPE(areg_ipc_private_ClientSendThread_runDispatcher);
 
-ClientSendThread::ClientSendThread( IERemoteServiceHandler & remoteService, ClientConnection & connection )
+ClientSendThread::ClientSendThread( IERemoteServiceHandler & remoteService, ClientConnection & connection, DirectConnection & direct )
     : DispatcherThread  ( NEConnection::CLIENT_SEND_MESSAGE_THREAD.data() )
     , mRemoteService    ( remoteService )
     , mConnection       ( connection )
+    , mDirect           ( direct )
 {
 }
 
@@ -35,9 +37,49 @@ bool ClientSendThread::runDispatcher(void)
     TRACE_DBG("Starting client service dispatcher thread [ %s ]", getName().getString());
 
     SendMessageEvent::addListener( static_cast<IESendMessageEventConsumer &>(*this), static_cast<DispatcherThread &>(*this));
+    mEventStarted.setEvent();
 
-    bool result = DispatcherThread::runDispatcher();
+    IESynchObject * syncObjects[2] = {&mEventExit, &mEventQueue};
+    MultiLock multiLock(syncObjects, 2, false);
 
+    int whichEvent = static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue);
+    do
+    {
+        // while the direct connections are not completed, check them periodically.
+        whichEvent = multiLock.lock( mDirect.hasPending( ) ? NEConnection::DIRECT_CONNECT_RETRY : NECommon::WAIT_INFINITE, false );
+        if ( whichEvent == MultiLock::LOCK_INDEX_TIMEOUT )
+        {
+            whichEvent = static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue);
+            _sendPendingMessages( );
+        }
+        else if ( whichEvent == static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue) )
+        {
+            Event * eventElem = pickEvent();
+            if ( isExitEvent(eventElem) )
+            {
+                whichEvent = static_cast<int>(EventDispatcherBase::eEventOrder::EventExit);
+            }
+            else if ( eventElem != nullptr )
+            {
+                if ( prepareDispatchEvent(eventElem) )
+                {
+                    dispatchEvent(*eventElem);
+                }
+
+                postDispatchEvent(eventElem);
+            }
+        }
+
+    } while ( whichEvent == static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue) );
+
+    // the messages waiting for direct connections are dropped as the queued events.
+    mDirect.removePending( );
+
+    mHasStarted = false;
+    removeEvents(false);
+    mEventStarted.resetEvent();
+
+    bool result = (whichEvent == static_cast<int>(EventDispatcherBase::eEventOrder::EventExit));
     SendMessageEvent::removeListener( static_cast<IESendMessageEventConsumer &>(*this), static_cast<DispatcherThread &>(*this));
     TRACE_DBG("Exiting client service dispatcher thread [ %s ] with result [ %s ]", getName().getString(), result ? "SUCCESS" : "FAILURE");
     return result;
@@ -45,9 +87,70 @@ bool ClientSendThread::runDispatcher(void)
 
 void ClientSendThread::processEvent( const SendMessageEventData & data )
 {
+    // Coalesce the messages queued after the current one and send all with single call.
+    const RemoteMessage * listMessages[NEConnection::MAXIMUM_SEND_MESSAGES];
+    Event * listEvents[NEConnection::MAXIMUM_SEND_MESSAGES];
+    int countMessages   = 0;
+    int countEvents     = 0;
+
     const RemoteMessage & msg = data.getRemoteMessage();
-    if ( msg.isValid())
+    if ( msg.isValid() )
+    {
+        listMessages[countMessages ++] = &msg;
+    }
+
+    Event * eventElem = nullptr;
+    while ( (countEvents < NEConnection::MAXIMUM_SEND_MESSAGES - 1) && ((eventElem = pickNextEvent(SendMessageEvent::_getClassId())) != nullptr) )
+    {
+        listEvents[countEvents ++] = eventElem;
+        const RemoteMessage & next = static_cast<SendMessageEvent *>(eventElem)->getData().getRemoteMessage();
+        if ( next.isValid() )
+        {
+            listMessages[countMessages ++] = &next;
+        }
+    }
+
+    // the messages queued before are sent first, if the direct connections completed.
+    if ( mDirect.hasPending( ) )
+    {
+        _sendPendingMessages( );
+    }
+
+    // the messages to applications with direct connection bypass the routing service,
+    // the rest keep the order and are sent to routing service.
+    int countRouted = 0;
+    for ( int i = 0; i < countMessages; ++ i )
+    {
+        if ( mDirect.sendMessage( *listMessages[i] ) == false )
+        {
+            listMessages[countRouted ++] = listMessages[i];
+        }
+    }
+
+    countMessages = countRouted;
+    if ( countMessages != 0 )
+    {
+        // only the messages, which were not completely sent, are failed.
+        int sent = countMessages == 1 ? (mConnection.sendMessage( *listMessages[0] ) > 0 ? 1 : 0) : mConnection.sendMessages( listMessages, countMessages );
+        for ( int i = MACRO_MAX(sent, 0); i < countMessages; ++ i )
+        {
+            mRemoteService.failedSendMessage( *listMessages[i] );
+        }
+    }
+
+    for ( int i = 0; i < countEvents; ++ i )
+    {
+        listEvents[i]->destroy();
+    }
+}
+
+void ClientSendThread::_sendPendingMessages( void )
+{
+    DirectConnection::ListMessages listRouted;
+    mDirect.sendPending( listRouted );
+    for ( ; listRouted.isEmpty( ) == false; listRouted.removeFirst( ) )
     {
+        const RemoteMessage & msg = listRouted.getFirstEntry( );
         if ( mConnection.sendMessage( msg ) <= 0 )
         {
             mRemoteService.failedSendMessage( msg );
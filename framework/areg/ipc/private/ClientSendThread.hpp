@@ -26,6 +26,7 @@
  ************************************************************************/
 class IERemoteServiceHandler;
 class ClientConnection;
+class DirectConnection;
 
 //////////////////////////////////////////////////////////////////////////
 // ClientSendThread class declaration
@@ -45,8 +46,9 @@ public:
      * \brief   Initializes Service handler and client connection objects.
      * \param   remoteService   The instance of remote service to process messages.
      * \param   connection      The instance of client connection object to send messages.
+     * \param   direct          The instance of direct connections to send messages bypassing routing service.
      **/
-    ClientSendThread( IERemoteServiceHandler & remoteService, ClientConnection & connection );
+    ClientSendThread( IERemoteServiceHandler & remoteService, ClientConnection & connection, DirectConnection & direct );
     /**
      * \brief   Destructor
      **/
@@ -94,6 +96,15 @@ private:
      **/
     virtual void processEvent( const SendMessageEventData & data ) override;
 
+/************************************************************************/
+// Hidden methods.
+/************************************************************************/
+    /**
+     * \brief   Sends the messages queued until the direct connections complete.
+     *          The messages to the applications, which failed to connect, are routed.
+     **/
+    void _sendPendingMessages( void );
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables.
 //////////////////////////////////////////////////////////////////////////
@@ -106,6 +117,10 @@ private:
      * \brief   The instance of connection to send messages from remote routing service.
      **/
     ClientConnection &          mConnection;
+    /**
+     * \brief   The instance of direct connections to send messages bypassing routing service.
+     **/
+    DirectConnection &          mDirect;
 
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
@@ -20,6 +20,7 @@
 
 #include "areg/ipc/RemoteServiceEvent.hpp"
 #include "areg/component/private/ServiceManager.hpp"
+#include "areg/component/private/ServiceAddressTable.hpp"
 #include "areg/component/RemoteEventFactory.hpp"
 #include "areg/component/DispatcherThread.hpp"
 #include "areg/component/StreamableEvent.hpp"
@@ -37,6 +38,7 @@ DEF_TRACE_SCOPE(areg_ipc_private_ClientService_processEvent);
 DEF_TRACE_SCOPE(areg_ipc_private_ClientService_startConnection);
 DEF_TRACE_SCOPE(areg_ipc_private_ClientService_stopConnection);
 DEF_TRACE_SCOPE(areg_ipc_private_ClientService_cancelConnection);
+DEF_TRACE_SCOPE(areg_ipc_private_ClientService_startDirectConnection);
 DEF_TRACE_SCOPE(areg_ipc_private_ClientService_failedSendMessage);
 DEF_TRACE_SCOPE(areg_ipc_private_ClientService_failedReceiveMessage);
 DEF_TRACE_SCOPE(areg_ipc_private_ClientService_failedProcessMessage);
@@ -60,10 +62,13 @@ ClientService::ClientService( IERemoteServiceConsumer & serviceConsumer )
     , IETimerConsumer               ( )
 
     , mClientConnection ( )
+    , mDirectConnection ( )
     , mServiceConsumer  ( serviceConsumer )
     , mTimerConnect     ( static_cast<IETimerConsumer &>(self()), NEConnection::CLIENT_CONNECT_TIMER_NAME.data() )
     , mThreadReceive    ( static_cast<IERemoteServiceHandler &>(self()), mClientConnection )
-    , mThreadSend       ( static_cast<IERemoteServiceHandler &>(self()), mClientConnection )
+    , mThreadSend       ( static_cast<IERemoteServiceHandler &>(self()), mClientConnection, mDirectConnection )
+    , mThreadDirect     ( static_cast<IERemoteServiceHandler &>(self()), mDirectConnection )
+    , mIsDirectEnabled  ( false )
     , mIsServiceEnabled ( NEConnection::DEFAULT_REMOVE_SERVICE_ENABLED )    // TODO: by default, should be false and read out from configuration file.
     , mConfigFile       ( "" )
     , mChannel          ( )
@@ -78,16 +83,32 @@ bool ClientService::configureRemoteServicing( const char * configFile )
     ConnectionConfiguration configConnect;
     if ( configConnect.loadConfiguration( configFile ) )
     {
+        NERemoteService::eServiceConnection connectType = configConnect.getConnectionType( );
         mConfigFile             = configConnect.getConfigFileName( );
-        mIsServiceEnabled       = configConnect.getConnectionEnableFlag( CONNECT_TYPE );
-        String hostName         = configConnect.getConnectionHost( CONNECT_TYPE );
-        unsigned short hostPort = configConnect.getConnectionPort( CONNECT_TYPE );
+        mIsServiceEnabled       = configConnect.getConnectionEnableFlag( connectType );
+        String hostName         = configConnect.getConnectionHost( connectType );
+        unsigned short hostPort = configConnect.getConnectionPort( connectType );
 
+        if ( connectType == NERemoteService::eServiceConnection::ConnectionUnix )
+        {
+            // the local connection uses the socket path set as the address.
+            mClientConnection.setSharedMemorySize( configConnect.getConnectionSharedMemory( connectType ) );
+            mIsDirectEnabled    = false;
+            NESocket::SocketAddress addrLocal;
+            addrLocal.setLocalAddress( hostName.getString( ) );
+            mClientConnection.setAddress( addrLocal );
+            return addrLocal.isValid( );
+        }
+
+        mClientConnection.setSharedMemorySize( 0 );
+        mIsDirectEnabled        = configConnect.getConnectionDirect( connectType );
         return mClientConnection.setAddress( hostName, hostPort );
     }
     else
     {
         mIsServiceEnabled       = NEConnection::DEFAULT_REMOVE_SERVICE_ENABLED;
+        mIsDirectEnabled        = false;
+        mClientConnection.setSharedMemorySize( 0 );
         return mClientConnection.setAddress( NEConnection::DEFAULT_REMOTE_SERVICE_HOST.data(), NEConnection::DEFAULT_REMOTE_SERVICE_PORT );
     }
 }
@@ -278,6 +299,7 @@ void ClientService::processEvent( const ClientServiceEventData & data )
             mThreadSend.completionWait( NECommon::WAIT_INFINITE );
 
             mClientConnection.closeSocket();
+            stopDirectConnection();
             mServiceConsumer.remoteServiceStopped( channel );
 
             mThreadReceive.destroyThread( NECommon::DO_NOT_WAIT );
@@ -310,6 +332,7 @@ void ClientService::processEvent( const ClientServiceEventData & data )
             mChannel.setTarget( NEService::TARGET_UNKNOWN );
             // stopConnection();
             cancelConnection();
+            mDirectConnection.removeAllRoutes();
 
             mThreadReceive.completionWait( NECommon::WAIT_INFINITE );
             mThreadSend.completionWait( NECommon::WAIT_INFINITE );
@@ -325,6 +348,7 @@ void ClientService::processEvent( const ClientServiceEventData & data )
         mChannel.setSource( NEService::SOURCE_UNKNOWN );
         mChannel.setTarget( NEService::TARGET_UNKNOWN );
         cancelConnection();
+        mDirectConnection.removeAllRoutes();
 
         mThreadReceive.completionWait( NECommon::WAIT_INFINITE );
         mThreadSend.completionWait( NECommon::WAIT_INFINITE );
@@ -384,7 +408,7 @@ inline bool ClientService::startConnection( void )
             VERIFY( mThreadReceive.waitForDispatcherStart( NECommon::WAIT_INFINITE ) );
             VERIFY( mThreadSend.waitForDispatcherStart( NECommon::WAIT_INFINITE ) );
             TRACE_DBG("Client service starting connection with remote routing service.");
-            result = mClientConnection.requestConnectServer();
+            result = mClientConnection.requestConnectServer( startDirectConnection() );
         }
     }
 
@@ -437,6 +461,75 @@ inline void ClientService::cancelConnection(void)
     mThreadSend.destroyThread( NECommon::DO_NOT_WAIT );
 }
 
+inline unsigned short ClientService::startDirectConnection( void )
+{
+    TRACE_SCOPE(areg_ipc_private_ClientService_startDirectConnection);
+
+    if ( mIsDirectEnabled && (mClientConnection.getAddress().isLoopback() == false) )
+    {
+        // the direct connections do not authenticate the peers, they are accepted only on loopback.
+        TRACE_WARN("The routing service is not on the same host, the direct connections are not used");
+    }
+    else if ( mIsDirectEnabled && (mDirectConnection.isValid() == false) )
+    {
+        // only the applications of the same host can connect and send remote calls.
+        if ( mDirectConnection.createSocket( NESocket::LocalAddress.data(), NESocket::InvalidPort ) )
+        {
+            if ( mThreadDirect.createThread( NECommon::WAIT_INFINITE ) && mThreadDirect.waitForDispatcherStart( NECommon::WAIT_INFINITE ) )
+            {
+                TRACE_DBG("Accepting direct connections on address [ %s : %u ]"
+                            , mDirectConnection.getAddress().getHostAddress().getString()
+                            , static_cast<uint32_t>(mDirectConnection.getAddress().getHostPort()));
+            }
+            else
+            {
+                TRACE_ERR("Failed to start thread of direct connections, the messages are routed");
+                mThreadDirect.destroyThread( NECommon::DO_NOT_WAIT );
+                mDirectConnection.closeSocket();
+            }
+        }
+        else
+        {
+            TRACE_ERR("Failed to create socket of direct connections, the messages are routed");
+        }
+    }
+
+    return (mDirectConnection.isValid() ? mDirectConnection.getAddress().getHostPort() : NESocket::InvalidPort);
+}
+
+inline void ClientService::stopDirectConnection( void )
+{
+    mDirectConnection.removeAllRoutes();
+    if ( mDirectConnection.isValid() )
+    {
+        // the thread waiting for events by poller is woken up when socket is closed.
+        // Otherwise, the waiting on select is not interrupted.
+        bool canWait = mDirectConnection.isEdgeTriggered();
+        mThreadDirect.triggerExitEvent();
+        mDirectConnection.closeSocket();
+        if ( canWait )
+        {
+            mThreadDirect.completionWait( NECommon::WAIT_INFINITE );
+        }
+
+        mThreadDirect.destroyThread( NECommon::DO_NOT_WAIT );
+    }
+}
+
+inline void ClientService::addDirectRoute( const RemoteMessage & msgReceived, ITEM_ID cookie )
+{
+    String host;
+    unsigned short port = NESocket::InvalidPort;
+    msgReceived >> host;
+    msgReceived >> port;
+
+    NESocket::SocketAddress addrDirect;
+    if ( mDirectConnection.isValid() && (port != NESocket::InvalidPort) && addrDirect.resolveAddress( host.getString(), port, false ) )
+    {
+        mDirectConnection.addRoute( cookie, addrDirect );
+    }
+}
+
 void ClientService::failedSendMessage(const RemoteMessage & msgFailed)
 {
     TRACE_SCOPE(areg_ipc_private_ClientService_failedSendMessage);
@@ -543,6 +636,8 @@ void ClientService::processReceivedMessage( const RemoteMessage & msgReceived, c
             {
                 NEService::eServiceConnection connection = NEService::eServiceConnection::ServiceConnectionUnknown;
                 ITEM_ID cookie = NEService::COOKIE_UNKNOWN;
+                bool skipChecksum = false;
+                bool sharedMemory = false;
                 msgReceived >> connection;
                 msgReceived >> cookie;
                 TRACE_DBG("Router connection notification. Connection status [ %s ], cookie [ %u ]", NEService::getString(connection), static_cast<uint32_t>(cookie));
@@ -552,12 +647,23 @@ void ClientService::processReceivedMessage( const RemoteMessage & msgReceived, c
                     Lock lock(mLock);
                     ASSERT(cookie == msgReceived.getTarget());
                     mClientConnection.setCookie(cookie);
+                    // the flag is set in the receive thread, before the next messages are extracted.
+                    msgReceived >> skipChecksum;
+                    msgReceived >> sharedMemory;
+                    mClientConnection.setChecksumSkipped(skipChecksum);
+                    mClientConnection.setSharedMemoryAccepted(sharedMemory);
+                    TRACE_DBG("The checksums of messages are [ %s ], shared memory is [ %s ]", skipChecksum ? "SKIPPED" : "CALCULATED", sharedMemory ? "USED" : "NOT USED");
+                    // the addresses of remote objects are registered again when the routing service notifies them.
+                    ServiceAddressTable::removeRemoteAddresses();
+                    ServiceAddressTable::setLocalCookie(cookie);
                     ClientServiceEvent::sendEvent( ClientServiceEventData(ClientServiceEventData::eClientServiceCommands::CMD_ServiceStarted)
                                                  , static_cast<IEClientServiceEventConsumer &>(self())
                                                  , static_cast<DispatcherThread &>(self()) );
                 }
                 else if ( (static_cast<unsigned int>(connection) & static_cast<unsigned int>(NEService::eServiceConnection::ServiceConnected)) == 0 )
                 {
+                    ServiceAddressTable::removeRemoteAddresses();
+                    ServiceAddressTable::setLocalCookie(NEService::COOKIE_UNKNOWN);
                     ClientServiceEvent::sendEvent( ClientServiceEventData(ClientServiceEventData::eClientServiceCommands::CMD_ServiceStopped)
                                                  , static_cast<IEClientServiceEventConsumer &>(self())
                                                  , static_cast<DispatcherThread &>(self()) );
@@ -583,9 +689,17 @@ void ClientService::processReceivedMessage( const RemoteMessage & msgReceived, c
                         ProxyAddress proxy(msgReceived);
                         proxy.setSource( mChannel.getSource() );
                         if ( result == NEMemory::eMessageResult::ResultSucceed )
+                        {
+                            // the direct connection is set before the proxy can get any message.
+                            addDirectRoute(msgReceived, proxy.getCookie());
+                            ServiceAddressTable::registerProxy(proxy.getCookie(), proxy);
                             mServiceConsumer.registerRemoteProxy(proxy);
+                        }
                         else
+                        {
+                            ServiceAddressTable::unregisterProxy(proxy.getCookie(), proxy.getHandle());
                             mServiceConsumer.unregisterRemoteProxy(proxy, NEService::COOKIE_ANY);
+                        }
                     }
                     break;
 
@@ -594,9 +708,17 @@ void ClientService::processReceivedMessage( const RemoteMessage & msgReceived, c
                         StubAddress stub(msgReceived);
                         stub.setSource( mChannel.getSource() );
                         if ( result == NEMemory::eMessageResult::ResultSucceed )
+                        {
+                            // the direct connection is set before the stub can get any message.
+                            addDirectRoute(msgReceived, stub.getCookie());
+                            ServiceAddressTable::registerStub(stub.getCookie(), stub);
                             mServiceConsumer.registerRemoteStub(stub);
+                        }
                         else
+                        {
+                            ServiceAddressTable::unregisterStub(stub.getCookie(), stub.getHandle());
                             mServiceConsumer.unregisterRemoteStub(stub, NEService::COOKIE_ANY);
+                        }
                     }
                     break;
 
@@ -604,6 +726,8 @@ void ClientService::processReceivedMessage( const RemoteMessage & msgReceived, c
                     {
                         ProxyAddress proxy(msgReceived);
                         proxy.setSource( mChannel.getSource() );
+                        mDirectConnection.removeRoute(proxy.getCookie());
+                        ServiceAddressTable::unregisterProxy(proxy.getCookie(), proxy.getHandle());
                         mServiceConsumer.unregisterRemoteProxy(proxy, NEService::COOKIE_ANY);
                     }
                     break;
@@ -612,6 +736,8 @@ void ClientService::processReceivedMessage( const RemoteMessage & msgReceived, c
                     {
                         StubAddress stub(msgReceived);
                         stub.setSource( mChannel.getSource() );
+                        mDirectConnection.removeRoute(stub.getCookie());
+                        ServiceAddressTable::unregisterStub(stub.getCookie(), stub.getHandle());
                         mServiceConsumer.unregisterRemoteStub(stub, NEService::COOKIE_ANY);
                     }
                     break;
@@ -623,6 +749,23 @@ void ClientService::processReceivedMessage( const RemoteMessage & msgReceived, c
             }
             break;
 
+        case NEService::eFuncIdRange::ServiceRouterNotifyCongestion:
+            {
+                ITEM_ID target  = NEService::COOKIE_UNKNOWN;
+                bool congested  = false;
+                msgReceived >> target;
+                msgReceived >> congested;
+                if ( congested )
+                {
+                    TRACE_WARN("The routing service notified that the messages to the application with cookie [ %u ] are congested", static_cast<uint32_t>(target));
+                }
+                else
+                {
+                    TRACE_INFO("The routing service notified that the application with cookie [ %u ] is recovered", static_cast<uint32_t>(target));
+                }
+            }
+            break;
+
         case NEService::eFuncIdRange::ServiceLastId:            // fall through
         case NEService::eFuncIdRange::ServiceRouterQuery:       // fall through
         case NEService::eFuncIdRange::ServiceRouterRegister:    // fall through
@@ -645,7 +788,17 @@ void ClientService::processReceivedMessage( const RemoteMessage & msgReceived, c
         case NEService::eFuncIdRange::EmptyFunctionId:          // fall through
         default:
             {
-                if ( NEService::isExecutableId(static_cast<unsigned int>(msgId)) )
+                if ( NEService::isExecutableId(static_cast<unsigned int>(msgId)) && (msgReceived.getTarget() == NEService::TARGET_MULTICAST) )
+                {
+                    TRACE_DBG("Processing multicast remote message with ID [ 0x%X ]", static_cast<unsigned int>(msgId));
+                    TEArrayList<StreamableEvent *, StreamableEvent *> listEvents;
+                    RemoteEventFactory::createEventsFromMulticast(msgReceived, mChannel, listEvents);
+                    for ( int i = 0; i < listEvents.getSize(); ++ i )
+                    {
+                        listEvents[i]->deliverEvent();
+                    }
+                }
+                else if ( NEService::isExecutableId(static_cast<unsigned int>(msgId)) )
                 {
                     TRACE_DBG("Processing executable remote message with ID [ 0x%X ]", static_cast<unsigned int>(msgId));
                     StreamableEvent * eventRemote = RemoteEventFactory::createEventFromStream(msgReceived, mChannel);
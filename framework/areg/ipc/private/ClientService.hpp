@@ -28,6 +28,8 @@
 #include "areg/ipc/private/ClientServiceEvent.hpp"
 #include "areg/ipc/private/ClientSendThread.hpp"
 #include "areg/ipc/private/ClientConnection.hpp"
+#include "areg/ipc/private/DirectConnection.hpp"
+#include "areg/ipc/private/DirectReceiveThread.hpp"
 #include "areg/ipc/NERemoteService.hpp"
 #include "areg/component/Channel.hpp"
 #include "areg/component/Timer.hpp"
@@ -59,11 +61,6 @@ class ClientService : public    IERemoteService
 // Internal types and constants
 //////////////////////////////////////////////////////////////////////////
 private:
-    /**
-     * \brief   Supported connection type. It is TCP/IP connection
-     **/
-    static constexpr    NERemoteService::eServiceConnection   CONNECT_TYPE  = NERemoteService::eServiceConnection::ConnectionTcpip;
-
     /**
      * \brief   ClientService::eConnectionState
      *          Defines connection state values
@@ -331,6 +328,30 @@ private:
      * \brief   Called when connection is lost and should be immediately canceled.
      **/
     inline void cancelConnection( void );
+
+    /**
+     * \brief   Called to start accepting direct connections of other applications,
+     *          if direct connections are enabled. Does nothing if already started.
+     *          The direct connections are accepted only on loopback address and only
+     *          if the routing service is reached via loopback.
+     * \return  Returns the port number of direct connections to pass to routing service.
+     *          Returns NESocket::InvalidPort if direct connections are disabled or failed.
+     **/
+    inline unsigned short startDirectConnection( void );
+
+    /**
+     * \brief   Called to stop accepting direct connections and close all direct connections.
+     **/
+    inline void stopDirectConnection( void );
+
+    /**
+     * \brief   Called when the routing service notifies the registration of remote service.
+     *          Reads the address of direct connection of application of remote service
+     *          from the message and adds the direct connection if it is valid.
+     * \param   msgReceived The notification message to read the address.
+     * \param   cookie      The cookie of application of remote service.
+     **/
+    inline void addDirectRoute( const RemoteMessage & msgReceived, ITEM_ID cookie );
     /**
      * \brief   Returns true if client socket connection is started.
      **/
@@ -361,6 +382,10 @@ private:
      * \brief   Client connection object
      **/
     ClientConnection            mClientConnection;
+    /**
+     * \brief   The direct connections with other applications.
+     **/
+    DirectConnection            mDirectConnection;
     /**
      * \brief   Instance of remote servicing consumer to handle message.
      **/
@@ -377,6 +402,14 @@ private:
      * \brief   Message sender thread
      **/
     ClientSendThread            mThreadSend;
+    /**
+     * \brief   The thread receiving messages of direct connections.
+     **/
+    DirectReceiveThread         mThreadDirect;
+    /**
+     * \brief   Flag, indicates whether the direct connections with other applications are enabled.
+     **/
+    bool                        mIsDirectEnabled;
     /**
      * \brief   Flag, indicates whether the remote servicing is enabled or not.
      **/
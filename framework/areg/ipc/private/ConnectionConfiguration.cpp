@@ -30,10 +30,29 @@ ConnectionConfiguration::eConnectionProperty ConnectionConfiguration::getPositio
         return eConnectionProperty::PropertyHost;
     else if (strProperty == NERemoteService::CONFIG_KEY_PROP_PORT.data( ) )
         return eConnectionProperty::PropertyPort;
+    else if (strProperty == NERemoteService::CONFIG_KEY_PROP_WORKERS.data( ) )
+        return eConnectionProperty::PropertyWorkers;
+    else if (strProperty == NERemoteService::CONFIG_KEY_PROP_SHMEM.data( ) )
+        return eConnectionProperty::PropertySharedMemory;
+    else if (strProperty == NERemoteService::CONFIG_KEY_PROP_DIRECT.data( ) )
+        return eConnectionProperty::PropertyDirect;
+    else if (strProperty == NERemoteService::CONFIG_KEY_PROP_SENDHIGH.data( ) )
+        return eConnectionProperty::PropertySendHigh;
+    else if (strProperty == NERemoteService::CONFIG_KEY_PROP_SENDLOW.data( ) )
+        return eConnectionProperty::PropertySendLow;
+    else if (strProperty == NERemoteService::CONFIG_KEY_PROP_SENDLIMIT.data( ) )
+        return eConnectionProperty::PropertySendLimit;
     else
         return eConnectionProperty::PropertyInvalid;
 }
 
+ConnectionConfiguration::ConnectionConfiguration( void )
+    : mConfigFile       ( )
+    , mConnectionType   ( NERemoteService::eServiceConnection::ConnectionTcpip )
+    , mMapConfig        ( )
+{
+}
+
 bool ConnectionConfiguration::loadConfiguration(const char * filePath /* = nullptr */)
 {
     mConfigFile = File::getFileFullPath( NEString::isEmpty<char>(filePath) ? NEApplication::DEFAULT_ROUTER_CONFIG_FILE.data() : filePath );
@@ -46,6 +65,8 @@ bool ConnectionConfiguration::loadConfiguration(const char * filePath /* = nullp
 bool ConnectionConfiguration::loadConfiguration(FileBase & file)
 {
     mMapConfig.removeAll();
+    mConnectionType = NERemoteService::eServiceConnection::ConnectionTcpip;
+    bool typeFound  = false;
 
     if (file.isOpened())
     {
@@ -62,7 +83,14 @@ bool ConnectionConfiguration::loadConfiguration(FileBase & file)
             {
                 ListProperties  listProp;
                 if ( _parseConnectionConfig(listProp, file, line, prop.getValue().getString()) )
+                {
                     mMapConfig.setAt(section, listProp);
+                    if ( (typeFound == false) && getConnectionEnableFlag(section) )
+                    {
+                        mConnectionType = section;
+                        typeFound       = true;
+                    }
+                }
                 else
                     section = NERemoteService::eServiceConnection::ConnectionUndefined;
             }
@@ -120,9 +148,10 @@ bool ConnectionConfiguration::_parseConnectionConfig(ListProperties & listProp,
 String ConnectionConfiguration::_getPropertyValue( NERemoteService::eServiceConnection key, ConnectionConfiguration::eConnectionProperty entryIndex, const char * defaultValue ) const
 {
     String result = defaultValue;
-    if ( mMapConfig.isEmpty( ) == false )
+    MAPPOS pos = mMapConfig.find( key );
+    if ( pos != nullptr )
     {
-        const ListProperties & listProp = mMapConfig.getAt( key );
+        const ListProperties & listProp = mMapConfig.valueAtPosition( pos );
         if ( listProp.getSize( ) > static_cast<int>(entryIndex) )
         {
             const Property & prop = listProp[static_cast<int>(entryIndex)];
@@ -150,6 +179,42 @@ bool ConnectionConfiguration::getConnectionEnableFlag( NERemoteService::eService
     return enabled.convToBool();
 }
 
+unsigned int ConnectionConfiguration::getConnectionWorkers( NERemoteService::eServiceConnection section /*= NERemoteService::eServiceConnection::ConnectionTcpip */ ) const
+{
+    String workers = _getPropertyValue( section, ConnectionConfiguration::PropertyWorkers, String::uint32ToString(NEConnection::DEFAULT_SERVER_WORKERS) );
+    return workers.convToUInt32( );
+}
+
+unsigned int ConnectionConfiguration::getConnectionSharedMemory( NERemoteService::eServiceConnection section /*= NERemoteService::eServiceConnection::ConnectionUnix */ ) const
+{
+    String size = _getPropertyValue( section, ConnectionConfiguration::PropertySharedMemory, String::uint32ToString( 0 ) );
+    return size.convToUInt32( );
+}
+
+bool ConnectionConfiguration::getConnectionDirect( NERemoteService::eServiceConnection section /*= NERemoteService::eServiceConnection::ConnectionTcpip */ ) const
+{
+    String direct = _getPropertyValue( section, ConnectionConfiguration::PropertyDirect, NECommon::BOOLEAN_FALSE.data() );
+    return direct.convToBool( );
+}
+
+unsigned int ConnectionConfiguration::getConnectionSendHighMark( NERemoteService::eServiceConnection section /*= NERemoteService::eServiceConnection::ConnectionTcpip */ ) const
+{
+    String size = _getPropertyValue( section, ConnectionConfiguration::PropertySendHigh, String::uint32ToString(NEConnection::DEFAULT_SEND_HIGH_WATERMARK) );
+    return size.convToUInt32( );
+}
+
+unsigned int ConnectionConfiguration::getConnectionSendLowMark( NERemoteService::eServiceConnection section /*= NERemoteService::eServiceConnection::ConnectionTcpip */ ) const
+{
+    String size = _getPropertyValue( section, ConnectionConfiguration::PropertySendLow, String::uint32ToString(NEConnection::DEFAULT_SEND_LOW_WATERMARK) );
+    return size.convToUInt32( );
+}
+
+unsigned int ConnectionConfiguration::getConnectionSendLimit( NERemoteService::eServiceConnection section /*= NERemoteService::eServiceConnection::ConnectionTcpip */ ) const
+{
+    String size = _getPropertyValue( section, ConnectionConfiguration::PropertySendLimit, String::uint32ToString(NEConnection::DEFAULT_SEND_QUEUE_LIMIT) );
+    return size.convToUInt32( );
+}
+
 unsigned short ConnectionConfiguration::getConnectionPort( NERemoteService::eServiceConnection section /*= NERemoteService::eServiceConnection::ConnectionTcpip */ ) const
 {
     String port = _getPropertyValue( section, ConnectionConfiguration::PropertyPort, String::uint32ToString(NEConnection::DEFAULT_REMOTE_SERVICE_PORT) );
@@ -0,0 +1,279 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/private/DirectConnection.cpp
+ * \ingroup     AREG Asynchronous Event-Driven Communication Framework
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the direct connections between applications.
+ ************************************************************************/
+#include "areg/ipc/private/DirectConnection.hpp"
+#include "areg/base/RemoteMessage.hpp"
+#include "areg/base/SocketClient.hpp"
+#include "areg/base/NEUtilities.hpp"
+#include "areg/ipc/NEConnection.hpp"
+
+#include "areg/trace/GETrace.h"
+
+DEF_TRACE_SCOPE(areg_ipc_private_DirectConnection_addRoute);
+DEF_TRACE_SCOPE(areg_ipc_private_DirectConnection_sendMessage);
+DEF_TRACE_SCOPE(areg_ipc_private_DirectConnection_sendPending);
+DEF_TRACE_SCOPE(areg_ipc_private_DirectConnection__checkConnect);
+DEF_TRACE_SCOPE(areg_ipc_private_DirectConnection__sendDirect);
+
+DirectConnection::DirectConnection( void )
+    : ServerConnectionBase  ( )
+    , SocketConnectionBase  ( )
+    , mRoutes               ( )
+    , mRouteLock            ( )
+    , mPending              ( )
+{
+}
+
+DirectConnection::~DirectConnection( void )
+{
+    removePending( );
+}
+
+void DirectConnection::addRoute( ITEM_ID cookie, const NESocket::SocketAddress & addrDirect )
+{
+    TRACE_SCOPE(areg_ipc_private_DirectConnection_addRoute);
+
+    Lock lock( mRouteLock );
+    MAPPOS pos = mRoutes.find( cookie );
+    if ( pos == nullptr )
+    {
+        TRACE_DBG("Add direct connection to application [ %u ], address [ %s : %u ]"
+                    , static_cast<uint32_t>(cookie)
+                    , addrDirect.getHostAddress().getString()
+                    , static_cast<uint32_t>(addrDirect.getHostPort()));
+
+        mRoutes.setAt( cookie, sDirectRoute{ addrDirect, ClientSocket( ), 0u, 1, false, false } );
+    }
+    else
+    {
+        sDirectRoute & route = mRoutes.getPosition( pos );
+        if ( route.drAddress != addrDirect )
+        {
+            route.drSocket.reset( );
+            route.drAddress     = addrDirect;
+            route.drConnected   = false;
+        }
+
+        route.drCount  += 1;
+        route.drFailed  = false;
+    }
+}
+
+void DirectConnection::removeRoute( ITEM_ID cookie )
+{
+    Lock lock( mRouteLock );
+    MAPPOS pos = mRoutes.find( cookie );
+    if ( pos != nullptr )
+    {
+        sDirectRoute & route = mRoutes.getPosition( pos );
+        if ( -- route.drCount <= 0 )
+        {
+            route.drSocket.reset( );
+            mRoutes.removePosition( pos );
+        }
+    }
+}
+
+void DirectConnection::removeAllRoutes( void )
+{
+    Lock lock( mRouteLock );
+    mRoutes.removeAll( );
+}
+
+bool DirectConnection::_getRoute( ITEM_ID target, sDirectRoute & out_route ) const
+{
+    Lock lock( mRouteLock );
+    MAPPOS pos = mRoutes.find( target );
+    bool result = (pos != nullptr) && (mRoutes.valueAtPosition( pos ).drFailed == false);
+    if ( result )
+    {
+        out_route = mRoutes.valueAtPosition( pos );
+    }
+
+    return result;
+}
+
+bool DirectConnection::_setRoute( ITEM_ID target, const sDirectRoute & route )
+{
+    Lock lock( mRouteLock );
+    MAPPOS pos = mRoutes.find( target );
+    bool result = (pos != nullptr) && (mRoutes.valueAtPosition( pos ).drAddress == route.drAddress);
+    if ( result )
+    {
+        // if the route failed, the messages are routed until the routing service notifies new registration.
+        sDirectRoute & entry = mRoutes.getPosition( pos );
+        entry.drSocket      = route.drSocket;
+        entry.drStarted     = route.drStarted;
+        entry.drConnected   = route.drConnected;
+        entry.drFailed      = route.drFailed;
+    }
+
+    return result;
+}
+
+void DirectConnection::_checkConnect( ITEM_ID target, sDirectRoute & route )
+{
+    TRACE_SCOPE(areg_ipc_private_DirectConnection__checkConnect);
+
+    // do not block the sending thread, the messages are queued until connected.
+    NESocket::eConnectState state = route.drSocket->checkConnected( );
+    if ( state == NESocket::eConnectState::ConnectSucceeded )
+    {
+        route.drConnected = true;
+    }
+    else if ( (state == NESocket::eConnectState::ConnectFailed) || ((NEUtilities::getTickCount( ) - route.drStarted) > NEConnection::DIRECT_CONNECT_TIMEOUT) )
+    {
+        route.drSocket.reset( );
+        route.drFailed = true;
+    }
+
+    if ( route.drConnected || route.drFailed )
+    {
+        TRACE_DBG("[ %s ] to connect directly application [ %u ], address [ %s : %u ]"
+                    , route.drConnected ? "SUCCEEDED" : "FAILED"
+                    , static_cast<uint32_t>(target)
+                    , route.drAddress.getHostAddress().getString()
+                    , static_cast<uint32_t>(route.drAddress.getHostPort()));
+
+        _setRoute( target, route );
+    }
+}
+
+bool DirectConnection::_sendDirect( ITEM_ID target, sDirectRoute & route, const RemoteMessage & message )
+{
+    TRACE_SCOPE(areg_ipc_private_DirectConnection__sendDirect);
+
+    // the checksums are skipped only if both applications are on the same host.
+    bool result = (SocketConnectionBase::sendMessage( message, *route.drSocket, route.drAddress.isLoopback( ) ) > 0);
+    if ( result == false )
+    {
+        TRACE_WARN("Failed to send message directly to application [ %u ], the messages are routed", static_cast<uint32_t>(target));
+        route.drSocket.reset( );
+        route.drConnected   = false;
+        route.drFailed      = true;
+        _setRoute( target, route );
+    }
+
+    return result;
+}
+
+bool DirectConnection::sendMessage( const RemoteMessage & message )
+{
+    TRACE_SCOPE(areg_ipc_private_DirectConnection_sendMessage);
+
+    bool result     = false;
+    ITEM_ID target  = message.getTarget( );
+    sDirectRoute route;
+
+    MAPPOS pos = mPending.find( target );
+    if ( pos != nullptr )
+    {
+        // keep the order, the message waits until the connection completes.
+        mPending.valueAtPosition( pos )->pushLast( message );
+        result = true;
+    }
+    else if ( _getRoute( target, route ) )
+    {
+        if ( route.drSocket.get( ) == nullptr )
+        {
+            // only the sending thread connects, the route cannot get other socket meanwhile.
+            route.drSocket  = std::make_shared<SocketClient>( route.drAddress );
+            route.drStarted = NEUtilities::getTickCount( );
+            route.drFailed  = (route.drSocket->createSocketAsync( ) == false);
+            if ( route.drFailed )
+            {
+                route.drSocket.reset( );
+            }
+
+            // the route might be removed or changed meanwhile, then the socket is released.
+            _setRoute( target, route );
+        }
+
+        if ( (route.drSocket.get( ) != nullptr) && (route.drConnected == false) )
+        {
+            _checkConnect( target, route );
+        }
+
+        if ( route.drConnected )
+        {
+            result = _sendDirect( target, route, message );
+        }
+        else if ( route.drSocket.get( ) != nullptr )
+        {
+            // the connection is not completed yet, the messages are queued and are not routed to keep the order.
+            ListMessages * queue = DEBUG_NEW ListMessages( );
+            queue->pushLast( message );
+            mPending.setAt( target, queue );
+            result = true;
+        }
+    }
+
+    return result;
+}
+
+void DirectConnection::sendPending( DirectConnection::ListMessages & OUT out_routed )
+{
+    TRACE_SCOPE(areg_ipc_private_DirectConnection_sendPending);
+
+    MAPPOS pos = mPending.firstPosition( );
+    while ( pos != nullptr )
+    {
+        ITEM_ID target{ NEService::COOKIE_UNKNOWN };
+        ListMessages * queue{ nullptr };
+        mPending.getAtPosition( pos, target, queue );
+
+        // the route might be removed, changed or closed meanwhile, then the messages are routed.
+        sDirectRoute route;
+        bool isValid = _getRoute( target, route ) && (route.drSocket.get( ) != nullptr);
+        if ( isValid && (route.drConnected == false) )
+        {
+            _checkConnect( target, route );
+            if ( (route.drConnected == false) && (route.drFailed == false) )
+            {
+                // the connection is not completed yet, check later.
+                pos = mPending.nextPosition( pos );
+                continue;
+            }
+        }
+
+        bool isDirect = isValid && route.drConnected;
+        TRACE_DBG("Sending [ %d ] queued messages to application [ %u ] [ %s ]"
+                    , queue->getSize( )
+                    , static_cast<uint32_t>(target)
+                    , isDirect ? "DIRECTLY" : "VIA ROUTER");
+
+        for ( ; queue->isEmpty( ) == false; queue->removeFirst( ) )
+        {
+            const RemoteMessage & message = queue->getFirstEntry( );
+            isDirect = isDirect && _sendDirect( target, route, message );
+            if ( isDirect == false )
+            {
+                out_routed.pushLast( message );
+            }
+        }
+
+        pos = mPending.removePosition( pos, target, queue );
+        delete queue;
+    }
+}
+
+void DirectConnection::removePending( void )
+{
+    for ( MAPPOS pos = mPending.firstPosition( ); pos != nullptr; pos = mPending.nextPosition( pos ) )
+    {
+        delete mPending.valueAtPosition( pos );
+    }
+
+    mPending.removeAll( );
+}
@@ -0,0 +1,281 @@
+#pragma once
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/private/DirectConnection.hpp
+ * \ingroup     AREG Asynchronous Event-Driven Communication Framework
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the direct connections between applications.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/ipc/ServerConnectionBase.hpp"
+#include "areg/ipc/SocketConnectionBase.hpp"
+
+#include "areg/base/SynchObjects.hpp"
+#include "areg/base/SocketAccepted.hpp"
+#include "areg/base/TEHashMap.hpp"
+#include "areg/base/TELinkedList.hpp"
+#include "areg/base/RemoteMessage.hpp"
+
+#include <memory>
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+class SocketClient;
+class SocketReceiveBuffer;
+
+//////////////////////////////////////////////////////////////////////////
+// DirectConnection class declaration.
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The direct connections between applications, which bypass the
+ *          routing service. The routing service is used only to discover
+ *          services. When it notifies the registration of remote service,
+ *          it passes the address where the application of remote service
+ *          accepts direct connections. The messages to the applications with
+ *          known address are sent directly, all other messages are routed.
+ *
+ *          The direct connections are accepted only on loopback address,
+ *          so that only the applications of the same host can connect and
+ *          send remote calls.
+ *
+ *          The object accepts the connections of other applications and
+ *          opens outgoing connection to an application when the first message
+ *          is sent to it. Until the connection completes, the messages to the
+ *          application are queued and then sent in the same order, either
+ *          directly or routed if failed to connect. If failed to connect or send,
+ *          the messages to the application are routed until the routing service
+ *          notifies new registration. The state of remote services is defined
+ *          only by routing service, the failure of direct connection does not
+ *          disconnect the services.
+ **/
+class DirectConnection  : public    ServerConnectionBase
+                        , private   SocketConnectionBase
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   DirectConnection::ListMessages
+     *          The list of messages in the order to send.
+     **/
+    using ListMessages  = TELinkedList<RemoteMessage, const RemoteMessage &>;
+
+private:
+    /**
+     * \brief   DirectConnection::ClientSocket
+     *          The shared connected socket. The socket is closed when the last reference is released,
+     *          so that the sending thread can use it while the route is removed by other thread.
+     **/
+    using ClientSocket  = std::shared_ptr<SocketClient>;
+
+    /**
+     * \brief   DirectConnection::sDirectRoute
+     *          The outgoing direct connection to the application.
+     **/
+    typedef struct S_DirectRoute
+    {
+        NESocket::SocketAddress drAddress;  //!< The address, where the application accepts direct connections.
+        ClientSocket            drSocket;   //!< The socket of connection, empty until the first message is sent.
+        uint64_t                drStarted;  //!< The tick count in milliseconds when started to connect.
+        int                     drCount;    //!< The number of registered remote services of the application.
+        bool                    drConnected;//!< The flag, indicating that the socket completed to connect.
+        bool                    drFailed;   //!< The flag, indicating that failed to connect or send, the messages are routed.
+    } sDirectRoute;
+
+    /**
+     * \brief   The map of outgoing direct connections, where the keys are cookies of applications.
+     **/
+    using ImplMapRoutes = TEHashMapImpl<ITEM_ID, const sDirectRoute &>;
+    using MapRoutes     = TEHashMap<ITEM_ID, sDirectRoute, ITEM_ID, const sDirectRoute &, ImplMapRoutes>;
+
+    /**
+     * \brief   The map of messages queued until the direct connection completes, where the keys are cookies of applications.
+     **/
+    using ImplMapPending= TEHashMapImpl<ITEM_ID, ListMessages *>;
+    using MapPending    = TEHashMap<ITEM_ID, ListMessages *, ITEM_ID, ListMessages *, ImplMapPending>;
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Creates instance of object with invalid socket object.
+     *          Before accepting connections, the socket should be created.
+     **/
+    DirectConnection( void );
+
+    /**
+     * \brief   Destructor.
+     **/
+    virtual ~DirectConnection( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Operations
+//////////////////////////////////////////////////////////////////////////
+public:
+
+    /**
+     * \brief   Called when the routing service notifies the registration of remote service
+     *          of application, which accepts direct connections. Increases the number of
+     *          registered services of application, sets the address and resets the failure.
+     * \param   cookie      The cookie of application of registered remote service.
+     * \param   addrDirect  The address, where the application accepts direct connections.
+     **/
+    void addRoute( ITEM_ID cookie, const NESocket::SocketAddress & addrDirect );
+
+    /**
+     * \brief   Called when the routing service notifies the unregistration of remote service.
+     *          Decreases the number of registered services of application and closes the
+     *          outgoing direct connection if there are no more registered services.
+     * \param   cookie      The cookie of application of unregistered remote service.
+     **/
+    void removeRoute( ITEM_ID cookie );
+
+    /**
+     * \brief   Closes all outgoing direct connections. Called when the connection with
+     *          routing service is lost or stopped.
+     **/
+    void removeAllRoutes( void );
+
+    /**
+     * \brief   Sends the message via direct connection to the target application.
+     *          If the application has no outgoing direct connection, it starts to connect
+     *          without blocking. Until the connection completes, the messages are queued.
+     *          The call should be made only by the thread sending messages.
+     * \param   message     The message to send.
+     * \return  Returns true if the message is sent or queued. Returns false if the target has
+     *          no direct connection or failed to send. In this case the message should be routed.
+     **/
+    bool sendMessage( const RemoteMessage & message );
+
+    /**
+     * \brief   Checks the connections, which are not completed yet, and sends the queued messages
+     *          in the same order. If the connection failed, the queued messages are moved to the
+     *          list of messages to route. The call should be made only by the thread sending messages.
+     * \param   out_routed  On output, contains the messages to route in the order to send.
+     **/
+    void sendPending( DirectConnection::ListMessages & OUT out_routed );
+
+    /**
+     * \brief   Removes the messages queued until the direct connections complete.
+     *          Called when the thread sending messages exits.
+     **/
+    void removePending( void );
+
+    /**
+     * \brief   Returns true if there are messages queued until the direct connection completes.
+     *          The call should be made only by the thread sending messages.
+     **/
+    inline bool hasPending( void ) const;
+
+    /**
+     * \brief   Receives data from the accepted direct connection and extracts the messages
+     *          in the receive buffer. The call is blocking until any data is received.
+     * \param   recvBuffer      The receive buffer of connection.
+     * \param   clientSocket    The accepted socket of direct connection.
+     * \return  Returns the number of received bytes. Returns 0 or negative value if failed.
+     **/
+    inline int receiveMessages( SocketReceiveBuffer & recvBuffer, const SocketAccepted & clientSocket ) const;
+
+    /**
+     * \brief   Receives the pending data from the accepted direct connection without blocking.
+     * \param   recvBuffer      The receive buffer of connection.
+     * \param   clientSocket    The accepted socket of direct connection.
+     * \return  Returns the number of received bytes, 0 if no pending data. Returns negative value if failed.
+     **/
+    inline int receivePendingMessages( SocketReceiveBuffer & recvBuffer, const SocketAccepted & clientSocket ) const;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Returns the copy of outgoing direct connection to the application.
+     * \param   target      The cookie of application.
+     * \param   out_route   On output, contains the copy of direct connection. The socket is empty if not connected yet.
+     * \return  Returns false if the application has no direct connection or it failed.
+     **/
+    bool _getRoute( ITEM_ID target, sDirectRoute & out_route ) const;
+
+    /**
+     * \brief   Sets the socket and the state of outgoing direct connection to the application,
+     *          if the address did not change. The number of registered services is not changed.
+     * \param   target      The cookie of application.
+     * \param   route       The direct connection with the address, which was used to connect.
+     * \return  Returns false if the application has no direct connection or the address changed.
+     **/
+    bool _setRoute( ITEM_ID target, const sDirectRoute & route );
+
+    /**
+     * \brief   Checks without blocking the state of connection, which is not completed yet.
+     *          If the connection completed or failed, updates the direct connection to the application.
+     * \param   target      The cookie of application.
+     * \param   route       The copy of direct connection to check.
+     **/
+    void _checkConnect( ITEM_ID target, sDirectRoute & route );
+
+    /**
+     * \brief   Sends the message via completed direct connection. If failed, the direct connection
+     *          to the application is closed and the messages are routed.
+     * \param   target      The cookie of application.
+     * \param   route       The copy of completed direct connection.
+     * \param   message     The message to send.
+     * \return  Returns true if the message is sent.
+     **/
+    bool _sendDirect( ITEM_ID target, sDirectRoute & route, const RemoteMessage & message );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The outgoing direct connections, where the keys are cookies of applications.
+     **/
+    MapRoutes               mRoutes;
+    /**
+     * \brief   The synchronization object of outgoing direct connections.
+     **/
+    mutable ResourceLock    mRouteLock;
+    /**
+     * \brief   The messages queued until the direct connections complete. Accessed only by the thread sending messages.
+     **/
+    MapPending              mPending;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    DECLARE_NOCOPY_NOMOVE( DirectConnection );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// DirectConnection class inline functions
+//////////////////////////////////////////////////////////////////////////
+
+inline bool DirectConnection::hasPending( void ) const
+{
+    return (mPending.isEmpty( ) == false);
+}
+
+inline int DirectConnection::receiveMessages( SocketReceiveBuffer & recvBuffer, const SocketAccepted & clientSocket ) const
+{
+    return SocketConnectionBase::receiveMessages( recvBuffer, clientSocket );
+}
+
+inline int DirectConnection::receivePendingMessages( SocketReceiveBuffer & recvBuffer, const SocketAccepted & clientSocket ) const
+{
+    return SocketConnectionBase::receivePendingMessages( recvBuffer, clientSocket );
+}
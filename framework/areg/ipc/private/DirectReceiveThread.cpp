@@ -0,0 +1,175 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/private/DirectReceiveThread.cpp
+ * \ingroup     AREG Asynchronous Event-Driven Communication Framework
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the thread receiving messages of direct connections.
+ ************************************************************************/
+#include "areg/ipc/private/DirectReceiveThread.hpp"
+
+#include "areg/ipc/private/DirectConnection.hpp"
+#include "areg/ipc/IERemoteServiceHandler.hpp"
+#include "areg/ipc/NEConnection.hpp"
+#include "areg/ipc/SocketReceiveBuffer.hpp"
+#include "areg/component/NEService.hpp"
+#include "areg/base/RemoteMessage.hpp"
+#include "areg/base/SocketAccepted.hpp"
+
+#include "areg/trace/GETrace.h"
+
+DEF_TRACE_SCOPE(areg_ipc_private_DirectReceiveThread_runDispatcher);
+
+DirectReceiveThread::DirectReceiveThread( IERemoteServiceHandler & remoteService, DirectConnection & connection )
+    : DispatcherThread  ( NEConnection::CLIENT_DIRECT_MESSAGE_THREAD.data() )
+    , mRemoteService    ( remoteService )
+    , mConnection       ( connection )
+    , mReceiveBuffers   ( )
+{
+}
+
+bool DirectReceiveThread::runDispatcher( void )
+{
+    TRACE_SCOPE(areg_ipc_private_DirectReceiveThread_runDispatcher);
+    TRACE_DBG("Starting dispatcher [ %s ]", getName().getString());
+
+    mEventStarted.setEvent();
+
+    int whichEvent  = static_cast<int>(EventDispatcherBase::eEventOrder::EventError);
+    if ( mConnection.serverListen( NESocket::MAXIMUM_LISTEN_QUEUE_SIZE ) )
+    {
+        IESynchObject* syncObjects[2] = {&mEventExit, &mEventQueue};
+        MultiLock multiLock(syncObjects, 2, false);
+
+        RemoteMessage msgReceived;
+        do
+        {
+            whichEvent = multiLock.lock(NECommon::DO_NOT_WAIT, false);
+            if ( whichEvent == MultiLock::LOCK_INDEX_TIMEOUT )
+            {
+                whichEvent = static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue); // escape quit
+                NESocket::SocketAddress addrAccepted;
+                SOCKETHANDLE hSocket = mConnection.waitForConnectionEvent(addrAccepted);
+                if ( hSocket == NESocket::InvalidSocketHandle )
+                {
+                    continue;
+                }
+
+                SocketAccepted peerSocket;
+                if ( mConnection.isConnectionAccepted(hSocket) )
+                {
+                    peerSocket = mConnection.getClientByHandle( hSocket );
+                }
+                else
+                {
+                    TRACE_DBG("Accepting direct connection of socket [ %u ], application [ %s : %d ]"
+                                    , hSocket
+                                    , addrAccepted.getHostAddress().getString()
+                                    , addrAccepted.getHostPort());
+
+                    // the socket handle might be reused, drop the data of previous connection.
+                    _removeReceiveBuffer(hSocket);
+                    peerSocket = SocketAccepted(hSocket, addrAccepted);
+                    mConnection.acceptConnection(peerSocket);
+                }
+
+                // the checksums are skipped only if both applications are on the same host.
+                const NESocket::SocketAddress & addrPeer = peerSocket.getAddress();
+                SocketReceiveBuffer & recvBuffer = _getReceiveBuffer(hSocket);
+                recvBuffer.setChecksumSkipped( addrPeer.isLoopback() );
+
+                bool noWait     = mConnection.isEdgeTriggered();
+                int received    = noWait ? mConnection.receivePendingMessages(recvBuffer, peerSocket) : mConnection.receiveMessages(recvBuffer, peerSocket);
+                bool succeeded  = noWait ? received >= 0 : received > 0;
+                while ( succeeded && (received > 0) )
+                {
+                    while ( succeeded && recvBuffer.extractMessage(msgReceived) )
+                    {
+                        succeeded = msgReceived.isValid();
+                        if ( succeeded && NEService::isExecutableId(msgReceived.getMessageId()) )
+                        {
+                            mRemoteService.processReceivedMessage(msgReceived, addrPeer, hSocket);
+                        }
+                        else if ( succeeded )
+                        {
+                            TRACE_WARN("Ignoring message [ 0x%X ] received via direct connection, only remote calls are processed"
+                                        , static_cast<uint32_t>(msgReceived.getMessageId()));
+                        }
+
+                        msgReceived.invalidate();
+                    }
+
+                    received    = succeeded ? mConnection.receivePendingMessages(recvBuffer, peerSocket) : -1;
+                    succeeded   = received >= 0;
+                }
+
+                if ( succeeded == false )
+                {
+                    // the direct connection is closed without notification, the routing service notifies disconnected services.
+                    TRACE_DBG("Closing direct connection of application [ %s : %d ], socket [ %u ]"
+                                    , addrPeer.getHostAddress().getString()
+                                    , addrPeer.getHostPort()
+                                    , hSocket);
+
+                    _removeReceiveBuffer(hSocket);
+                    mConnection.closeConnection(peerSocket);
+                }
+            }
+            else
+            {
+                Event * eventElem = whichEvent == static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue) ? pickEvent() : nullptr;
+                whichEvent = isExitEvent(eventElem) ? static_cast<int>(EventDispatcherBase::eEventOrder::EventExit) : whichEvent;
+            }
+
+        } while (whichEvent == static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue));
+    }
+
+    mHasStarted = false;
+    removeEvents(false);
+    _removeAllReceiveBuffers();
+
+    mEventStarted.resetEvent();
+
+    TRACE_DBG("Dispatcher [ %s ] completed job and stopping running.", mDispatcherName.getString());
+    return (whichEvent == static_cast<int>(EventDispatcherBase::eEventOrder::EventExit));
+}
+
+SocketReceiveBuffer & DirectReceiveThread::_getReceiveBuffer( SOCKETHANDLE hSocket )
+{
+    MAPPOS pos = mReceiveBuffers.find(hSocket);
+    if ( pos == nullptr )
+    {
+        pos = mReceiveBuffers.setAt(hSocket, DEBUG_NEW SocketReceiveBuffer( ), false);
+    }
+
+    SocketReceiveBuffer * buffer = mReceiveBuffers.valueAtPosition(pos);
+    ASSERT(buffer != nullptr);
+    return (*buffer);
+}
+
+void DirectReceiveThread::_removeReceiveBuffer( SOCKETHANDLE hSocket )
+{
+    SocketReceiveBuffer * buffer = nullptr;
+    if ( mReceiveBuffers.removeAt(hSocket, buffer) )
+    {
+        delete buffer;
+    }
+}
+
+void DirectReceiveThread::_removeAllReceiveBuffers( void )
+{
+    MAPPOS pos = mReceiveBuffers.firstPosition();
+    while ( pos != nullptr )
+    {
+        delete mReceiveBuffers.valueAtPosition(pos);
+        pos = mReceiveBuffers.nextPosition(pos);
+    }
+
+    mReceiveBuffers.removeAll();
+}
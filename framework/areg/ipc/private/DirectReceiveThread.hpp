@@ -0,0 +1,126 @@
+#pragma once
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/private/DirectReceiveThread.hpp
+ * \ingroup     AREG Asynchronous Event-Driven Communication Framework
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the thread receiving messages of direct connections.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/component/DispatcherThread.hpp"
+#include "areg/base/TEHashMap.hpp"
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+class IERemoteServiceHandler;
+class DirectConnection;
+class SocketReceiveBuffer;
+
+//////////////////////////////////////////////////////////////////////////
+// DirectReceiveThread class declaration.
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The thread accepting direct connections of other applications and
+ *          receiving their messages. Only the messages of remote calls are
+ *          processed, all other messages are passed via routing service.
+ *          When direct connection fails, it is closed without notifications,
+ *          the remote services are disconnected only by routing service.
+ **/
+class DirectReceiveThread   : public    DispatcherThread
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The map of accepted socket and its receive buffer.
+     **/
+    using ImplMapSocketToBuffer = TEHashMapImpl<SOCKETHANDLE, SocketReceiveBuffer *>;
+    using MapSocketToBuffer     = TEHashMap<SOCKETHANDLE, SocketReceiveBuffer *, SOCKETHANDLE, SocketReceiveBuffer *, ImplMapSocketToBuffer>;
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Initializes remote servicing handler and direct connection objects.
+     * \param   remoteService   The instance of remote servicing handler to process messages.
+     * \param   connection      The instance of direct connection object to accept connections.
+     **/
+    DirectReceiveThread( IERemoteServiceHandler & remoteService, DirectConnection & connection );
+    /**
+     * \brief   Destructor
+     **/
+    virtual ~DirectReceiveThread( void ) = default;
+
+protected:
+/************************************************************************/
+// DispatcherThread overrides
+/************************************************************************/
+
+    /**
+     * \brief	Triggered when dispatcher starts running.
+     *          In this function runs main dispatching loop.
+     *          Events are picked and dispatched here.
+     *          Override if logic should be changed.
+     * \return	Returns true if Exit Event is signaled.
+     **/
+    virtual bool runDispatcher( void ) override;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Returns the receive buffer of accepted socket. Creates new buffer if it does not exist.
+     * \param   hSocket     The handle of accepted socket.
+     **/
+    SocketReceiveBuffer & _getReceiveBuffer( SOCKETHANDLE hSocket );
+
+    /**
+     * \brief   Removes and deletes the receive buffer of accepted socket.
+     * \param   hSocket     The handle of accepted socket.
+     **/
+    void _removeReceiveBuffer( SOCKETHANDLE hSocket );
+
+    /**
+     * \brief   Removes and deletes the receive buffers of all sockets.
+     **/
+    void _removeAllReceiveBuffers( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The instance of remote servicing handler to process messages.
+     **/
+    IERemoteServiceHandler &    mRemoteService;
+    /**
+     * \brief   The instance of direct connection object.
+     **/
+    DirectConnection &          mConnection;
+    /**
+     * \brief   The receive buffers of accepted sockets.
+     **/
+    MapSocketToBuffer           mReceiveBuffers;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    DirectReceiveThread( void ) = delete;
+    DECLARE_NOCOPY_NOMOVE( DirectReceiveThread );
+};
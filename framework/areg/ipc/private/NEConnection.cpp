@@ -179,6 +179,26 @@ AREG_API const NEMemory::sRemoteMessage     NEConnection::MessageRegisterNotify
     , {static_cast<char>(0)}
 };
 
+AREG_API const NEMemory::sRemoteMessage     NEConnection::MessageCongestionNotify  =
+{
+    {
+        {   /*rbhBufHeader*/
+              sizeof(NEMemory::sRemoteMessage)          // biBufSize
+            , sizeof(unsigned char)                     // biLength
+            , sizeof(NEMemory::sRemoteMessageHeader)    // biOffset
+            , NEMemory::eBufferType::BufferRemote       // biBufType
+            , 0                                         // biUsed
+        }
+        , NEMemory::INVALID_VALUE                       // rbhTarget
+        , NEMemory::INVALID_VALUE                       // rbhChecksum
+        , NEService::COOKIE_ROUTER                      // rbhSource
+        , static_cast<uint32_t>(NEService::eFuncIdRange::ServiceRouterNotifyCongestion) // rbhMessageId
+        , NEMemory::MESSAGE_SUCCESS                     // rbhResult
+        , NEService::SEQUENCE_NUMBER_NOTIFY             // rbhSequenceNr
+    }
+    , {static_cast<char>(0)}
+};
+
 inline static bool _isValidSource( ITEM_ID client )
 {
     return ((client != NEService::COOKIE_UNKNOWN) && client != (NEService::COOKIE_LOCAL));
@@ -209,7 +229,7 @@ inline static void _createRegisterRequest( RemoteMessage & out_msgRegister, ITEM
     }
 }
 
-inline static void _createRegistereNotify( RemoteMessage & out_msgNotify, ITEM_ID target, NEService::eServiceRequestType reqType, const StubAddress & addrService )
+inline static void _createRegistereNotify( RemoteMessage & out_msgNotify, ITEM_ID target, NEService::eServiceRequestType reqType, const StubAddress & addrService, const NESocket::SocketAddress * addrDirect = nullptr )
 {
     if ( out_msgNotify.initMessage( NEConnection::MessageRegisterNotify.rbHeader ) != nullptr )
     {
@@ -217,11 +237,17 @@ inline static void _createRegistereNotify( RemoteMessage & out_msgNotify, ITEM_I
         out_msgNotify.setSequenceNr( NEService::SEQUENCE_NUMBER_NOTIFY );
         out_msgNotify << reqType;
         out_msgNotify << addrService;
+        if ( addrDirect != nullptr )
+        {
+            out_msgNotify << addrDirect->getHostAddress();
+            out_msgNotify << addrDirect->getHostPort();
+        }
+
         out_msgNotify.bufferCompletionFix();
     }
 }
 
-inline static void _createRegistereNotify( RemoteMessage & out_msgNotify, ITEM_ID target, NEService::eServiceRequestType reqType, const ProxyAddress & addrService )
+inline static void _createRegistereNotify( RemoteMessage & out_msgNotify, ITEM_ID target, NEService::eServiceRequestType reqType, const ProxyAddress & addrService, const NESocket::SocketAddress * addrDirect = nullptr )
 {
     if ( out_msgNotify.initMessage( NEConnection::MessageRegisterNotify.rbHeader ) != nullptr )
     {
@@ -229,10 +255,27 @@ inline static void _createRegistereNotify( RemoteMessage & out_msgNotify, ITEM_I
         out_msgNotify.setSequenceNr( NEService::SEQUENCE_NUMBER_NOTIFY );
         out_msgNotify << reqType;
         out_msgNotify << addrService;
+        if ( addrDirect != nullptr )
+        {
+            out_msgNotify << addrDirect->getHostAddress();
+            out_msgNotify << addrDirect->getHostPort();
+        }
+
         out_msgNotify.bufferCompletionFix();
     }
 }
 
+AREG_API String NEConnection::getWorkerThreadName( const std::string_view & baseName, int worker )
+{
+    String result( baseName.data() );
+    if ( worker != 0 )
+    {
+        result += String().formatString( "_%d", worker );
+    }
+
+    return result;
+}
+
 AREG_API RemoteMessage NEConnection::createRouterRegisterService( const StubAddress & stub, ITEM_ID source )
 {
     RemoteMessage msgResult;
@@ -334,25 +377,25 @@ AREG_API bool NEConnection::isMessageRegisterService(const RemoteMessage & msgRe
     return result;
 }
 
-AREG_API RemoteMessage NEConnection::createServiceRegisteredNotification(const StubAddress & stub, ITEM_ID target)
+AREG_API RemoteMessage NEConnection::createServiceRegisteredNotification(const StubAddress & stub, ITEM_ID target, const NESocket::SocketAddress & addrDirect)
 {
     RemoteMessage msgResult;
     if ( stub.isServicePublic() && _isValidSource(target) )
     {
         StubAddress temp( stub );
-        _createRegistereNotify(msgResult, target, NEService::eServiceRequestType::RegisterStub, temp);
+        _createRegistereNotify(msgResult, target, NEService::eServiceRequestType::RegisterStub, temp, &addrDirect);
     }
 
     return msgResult;
 }
 
-AREG_API RemoteMessage NEConnection::createServiceClientRegisteredNotification(const ProxyAddress & proxy, ITEM_ID target)
+AREG_API RemoteMessage NEConnection::createServiceClientRegisteredNotification(const ProxyAddress & proxy, ITEM_ID target, const NESocket::SocketAddress & addrDirect)
 {
     RemoteMessage msgResult;
     if ( proxy.isServicePublic() && _isValidSource(target) )
     {
         ProxyAddress temp( proxy );
-        _createRegistereNotify(msgResult, target, NEService::eServiceRequestType::RegisterClient, temp);
+        _createRegistereNotify(msgResult, target, NEService::eServiceRequestType::RegisterClient, temp, &addrDirect);
     }
 
     return msgResult;
@@ -381,13 +424,16 @@ AREG_API RemoteMessage NEConnection::createServiceClientUnregisteredNotification
     return msgResult;
 }
 
-AREG_API RemoteMessage NEConnection::createConnectRequest(void)
+AREG_API RemoteMessage NEConnection::createConnectRequest(bool skipChecksum, const String & sharedMemory, unsigned short directPort)
 {
     RemoteMessage msgHelloServer;
     if ( msgHelloServer.initMessage( NEConnection::MessageHelloServer.rbHeader ) != nullptr )
     {
         msgHelloServer.setSource( NEService::SOURCE_UNKNOWN );
         msgHelloServer.setSequenceNr( NEService::SEQUENCE_NUMBER_NOTIFY );
+        msgHelloServer << skipChecksum;
+        msgHelloServer << sharedMemory;
+        msgHelloServer << directPort;
 
         msgHelloServer.bufferCompletionFix();
     }
@@ -410,7 +456,7 @@ AREG_API RemoteMessage NEConnection::createDisconnectRequest(ITEM_ID cookie)
     return msgBeyServer;
 }
 
-AREG_API RemoteMessage NEConnection::createConnectNotify( ITEM_ID cookie  )
+AREG_API RemoteMessage NEConnection::createConnectNotify( ITEM_ID cookie, bool skipChecksum, bool sharedMemory )
 {
     RemoteMessage msgNotifyConnect;
     if ( msgNotifyConnect.initMessage( NEConnection::MessageAcceptClient.rbHeader ) != nullptr )
@@ -420,8 +466,11 @@ AREG_API RemoteMessage NEConnection::createConnectNotify( ITEM_ID cookie  )
 
         msgNotifyConnect << NEService::eServiceConnection::ServiceConnected;
         msgNotifyConnect << cookie;
+        msgNotifyConnect << skipChecksum;
+        msgNotifyConnect << sharedMemory;
 
         msgNotifyConnect.bufferCompletionFix();
+        msgNotifyConnect.checksumMark();
     }
 
     return msgNotifyConnect;
@@ -444,6 +493,23 @@ AREG_API RemoteMessage NEConnection::createDisconnectNotify(ITEM_ID cookie)
     return msgNotifyDisconnect;
 }
 
+AREG_API RemoteMessage NEConnection::createCongestionNotify( ITEM_ID source, ITEM_ID target, bool congested )
+{
+    RemoteMessage msgNotifyCongestion;
+    if ( msgNotifyCongestion.initMessage( NEConnection::MessageCongestionNotify.rbHeader ) != nullptr )
+    {
+        msgNotifyCongestion.setTarget( source );
+        msgNotifyCongestion.setSequenceNr( NEService::SEQUENCE_NUMBER_NOTIFY );
+
+        msgNotifyCongestion << target;
+        msgNotifyCongestion << congested;
+
+        msgNotifyCongestion.bufferCompletionFix();
+    }
+
+    return msgNotifyCongestion;
+}
+
 AREG_API RemoteMessage NEConnection::createRejectNotify(ITEM_ID cookie)
 {
     RemoteMessage msgNotifyReject;
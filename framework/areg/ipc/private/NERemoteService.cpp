@@ -22,6 +22,10 @@ AREG_API const char * NERemoteService::getServiceConnectionTypeString(NERemoteSe
     {
         return NERemoteService::STR_CONNECTION_TYPE_TCPIP.data( );
     }
+    else if ( connectionType == NERemoteService::eServiceConnection::ConnectionUnix )
+    {
+        return NERemoteService::STR_CONNECTION_TYPE_UNIX.data( );
+    }
     else
     {
         return String::EmptyString.data( );
@@ -34,6 +38,10 @@ AREG_API NERemoteService::eServiceConnection NERemoteService::getServiceConnecti
     {
         return NERemoteService::eServiceConnection::ConnectionTcpip;
     }
+    else if ( NEString::compareStrings<char, char>(NERemoteService::STR_CONNECTION_TYPE_UNIX.data(), connectionType, NEString::COUNT_ALL, caseSensitive ) == 0)
+    {
+        return NERemoteService::eServiceConnection::ConnectionUnix;
+    }
     else
     {
         return NERemoteService::eServiceConnection::ConnectionUndefined;
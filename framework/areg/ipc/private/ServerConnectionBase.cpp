@@ -13,6 +13,13 @@
  * \brief       AREG Platform Server Connection class declaration.
  ************************************************************************/
 #include "areg/ipc/ServerConnectionBase.hpp"
+#include "areg/ipc/NEConnection.hpp"
+
+#include "areg/trace/GETrace.h"
+
+DEF_TRACE_SCOPE(areg_ipc_ServerConnectionBase_serverListen);
+DEF_TRACE_SCOPE(areg_ipc_ServerConnectionBase__createPollers);
+DEF_TRACE_SCOPE(areg_ipc_ServerConnectionBase__waitPollerEvent);
 
 ServerConnectionBase::ServerConnectionBase( void )
     : mServerSocket         ( )
@@ -20,8 +27,13 @@ ServerConnectionBase::ServerConnectionBase( void )
     , mAcceptedConnections  ( )
     , mCookieToSocket       ( )
     , mSocketToCookie       ( )
+    , mChecksumSkipped      ( )
+    , mSharedMemory         ( )
     , mMasterList           ( ServerConnectionBase::MASTER_LIST_SIZE )
     , mLock                 ( )
+    , mPollers              ( nullptr )
+    , mWorkerCount          ( 1 )
+    , mConnectionsVersion   ( 0 )
 {
 }
 
@@ -31,8 +43,13 @@ ServerConnectionBase::ServerConnectionBase(const char * hostName, unsigned short
     , mAcceptedConnections  ( )
     , mCookieToSocket       ( )
     , mSocketToCookie       ( )
+    , mChecksumSkipped      ( )
+    , mSharedMemory         ( )
     , mMasterList           ( ServerConnectionBase::MASTER_LIST_SIZE )
     , mLock                 ( )
+    , mPollers              ( nullptr )
+    , mWorkerCount          ( 1 )
+    , mConnectionsVersion   ( 0 )
 {
 }
 
@@ -42,43 +59,126 @@ ServerConnectionBase::ServerConnectionBase(const NESocket::SocketAddress & serve
     , mAcceptedConnections  ( )
     , mCookieToSocket       ( )
     , mSocketToCookie       ( )
+    , mChecksumSkipped      ( )
+    , mSharedMemory         ( )
     , mMasterList           ( ServerConnectionBase::MASTER_LIST_SIZE )
     , mLock                 ( )
+    , mPollers              ( nullptr )
+    , mWorkerCount          ( 1 )
+    , mConnectionsVersion   ( 0 )
+{
+}
+
+ServerConnectionBase::~ServerConnectionBase( void )
 {
+    _releasePollers();
+}
+
+void ServerConnectionBase::setWorkerCount( unsigned int count )
+{
+    Lock lock(mLock);
+    mWorkerCount = static_cast<int>(MACRO_MAX(1u, MACRO_MIN(count, NEConnection::MAXIMUM_SERVER_WORKERS)));
 }
 
 bool ServerConnectionBase::createSocket(const char * hostName, unsigned short portNr)
 {
     Lock lock(mLock);
-    return mServerSocket.createSocket(hostName, portNr);
+    bool result = mServerSocket.createSocket(hostName, portNr);
+    _createPollers();
+    return result;
 }
 
 bool ServerConnectionBase::createSocket(void)
 {
     Lock lock(mLock);
-    return mServerSocket.createSocket();
+    bool result = mServerSocket.createSocket();
+    _createPollers();
+    return result;
 }
 
 void ServerConnectionBase::closeSocket(void)
 {
     Lock lock(mLock);
+    for ( int i = 0; (mPollers != nullptr) && (i < mMasterList.getSize()); ++ i )
+    {
+        mPollers[_getSocketWorker(mMasterList[i])].removeSocket( mMasterList[i] );
+    }
+
     mMasterList.removeAll();
     mCookieToSocket.removeAll();
     mSocketToCookie.removeAll();
+    mChecksumSkipped.removeAll();
+    mSharedMemory.removeAll();
     mAcceptedConnections.removeAll();
     mCookieGenerator = static_cast<ITEM_ID>(NEService::eCookies::CookieFirstValid);
+    mConnectionsVersion.fetch_add( 1, std::memory_order_acq_rel );
 
     mServerSocket.closeSocket();
+    // the closed sockets are removed from the pollers, wake up the threads waiting for connection events.
+    for ( int i = 0; (mPollers != nullptr) && (i < mWorkerCount); ++ i )
+    {
+        mPollers[i].wakeUp();
+    }
 }
 
 bool ServerConnectionBase::serverListen(int maxQueueSize /*= NESocket::MAXIMUM_LISTEN_QUEUE_SIZE */)
 {
-    return mServerSocket.listenConnection(maxQueueSize);
+    TRACE_SCOPE(areg_ipc_ServerConnectionBase_serverListen);
+
+    bool result = mServerSocket.listenConnection(maxQueueSize);
+
+    if ( result && (mPollers != nullptr) )
+    {
+        Lock lock(mLock);
+        // the server socket is level-triggered, a single connection is accepted per event.
+        result = mPollers[0].addSocket(mServerSocket.getHandle(), false);
+        if ( result == false )
+        {
+            TRACE_ERR("Failed to register server socket in the poller, cannot accept connections");
+        }
+    }
+
+    return result;
+}
+
+SOCKETHANDLE ServerConnectionBase::waitForConnectionEvent(NESocket::SocketAddress & out_addrNewAccepted, int worker /*= 0*/)
+{
+    ASSERT((worker >= 0) && (worker < mWorkerCount));
+    return ( mPollers != nullptr ?
+                _waitPollerEvent(out_addrNewAccepted, worker) :
+                mServerSocket.waitConnectionEvent(out_addrNewAccepted, static_cast<const SOCKETHANDLE *>(mMasterList), mMasterList.getSize()) );
 }
 
-SOCKETHANDLE ServerConnectionBase::waitForConnectionEvent(NESocket::SocketAddress & out_addrNewAccepted)
+SOCKETHANDLE ServerConnectionBase::_waitPollerEvent( NESocket::SocketAddress & out_addrNewAccepted, int worker )
 {
-    return mServerSocket.waitConnectionEvent(out_addrNewAccepted, static_cast<const SOCKETHANDLE *>(mMasterList), mMasterList.getSize());
+    TRACE_SCOPE(areg_ipc_ServerConnectionBase__waitPollerEvent);
+
+    SocketPoller & poller= mPollers[worker];
+    SOCKETHANDLE result  = NESocket::InvalidSocketHandle;
+    SOCKETHANDLE hSocket = poller.waitSocketEvent();
+    while ( hSocket != NESocket::InvalidSocketHandle )
+    {
+        SOCKETHANDLE hServer = getSocketHandle();
+        ITEM_ID cookie       = getCookie(hSocket);
+        if ( hSocket == hServer )
+        {
+            result = NESocket::serverAcceptConnection(hServer, nullptr, 0, &out_addrNewAccepted);
+            // the events of closed socket with the same handle are not relevant anymore.
+            poller.dropReadySocket(result);
+        }
+        else if ( (cookie != NEService::COOKIE_UNKNOWN) && (getConnectionWorker(cookie) == worker) )
+        {
+            result = hSocket;
+        }
+        else
+        {
+            TRACE_DBG("Ignoring the event of socket [ %u ], which is already closed or handled by other worker", static_cast<unsigned int>(hSocket));
+        }
+
+        hSocket = result == NESocket::InvalidSocketHandle ? poller.waitSocketEvent() : NESocket::InvalidSocketHandle;
+    }
+
+    return result;
 }
 
 bool ServerConnectionBase::acceptConnection(SocketAccepted & clientConnection)
@@ -105,6 +205,13 @@ bool ServerConnectionBase::acceptConnection(SocketAccepted & clientConnection)
                 mCookieToSocket.setAt(cookie, hSocket);
                 mSocketToCookie.setAt(hSocket, cookie);
                 mMasterList.add( hSocket );
+                if ( mPollers != nullptr )
+                {
+                    mPollers[getConnectionWorker(cookie)].addSocket( hSocket, true );
+                }
+
+                mConnectionsVersion.fetch_add( 1, std::memory_order_acq_rel );
+
                 result = true;
             }
             else
@@ -126,12 +233,22 @@ void ServerConnectionBase::closeConnection(SocketAccepted & clientConnection)
     SOCKETHANDLE hSocket= clientConnection.getHandle();
     MAPPOS pos = mSocketToCookie.find(hSocket);
     ITEM_ID cookie = pos != nullptr ? mSocketToCookie.valueAtPosition(pos) : NEService::COOKIE_UNKNOWN;
+    if ( (pos != nullptr) && (mPollers != nullptr) )
+    {
+        mPollers[getConnectionWorker(cookie)].removeSocket(hSocket);
+    }
 
     mSocketToCookie.removeAt(hSocket);
+    mChecksumSkipped.removeAt(hSocket);
+    mSharedMemory.removeAt(hSocket);
     mCookieToSocket.removeAt(cookie);
     mAcceptedConnections.removeAt(hSocket);
     mMasterList.remove(hSocket, 0);
+    mConnectionsVersion.fetch_add( 1, std::memory_order_acq_rel );
 
+    // the copies of socket cached by other threads keep the handle open, shut down the connection.
+    clientConnection.disableSend();
+    clientConnection.disableReceive();
     clientConnection.closeSocket();
 }
 
@@ -145,11 +262,65 @@ void ServerConnectionBase::closeConnection( ITEM_ID cookie )
         SOCKETHANDLE hSocket= mCookieToSocket.removePosition( posCookie );
         MAPPOS posClient    = mAcceptedConnections.find( hSocket );
         mSocketToCookie.removeAt( hSocket );
+        mChecksumSkipped.removeAt( hSocket );
+        mSharedMemory.removeAt( hSocket );
         mMasterList.remove( hSocket, 0 );
+        if ( mPollers != nullptr )
+        {
+            mPollers[getConnectionWorker(cookie)].removeSocket( hSocket );
+        }
+
+        mConnectionsVersion.fetch_add( 1, std::memory_order_acq_rel );
         if (posClient != nullptr)
         {
             SocketAccepted client(mAcceptedConnections.removePosition(posClient));
+            client.disableSend( );
+            client.disableReceive( );
             client.closeSocket( );
         }
     }
 }
+
+void ServerConnectionBase::_createPollers( void )
+{
+    TRACE_SCOPE(areg_ipc_ServerConnectionBase__createPollers);
+
+    _releasePollers();
+
+#if defined(AREG_SOCKET_EPOLL)
+
+    if ( mServerSocket.isValid() )
+    {
+        mPollers = DEBUG_NEW SocketPoller[static_cast<uint32_t>(mWorkerCount)];
+        bool created = (mPollers != nullptr);
+        for ( int i = 0; created && (i < mWorkerCount); ++ i )
+        {
+            created = mPollers[i].create();
+        }
+
+        if ( created == false )
+        {
+            TRACE_WARN("Failed to create socket pollers, falling back to select");
+            _releasePollers();
+        }
+    }
+
+#endif  // defined(AREG_SOCKET_EPOLL)
+
+    if ( mPollers == nullptr )
+    {
+        // without poller all connection events are waited by one thread.
+        mWorkerCount = 1;
+    }
+
+    TRACE_DBG("The server connection has [ %d ] I/O worker(s), the pollers are [ %s ]", mWorkerCount, mPollers != nullptr ? "ENABLED" : "DISABLED");
+}
+
+void ServerConnectionBase::_releasePollers( void )
+{
+    if ( mPollers != nullptr )
+    {
+        delete [] mPollers;
+        mPollers = nullptr;
+    }
+}
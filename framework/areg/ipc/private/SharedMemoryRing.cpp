@@ -0,0 +1,309 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/private/SharedMemoryRing.cpp
+ * \ingroup     AREG Asynchronous Event-Driven Communication Framework
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the shared memory rings of local connection
+ ************************************************************************/
+
+#include "areg/ipc/SharedMemoryRing.hpp"
+#include "areg/base/RemoteMessage.hpp"
+#include "areg/base/NEMemory.hpp"
+#include "areg/base/Process.hpp"
+
+#include "areg/trace/GETrace.h"
+
+DEF_TRACE_SCOPE(areg_ipc_SharedMemoryRing_createRing);
+DEF_TRACE_SCOPE(areg_ipc_SharedMemoryRing_openRing);
+
+namespace
+{
+    //!< The number of attempts to create the segment with unique name.
+    constexpr int           CREATE_ATTEMPTS     { 8 };
+
+    //!< The alignment of records in the ring.
+    constexpr unsigned int  RECORD_ALIGNMENT    { 8 };
+
+    //!< The size of message header in the record.
+    constexpr unsigned int  RECORD_HEADER_SIZE  { static_cast<unsigned int>(sizeof(NEMemory::sRemoteMessageHeader)) };
+
+    //!< Returns the size of data, which follows the header of message.
+    inline unsigned int _messageDataSize( const NEMemory::sRemoteMessageHeader & header )
+    {
+        return (header.rbhBufHeader.biUsed > 0 ? header.rbhBufHeader.biLength : 0);
+    }
+
+    //!< Returns the aligned size of record of message.
+    inline unsigned int _recordSize( unsigned int dataSize )
+    {
+        return ((RECORD_HEADER_SIZE + dataSize + RECORD_ALIGNMENT - 1) & ~(RECORD_ALIGNMENT - 1));
+    }
+
+    //!< Returns the ring size rounded up to the power of 2 within valid range.
+    inline unsigned int _normalizeRingSize( unsigned int ringSize )
+    {
+        unsigned int result = SharedMemoryRing::MINIMUM_RING_SIZE;
+        while ( (result < ringSize) && (result < SharedMemoryRing::MAXIMUM_RING_SIZE) )
+        {
+            result <<= 1;
+        }
+
+        return result;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// SharedMemoryRing class implementation
+//////////////////////////////////////////////////////////////////////////
+
+SharedMemoryRing::SharedMemoryRing( void )
+    : mName         ( )
+    , mSegment      ( nullptr )
+    , mSegmentSize  ( 0 )
+    , mRingSize     ( 0 )
+    , mWriteControl ( nullptr )
+    , mWriteData    ( nullptr )
+    , mReadControl  ( nullptr )
+    , mReadData     ( nullptr )
+    , mMapHandle    ( nullptr )
+    , mUnlinkName   ( false )
+    , mLock         ( )
+{
+}
+
+SharedMemoryRing::~SharedMemoryRing( void )
+{
+    closeRing( );
+}
+
+bool SharedMemoryRing::createRing( unsigned int ringSize )
+{
+    TRACE_SCOPE(areg_ipc_SharedMemoryRing_createRing);
+
+    static std::atomic_uint _counter{ 0 };
+
+    closeRing( );
+
+    unsigned int size       = _normalizeRingSize( ringSize );
+    unsigned int segSize    = static_cast<unsigned int>(sizeof(sSegmentHeader)) + 2 * size;
+    for ( int i = 0; (mSegment == nullptr) && (i < CREATE_ATTEMPTS); ++ i )
+    {
+        char name[64];
+        String::formatString( name, 64, "areg_%u_%u"
+                            , static_cast<unsigned int>(Process::getInstance().getId())
+                            , _counter.fetch_add(1, std::memory_order_relaxed) );
+
+        mSegment = _osCreateSegment( name, segSize );
+        if ( mSegment != nullptr )
+        {
+            mName       = name;
+            mSegmentSize= segSize;
+            mRingSize   = size;
+            mUnlinkName = true;
+
+            sSegmentHeader * header = reinterpret_cast<sSegmentHeader *>(mSegment);
+            header->shRingSize      = size;
+            for ( sRingControl & ring : header->shRings )
+            {
+                ring.rcWrite.store( 0, std::memory_order_relaxed );
+                ring.rcRead.store( 0, std::memory_order_relaxed );
+            }
+
+            // the magic number is set last, the segment is valid when it is set.
+            std::atomic_thread_fence( std::memory_order_release );
+            header->shMagic         = SEGMENT_MAGIC;
+
+            _initRings( true );
+            TRACE_DBG("Created shared memory ring [ %s ] of [ %u ] bytes per direction", name, size);
+        }
+    }
+
+    if ( mSegment == nullptr )
+    {
+        TRACE_ERR("Failed to create shared memory ring of [ %u ] bytes", size);
+    }
+
+    return (mSegment != nullptr);
+}
+
+bool SharedMemoryRing::openRing( const String & ringName )
+{
+    TRACE_SCOPE(areg_ipc_SharedMemoryRing_openRing);
+
+    closeRing( );
+
+    if ( ringName.isEmpty( ) == false )
+    {
+        unsigned int segSize = 0;
+        mSegment = _osOpenSegment( ringName.getString( ), segSize );
+        if ( mSegment != nullptr )
+        {
+            const sSegmentHeader * header = reinterpret_cast<const sSegmentHeader *>(mSegment);
+            unsigned int size = segSize >= sizeof(sSegmentHeader) ? header->shRingSize : 0;
+            if ( (segSize >= sizeof(sSegmentHeader)) && (header->shMagic == SEGMENT_MAGIC) &&
+                 (size == _normalizeRingSize(size)) && (segSize >= static_cast<unsigned int>(sizeof(sSegmentHeader)) + 2 * size) )
+            {
+                std::atomic_thread_fence( std::memory_order_acquire );
+                mName       = ringName;
+                mSegmentSize= segSize;
+                mRingSize   = size;
+                mUnlinkName = false;
+                _initRings( false );
+                TRACE_DBG("Opened shared memory ring [ %s ] of [ %u ] bytes per direction", ringName.getString(), size);
+            }
+            else
+            {
+                TRACE_ERR("The shared memory ring [ %s ] is not valid, closing", ringName.getString());
+                mSegmentSize = segSize;
+                _osCloseSegment( );
+                mSegment     = nullptr;
+                mSegmentSize = 0;
+            }
+        }
+        else
+        {
+            TRACE_ERR("Failed to open shared memory ring [ %s ]", ringName.getString());
+        }
+    }
+
+    return (mSegment != nullptr);
+}
+
+void SharedMemoryRing::closeRing( void )
+{
+    if ( mSegment != nullptr )
+    {
+        unlinkRing( );
+        _osCloseSegment( );
+    }
+
+    mName.clear( );
+    mSegment        = nullptr;
+    mSegmentSize    = 0;
+    mRingSize       = 0;
+    mWriteControl   = nullptr;
+    mWriteData      = nullptr;
+    mReadControl    = nullptr;
+    mReadData       = nullptr;
+    mMapHandle      = nullptr;
+}
+
+void SharedMemoryRing::unlinkRing( void )
+{
+    if ( mUnlinkName )
+    {
+        mUnlinkName = false;
+        _osUnlinkSegment( mName.getString( ) );
+    }
+}
+
+bool SharedMemoryRing::isBulkMessage( const RemoteMessage & message )
+{
+    const NEMemory::sRemoteMessageHeader & header = reinterpret_cast<const NEMemory::sRemoteMessageHeader &>(*message.getByteBuffer());
+    return (header.rbhBufHeader.biUsed >= SharedMemoryRing::MINIMUM_DATA_SIZE);
+}
+
+bool SharedMemoryRing::writeMessage( const RemoteMessage & message )
+{
+    bool result = false;
+    if ( mSegment != nullptr )
+    {
+        const NEMemory::sRemoteMessageHeader & header = reinterpret_cast<const NEMemory::sRemoteMessageHeader &>(*message.getByteBuffer());
+        unsigned int sizeData   = _messageDataSize( header );
+        unsigned int sizeRecord = _recordSize( sizeData );
+
+        Lock lock( mLock );
+
+        unsigned int write  = mWriteControl->rcWrite.load( std::memory_order_relaxed );
+        unsigned int read   = mWriteControl->rcRead.load( std::memory_order_acquire );
+        if ( sizeRecord <= mRingSize - (write - read) )
+        {
+            _copyIn( write, &header, RECORD_HEADER_SIZE );
+            if ( sizeData > 0 )
+            {
+                _copyIn( write + RECORD_HEADER_SIZE, message.getBuffer( ), sizeData );
+            }
+
+            mWriteControl->rcWrite.store( write + sizeRecord, std::memory_order_release );
+            result = true;
+        }
+    }
+
+    return result;
+}
+
+bool SharedMemoryRing::readMessage( RemoteMessage & out_message )
+{
+    bool result = false;
+    if ( mSegment != nullptr )
+    {
+        unsigned int read   = mReadControl->rcRead.load( std::memory_order_relaxed );
+        unsigned int write  = mReadControl->rcWrite.load( std::memory_order_acquire );
+        unsigned int used   = write - read;
+        if ( used >= RECORD_HEADER_SIZE )
+        {
+            NEMemory::sRemoteMessageHeader header;
+            _copyOut( read, &header, RECORD_HEADER_SIZE );
+            unsigned int sizeData   = _messageDataSize( header );
+            unsigned int sizeRecord = _recordSize( sizeData );
+            if ( used >= sizeRecord )
+            {
+                unsigned char * buffer = out_message.initMessage( header );
+                if ( (buffer != nullptr) && (sizeData > 0) )
+                {
+                    const NEMemory::sRemoteMessageHeader & msgHeader = reinterpret_cast<const NEMemory::sRemoteMessageHeader &>(*static_cast<const RemoteMessage &>(out_message).getByteBuffer());
+                    _copyOut( read + RECORD_HEADER_SIZE, buffer, MACRO_MIN(sizeData, msgHeader.rbhBufHeader.biLength) );
+                }
+
+                mReadControl->rcRead.store( read + sizeRecord, std::memory_order_release );
+                result = (buffer != nullptr);
+            }
+        }
+    }
+
+    return result;
+}
+
+void SharedMemoryRing::_initRings( bool isCreator )
+{
+    sSegmentHeader * header = reinterpret_cast<sSegmentHeader *>(mSegment);
+    unsigned char * data    = mSegment + sizeof(sSegmentHeader);
+
+    int writeIndex  = isCreator ? 0 : 1;
+    int readIndex   = isCreator ? 1 : 0;
+    mWriteControl   = &header->shRings[writeIndex];
+    mWriteData      = data + writeIndex * mRingSize;
+    mReadControl    = &header->shRings[readIndex];
+    mReadData       = data + readIndex * mRingSize;
+}
+
+inline void SharedMemoryRing::_copyIn( unsigned int position, const void * data, unsigned int length )
+{
+    unsigned int offset = position & (mRingSize - 1);
+    unsigned int first  = MACRO_MIN(length, mRingSize - offset);
+    const unsigned char * src = reinterpret_cast<const unsigned char *>(data);
+    NEMemory::memCopy( mWriteData + offset, static_cast<int>(first), src, static_cast<int>(first) );
+    if ( first < length )
+    {
+        NEMemory::memCopy( mWriteData, static_cast<int>(length - first), src + first, static_cast<int>(length - first) );
+    }
+}
+
+inline void SharedMemoryRing::_copyOut( unsigned int position, void * data, unsigned int length ) const
+{
+    unsigned int offset = position & (mRingSize - 1);
+    unsigned int first  = MACRO_MIN(length, mRingSize - offset);
+    unsigned char * dst = reinterpret_cast<unsigned char *>(data);
+    NEMemory::memCopy( dst, static_cast<int>(first), mReadData + offset, static_cast<int>(first) );
+    if ( first < length )
+    {
+        NEMemory::memCopy( dst + first, static_cast<int>(length - first), mReadData, static_cast<int>(length - first) );
+    }
+}
@@ -14,16 +14,22 @@
  ************************************************************************/
 
 #include "areg/ipc/SocketConnectionBase.hpp"
+#include "areg/ipc/SocketReceiveBuffer.hpp"
+#include "areg/ipc/SharedMemoryRing.hpp"
 #include "areg/base/Socket.hpp"
 #include "areg/base/RemoteMessage.hpp"
 #include "areg/base/NEMemory.hpp"
+#include "areg/component/NEService.hpp"
 
 #include "areg/trace/GETrace.h"
 
 DEF_TRACE_SCOPE(areg_ipc_SocketConnectionBase_sendMessage);
+DEF_TRACE_SCOPE(areg_ipc_SocketConnectionBase_sendMessages);
 DEF_TRACE_SCOPE(areg_ipc_SocketConnectionBase_receiveMessage);
+DEF_TRACE_SCOPE(areg_ipc_SocketConnectionBase_receiveMessages);
+DEF_TRACE_SCOPE(areg_ipc_SocketConnectionBase_receivePendingMessages);
 
-int SocketConnectionBase::sendMessage(const RemoteMessage & in_message, const Socket & clientSocket) const
+int SocketConnectionBase::sendMessage(const RemoteMessage & in_message, const Socket & clientSocket, bool skipChecksum, SharedMemoryRing * sharedMemory /*= nullptr*/) const
 {
     TRACE_SCOPE(areg_ipc_SocketConnectionBase_sendMessage);
 
@@ -44,20 +50,24 @@ int SocketConnectionBase::sendMessage(const RemoteMessage & in_message, const So
                         , buffer.rbhBufHeader.biLength
                         , buffer.rbhChecksum);
 
-        TRACE_DBG("Sending message [ %p ] of [ %d ] bytes of header data, follow data is [ ] bytes."
-                            , in_message.getMessageId()
-                            , sizeof(NEMemory::sRemoteMessageHeader)
+        TRACE_DBG("Sending message [ %p ] of [ %d ] bytes of header data, follow data is [ %u ] bytes."
+                            , static_cast<id_type>(in_message.getMessageId())
+                            , static_cast<int>(sizeof(NEMemory::sRemoteMessageHeader))
                             , buffer.rbhBufHeader.biUsed);
-        result = clientSocket.sendData( reinterpret_cast<const unsigned char *>(&buffer), sizeof(NEMemory::sRemoteMessageHeader) );
-        if ((result == sizeof(NEMemory::sRemoteMessageHeader)) && (buffer.rbhBufHeader.biUsed != 0))
+
+        // send the header and aligned length of data with single call.
+        NESocket::sSocketBuffer listBuffers[2];
+        NEMemory::sRemoteMessageHeader header;
+        int count = _setMessageBuffers( in_message, listBuffers, header, skipChecksum, sharedMemory );
+        int length= listBuffers[0].sbLength + (count > 1 ? listBuffers[1].sbLength : 0);
+        result = clientSocket.sendDataVector( listBuffers, count );
+        if ( (result >= 0) && (result < length) )
         {
-            ASSERT(buffer.rbhBufHeader.biLength >= buffer.rbhBufHeader.biUsed);
-            // send the aligned length.
-            result += clientSocket.sendData(in_message.getBuffer(), static_cast<int>(buffer.rbhBufHeader.biLength));
-            TRACE_DBG("Sent [ %d ] bytes of aligned data, used size [ %d ]", buffer.rbhBufHeader.biLength, buffer.rbhBufHeader.biUsed);
+            TRACE_ERR("Failed to send message [ %p ], sent [ %d ] bytes of [ %d ]", static_cast<id_type>(in_message.getMessageId()), result, length);
+            result = -1;
         }
 
-        TRACE_DBG("Sent [ %d ] bytes of data. The remote buffer size is [ %u ], checksum [ %u ]", result, buffer.rbhBufHeader.biBufSize, buffer.rbhChecksum);
+        TRACE_DBG("Sent [ %d ] bytes of data. The remote buffer size is [ %u ], checksum is [ %s ]", result, buffer.rbhBufHeader.biBufSize, skipChecksum ? "SKIPPED" : "CALCULATED");
     }
     else
     {
@@ -67,6 +77,119 @@ int SocketConnectionBase::sendMessage(const RemoteMessage & in_message, const So
     return result;
 }
 
+int SocketConnectionBase::sendMessages( const RemoteMessage * const * listMessages, int count, const Socket & clientSocket, bool skipChecksum, SharedMemoryRing * sharedMemory /*= nullptr*/ ) const
+{
+    TRACE_SCOPE(areg_ipc_SocketConnectionBase_sendMessages);
+
+    int result = -1;
+    if ( clientSocket.isValid() )
+    {
+        TRACE_DBG("Sending [ %d ] messages via socket [ %u ] to address [ %s : %d ]"
+                        , count
+                        , static_cast<unsigned int>(clientSocket.getHandle())
+                        , clientSocket.getAddress().getHostAddress().getString()
+                        , clientSocket.getAddress().getHostPort());
+
+        result = 0;
+        NESocket::sSocketBuffer listBuffers[NESocket::MAXIMUM_SEND_BUFFERS];
+        // every message has at least one buffer, there are no more headers than buffers.
+        NEMemory::sRemoteMessageHeader listHeaders[NESocket::MAXIMUM_SEND_BUFFERS];
+        int listLengths[NESocket::MAXIMUM_SEND_BUFFERS];
+        int entries = 0;
+        int headers = 0;
+        bool failed = false;
+        for ( int i = 0; (i < count) && (failed == false); ++ i )
+        {
+            ASSERT( listMessages[i] != nullptr );
+            int added = _setMessageBuffers( *listMessages[i], listBuffers + entries, listHeaders[headers], skipChecksum, sharedMemory );
+            listLengths[headers ++] = listBuffers[entries].sbLength + (added > 1 ? listBuffers[entries + 1].sbLength : 0);
+            entries += added;
+            if ( (entries > NESocket::MAXIMUM_SEND_BUFFERS - 2) || (i == count - 1) )
+            {
+                // count the completely sent messages, the rest are not delivered if failed.
+                int sent = clientSocket.sendDataVector( listBuffers, entries );
+                for ( int j = 0; j < headers; ++ j )
+                {
+                    if ( sent >= listLengths[j] )
+                    {
+                        sent -= listLengths[j];
+                        ++ result;
+                    }
+                    else
+                    {
+                        failed = true;
+                        break;
+                    }
+                }
+
+                entries  = 0;
+                headers  = 0;
+            }
+        }
+
+        TRACE_DBG("Sent [ %d ] of [ %d ] messages", result, count);
+    }
+    else
+    {
+        TRACE_ERR("The socket is invalid, cannot send [ %d ] messages", count);
+    }
+
+    return result;
+}
+
+unsigned int SocketConnectionBase::prepareMessage( const RemoteMessage & in_message, NEMemory::sRemoteMessageHeader & out_header, bool skipChecksum, SharedMemoryRing * sharedMemory /*= nullptr*/ ) const
+{
+    NESocket::sSocketBuffer listBuffers[2];
+    int count = _setMessageBuffers( in_message, listBuffers, out_header, skipChecksum, sharedMemory );
+    if ( listBuffers[0].sbData != reinterpret_cast<const unsigned char *>(&out_header) )
+    {
+        // the header of message is sent as it is.
+        out_header = reinterpret_cast<const NEMemory::sRemoteMessageHeader &>( *listBuffers[0].sbData );
+    }
+
+    return static_cast<unsigned int>(listBuffers[0].sbLength) + (count > 1 ? static_cast<unsigned int>(listBuffers[1].sbLength) : 0u);
+}
+
+int SocketConnectionBase::_setMessageBuffers( const RemoteMessage & in_message, NESocket::sSocketBuffer * out_buffers, NEMemory::sRemoteMessageHeader & out_header, bool skipChecksum, SharedMemoryRing * sharedMemory )
+{
+    const NEMemory::sRemoteMessageHeader & buffer = reinterpret_cast<const NEMemory::sRemoteMessageHeader &>( *in_message.getByteBuffer() );
+    if ( (sharedMemory != nullptr) && SharedMemoryRing::isBulkMessage(in_message) && sharedMemory->writeMessage(in_message) )
+    {
+        // the message is in the ring, send only the notification without data.
+        out_header                          = buffer;
+        out_header.rbhMessageId             = static_cast<unsigned int>(NEService::eFuncIdRange::ServiceRouterSharedData);
+        out_header.rbhBufHeader.biLength    = 0;
+        out_header.rbhBufHeader.biUsed      = 0;
+        out_buffers[0].sbData   = reinterpret_cast<const unsigned char *>(&out_header);
+        out_buffers[0].sbLength = static_cast<int>(sizeof(NEMemory::sRemoteMessageHeader));
+        return 1;
+    }
+    else if ( skipChecksum )
+    {
+        out_buffers[0].sbData   = reinterpret_cast<const unsigned char *>(&buffer);
+    }
+    else
+    {
+        out_header              = buffer;
+        out_header.rbhChecksum  = in_message.checksumCalculate( );
+        out_buffers[0].sbData   = reinterpret_cast<const unsigned char *>(&out_header);
+    }
+
+    out_buffers[0].sbLength = static_cast<int>(sizeof(NEMemory::sRemoteMessageHeader));
+
+    int result = 1;
+    if ( buffer.rbhBufHeader.biUsed != 0 )
+    {
+        ASSERT(buffer.rbhBufHeader.biLength >= buffer.rbhBufHeader.biUsed);
+        // send the aligned length.
+        out_buffers[1].sbData   = in_message.getBuffer();
+        out_buffers[1].sbLength = static_cast<int>(buffer.rbhBufHeader.biLength);
+        ++ result;
+    }
+
+    return result;
+}
+
 int SocketConnectionBase::receiveMessage(RemoteMessage & out_message, const Socket & clientSocket) const
 {
     TRACE_SCOPE(areg_ipc_SocketConnectionBase_receiveMessage);
@@ -122,3 +245,47 @@ int SocketConnectionBase::receiveMessage(RemoteMessage & out_message, const Sock
 
     return result;
 }
+
+int SocketConnectionBase::receiveMessages( SocketReceiveBuffer & recvBuffer, const Socket & clientSocket ) const
+{
+    TRACE_SCOPE(areg_ipc_SocketConnectionBase_receiveMessages);
+
+    int result = -1;
+    if ( clientSocket.isValid() && clientSocket.isAlive() )
+    {
+        result = recvBuffer.receiveData( clientSocket );
+        if ( result > 0 )
+        {
+            TRACE_DBG("Received [ %d ] bytes of data via socket [ %u ]", result, static_cast<unsigned int>(clientSocket.getHandle()));
+        }
+        else
+        {
+            TRACE_WARN("Failed to receive remote message data. Probably the connection is closed, result [ %d ].", result);
+            recvBuffer.reset();
+        }
+    }
+
+    return result;
+}
+
+int SocketConnectionBase::receivePendingMessages( SocketReceiveBuffer & recvBuffer, const Socket & clientSocket ) const
+{
+    TRACE_SCOPE(areg_ipc_SocketConnectionBase_receivePendingMessages);
+
+    int result = -1;
+    if ( clientSocket.isValid() )
+    {
+        result = recvBuffer.receivePendingData( clientSocket );
+        if ( result > 0 )
+        {
+            TRACE_DBG("Received [ %d ] bytes of pending data via socket [ %u ]", result, static_cast<unsigned int>(clientSocket.getHandle()));
+        }
+        else if ( result < 0 )
+        {
+            TRACE_WARN("Failed to receive pending data. Probably the connection is closed, result [ %d ].", result);
+            recvBuffer.reset();
+        }
+    }
+
+    return result;
+}
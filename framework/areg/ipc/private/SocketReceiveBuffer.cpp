@@ -0,0 +1,218 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/private/SocketReceiveBuffer.cpp
+ * \ingroup     AREG Asynchronous Event-Driven Communication Framework
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the receive buffer of socket connection.
+ ************************************************************************/
+
+#include "areg/ipc/SocketReceiveBuffer.hpp"
+#include "areg/ipc/SharedMemoryRing.hpp"
+#include "areg/base/Socket.hpp"
+#include "areg/base/NEMemory.hpp"
+#include "areg/component/NEService.hpp"
+
+#include "areg/trace/GETrace.h"
+
+DEF_TRACE_SCOPE(areg_ipc_SocketReceiveBuffer_extractMessage);
+DEF_TRACE_SCOPE(areg_ipc_SocketReceiveBuffer__checkMessage);
+
+SocketReceiveBuffer::SocketReceiveBuffer( unsigned int bufferSize /*= SocketReceiveBuffer::DEFAULT_BUFFER_SIZE*/ )
+    : mBuffer       ( nullptr )
+    , mSize         ( MACRO_MAX(bufferSize, 2 * static_cast<unsigned int>(sizeof(NEMemory::sRemoteMessageHeader))) )
+    , mReadPos      ( 0 )
+    , mWritePos     ( 0 )
+    , mLargeMessage ( )
+    , mLargeRemain  ( 0 )
+    , mLargeCopied  ( 0 )
+    , mChecksumSkipped( false )
+    , mSharedMemory ( )
+{
+    mBuffer = DEBUG_NEW unsigned char[mSize];
+}
+
+SocketReceiveBuffer::~SocketReceiveBuffer( void )
+{
+    delete [] mBuffer;
+    mBuffer = nullptr;
+}
+
+int SocketReceiveBuffer::receiveData( const Socket & clientSocket )
+{
+    _compact();
+    ASSERT( mWritePos < mSize );
+
+    int result = clientSocket.receiveAvailableData( mBuffer + mWritePos, static_cast<int>(mSize - mWritePos) );
+    if ( result > 0 )
+    {
+        mWritePos += static_cast<unsigned int>(result);
+    }
+
+    return result;
+}
+
+int SocketReceiveBuffer::receivePendingData( const Socket & clientSocket )
+{
+    _compact();
+    ASSERT( mWritePos < mSize );
+
+    int result = clientSocket.receivePendingData( mBuffer + mWritePos, static_cast<int>(mSize - mWritePos) );
+    if ( result > 0 )
+    {
+        mWritePos += static_cast<unsigned int>(result);
+    }
+
+    return result;
+}
+
+bool SocketReceiveBuffer::extractMessage( RemoteMessage & out_message )
+{
+    TRACE_SCOPE(areg_ipc_SocketReceiveBuffer_extractMessage);
+
+    constexpr unsigned int sizeHeader = static_cast<unsigned int>(sizeof(NEMemory::sRemoteMessageHeader));
+
+    bool result = false;
+    unsigned int available = mWritePos - mReadPos;
+    if ( mLargeMessage.isValid() )
+    {
+        // continue to collect the data of message, which does not fit the buffer.
+        const NEMemory::sRemoteMessageHeader & header = reinterpret_cast<const NEMemory::sRemoteMessageHeader &>(*static_cast<const RemoteMessage &>(mLargeMessage).getByteBuffer());
+        unsigned int length = MACRO_MIN(available, mLargeRemain);
+        unsigned int space  = header.rbhBufHeader.biLength - mLargeCopied;
+        unsigned int copy   = MACRO_MIN(length, space);
+        NEMemory::memCopy( mLargeMessage.getBuffer() + mLargeCopied, copy, mBuffer + mReadPos, copy );
+
+        mLargeCopied+= copy;
+        mLargeRemain-= length;
+        mReadPos    += length;
+        if ( mLargeRemain == 0 )
+        {
+            TRACE_DBG("Completed to receive large message [ %p ] of [ %u ] bytes", static_cast<id_type>(mLargeMessage.getMessageId()), mLargeCopied);
+            out_message = mLargeMessage;
+            mLargeMessage.invalidate();
+            _checkMessage( out_message );
+            result = true;
+        }
+    }
+    else if ( available >= sizeHeader )
+    {
+        NEMemory::sRemoteMessageHeader msgHeader;
+        NEMemory::memCopy( reinterpret_cast<unsigned char *>(&msgHeader), sizeHeader, mBuffer + mReadPos, sizeHeader );
+        // the sender sends aligned length of data.
+        unsigned int sizeData = msgHeader.rbhBufHeader.biUsed > 0 ? msgHeader.rbhBufHeader.biLength : 0;
+
+        if ( (sizeData == 0) && (mSharedMemory != nullptr) && (msgHeader.rbhMessageId == static_cast<unsigned int>(NEService::eFuncIdRange::ServiceRouterSharedData)) )
+        {
+            // the message is passed via shared memory, the notification has no data.
+            mReadPos += sizeHeader;
+            if ( mSharedMemory->readMessage( out_message ) )
+            {
+                _checkMessage( out_message );
+            }
+            else
+            {
+                TRACE_ERR("Failed to read the message from shared memory ring, invalidating message");
+                out_message.invalidate();
+            }
+
+            result = true;
+        }
+        else if ( available - sizeHeader >= sizeData )
+        {
+            unsigned char * buffer = out_message.initMessage( msgHeader );
+            if ( (buffer != nullptr) && (sizeData > 0) )
+            {
+                const NEMemory::sRemoteMessageHeader & header = reinterpret_cast<const NEMemory::sRemoteMessageHeader &>(*static_cast<const RemoteMessage &>(out_message).getByteBuffer());
+                unsigned int copy = MACRO_MIN(sizeData, header.rbhBufHeader.biLength);
+                NEMemory::memCopy( buffer, copy, mBuffer + mReadPos + sizeHeader, copy );
+            }
+
+            mReadPos += sizeHeader + sizeData;
+            _checkMessage( out_message );
+            result = true;
+        }
+        else if ( (sizeData > SocketReceiveBuffer::MAXIMUM_MESSAGE_SIZE) || (msgHeader.rbhBufHeader.biUsed > msgHeader.rbhBufHeader.biLength) )
+        {
+            // the stream is out of sync or the peer is broken, the connection should be reset.
+            TRACE_ERR("The message [ %p ] has invalid length [ %u ] and used size [ %u ], invalidating message"
+                        , static_cast<id_type>(msgHeader.rbhMessageId)
+                        , sizeData
+                        , msgHeader.rbhBufHeader.biUsed);
+            out_message.invalidate();
+            result = true;
+        }
+        else if ( sizeData > mSize - sizeHeader )
+        {
+            TRACE_DBG("The message [ %p ] of [ %u ] bytes does not fit the receive buffer, collecting data in message"
+                        , static_cast<id_type>(msgHeader.rbhMessageId)
+                        , sizeData);
+
+            mLargeMessage.initMessage( msgHeader );
+            if ( mLargeMessage.isValid() )
+            {
+                mLargeRemain = sizeData;
+                mLargeCopied = 0;
+                mReadPos    += sizeHeader;
+                result = extractMessage( out_message );
+            }
+            else
+            {
+                // the payload cannot be skipped, the stream is out of sync and the connection should be reset.
+                TRACE_ERR("Failed to allocate [ %u ] bytes for message [ %p ], invalidating message"
+                            , sizeData
+                            , static_cast<id_type>(msgHeader.rbhMessageId));
+                out_message.invalidate();
+                result = true;
+            }
+        }
+    }
+
+    if ( mReadPos == mWritePos )
+    {
+        mReadPos    = 0;
+        mWritePos   = 0;
+    }
+
+    return result;
+}
+
+void SocketReceiveBuffer::reset( void )
+{
+    mReadPos    = 0;
+    mWritePos   = 0;
+    mLargeRemain= 0;
+    mLargeCopied= 0;
+    mLargeMessage.invalidate();
+    mChecksumSkipped = false;
+    mSharedMemory.reset();
+}
+
+inline void SocketReceiveBuffer::_compact( void )
+{
+    if ( mReadPos != 0 )
+    {
+        unsigned int remain = mWritePos - mReadPos;
+        NEMemory::memMove( mBuffer, mBuffer + mReadPos, remain );
+        mReadPos    = 0;
+        mWritePos   = remain;
+    }
+}
+
+void SocketReceiveBuffer::_checkMessage( RemoteMessage & msgReceived ) const
+{
+    TRACE_SCOPE(areg_ipc_SocketReceiveBuffer__checkMessage);
+
+    msgReceived.moveToBegin();
+    if ( (mChecksumSkipped == false) && (msgReceived.isChecksumValid() == false) )
+    {
+        TRACE_DBG("Received remote message [ %p ], but checksum is invalid, ignoring and invalidating message", static_cast<id_type>(msgReceived.getMessageId()));
+        msgReceived.invalidate();
+    }
+}
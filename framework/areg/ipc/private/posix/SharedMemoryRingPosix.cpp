@@ -0,0 +1,109 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/private/posix/SharedMemoryRingPosix.cpp
+ * \ingroup     AREG Asynchronous Event-Driven Communication Framework
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the shared memory rings of local connection.
+ *              POSIX specific implementation
+ ************************************************************************/
+#include "areg/ipc/SharedMemoryRing.hpp"
+
+#if defined(_POSIX) || defined(POSIX)
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+
+namespace
+{
+    //!< Returns the POSIX name of shared memory object, which should start with slash.
+    inline String _posixName( const char * segmentName )
+    {
+        String result( "/" );
+        result += segmentName;
+        return result;
+    }
+}
+
+unsigned char * SharedMemoryRing::_osCreateSegment( const char * segmentName, unsigned int segmentSize )
+{
+    unsigned char * result = nullptr;
+
+    String name = _posixName( segmentName );
+    int fd = ::shm_open( name.getString( ), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR );
+    if ( fd != -1 )
+    {
+        if ( ::ftruncate( fd, static_cast<off_t>(segmentSize) ) == 0 )
+        {
+            void * data = ::mmap( nullptr, static_cast<size_t>(segmentSize), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+            result = data != MAP_FAILED ? reinterpret_cast<unsigned char *>(data) : nullptr;
+        }
+
+        // the mapping remains valid after closing the descriptor.
+        ::close( fd );
+        if ( result == nullptr )
+        {
+            ::shm_unlink( name.getString( ) );
+        }
+    }
+
+    if ( result == nullptr )
+    {
+        OUTPUT_WARN( "Failed to create shared memory [ %s ], errno = [ %d ]", name.getString( ), errno );
+    }
+
+    return result;
+}
+
+unsigned char * SharedMemoryRing::_osOpenSegment( const char * segmentName, unsigned int & out_segmentSize )
+{
+    unsigned char * result = nullptr;
+    out_segmentSize = 0;
+
+    String name = _posixName( segmentName );
+    int fd = ::shm_open( name.getString( ), O_RDWR, 0 );
+    if ( fd != -1 )
+    {
+        struct stat info;
+        if ( (::fstat( fd, &info ) == 0) && (info.st_size > 0) && (info.st_size <= static_cast<off_t>(0xFFFFFFFFu)) )
+        {
+            void * data = ::mmap( nullptr, static_cast<size_t>(info.st_size), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+            if ( data != MAP_FAILED )
+            {
+                result = reinterpret_cast<unsigned char *>(data);
+                out_segmentSize = static_cast<unsigned int>(info.st_size);
+            }
+        }
+
+        ::close( fd );
+    }
+
+    if ( result == nullptr )
+    {
+        OUTPUT_ERR( "Failed to open shared memory [ %s ], errno = [ %d ]", name.getString( ), errno );
+    }
+
+    return result;
+}
+
+void SharedMemoryRing::_osCloseSegment( void )
+{
+    ::munmap( mSegment, static_cast<size_t>(mSegmentSize) );
+}
+
+void SharedMemoryRing::_osUnlinkSegment( const char * segmentName )
+{
+    String name = _posixName( segmentName );
+    ::shm_unlink( name.getString( ) );
+}
+
+#endif  // defined(_POSIX) || defined(POSIX)
@@ -0,0 +1,98 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/private/win32/SharedMemoryRingWin32.cpp
+ * \ingroup     AREG Asynchronous Event-Driven Communication Framework
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the shared memory rings of local connection.
+ *              Windows specific implementation
+ ************************************************************************/
+#include "areg/ipc/SharedMemoryRing.hpp"
+
+#ifdef  _WINDOWS
+
+#define WIN32_LEAN_AND_MEAN             // Exclude rarely-used stuff from Windows headers
+#include <windows.h>
+
+unsigned char * SharedMemoryRing::_osCreateSegment( const char * segmentName, unsigned int segmentSize )
+{
+    unsigned char * result = nullptr;
+
+    HANDLE hMap = ::CreateFileMappingA( INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, static_cast<DWORD>(segmentSize), segmentName );
+    if ( (hMap != nullptr) && (::GetLastError( ) != ERROR_ALREADY_EXISTS) )
+    {
+        result = reinterpret_cast<unsigned char *>(::MapViewOfFile( hMap, FILE_MAP_ALL_ACCESS, 0, 0, static_cast<SIZE_T>(segmentSize) ));
+    }
+
+    if ( result != nullptr )
+    {
+        mMapHandle = static_cast<void *>(hMap);
+    }
+    else
+    {
+        OUTPUT_WARN( "Failed to create shared memory [ %s ], error = [ %d ]", segmentName, static_cast<int>(::GetLastError( )) );
+        if ( hMap != nullptr )
+        {
+            ::CloseHandle( hMap );
+        }
+    }
+
+    return result;
+}
+
+unsigned char * SharedMemoryRing::_osOpenSegment( const char * segmentName, unsigned int & out_segmentSize )
+{
+    unsigned char * result = nullptr;
+    out_segmentSize = 0;
+
+    HANDLE hMap = ::OpenFileMappingA( FILE_MAP_ALL_ACCESS, FALSE, segmentName );
+    if ( hMap != nullptr )
+    {
+        result = reinterpret_cast<unsigned char *>(::MapViewOfFile( hMap, FILE_MAP_ALL_ACCESS, 0, 0, 0 ));
+        MEMORY_BASIC_INFORMATION info;
+        if ( (result != nullptr) && (::VirtualQuery( result, &info, sizeof(MEMORY_BASIC_INFORMATION) ) != 0) )
+        {
+            mMapHandle      = static_cast<void *>(hMap);
+            out_segmentSize = static_cast<unsigned int>(info.RegionSize);
+        }
+        else
+        {
+            if ( result != nullptr )
+            {
+                ::UnmapViewOfFile( result );
+                result = nullptr;
+            }
+
+            ::CloseHandle( hMap );
+        }
+    }
+
+    if ( result == nullptr )
+    {
+        OUTPUT_ERR( "Failed to open shared memory [ %s ], error = [ %d ]", segmentName, static_cast<int>(::GetLastError( )) );
+    }
+
+    return result;
+}
+
+void SharedMemoryRing::_osCloseSegment( void )
+{
+    ::UnmapViewOfFile( mSegment );
+    if ( mMapHandle != nullptr )
+    {
+        ::CloseHandle( static_cast<HANDLE>(mMapHandle) );
+    }
+}
+
+void SharedMemoryRing::_osUnlinkSegment( const char * /*segmentName*/ )
+{
+    // the named mapping object is removed when the last handle is closed.
+}
+
+#endif  // _WINDOWS
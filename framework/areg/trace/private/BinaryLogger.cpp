@@ -0,0 +1,267 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/trace/private/BinaryLogger.cpp
+ * \ingroup     AREG Asynchronous Event-Driven Communication Framework
+ * \author      Artak Avetyan
+ * \brief       Binary Logger object to log message into the memory-mapped file
+ ************************************************************************/
+#include "areg/trace/private/BinaryLogger.hpp"
+
+#include "areg/trace/private/LogConfiguration.hpp"
+#include "areg/trace/private/NEBinaryLog.hpp"
+#include "areg/trace/private/TraceProperty.hpp"
+#include "areg/base/DateTime.hpp"
+#include "areg/base/File.hpp"
+#include "areg/base/Process.hpp"
+
+BinaryLogger::BinaryLogger( LogConfiguration & tracerConfig )
+    : LoggerBase    ( tracerConfig )
+
+    , mFileName     ( )
+    , mFileHandle   ( nullptr )
+    , mMapHandle    ( nullptr )
+    , mMapData      ( nullptr )
+    , mMapSize      ( 0 )
+    , mMapUsed      ( 0 )
+    , mScopes       ( )
+{
+}
+
+BinaryLogger::~BinaryLogger( void )
+{
+    _closeFile( );
+}
+
+bool BinaryLogger::openLogger( void )
+{
+    if ( (mMapData == nullptr) && _openFile() )
+    {
+        _writeProcessMessage( LoggerBase::FOMAT_MESSAGE_HELLO );
+    }
+
+    return (mMapData != nullptr);
+}
+
+void BinaryLogger::closeLogger( void )
+{
+    if ( mMapData != nullptr )
+    {
+        _writeProcessMessage( LoggerBase::FORMAT_MESSAGE_BYE );
+    }
+
+    _closeFile( );
+}
+
+bool BinaryLogger::logMessage( const NETrace::sLogMessage & logMessage )
+{
+    bool result = false;
+    if ( mMapData != nullptr )
+    {
+        constexpr unsigned int logSize  { static_cast<unsigned int>(sizeof(NEBinaryLog::sRecord)) + NEBinaryLog::LOG_FIXED_SIZE + 1 };
+        constexpr unsigned int scopeSize{ static_cast<unsigned int>(sizeof(NEBinaryLog::sRecord) + offsetof(NEBinaryLog::sScopeRecord, srName)) + 1 };
+
+        switch ( logMessage.lmHeader.logType )
+        {
+        case NETrace::LogMessage:
+            {
+                unsigned int textLen = static_cast<unsigned int>(NEString::getStringLength<char>( logMessage.lmTrace.traceMessage ));
+                textLen = MACRO_MIN( textLen, NETrace::LOG_MESSAGE_BUFFER_SIZE - 1 );
+                if ( _ensureSpace( NEBinaryLog::alignRecord( logSize + textLen ) ) )
+                {
+                    _writeLogRecord( logMessage, textLen );
+                    result = true;
+                }
+            }
+            break;
+
+        case NETrace::LogScopeEnter:    // fall through
+        case NETrace::LogScopeExit:
+            {
+                // the name of scope is written only once per file.
+                unsigned int nameLen = static_cast<unsigned int>(NEString::getStringLength<char>( logMessage.lmTrace.traceMessage ));
+                nameLen = MACRO_MIN( nameLen, NETrace::LOG_MESSAGE_BUFFER_SIZE - 1 );
+                if ( _ensureSpace( NEBinaryLog::alignRecord( scopeSize + nameLen ) + NEBinaryLog::alignRecord( logSize ) ) )
+                {
+                    bool written = false;
+                    if ( mScopes.find( logMessage.lmTrace.traceScopeId, written ) == false )
+                    {
+                        _writeScopeRecord( logMessage.lmTrace.traceScopeId, logMessage.lmTrace.traceMessage, nameLen );
+                        mScopes.setAt( logMessage.lmTrace.traceScopeId, true, false );
+                    }
+
+                    _writeLogRecord( logMessage, 0 );
+                    result = true;
+                }
+            }
+            break;
+
+        case NETrace::LogCommand:
+            break;
+
+        case NETrace::LogUndefined: // fall through
+        default:
+            ASSERT(false);  // unexpected message to log
+            break;
+        }
+    }
+
+    return result;
+}
+
+void BinaryLogger::flushLogs( void )
+{
+}
+
+bool BinaryLogger::isLoggerOpened( void ) const
+{
+    return (mMapData != nullptr);
+}
+
+bool BinaryLogger::_openFile( void )
+{
+    const LogConfiguration & traceConfig = getTraceConfiguration( );
+    const TraceProperty & prop = traceConfig.getBinaryFile( );
+    if ( (mMapData == nullptr) && prop.isValid( ) )
+    {
+        String fileName = File::normalizePath( static_cast<const char *>(prop.getValue( )) );
+        if ( fileName.isEmpty( ) == false )
+        {
+            unsigned int sizeMB = static_cast<unsigned int>(traceConfig.getBinarySize( ).getValue( ));
+            sizeMB = MACRO_MAX( 1u, MACRO_MIN( sizeMB, BinaryLogger::MAX_FILE_SIZE_MB ) );
+
+            if ( File::existFile( fileName ) )
+            {
+                // keep the previous file, if the name is fixed.
+                String oldName( fileName );
+                oldName += BinaryLogger::FILE_EXTENSION_OLD.data( );
+                File::deleteFile( oldName );
+                File::moveFile( fileName, oldName );
+            }
+            else
+            {
+                File::createDirCascaded( File::getFileDirectory( fileName ) );
+            }
+
+            mMapData = _osMapFile( fileName, sizeMB * BinaryLogger::ONE_MEGABYTE );
+            if ( mMapData != nullptr )
+            {
+                const Process & curProcess = Process::getInstance( );
+                NEBinaryLog::sFileHeader & header = *reinterpret_cast<NEBinaryLog::sFileHeader *>(mMapData);
+                NEMemory::zeroElement<NEBinaryLog::sFileHeader>( header );
+
+                header.fhMagic      = NEBinaryLog::FILE_MAGIC;
+                header.fhVersion    = NEBinaryLog::FILE_VERSION;
+                header.fhHeaderSize = NEBinaryLog::alignRecord( static_cast<unsigned int>(sizeof(NEBinaryLog::sFileHeader)) );
+                header.fhFixedSize  = NEBinaryLog::LOG_FIXED_SIZE;
+                header.fhProcessId  = static_cast<uint64_t>(curProcess.getId( ));
+                header.fhCreated    = static_cast<TIME64>(DateTime::getNow( ));
+                NEString::copyString<char, char>( header.fhModuleName, NEBinaryLog::MODULE_NAME_SIZE, curProcess.getAppName( ).getString( ) );
+
+                mFileName   = fileName;
+                mMapSize    = sizeMB * BinaryLogger::ONE_MEGABYTE;
+                mMapUsed    = header.fhHeaderSize;
+                mScopes.removeAll( );
+            }
+        }
+    }
+
+    return (mMapData != nullptr);
+}
+
+void BinaryLogger::_closeFile( void )
+{
+    if ( mMapData != nullptr )
+    {
+        _osUnmapFile( mFileName, mMapUsed );
+
+        mMapData    = nullptr;
+        mMapSize    = 0;
+        mMapUsed    = 0;
+        mFileName.clear( );
+        mScopes.removeAll( );
+    }
+}
+
+bool BinaryLogger::_ensureSpace( unsigned int length )
+{
+    if ( (mMapData != nullptr) && (mMapUsed + length > mMapSize) )
+    {
+        // the file is full, continue in the new file.
+        _closeFile( );
+        _openFile( );
+    }
+
+    return ((mMapData != nullptr) && (mMapUsed + length <= mMapSize));
+}
+
+void BinaryLogger::_writeScopeRecord( unsigned int scopeId, const char * scopeName, unsigned int nameLen )
+{
+    unsigned int length = NEBinaryLog::alignRecord( static_cast<unsigned int>(sizeof(NEBinaryLog::sRecord) + offsetof(NEBinaryLog::sScopeRecord, srName)) + nameLen + 1 );
+    unsigned char * data = mMapData + mMapUsed;
+
+    NEBinaryLog::sRecord & record   = *reinterpret_cast<NEBinaryLog::sRecord *>(data);
+    record.recLength                = length;
+    record.recType                  = NEBinaryLog::eRecord::RecordScope;
+
+    NEBinaryLog::sScopeRecord & scope = *reinterpret_cast<NEBinaryLog::sScopeRecord *>(data + sizeof(NEBinaryLog::sRecord));
+    scope.srScopeId                 = scopeId;
+    scope.srNameLen                 = nameLen;
+    NEMemory::memCopy( scope.srName, static_cast<int>(nameLen), scopeName, static_cast<int>(nameLen) );
+    scope.srName[nameLen]           = String::EmptyChar;
+
+    mMapUsed += length;
+}
+
+void BinaryLogger::_writeLogRecord( const NETrace::sLogMessage & logMessage, unsigned int textLen )
+{
+    constexpr unsigned int offsetLen{ static_cast<unsigned int>(offsetof(NETrace::sLogMessage, lmTrace) + offsetof(NETrace::sLogData, traceMessageLen)) };
+
+    unsigned int length = NEBinaryLog::alignRecord( static_cast<unsigned int>(sizeof(NEBinaryLog::sRecord)) + NEBinaryLog::LOG_FIXED_SIZE + textLen + 1 );
+    unsigned char * data = mMapData + mMapUsed;
+
+    NEBinaryLog::sRecord & record   = *reinterpret_cast<NEBinaryLog::sRecord *>(data);
+    record.recLength                = length;
+    record.recType                  = NEBinaryLog::eRecord::RecordLog;
+
+    // the fixed part of log message is copied as it is, only the length of text is updated.
+    unsigned char * fixed = data + sizeof(NEBinaryLog::sRecord);
+    NEMemory::memCopy( fixed, static_cast<int>(NEBinaryLog::LOG_FIXED_SIZE), &logMessage, static_cast<int>(NEBinaryLog::LOG_FIXED_SIZE) );
+    NEMemory::memCopy( fixed + offsetLen, static_cast<int>(sizeof(unsigned int)), &textLen, static_cast<int>(sizeof(unsigned int)) );
+
+    char * text = reinterpret_cast<char *>(fixed + NEBinaryLog::LOG_FIXED_SIZE);
+    NEMemory::memCopy( text, static_cast<int>(textLen), logMessage.lmTrace.traceMessage, static_cast<int>(textLen) );
+    text[textLen] = String::EmptyChar;
+
+    mMapUsed += length;
+}
+
+void BinaryLogger::_writeProcessMessage( const std::string_view & format )
+{
+    Process & curProcess = Process::getInstance();
+    NETrace::sLogMessage logMsgHello;
+    NEMemory::zeroElement<NETrace::sLogMessage>( logMsgHello );
+
+    logMsgHello.lmHeader.logLength      = sizeof(NETrace::sLogMessage);
+    logMsgHello.lmHeader.logType        = NETrace::LogMessage;
+    logMsgHello.lmHeader.logModuleId    = 0;
+
+    logMsgHello.lmTrace.traceThreadId   = 0;
+    logMsgHello.lmTrace.traceScopeId    = 0;
+    logMsgHello.lmTrace.traceTimestamp  = static_cast<TIME64>(DateTime::getNow());
+    logMsgHello.lmTrace.traceMessagePrio= NETrace::PrioIgnoreLayout;
+    String::formatString( logMsgHello.lmTrace.traceMessage
+                        , NETrace::LOG_MESSAGE_BUFFER_SIZE
+                        , format.data()
+                        , Process::getString(curProcess.getEnvironment())
+                        , curProcess.getFullPath().getString()
+                        , curProcess.getId());
+
+    logMessage( logMsgHello );
+}
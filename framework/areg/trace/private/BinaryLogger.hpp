@@ -0,0 +1,220 @@
+#pragma once
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/trace/private/BinaryLogger.hpp
+ * \ingroup     AREG Asynchronous Event-Driven Communication Framework
+ * \author      Artak Avetyan
+ * \brief       Binary Logger object to log message into the memory-mapped file
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/trace/private/LoggerBase.hpp"
+
+#include "areg/base/String.hpp"
+#include "areg/base/TEHashMap.hpp"
+
+//////////////////////////////////////////////////////////////////////////
+// BinaryLogger class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   Message logger to output binary log records in the memory-mapped file.
+ *          The file is pre-allocated with the size set in the configuration.
+ *          The logger copies the records in the mapped memory without formatting
+ *          them, the operating system writes the pages to the file.
+ *          When the file is full, the logger rotates the file: the file is
+ *          truncated to the size of the records and the new file is created.
+ *          If the name of the file is fixed, the previous file is kept with
+ *          the '.old' extension. The format of file is described in NEBinaryLog.
+ *          Use 'logdecoder' utility to convert the binary file to text.
+ **/
+class BinaryLogger  : public    LoggerBase
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The hash map helper of written scopes.
+    using ImplMapScopes = TEHashMapImpl<unsigned int, bool>;
+    //!< The hash map of scopes, which names are written in the file.
+    using MapScopes     = TEHashMap<unsigned int, bool, unsigned int, bool, ImplMapScopes>;
+
+    //!< The extension of previous log file, if the name of file is fixed.
+    static constexpr std::string_view   FILE_EXTENSION_OLD  { ".old" };
+
+    //!< The number of bytes in one megabyte, the size of file is set in megabytes.
+    static constexpr unsigned int       ONE_MEGABYTE        { 1024 * 1024 };
+
+    //!< The maximum size in megabytes of the binary log file.
+    static constexpr unsigned int       MAX_FILE_SIZE_MB    { 1024 };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Constructor.
+     *          Instantiates logger and sets tracer configuration object,
+     *          which contains methods to get property values after
+     *          configuring tracer.
+     * \param   tracerConfig    The instance tracer configuration object,
+     *                          which contains configuration values,
+     *                          required by logger during initialization (open)
+     *                          and when outputs message.
+     **/
+    BinaryLogger( LogConfiguration & tracerConfig );
+
+    /**
+     * \brief   Destructor
+     **/
+    virtual ~BinaryLogger( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Override operations and attribute
+//////////////////////////////////////////////////////////////////////////
+public:
+
+/************************************************************************/
+// LoggerBase interface overrides
+/************************************************************************/
+
+    /**
+     * \brief   Called to initialize / open logger. If method returns true,
+     *          the trace manager starts to forward messages for logging.
+     *          If method returns false, the tracer manager assumes that
+     *          logger is not initialized and will not send messages for logging.
+     *          Before any message is logger, the logger should be opened.
+     * \return  Returns true if logger succeeded initialization (open).
+     **/
+    virtual bool openLogger( void ) override;
+
+    /**
+     * \brief   Called to close logger and stop logging.
+     **/
+    virtual void closeLogger( void ) override;
+
+    /**
+     * \brief   Called when message should be logged.
+     *          Every logger should implement method to process logger specific logging.
+     **/
+    virtual bool logMessage( const NETrace::sLogMessage & logMessage ) override;
+
+    /**
+     * \brief   Call to flush logs, if they are queued. The binary logger ignores it,
+     *          the operating system writes the pages of mapped file.
+     **/
+    virtual void flushLogs( void ) override;
+
+    /**
+     * \brief   Returns true if logger is initialized (opened).
+     **/
+    virtual bool isLoggerOpened( void ) const override;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Creates new binary log file, maps it and writes the file header.
+     * \return  Returns true if succeeded to create and map the file.
+     **/
+    bool _openFile( void );
+
+    /**
+     * \brief   Unmaps and closes the binary log file. The file is truncated to the size of records.
+     **/
+    void _closeFile( void );
+
+    /**
+     * \brief   Makes sure that the file has space for the records of given length.
+     *          If the file is full, rotates the file.
+     * \param   length  The length in bytes of the records, aligned by NEBinaryLog::RECORD_ALIGN.
+     * \return  Returns true if the file is mapped and has enough space.
+     **/
+    bool _ensureSpace( unsigned int length );
+
+    /**
+     * \brief   Writes the scope name dictionary record.
+     * \param   scopeId     The ID of scope.
+     * \param   scopeName   The name of scope.
+     * \param   nameLen     The length of scope name.
+     **/
+    void _writeScopeRecord( unsigned int scopeId, const char * scopeName, unsigned int nameLen );
+
+    /**
+     * \brief   Writes the log message record.
+     * \param   logMessage  The log message to write.
+     * \param   textLen     The length of message text to write. It is zero for entering and exiting scopes.
+     **/
+    void _writeLogRecord( const NETrace::sLogMessage & logMessage, unsigned int textLen );
+
+    /**
+     * \brief   Writes the message with the information of the process when the logger is opened or closed.
+     * \param   format  The format of the message.
+     **/
+    void _writeProcessMessage( const std::string_view & format );
+
+    /**
+     * \brief   OS specific implementation to create the file of given size and map it in the memory.
+     * \param   fileName    The name of the file to create.
+     * \param   fileSize    The size in bytes of the file.
+     * \return  Returns the address of mapped memory or nullptr if failed.
+     **/
+    unsigned char * _osMapFile( const char * fileName, unsigned int fileSize );
+
+    /**
+     * \brief   OS specific implementation to unmap the file and truncate it to the given size.
+     * \param   fileName    The name of mapped file.
+     * \param   fileSize    The size in bytes to truncate the file.
+     **/
+    void _osUnmapFile( const char * fileName, unsigned int fileSize );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The name of currently mapped file.
+     **/
+    String          mFileName;
+    /**
+     * \brief   The OS specific handle of the file, used only if the file should be open while it is mapped.
+     **/
+    FILEHANDLE      mFileHandle;
+    /**
+     * \brief   The OS specific handle of the file mapping, used only if the system requires it.
+     **/
+    FILEHANDLE      mMapHandle;
+    /**
+     * \brief   The address of mapped memory.
+     **/
+    unsigned char * mMapData;
+    /**
+     * \brief   The size in bytes of the mapped file.
+     **/
+    unsigned int    mMapSize;
+    /**
+     * \brief   The size in bytes of the header and written records.
+     **/
+    unsigned int    mMapUsed;
+    /**
+     * \brief   The scopes, which names are written in the current file.
+     **/
+    MapScopes       mScopes;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden / Forbidden calls.
+//////////////////////////////////////////////////////////////////////////
+private:
+    BinaryLogger( void ) = delete;
+    DECLARE_NOCOPY_NOMOVE( BinaryLogger );
+};
@@ -161,8 +161,12 @@ bool DebugOutputLogger::isLoggerOpened(void) const
     return mIsOpened;
 }
 
-unsigned int DebugOutputLogger::write(const unsigned char * /*buffer*/, unsigned int size)
+unsigned int DebugOutputLogger::write(const unsigned char * buffer, unsigned int size)
 {
+#if defined(_OUTPUT_DEBUG)
+    // the layouts write text without null-termination
+    mOutputMessageA.append( reinterpret_cast<const char *>(buffer), static_cast<NEString::CharCount>(size) );
+#endif  // defined(_OUTPUT_DEBUG)
     return size;
 }
 
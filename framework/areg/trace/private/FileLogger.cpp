@@ -18,11 +18,17 @@
 #include "areg/trace/private/TraceProperty.hpp"
 #include "areg/base/Process.hpp"
 #include "areg/base/DateTime.hpp"
+#include "areg/base/IEByteBuffer.hpp"
+#include "areg/base/WideString.hpp"
 
 FileLogger::FileLogger( LogConfiguration & tracerConfig )
-    : LoggerBase( tracerConfig )
+    : LoggerBase    ( tracerConfig )
+    , IEOutStream   ( )
 
-    , mLogFile          ( )
+    , mLogFile      ( )
+    , mSyncFile     ( false )
+    , mBufferUsed   ( 0 )
+    , mLastWrite    ( 0 )
 {
 }
 
@@ -40,6 +46,9 @@ bool FileLogger::openLogger( void )
             if ( fileName.isEmpty() == false )
             {
                 bool newFile      = static_cast<bool>(traceConfig.getAppendData()) == false;
+                mSyncFile         = static_cast<bool>(traceConfig.getSyncData());
+                mBufferUsed       = 0;
+                mLastWrite        = static_cast<TIME64>(DateTime::getNow());
                 unsigned int mode = File::FO_MODE_WRITE | File::FO_MODE_READ | File::FO_MODE_SHARE_READ | File::FO_MODE_SHARE_WRITE | File::FO_MODE_TEXT;
 
                 if ( File::existFile(fileName) )
@@ -109,6 +118,7 @@ void FileLogger::closeLogger(void)
                             , curProcess.getId());
 
         logMessage(logMsgHello);
+        _writeBuffer();
     }
 
     releaseLayouts();
@@ -123,15 +133,15 @@ bool FileLogger::logMessage( const NETrace::sLogMessage & logMessage )
         switch (logMessage.lmHeader.logType)
         {
         case NETrace::LogMessage:
-            result = getLayoutMessage().logMessage( logMessage, static_cast<IEOutStream &>(mLogFile) );
+            result = getLayoutMessage().logMessage( logMessage, static_cast<IEOutStream &>(*this) );
             break;
 
         case NETrace::LogScopeEnter:
-            result = getLayoutEnterScope().logMessage( logMessage, static_cast<IEOutStream &>(mLogFile) );
+            result = getLayoutEnterScope().logMessage( logMessage, static_cast<IEOutStream &>(*this) );
             break;
 
         case NETrace::LogScopeExit:
-            result = getLayoutExitScope().logMessage( logMessage, static_cast<IEOutStream &>(mLogFile) );
+            result = getLayoutExitScope().logMessage( logMessage, static_cast<IEOutStream &>(*this) );
             break;
 
         case NETrace::LogCommand:
@@ -142,6 +152,12 @@ bool FileLogger::logMessage( const NETrace::sLogMessage & logMessage )
             ASSERT(false);  // unexpected message to log
             break;
         }
+
+        // do not keep messages in the buffer too long, even if the tracer is busy.
+        if ( logMessage.lmTrace.traceTimestamp >= mLastWrite + LOG_FLUSH_INTERVAL )
+        {
+            _writeBuffer();
+        }
     }
 
     return result;
@@ -154,5 +170,65 @@ bool FileLogger::isLoggerOpened(void) const
 
 void FileLogger::flushLogs(void)
 {
-    mLogFile.flush();
+    _writeBuffer();
+    if ( mSyncFile )
+    {
+        mLogFile.flush();
+    }
+}
+
+unsigned int FileLogger::write( const unsigned char * buffer, unsigned int size )
+{
+    if ( size > LOG_BUFFER_SIZE - mBufferUsed )
+    {
+        _writeBuffer();
+    }
+
+    if ( size > LOG_BUFFER_SIZE )
+    {
+        size = mLogFile.write( buffer, size );
+    }
+    else
+    {
+        NEMemory::memCopy( mBuffer + mBufferUsed, static_cast<int>(size), buffer, static_cast<int>(size) );
+        mBufferUsed += size;
+    }
+
+    return size;
+}
+
+unsigned int FileLogger::write( const IEByteBuffer & buffer )
+{
+    return write( buffer.getBuffer( ), buffer.getSizeUsed( ) );
+}
+
+unsigned int FileLogger::write( const String & asciiString )
+{
+    return write( reinterpret_cast<const unsigned char *>(asciiString.getString( )), static_cast<unsigned int>(asciiString.getLength( )) );
+}
+
+unsigned int FileLogger::write( const WideString & wideString )
+{
+    return write( reinterpret_cast<const unsigned char *>(wideString.getString( )), static_cast<unsigned int>(wideString.getLength( ) * sizeof(wchar_t)) );
+}
+
+void FileLogger::flush( void )
+{
+    _writeBuffer( );
+}
+
+unsigned int FileLogger::getSizeWritable( void ) const
+{
+    return (LOG_BUFFER_SIZE - mBufferUsed);
+}
+
+void FileLogger::_writeBuffer( void )
+{
+    if ( mBufferUsed != 0 )
+    {
+        mLogFile.write( mBuffer, mBufferUsed );
+        mBufferUsed = 0;
+    }
+
+    mLastWrite = static_cast<TIME64>(DateTime::getNow());
 }
@@ -29,9 +29,25 @@
  * \brief   Message logger to output messages in to the file.
  *          At the moment the output logger supports only ASCII messages
  *          and any Unicode character might output wrong.
+ *          The layouts format messages in the internal buffer of the logger,
+ *          which is written to the file by one call when the buffer is full,
+ *          when the flush interval is elapsed or when the logs are flushed.
+ *          The file is synchronized with the storage device only if
+ *          the 'log.sync' property is set in the configuration.
  **/
 class FileLogger    : public    LoggerBase
+                    , private   IEOutStream
 {
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    //!< The size in bytes of the buffer to format messages.
+    static constexpr unsigned int   LOG_BUFFER_SIZE         { 64 * 1024 };
+
+    //!< The maximum time in microseconds formatted messages may stay in the buffer.
+    static constexpr TIME64         LOG_FLUSH_INTERVAL      { 500 * 1'000 };
+
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
 //////////////////////////////////////////////////////////////////////////
@@ -93,6 +109,66 @@ public:
      **/
     virtual bool isLoggerOpened( void ) const override;
 
+//////////////////////////////////////////////////////////////////////////
+// Overrides
+//////////////////////////////////////////////////////////////////////////
+private:
+/************************************************************************/
+// IEOutStream interface overrides
+/************************************************************************/
+
+    /**
+     * \brief	Copies data to the buffer of the logger. If the buffer has no
+     *          space, the formatted messages are written to the file.
+     * \param	buffer	The pointer to buffer to read data and
+     *          copy to output stream object
+     * \param	size	The size in bytes of data buffer
+     * \return	Returns the size in bytes of written data
+     **/
+    virtual unsigned int write( const unsigned char * buffer, unsigned int size ) override;
+
+    /**
+     * \brief	Writes Binary data from Byte Buffer object to Output Stream object
+     *          and returns the size of written data.
+     * \param	buffer	The instance of Byte Buffer object containing data to stream to Output Stream.
+     * \return	Returns the size in bytes of written data
+     **/
+    virtual unsigned int write( const IEByteBuffer & buffer ) override;
+
+    /**
+     * \brief   Writes string data from given ASCII String object to output stream object.
+     * \param   asciiString     The buffer of String containing data to stream to Output Stream.
+     * \return  Returns the size in bytes of copied string data.
+     **/
+    virtual unsigned int write( const String & asciiString ) override;
+
+    /**
+     * \brief   Writes string data from given wide-char String object to output stream object.
+     * \param   wideString  The buffer of String containing data to stream to Output Stream.
+     * \return  Returns the size in bytes of copied string data.
+     **/
+    virtual unsigned int write( const WideString & wideString ) override;
+
+    /**
+     * \brief	Writes the formatted messages of the buffer to the file.
+     **/
+    virtual void flush( void ) override;
+
+    /**
+     * \brief	Returns size in bytes of remaining space in the buffer.
+     **/
+    virtual unsigned int getSizeWritable( void ) const override;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Writes the formatted messages of the buffer to the file by one call
+     *          and empties the buffer.
+     **/
+    void _writeBuffer( void );
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
@@ -100,7 +176,24 @@ private:
     /**
      * \brief   The log file object
      **/
-    File              mLogFile;
+    File                mLogFile;
+    /**
+     * \brief   The flag, indicating whether the file is synchronized with
+     *          the storage device when logs are flushed.
+     **/
+    bool                mSyncFile;
+    /**
+     * \brief   The size in bytes of formatted messages in the buffer.
+     **/
+    unsigned int        mBufferUsed;
+    /**
+     * \brief   The timestamp when the buffer was last written to the file.
+     **/
+    TIME64              mLastWrite;
+    /**
+     * \brief   The buffer of formatted messages.
+     **/
+    unsigned char       mBuffer[LOG_BUFFER_SIZE];
 
 //////////////////////////////////////////////////////////////////////////
 // Hidden / Forbidden calls.
@@ -37,7 +37,7 @@ class IEOutStream;
  *              - Enter scope layout, format to display enter scope message
  *              - Exit scope layout, format to display exit scope message
  **/
-class LayoutManager
+class AREG_API LayoutManager
 {
 //////////////////////////////////////////////////////////////////////////
 // Local types and constants.
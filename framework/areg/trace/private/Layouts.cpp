@@ -20,6 +20,17 @@
 
 #include <utility>
 
+namespace
+{
+    /**
+     * \brief   Writes the null-terminated text to the stream without creating temporary string object.
+     **/
+    inline void _writeText( IEOutStream & stream, const char * text )
+    {
+        stream.write( reinterpret_cast<const unsigned char *>(text), static_cast<unsigned int>(NEString::getStringLength<char>( text )) );
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////
 // IELayout interface implementation
 //////////////////////////////////////////////////////////////////////////
@@ -52,7 +63,7 @@ void TickCountLayout::logMessage( const NETrace::sLogMessage & /*msgLog*/, IEOut
 {
     char buffer[65];    
     String::formatString(buffer, 64, "%llu", static_cast<uint64_t>( DateTime::getProcessTickCount() ));
-    stream.write(buffer);
+    _writeText(stream, buffer);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -61,26 +72,55 @@ void TickCountLayout::logMessage( const NETrace::sLogMessage & /*msgLog*/, IEOut
 
 
 DayTimeLaytout::DayTimeLaytout( void )
-    : IELayout ( NELogConfig::eLayouts::LayoutDayTime )
+    : IELayout      ( NELogConfig::eLayouts::LayoutDayTime )
+    , mCachedSecond ( static_cast<TIME64>(~0) )
+    , mCachedLength ( 0 )
 {
+    mCachedTime[0] = String::EmptyChar;
 }
 
 DayTimeLaytout::DayTimeLaytout( const DayTimeLaytout & /*src*/ )
-    : IELayout ( NELogConfig::eLayouts::LayoutDayTime )
+    : IELayout      ( NELogConfig::eLayouts::LayoutDayTime )
+    , mCachedSecond ( static_cast<TIME64>(~0) )
+    , mCachedLength ( 0 )
 {
+    mCachedTime[0] = String::EmptyChar;
 }
 
 DayTimeLaytout::DayTimeLaytout( DayTimeLaytout && /*src*/ ) noexcept
-    : IELayout ( NELogConfig::eLayouts::LayoutDayTime )
+    : IELayout      ( NELogConfig::eLayouts::LayoutDayTime )
+    , mCachedSecond ( static_cast<TIME64>(~0) )
+    , mCachedLength ( 0 )
 {
+    mCachedTime[0] = String::EmptyChar;
 }
 
 void DayTimeLaytout::logMessage( const NETrace::sLogMessage & msgLog, IEOutStream & stream ) const
 {
     if ( msgLog.lmTrace.traceTimestamp != 0 )
     {
-        DateTime timestamp( msgLog.lmTrace.traceTimestamp );
-        stream.write( timestamp.formatTime( DateTime::TIME_FORMAT_ISO8601_OUTPUT) );
+        TIME64 second       = msgLog.lmTrace.traceTimestamp / NEUtilities::SEC_TO_MICROSECS;
+        unsigned int milli  = static_cast<unsigned int>((msgLog.lmTrace.traceTimestamp % NEUtilities::SEC_TO_MICROSECS) / NEUtilities::MILLISEC_TO_MICROSECS);
+        if ( second != mCachedSecond )
+        {
+            // The output format ends with 3 digits of milliseconds, cache the rest of the text.
+            DateTime timestamp( second * NEUtilities::SEC_TO_MICROSECS );
+            String formatted( timestamp.formatTime( DateTime::TIME_FORMAT_ISO8601_OUTPUT ) );
+            NEString::CharCount len = formatted.getLength( ) > 3 ? formatted.getLength( ) - 3 : 0;
+            len = MACRO_MIN( len, static_cast<NEString::CharCount>(sizeof(mCachedTime) - 1) );
+
+            NEMemory::memCopy( mCachedTime, static_cast<int>(sizeof(mCachedTime)), formatted.getString( ), static_cast<int>(len) );
+            mCachedTime[len]= String::EmptyChar;
+            mCachedLength   = static_cast<unsigned int>(len);
+            mCachedSecond   = second;
+        }
+
+        char buffer[sizeof(mCachedTime) + 4];
+        NEMemory::memCopy( buffer, static_cast<int>(sizeof(buffer)), mCachedTime, static_cast<int>(mCachedLength) );
+        buffer[mCachedLength + 0] = static_cast<char>('0' + (milli / 100));
+        buffer[mCachedLength + 1] = static_cast<char>('0' + (milli / 10) % 10);
+        buffer[mCachedLength + 2] = static_cast<char>('0' + (milli % 10));
+        stream.write( reinterpret_cast<const unsigned char *>(buffer), mCachedLength + 3 );
     }
 }
 
@@ -109,7 +149,7 @@ void ModuleIdLayout::logMessage( const NETrace::sLogMessage & msgLog, IEOutStrea
     {
         char buffer[32];
         String::formatString( buffer, 16, "0x%llX", msgLog.lmHeader.logModuleId );
-        stream.write(buffer);
+        _writeText(stream, buffer);
     }
 }
 
@@ -134,7 +174,7 @@ MessageLayout::MessageLayout( MessageLayout && /*src*/ ) noexcept
 
 void MessageLayout::logMessage( const NETrace::sLogMessage & msgLog, IEOutStream & stream ) const
 {
-    stream.write(msgLog.lmTrace.traceMessage);
+    _writeText(stream, msgLog.lmTrace.traceMessage);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -159,7 +199,7 @@ EndOfLineLayout::EndOfLineLayout( EndOfLineLayout && /*src*/ ) noexcept
 void EndOfLineLayout::logMessage( const NETrace::sLogMessage & /*src*/, IEOutStream & stream ) const
 {
     constexpr char const END_OF_LINE[] { "\n" };
-    stream.write(END_OF_LINE);
+    stream.write(reinterpret_cast<const unsigned char *>(END_OF_LINE), static_cast<unsigned int>(sizeof(END_OF_LINE) - 1));
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -183,7 +223,7 @@ PriorityLayout::PriorityLayout( PriorityLayout && /*src*/ ) noexcept
 
 void PriorityLayout::logMessage( const NETrace::sLogMessage & msgLog, IEOutStream & stream ) const
 {
-    stream.write( NETrace::convToString( msgLog.lmTrace.traceMessagePrio ) );
+    _writeText( stream, NETrace::convToString( msgLog.lmTrace.traceMessagePrio ) );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -211,7 +251,7 @@ void ScopeIdLayout::logMessage( const NETrace::sLogMessage & msgLog, IEOutStream
     {
         char buffer[16];
         String::formatString(buffer, 16, "%u", msgLog.lmTrace.traceScopeId);
-        stream.write(buffer);
+        _writeText(stream, buffer);
     }
 }
 
@@ -246,7 +286,7 @@ void ThreadIdLayout::logMessage( const NETrace::sLogMessage & msgLog, IEOutStrea
         String::formatString( buffer, 32, "0x%016llX", static_cast<uint64_t>(msgLog.lmTrace.traceThreadId) );
 #endif  // _BIT64
 
-        stream.write(buffer);
+        _writeText(stream, buffer);
     }
 }
 
@@ -321,7 +361,7 @@ ScopeNameLayout::ScopeNameLayout( ScopeNameLayout && /*src*/ ) noexcept
 
 void ScopeNameLayout::logMessage( const NETrace::sLogMessage & msgLog, IEOutStream & stream ) const
 {
-    stream.write( msgLog.lmTrace.traceMessage );
+    _writeText( stream, msgLog.lmTrace.traceMessage );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -360,5 +400,5 @@ AnyTextLayout::AnyTextLayout(const char * anyMessage)
 
 void AnyTextLayout::logMessage( const NETrace::sLogMessage & /*msgLog*/, IEOutStream & stream ) const
 {
-    stream.write( mTextMessage.getString() );
+    stream.write( mTextMessage );
 }
@@ -245,6 +245,24 @@ public:
      * \param   stream  The streaming object, where the text message should be written.
      **/
     virtual void logMessage( const NETrace::sLogMessage & msgLog, IEOutStream & stream ) const override;
+
+//////////////////////////////////////////////////////////////////////////
+// Member variable
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The second of the timestamp, which formatted part is cached.
+     **/
+    mutable TIME64          mCachedSecond;
+    /**
+     * \brief   The length of cached formatted part of the timestamp.
+     **/
+    mutable unsigned int    mCachedLength;
+    /**
+     * \brief   The cached formatted timestamp without milliseconds. Since the
+     *          day-time changes only once per second, it is not formatted for every message.
+     **/
+    mutable char            mCachedTime[32];
 };
 
 //////////////////////////////////////////////////////////////////////////
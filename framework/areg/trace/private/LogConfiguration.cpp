@@ -30,9 +30,12 @@ void LogConfiguration::setDefaultValues( void )
     getDebugOutput().parseProperty( NELogConfig::DEFAULT_LOG_LAYOUT_DEBUG.data( ) );
     getStatus().parseProperty( NELogConfig::DEFAULT_LOG_ENABLE.data( ) );
     getAppendData().parseProperty( NELogConfig::DEFAULT_LOG_APPEND.data( ) );
+    getSyncData().parseProperty( NELogConfig::DEFAULT_LOG_SYNC.data( ) );
+    getBinarySize().parseProperty( NELogConfig::DEFAULT_LOG_BINARY_SIZE.data( ) );
     getLogFile().parseProperty( NELogConfig::DEFAULT_LOG_FILE.data( ) );
 
     getStackSize().clearProperty( );
+    getBinaryFile().clearProperty( );
     getRemoteHost().clearProperty( );
     getRemotePort().clearProperty( );
     getDatabaseHost().clearProperty( );
@@ -82,6 +85,9 @@ bool LogConfiguration::updateProperty( const TraceProperty & prop )
     case NELogConfig::eLogConfig::ConfigLogDatabasePwd:     // fall through
     case NELogConfig::eLogConfig::ConfigLogDebug:           // fall through
     case NELogConfig::eLogConfig::ConfigLogAppend:          // fall through
+    case NELogConfig::eLogConfig::ConfigLogSync:            // fall through
+    case NELogConfig::eLogConfig::ConfigLogBinary:          // fall through
+    case NELogConfig::eLogConfig::ConfigLogBinarySize:      // fall through
     case NELogConfig::eLogConfig::ConfigLogStack:           // fall through
     case NELogConfig::eLogConfig::ConfigLogEnable:          // fall through
     case NELogConfig::eLogConfig::ConfigLogLayoutEnter:     // fall through
@@ -33,7 +33,7 @@
  *          The inter has methods to get values of configured properties.
  *          All properties are read only and cannot be modified
  **/
-class LogConfiguration
+class AREG_API LogConfiguration
 {
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor. Protected
@@ -137,6 +137,27 @@ public:
     inline TraceProperty & getAppendData( void );
     inline void setAppendData( const TraceProperty & prop );
 
+    /**
+     * \brief   Gets and set property value of log file synchronization status.
+     **/
+    inline const TraceProperty & getSyncData( void ) const;
+    inline TraceProperty & getSyncData( void );
+    inline void setSyncData( const TraceProperty & prop );
+
+    /**
+     * \brief   Gets and set property value of binary log file name.
+     **/
+    inline const TraceProperty & getBinaryFile( void ) const;
+    inline TraceProperty & getBinaryFile( void );
+    inline void setBinaryFile( const TraceProperty & prop );
+
+    /**
+     * \brief   Gets and set property value of binary log file size in megabytes.
+     **/
+    inline const TraceProperty & getBinarySize( void ) const;
+    inline TraceProperty & getBinarySize( void );
+    inline void setBinarySize( const TraceProperty & prop );
+
     /**
      * \brief   Gets and set property value of file logging settings.
      **/
@@ -353,6 +374,51 @@ inline void LogConfiguration::setAppendData( const TraceProperty & prop )
     mProperties[static_cast<int>(NELogConfig::eLogConfig::ConfigLogAppend)] = prop;
 }
 
+inline const TraceProperty & LogConfiguration::getSyncData( void ) const
+{
+    return mProperties[static_cast<int>(NELogConfig::eLogConfig::ConfigLogSync)];
+}
+
+inline TraceProperty & LogConfiguration::getSyncData( void )
+{
+    return mProperties[static_cast<int>(NELogConfig::eLogConfig::ConfigLogSync)];
+}
+
+inline void LogConfiguration::setSyncData( const TraceProperty & prop )
+{
+    mProperties[static_cast<int>(NELogConfig::eLogConfig::ConfigLogSync)] = prop;
+}
+
+inline const TraceProperty & LogConfiguration::getBinaryFile( void ) const
+{
+    return mProperties[static_cast<int>(NELogConfig::eLogConfig::ConfigLogBinary)];
+}
+
+inline TraceProperty & LogConfiguration::getBinaryFile( void )
+{
+    return mProperties[static_cast<int>(NELogConfig::eLogConfig::ConfigLogBinary)];
+}
+
+inline void LogConfiguration::setBinaryFile( const TraceProperty & prop )
+{
+    mProperties[static_cast<int>(NELogConfig::eLogConfig::ConfigLogBinary)] = prop;
+}
+
+inline const TraceProperty & LogConfiguration::getBinarySize( void ) const
+{
+    return mProperties[static_cast<int>(NELogConfig::eLogConfig::ConfigLogBinarySize)];
+}
+
+inline TraceProperty & LogConfiguration::getBinarySize( void )
+{
+    return mProperties[static_cast<int>(NELogConfig::eLogConfig::ConfigLogBinarySize)];
+}
+
+inline void LogConfiguration::setBinarySize( const TraceProperty & prop )
+{
+    mProperties[static_cast<int>(NELogConfig::eLogConfig::ConfigLogBinarySize)] = prop;
+}
+
 inline const TraceProperty & LogConfiguration::getLogFile( void ) const
 {
     return mProperties[static_cast<int>(NELogConfig::eLogConfig::ConfigLogFile)];
@@ -0,0 +1,131 @@
+#pragma once
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/trace/private/NEBinaryLog.hpp
+ * \ingroup     AREG Asynchronous Event-Driven Communication Framework
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, The format of binary log files.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/trace/NETrace.hpp"
+
+#include <stddef.h>
+
+//////////////////////////////////////////////////////////////////////////
+// NEBinaryLog namespace declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The binary log file starts with the header, followed by the records.
+ *          Every record starts with the record header, which contains the length
+ *          and the type of the record. The records are aligned by RECORD_ALIGN
+ *          bytes. The file is pre-allocated and filled with zeros, so that the
+ *          record with zero length is the end of records.
+ *
+ *          The log record contains the fixed part of NETrace::sLogMessage structure
+ *          till the message text, followed by the null-terminated text of message.
+ *          The names of scopes are not written in the records of entering and
+ *          exiting scope. Instead, the scope name record is written once before
+ *          the first record of the scope.
+ **/
+namespace NEBinaryLog
+{
+    /**
+     * \brief   The magic number of binary log file, the 'ALOG' characters.
+     **/
+    constexpr uint32_t      FILE_MAGIC              { 0x474F4C41u };
+
+    /**
+     * \brief   The version of binary log file format.
+     **/
+    constexpr uint32_t      FILE_VERSION            { 1u };
+
+    /**
+     * \brief   The alignment of records in the binary log file.
+     **/
+    constexpr unsigned int  RECORD_ALIGN            { 8u };
+
+    /**
+     * \brief   The maximum length of module name in the file header, including null-termination.
+     **/
+    constexpr unsigned int  MODULE_NAME_SIZE        { 128u };
+
+    /**
+     * \brief   NEBinaryLog::eRecord
+     *          The types of records in the binary log file.
+     **/
+    enum class eRecord  : uint32_t
+    {
+          RecordEnd     = 0 //!< No more records, the rest of file is empty.
+        , RecordLog         //!< The log record, the fixed part of NETrace::sLogMessage and the message text.
+        , RecordScope       //!< The record of scope name dictionary.
+    };
+
+    /**
+     * \brief   NEBinaryLog::sFileHeader
+     *          The header of binary log file.
+     **/
+    typedef struct S_FileHeader
+    {
+        uint32_t        fhMagic;        //!< The magic number of binary log file, should be FILE_MAGIC.
+        uint32_t        fhVersion;      //!< The version of binary log file format.
+        uint32_t        fhHeaderSize;   //!< The size in bytes of the header, the records start after the header.
+        uint32_t        fhFixedSize;    //!< The size in bytes of fixed part of NETrace::sLogMessage in the log record.
+        uint64_t        fhProcessId;    //!< The ID of logging process.
+        TIME64          fhCreated;      //!< The timestamp when the file was created.
+        char            fhModuleName[MODULE_NAME_SIZE]; //!< The name of logging module.
+    } sFileHeader;
+
+    /**
+     * \brief   NEBinaryLog::sRecord
+     *          The header of the record in the binary log file.
+     **/
+    typedef struct S_Record
+    {
+        uint32_t                recLength;  //!< The length in bytes of complete record, aligned by RECORD_ALIGN.
+        NEBinaryLog::eRecord    recType;    //!< The type of the record.
+    } sRecord;
+
+    /**
+     * \brief   NEBinaryLog::sScopeRecord
+     *          The scope name dictionary record, follows the record header.
+     **/
+    typedef struct S_ScopeRecord
+    {
+        uint32_t        srScopeId;  //!< The ID of scope.
+        uint32_t        srNameLen;  //!< The length of scope name without null-termination.
+        char            srName[1];  //!< The null-terminated name of scope.
+    } sScopeRecord;
+
+    /**
+     * \brief   The size in bytes of fixed part of NETrace::sLogMessage, which is written in the log record.
+     *          The message text of NETrace::LOG_MESSAGE_BUFFER_SIZE characters is not copied,
+     *          only the actual text is written after the fixed part.
+     **/
+    constexpr unsigned int  LOG_FIXED_SIZE          { static_cast<unsigned int>(offsetof(NETrace::sLogMessage, lmTrace) + offsetof(NETrace::sLogData, traceMessage)) };
+
+    /**
+     * \brief   Returns the length of record aligned by RECORD_ALIGN.
+     * \param   length  The length in bytes of the record data.
+     **/
+    inline unsigned int alignRecord( unsigned int length );
+}
+
+//////////////////////////////////////////////////////////////////////////
+// NEBinaryLog namespace inline functions
+//////////////////////////////////////////////////////////////////////////
+
+inline unsigned int NEBinaryLog::alignRecord( unsigned int length )
+{
+    return ((length + NEBinaryLog::RECORD_ALIGN - 1) & ~(NEBinaryLog::RECORD_ALIGN - 1));
+}
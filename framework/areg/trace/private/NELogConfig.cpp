@@ -67,6 +67,18 @@ NELogConfig::eLogConfig NELogConfig::convFromString( const char * cmdSyntax )
         {
             result = NELogConfig::eLogConfig::ConfigLogAppend;
         }
+        else if ( NEString::compareStrings<char, char>(cmdSyntax, SYNTAX_CMD_LOG_SYNC.data( ), static_cast<int>(SYNTAX_CMD_LOG_SYNC.length()), false) == 0 )
+        {
+            result = NELogConfig::eLogConfig::ConfigLogSync;
+        }
+        else if ( NEString::compareStrings<char, char>(cmdSyntax, SYNTAX_CMD_LOG_BINARY.data( ), static_cast<int>(SYNTAX_CMD_LOG_BINARY.length()), false) == 0 )
+        {
+            result = NELogConfig::eLogConfig::ConfigLogBinary;
+        }
+        else if ( NEString::compareStrings<char, char>(cmdSyntax, SYNTAX_CMD_LOG_BINARY_SIZE.data( ), static_cast<int>(SYNTAX_CMD_LOG_BINARY_SIZE.length()), false) == 0 )
+        {
+            result = NELogConfig::eLogConfig::ConfigLogBinarySize;
+        }
         else if ( NEString::compareStrings<char, char>(cmdSyntax, SYNTAX_CMD_LOG_STACK.data( ), static_cast<int>(SYNTAX_CMD_LOG_STACK.length()), false) == 0 )
         {
             result = NELogConfig::eLogConfig::ConfigLogStack;
@@ -122,6 +134,12 @@ const std::string_view & NELogConfig::convToString( NELogConfig::eLogConfig logC
         return NELogConfig::SYNTAX_CMD_LOG_DEBUG;
     case NELogConfig::eLogConfig::ConfigLogAppend:
         return NELogConfig::SYNTAX_CMD_LOG_APPEND;
+    case NELogConfig::eLogConfig::ConfigLogSync:
+        return NELogConfig::SYNTAX_CMD_LOG_SYNC;
+    case NELogConfig::eLogConfig::ConfigLogBinary:
+        return NELogConfig::SYNTAX_CMD_LOG_BINARY;
+    case NELogConfig::eLogConfig::ConfigLogBinarySize:
+        return NELogConfig::SYNTAX_CMD_LOG_BINARY_SIZE;
     case NELogConfig::eLogConfig::ConfigLogStack:
         return NELogConfig::SYNTAX_CMD_LOG_STACK;
     case NELogConfig::eLogConfig::ConfigLogEnable:
@@ -55,6 +55,9 @@ namespace NELogConfig
         , ConfigLogDatabaseName     //!< Configuration property is database name to connect
         , ConfigLogDebug            //!< Configuration property is information to print logging message in output debug console
         , ConfigLogAppend           //!< Configuration property is instruction to append message in existing file or create new logging file.
+        , ConfigLogSync             //!< Configuration property is instruction to synchronize the log file with the storage device when logs are flushed.
+        , ConfigLogBinary           //!< Configuration property is the name of memory-mapped binary log file.
+        , ConfigLogBinarySize       //!< Configuration property is the size in megabytes of binary log file.
         , ConfigLogStack            //!< Configuration property is information of maximum stack size to hold log data before streaming is initialized
         , ConfigLogEnable           //!< Configuration property is information whether logging is enabled or not
         , ConfigLogLayoutEnter      //!< Configuration property is information for layout to output enter scope message
@@ -275,6 +278,18 @@ namespace NELogConfig
      * \breif   The syntax of target (file or database) output command -- append in existing or create new.
      **/
     constexpr std::string_view  SYNTAX_CMD_LOG_APPEND               { "log.append" };
+    /**
+     * \brief   Log file synchronize command
+     **/
+    constexpr std::string_view  SYNTAX_CMD_LOG_SYNC                 { "log.sync" };
+    /**
+     * \brief   Binary log file name command
+     **/
+    constexpr std::string_view  SYNTAX_CMD_LOG_BINARY               { "log.binary" };
+    /**
+     * \brief   Binary log file size command
+     **/
+    constexpr std::string_view  SYNTAX_CMD_LOG_BINARY_SIZE          { "log.binsize" };
     /**
      * \breif   The syntax of logging stack size command.
      **/
@@ -441,6 +456,9 @@ namespace NELogConfig
                 , NELogConfig::SYNTAX_CMD_LOG_DB_NAME           //!< eLogConfig::ConfigLogDatabaseName
                 , NELogConfig::SYNTAX_CMD_LOG_DEBUG             //!< eLogConfig::ConfigLogDebug
                 , NELogConfig::SYNTAX_CMD_LOG_APPEND            //!< eLogConfig::ConfigLogAppend
+                , NELogConfig::SYNTAX_CMD_LOG_SYNC              //!< eLogConfig::ConfigLogSync
+                , NELogConfig::SYNTAX_CMD_LOG_BINARY            //!< eLogConfig::ConfigLogBinary
+                , NELogConfig::SYNTAX_CMD_LOG_BINARY_SIZE       //!< eLogConfig::ConfigLogBinarySize
                 , NELogConfig::SYNTAX_CMD_LOG_STACK             //!< eLogConfig::ConfigLogStack
                 , NELogConfig::SYNTAX_CMD_LOG_ENABLE            //!< eLogConfig::ConfigLogEnable
                 , NELogConfig::SYNTAX_CMD_LOG_LAYOUT_ENTER      //!< eLogConfig::ConfigLogLayoutEnter
@@ -461,6 +479,12 @@ namespace NELogConfig
     //!< The default flag, indicating whether logs are enabled.
     constexpr std::string_view   DEFAULT_LOG_APPEND             { "log.append = false" };
 
+    //!< The default flag, indicating whether the log file is synchronized with the storage device on flush.
+    constexpr std::string_view   DEFAULT_LOG_SYNC               { "log.sync = false" };
+
+    //!< The default size in megabytes of binary log file.
+    constexpr std::string_view   DEFAULT_LOG_BINARY_SIZE        { "log.binsize = 16" };
+
     //!< Logging default layout format of logging scope activation. /*%d: [ %c.%t  %x.%z: Enter --> ]%n*/
     constexpr std::string_view   DEFAULT_LOG_LAYOUT_ENTER       { "log.layout.enter = %d: [ %t  %x.%z: Enter --> ]%n" };
 
@@ -505,6 +529,12 @@ inline const char * NELogConfig::getString( NELogConfig::eLogConfig logConfig )
         return "NELogConfig::ConfigLogDebug";
     case NELogConfig::eLogConfig::ConfigLogAppend:
         return "NELogConfig::ConfigLogNew";
+    case NELogConfig::eLogConfig::ConfigLogSync:
+        return "NELogConfig::ConfigLogSync";
+    case NELogConfig::eLogConfig::ConfigLogBinary:
+        return "NELogConfig::ConfigLogBinary";
+    case NELogConfig::eLogConfig::ConfigLogBinarySize:
+        return "NELogConfig::ConfigLogBinarySize";
     case NELogConfig::eLogConfig::ConfigLogStack:
         return "NELogConfig::ConfigLogStack";
     case NELogConfig::eLogConfig::ConfigLogEnable:
@@ -61,6 +61,7 @@ public:
         , TraceThreadUnregistered       //!< Action to notify the logging thread unregistered
         , TraceChangeStack              //!< Action to notify the to change logging stack size
         , TraceProcessModuleId          //!< Action to set process module ID
+        , TraceFlushRings               //!< Action to output the log records of thread ring buffers
     } eTraceAction;
 
     /**
@@ -203,6 +204,8 @@ inline const char * TraceEventData::getString( TraceEventData::eTraceAction acti
     CASE_MAKE_STRING(TraceEventData::eTraceAction::TraceThreadRegistered);
     CASE_MAKE_STRING(TraceEventData::eTraceAction::TraceThreadUnregistered);
     CASE_MAKE_STRING(TraceEventData::eTraceAction::TraceChangeStack);
+    CASE_MAKE_STRING(TraceEventData::eTraceAction::TraceProcessModuleId);
+    CASE_MAKE_STRING(TraceEventData::eTraceAction::TraceFlushRings);
     CASE_DEFAULT("ERR: Undefined TraceEventData::eTraceAction value!");
     }
 }
@@ -25,6 +25,35 @@
 #include "areg/base/Containers.hpp"
 #include "areg/base/NEString.hpp"
 
+#if defined(AREG_TRACE_RING)
+namespace
+{
+    /**
+     * \brief   The holder of the log record ring of the thread. When the thread exits,
+     *          it releases the ring, which is deleted by the tracer thread.
+     **/
+    class ThreadRingHolder
+    {
+    public:
+        ThreadRingHolder( void ) = default;
+
+        ~ThreadRingHolder( void )
+        {
+            if ( mRing != nullptr )
+            {
+                mRing->releaseRing( );
+                mRing = nullptr;
+            }
+        }
+
+        TraceRing * mRing { nullptr };  //!< The ring of the thread.
+    };
+
+    //!< The log record ring of the current thread.
+    thread_local ThreadRingHolder   _threadRing;
+}
+#endif  // defined(AREG_TRACE_RING)
+
 //////////////////////////////////////////////////////////////////////////
 // TraceManager::TraceScopeMap class implementation
 //////////////////////////////////////////////////////////////////////////
@@ -66,14 +95,72 @@ void TraceManager::sendLogMessage( LogMessage & logData )
 {
     TraceManager & tracer = TraceManager::getInstance();
     logData.setModuleId( tracer.mModuleId );
+#if defined(AREG_TRACE_RING)
+    // the records, which the thread writes in the ring after the message, wait until the message is logged.
+    TraceRing * ring = _threadRing.mRing;
+    if ( ring != nullptr )
+    {
+        ring->postFallback( );
+    }
+
+    if ( (tracer._sendLogEvent( TraceEventData(TraceEventData::eTraceAction::TraceMessage, logData) ) == false) && (ring != nullptr) )
+    {
+        ring->cancelFallback( );
+    }
+#else   // defined(AREG_TRACE_RING)
     tracer._sendLogEvent( TraceEventData(TraceEventData::eTraceAction::TraceMessage, logData) );
+#endif  // defined(AREG_TRACE_RING)
+}
+
+inline bool TraceManager::_sendLogEvent( const TraceEventData & data )
+{
+    return TraceEvent::sendEvent( data, static_cast<IETraceEventConsumer &>(self()), static_cast<DispatcherThread &>(self()) );
 }
 
-inline void TraceManager::_sendLogEvent( const TraceEventData & data )
+#if defined(AREG_TRACE_RING)
+
+inline void TraceManager::_signalRings( void )
 {
-    TraceEvent::sendEvent( data, static_cast<IETraceEventConsumer &>(self()), static_cast<DispatcherThread &>(self()) );
+    // The fence pairs with the fence in _drainRings( ). Either the tracer thread
+    // sees the new record, or this thread sees the cleared flag and notifies the tracer.
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+    if ( (mRingSignaled.load( std::memory_order_relaxed ) == false) && (mRingSignaled.exchange( true ) == false) )
+    {
+        if ( _sendLogEvent( TraceEventData( TraceEventData::eTraceAction::TraceFlushRings ) ) == false )
+        {
+            mRingSignaled.store( false );
+        }
+    }
 }
 
+bool TraceManager::sendLogRecord( unsigned int scopeId, NETrace::eLogPriority msgPrio, const char * format, va_list args )
+{
+    TraceManager & tracer = TraceManager::getInstance();
+    TraceRing * ring = tracer._getThreadRing( );
+    bool result = (ring != nullptr) && ring->pushMessage( scopeId, msgPrio, format, args );
+    if ( result )
+    {
+        tracer._signalRings( );
+    }
+
+    return result;
+}
+
+bool TraceManager::sendScopeRecord( NETrace::eLogType logType, unsigned int scopeId, const char * scopeName )
+{
+    TraceManager & tracer = TraceManager::getInstance();
+    TraceRing * ring = tracer._getThreadRing( );
+    bool result = (ring != nullptr) && ring->pushScope( logType, scopeId, scopeName );
+    if ( result )
+    {
+        tracer._signalRings( );
+    }
+
+    return result;
+}
+
+#endif  // defined(AREG_TRACE_RING)
+
 bool TraceManager::startLogging( const char * configFile /*= nullptr*/, unsigned int waitTimeout /*= NECommon::WAIT_INFINITE*/ )
 {
     TraceManager & traceManager = TraceManager::getInstance();
@@ -181,11 +268,35 @@ TraceManager::TraceManager(void)
     , mModuleId         ( Process::getInstance().getId() )
 
     , mLoggerFile       ( mLogConfig )
+    , mLoggerBinary     ( mLogConfig )
     , mLoggerDebug      ( mLogConfig )
 
     , mLogStarted       ( false, false )
     , mLock             ( )
+#if defined(AREG_TRACE_RING)
+    , mRingList         ( )
+    , mRingLock         ( )
+    , mRingSignaled     ( false )
+#endif  // defined(AREG_TRACE_RING)
+{
+}
+
+TraceManager::~TraceManager( void )
 {
+#if defined(AREG_TRACE_RING)
+    // The rings of running threads are not deleted, the threads still can log.
+    Lock lock( mRingLock );
+    for ( int i = 0; i < mRingList.getSize(); ++ i )
+    {
+        TraceRing * ring = mRingList[i];
+        if ( ring->isReleased() )
+        {
+            delete ring;
+        }
+    }
+
+    mRingList.removeAll();
+#endif  // defined(AREG_TRACE_RING)
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -444,7 +555,7 @@ bool TraceManager::initializeConfig(void)
 
 bool TraceManager::_isValid(void) const
 {
-    return (mLogConfig.getVersion().isValid() ? (isFileValid() || isHostValid() || isDebugOutputValid() || isDatabaseValid()) : false);
+    return (mLogConfig.getVersion().isValid() ? (isFileValid() || isBinaryValid() || isHostValid() || isDebugOutputValid() || isDatabaseValid()) : false);
 }
 
 bool TraceManager::_isEnabled(void) const
@@ -467,6 +578,11 @@ bool TraceManager::isFileValid(void) const
     return mLogConfig.getLogFile().isValid();
 }
 
+bool TraceManager::isBinaryValid(void) const
+{
+    return mLogConfig.getBinaryFile().isValid();
+}
+
 bool TraceManager::isDebugOutputValid(void) const
 {
     return mLogConfig.getDebugOutput().isValid();
@@ -524,12 +640,18 @@ void TraceManager::processEvent(const TraceEventData & data)
     case TraceEventData::eTraceAction::TraceStartLogs:
         {
             traceStartLogs( );
+#if defined(AREG_TRACE_RING)
+            _drainRings( );
+#endif  // defined(AREG_TRACE_RING)
             mLogStarted.setEvent();
         }
         break;
 
     case TraceEventData::eTraceAction::TraceStopLogs:
         {
+#if defined(AREG_TRACE_RING)
+            _drainRings( );
+#endif  // defined(AREG_TRACE_RING)
             traceStopLogs( );
             triggerExitEvent();
             mLogStarted.resetEvent();
@@ -558,7 +680,23 @@ void TraceManager::processEvent(const TraceEventData & data)
 
     case TraceEventData::eTraceAction::TraceMessage:
         {
+#if defined(AREG_TRACE_RING)
+            // output the records, which the thread has written before the message
+            LogMessage logMessage( static_cast<const IEInStream &>(stream) );
+            _drainRings( );
+            traceMessage( logMessage );
+            _completeFallback( logMessage.lmTrace.traceThreadId );
+#else   // defined(AREG_TRACE_RING)
             traceMessage( LogMessage(static_cast<const IEInStream &>(stream)) );
+#endif  // defined(AREG_TRACE_RING)
+        }
+        break;
+
+    case TraceEventData::eTraceAction::TraceFlushRings:
+        {
+#if defined(AREG_TRACE_RING)
+            _drainRings( );
+#endif  // defined(AREG_TRACE_RING)
         }
         break;
 
@@ -573,6 +711,7 @@ bool TraceManager::runDispatcher(void)
     bool result = DispatcherThread::runDispatcher();
 
     mLoggerFile.closeLogger();
+    mLoggerBinary.closeLogger();
     mLoggerDebug.closeLogger();
 
     TraceEvent::removeListener(static_cast<IETraceEventConsumer &>(self()), static_cast<DispatcherThread &>(self()));
@@ -586,6 +725,7 @@ void TraceManager::traceStartLogs( void )
     {
         setScopesActivity( true );
         mLoggerFile.openLogger();
+        mLoggerBinary.openLogger();
 #if defined(_OUTPUT_DEBUG)
         mLoggerDebug.openLogger();
 #endif // !defined(_OUTPUT_DEBUG)
@@ -682,6 +822,7 @@ void TraceManager::onUpdateScopes(SortedStringList & scopeList)
 void TraceManager::traceMessage( const LogMessage & logMessage )
 {
     mLoggerFile.logMessage( static_cast<const NETrace::sLogMessage &>(logMessage) );
+    mLoggerBinary.logMessage( static_cast<const NETrace::sLogMessage &>(logMessage) );
     mLoggerDebug.logMessage( static_cast<const NETrace::sLogMessage &>(logMessage) );
 
     if ( hasMoreEvents() == false )
@@ -690,6 +831,106 @@ void TraceManager::traceMessage( const LogMessage & logMessage )
     }
 }
 
+#if defined(AREG_TRACE_RING)
+
+TraceRing * TraceManager::_getThreadRing( void )
+{
+    if ( _threadRing.mRing == nullptr )
+    {
+        TraceRing * ring = DEBUG_NEW TraceRing( );
+        if ( ring != nullptr )
+        {
+            Lock lock( mRingLock );
+            mRingList.add( ring );
+            _threadRing.mRing = ring;
+        }
+    }
+
+    return _threadRing.mRing;
+}
+
+void TraceManager::_drainRings( void )
+{
+    mRingSignaled.store( false, std::memory_order_relaxed );
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+
+    Lock lock( mRingLock );
+
+    LogMessage logMessage( NETrace::LogMessage );
+    logMessage.setModuleId( mModuleId );
+
+    for ( int i = 0; i < mRingList.getSize(); )
+    {
+        TraceRing * ring = mRingList[i];
+        // check before draining, the released ring does not get new records.
+        bool released = ring->isReleased( );
+
+        // the number of records is limited, so that the busy thread does not block others.
+        // the records written after the message logged without ring wait for the message.
+        const TraceRing::sRingRecord * record = ring->readyRecord( );
+        for ( unsigned int count = 0; (record != nullptr) && (count < TraceRing::RING_SLOT_COUNT); ++ count )
+        {
+            logMessage.lmHeader.logType         = record->rrLogType;
+            logMessage.lmTrace.traceThreadId    = record->rrThreadId;
+            logMessage.lmTrace.traceScopeId     = record->rrScopeId;
+            logMessage.lmTrace.traceTimestamp   = record->rrTimestamp;
+            logMessage.lmTrace.traceMessagePrio = record->rrLogPrio;
+            logMessage.lmTrace.traceMessageLen  = TraceRing::formatRecord( *record, logMessage.lmTrace.traceMessage, NETrace::LOG_MESSAGE_BUFFER_SIZE );
+
+            ring->popRecord( );
+            record = ring->readyRecord( );
+
+            mLoggerFile.logMessage( static_cast<const NETrace::sLogMessage &>(logMessage) );
+            mLoggerBinary.logMessage( static_cast<const NETrace::sLogMessage &>(logMessage) );
+            mLoggerDebug.logMessage( static_cast<const NETrace::sLogMessage &>(logMessage) );
+        }
+
+        if ( record != nullptr )
+        {
+            // there are more records, continue in the next event.
+            _signalRings( );
+            ++ i;
+        }
+        else if ( released && (ring->frontRecord( ) == nullptr) && (ring->hasFallback( ) == false) )
+        {
+            mRingList.removeAt( i );
+            delete ring;
+        }
+        else
+        {
+            ++ i;
+        }
+    }
+
+    if ( hasMoreEvents( ) == false )
+    {
+        mLoggerFile.flushLogs( );
+    }
+}
+
+void TraceManager::_completeFallback( ITEM_ID threadId )
+{
+    Lock lock( mRingLock );
+    for ( int i = 0; i < mRingList.getSize(); ++ i )
+    {
+        // the exited thread has the same ID as the new one, the older ring is earlier in the list.
+        TraceRing * ring = mRingList[i];
+        if ( (ring->getThreadId( ) == threadId) && ring->hasFallback( ) )
+        {
+            ring->completeFallback( );
+            if ( ring->frontRecord( ) != nullptr )
+            {
+                // the records written after the message are notified before, drain them again.
+                _signalRings( );
+            }
+
+            break;
+        }
+    }
+}
+
+#endif  // defined(AREG_TRACE_RING)
+
 void TraceManager::activateScope( TraceScope & traceScope )
 {
     Lock lock(mLock);
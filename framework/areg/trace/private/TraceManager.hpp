@@ -24,6 +24,7 @@
 
 #include "areg/trace/private/LogConfiguration.hpp"
 #include "areg/base/TEResourceMap.hpp"
+#include "areg/base/TEArrayList.hpp"
 #include "areg/base/Containers.hpp"
 #include "areg/base/Version.hpp"
 #include "areg/base/String.hpp"
@@ -31,8 +32,12 @@
 
 #include "areg/trace/NETrace.hpp"
 #include "areg/trace/private/TraceProperty.hpp"
+#include "areg/trace/private/BinaryLogger.hpp"
 #include "areg/trace/private/FileLogger.hpp"
 #include "areg/trace/private/DebugOutputLogger.hpp"
+#include "areg/trace/private/TraceRing.hpp"
+
+#include <atomic>
 
 #include <string_view>
 
@@ -113,6 +118,13 @@ private:
      **/
     using ListProperties    = TELinkedList<TraceProperty, const TraceProperty &>;
 
+#if defined(AREG_TRACE_RING)
+    /**
+     * \brief   The list of log record rings of logging threads
+     **/
+    using ListRings         = TEArrayList<TraceRing *>;
+#endif  // defined(AREG_TRACE_RING)
+
     //!< The thread name of tracer
     static constexpr std::string_view   TRACER_THREAD_NAME          { "_AREG_TRACER_THREAD_" };
 
@@ -157,6 +169,30 @@ public:
      **/
     static void sendLogMessage( LogMessage & logData );
 
+#if defined(AREG_TRACE_RING)
+    /**
+     * \brief   Writes the binary record of logging message in the ring of the current thread.
+     *          The message is formatted in the tracer thread.
+     * \param   scopeId     The ID of trace scope to make messaging.
+     * \param   msgPrio     The priority of message to output.
+     * \param   format      The format of the message, should be a literal.
+     * \param   args        The list of arguments to set in formated text.
+     * \return  Returns true if the record is written. Returns false if the record cannot
+     *          be written, so that the message should be sent by calling sendLogMessage( ).
+     **/
+    static bool sendLogRecord( unsigned int scopeId, NETrace::eLogPriority msgPrio, const char * format, va_list args );
+
+    /**
+     * \brief   Writes the binary record to enter or exit the scope in the ring of the current thread.
+     * \param   logType     The type of logging, either NETrace::LogScopeEnter or NETrace::LogScopeExit.
+     * \param   scopeId     The ID of trace scope.
+     * \param   scopeName   The name of trace scope.
+     * \return  Returns true if the record is written. Returns false if the record cannot
+     *          be written, so that the message should be sent by calling sendLogMessage( ).
+     **/
+    static bool sendScopeRecord( NETrace::eLogType logType, unsigned int scopeId, const char * scopeName );
+#endif  // defined(AREG_TRACE_RING)
+
     /**
      * \brief   Call to configure logging. The passed configuration file name should be either
      *          full or relative path to configuration file. If passed nullptr,
@@ -247,7 +283,7 @@ private:
     /**
      * \brief   Protected destructor.
      **/
-    virtual ~TraceManager( void ) = default;
+    virtual ~TraceManager( void );
 
 //////////////////////////////////////////////////////////////////////////
 // Attributes and operations
@@ -539,9 +575,38 @@ private:
     inline TraceManager & self( void );
 
     /**
-     * \brief   Send log event, which contains specified logging event data
+     * \brief   Send log event, which contains specified logging event data.
+     *          Returns true if the event is sent.
+     **/
+    bool _sendLogEvent( const TraceEventData & data );
+
+#if defined(AREG_TRACE_RING)
+    /**
+     * \brief   Returns the log record ring of the current thread. On first call in
+     *          the thread it creates and registers the ring. Returns nullptr if failed.
+     **/
+    TraceRing * _getThreadRing( void );
+
+    /**
+     * \brief   Notifies the tracer thread to drain the rings, if it is not notified yet.
+     **/
+    void _signalRings( void );
+
+    /**
+     * \brief   Called in the tracer thread to log the records of all rings.
+     *          The rings released by exited threads are deleted when drained.
+     *          The records written after the message, which is logged without ring
+     *          and is not logged yet, are not drained.
+     **/
+    void _drainRings( void );
+
+    /**
+     * \brief   Called in the tracer thread when the message, which the thread logged
+     *          without ring, is logged. The records written after the message can be drained.
+     * \param   threadId    The ID of thread, which logged the message.
      **/
-    void _sendLogEvent( const TraceEventData & data );
+    void _completeFallback( ITEM_ID threadId );
+#endif  // defined(AREG_TRACE_RING)
 
 /************************************************************************/
 // Logging configuration, start / stop
@@ -626,6 +691,11 @@ private:
      **/
     bool isFileValid( void ) const;
 
+    /**
+     * \brief   Returns true, if settings to log traces in binary file are valid.
+     **/
+    bool isBinaryValid( void ) const;
+
     /**
      * \brief   Returns true, if settings to log traces in debugging output window are valid.
      **/
@@ -719,6 +789,10 @@ private:
      * \brief   The file logger object, to output logs in the file.
      **/
     FileLogger          mLoggerFile;
+    /**
+     * \brief   The binary logger object, to output binary log records in the memory-mapped file.
+     **/
+    BinaryLogger        mLoggerBinary;
     /**
      * \brief   The debug output logger to output logs in the output device (window).
      **/
@@ -732,6 +806,21 @@ private:
      **/
     mutable ResourceLock    mLock;
 
+#if defined(AREG_TRACE_RING)
+    /**
+     * \brief   The list of log record rings of logging threads.
+     **/
+    ListRings           mRingList;
+    /**
+     * \brief   Synchronization object used to register and drain the rings.
+     **/
+    ResourceLock        mRingLock;
+    /**
+     * \brief   Flag, indicating whether the tracer thread is notified to drain the rings.
+     **/
+    std::atomic_bool    mRingSignaled;
+#endif  // defined(AREG_TRACE_RING)
+
 private:
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
@@ -30,8 +30,13 @@ TraceMessage::TraceMessage( const TraceScope & traceScope )
 {
     if ( isScopeEnabled() )
     {
-        LogMessage msg(NETrace::LogScopeEnter, mScopeId, NETrace::PrioScope, mScopeName);
-        TraceManager::sendLogMessage(msg);
+#if defined(AREG_TRACE_RING)
+        if ( TraceManager::sendScopeRecord(NETrace::LogScopeEnter, mScopeId, mScopeName.getString()) == false )
+#endif  // defined(AREG_TRACE_RING)
+        {
+            LogMessage msg(NETrace::LogScopeEnter, mScopeId, NETrace::PrioScope, mScopeName);
+            TraceManager::sendLogMessage(msg);
+        }
     }
 }
 
@@ -40,8 +45,13 @@ TraceMessage::~TraceMessage( void )
 {
     if ( isScopeEnabled() )
     {
-        LogMessage msg(NETrace::LogScopeExit, mScopeId, NETrace::PrioScope, mScopeName);
-        TraceManager::sendLogMessage(msg);
+#if defined(AREG_TRACE_RING)
+        if ( TraceManager::sendScopeRecord(NETrace::LogScopeExit, mScopeId, mScopeName.getString()) == false )
+#endif  // defined(AREG_TRACE_RING)
+        {
+            LogMessage msg(NETrace::LogScopeExit, mScopeId, NETrace::PrioScope, mScopeName);
+            TraceManager::sendLogMessage(msg);
+        }
     }
 }
 
@@ -118,7 +128,13 @@ void TraceMessage::logTrace( NETrace::eLogPriority logPrio, const char * format,
 
 inline void TraceMessage::_sendLog( unsigned int scopeId, NETrace::eLogPriority msgPrio, const char * format, va_list args )
 {
-    LogMessage logData(NETrace::LogMessage, scopeId, msgPrio, nullptr, 0);
-    logData.lmTrace.traceMessageLen = String::formatStringList( logData.lmTrace.traceMessage, NETrace::LOG_MESSAGE_BUFFER_SIZE, format, args );
-    TraceManager::sendLogMessage( logData );
+#if defined(AREG_TRACE_RING)
+    // the message is formatted in the tracer thread
+    if ( TraceManager::sendLogRecord( scopeId, msgPrio, format, args ) == false )
+#endif  // defined(AREG_TRACE_RING)
+    {
+        LogMessage logData(NETrace::LogMessage, scopeId, msgPrio, nullptr, 0);
+        logData.lmTrace.traceMessageLen = String::formatStringList( logData.lmTrace.traceMessage, NETrace::LOG_MESSAGE_BUFFER_SIZE, format, args );
+        TraceManager::sendLogMessage( logData );
+    }
 }
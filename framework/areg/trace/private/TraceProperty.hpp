@@ -37,7 +37,7 @@ class File;
  *          of property key and property value pairs. The properties
  *          are used to read or save data in logging configuration file.
  **/
-class TraceProperty
+class AREG_API TraceProperty
 {
 //////////////////////////////////////////////////////////////////////////
 // Internal types and constants
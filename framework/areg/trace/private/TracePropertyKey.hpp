@@ -28,7 +28,7 @@
  * \brief   The logging property key object, which is containing
  *          key and module names of the property.
  **/
-class TracePropertyKey
+class AREG_API TracePropertyKey
 {
 //////////////////////////////////////////////////////////////////////////
 // Constructors / destructor
@@ -33,7 +33,7 @@
  *          The property value object gets value as string (in most cases)
  *          and converts to appropriate value type.
  **/
-class TracePropertyValue
+class AREG_API TracePropertyValue
 {
 //////////////////////////////////////////////////////////////////////////
 // Constructors / Destructor
@@ -0,0 +1,542 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/trace/private/TraceRing.cpp
+ * \ingroup     AREG Asynchronous Event-Driven Communication Framework
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, The per thread ring buffer of binary log records.
+ ************************************************************************/
+#include "areg/trace/private/TraceRing.hpp"
+
+#include "areg/base/DateTime.hpp"
+#include "areg/base/Thread.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+//////////////////////////////////////////////////////////////////////////
+// TraceRing class local types and functions
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    //!< The maximum length of single conversion specification.
+    constexpr unsigned int  MAX_SPEC_LENGTH { 32 };
+
+    //!< The maximum number of '*' width and precision arguments.
+    constexpr unsigned int  MAX_SPEC_STARS  { 2 };
+
+    //!< The size in bytes of numeric argument in the record.
+    constexpr unsigned int  ARG_VALUE_SIZE  { static_cast<unsigned int>(sizeof(uint64_t)) };
+
+    //!< The types of arguments of the conversions.
+    typedef enum class E_ArgType
+    {
+          ArgNone           //!< No argument, the '%%' conversion
+        , ArgInt            //!< The 'int' argument
+        , ArgLong           //!< The 'long' argument
+        , ArgLongLong       //!< The 'long long' argument
+        , ArgSize           //!< The 'size_t' argument
+        , ArgIntMax         //!< The 'intmax_t' argument
+        , ArgPtrDiff        //!< The 'ptrdiff_t' argument
+        , ArgDouble         //!< The 'double' argument
+        , ArgLongDouble     //!< The 'long double' argument
+        , ArgPointer        //!< The pointer argument
+        , ArgString         //!< The string argument
+        , ArgInvalid        //!< The conversion is not supported
+    } eArgType;
+
+    //!< The parsed conversion specification.
+    typedef struct S_FormatSpec
+    {
+        eArgType        fsType;         //!< The type of argument.
+        unsigned int    fsLength;       //!< The length of specification, including '%'.
+        unsigned int    fsStars;        //!< The number of '*' width and precision arguments.
+        bool            fsStarPrec;     //!< Flag, indicating whether the precision is '*' argument.
+        int             fsPrecision;    //!< The precision of specification or -1 if it is not set or it is '*' argument.
+    } sFormatSpec;
+
+    /**
+     * \brief   Parses the conversion specification, which starts with '%'.
+     **/
+    void _parseSpec( const char * spec, sFormatSpec & out )
+    {
+        out.fsType      = eArgType::ArgInvalid;
+        out.fsStars     = 0;
+        out.fsPrecision = -1;
+
+        const char * pos = spec + 1;
+        while ( (*pos == '-') || (*pos == '+') || (*pos == ' ') || (*pos == '#') || (*pos == '0') || (*pos == '\'') )
+            ++ pos;
+
+        if ( *pos == '*' )
+        {
+            ++ out.fsStars;
+            ++ pos;
+        }
+        else
+        {
+            while ( (*pos >= '0') && (*pos <= '9') )
+                ++ pos;
+        }
+
+        bool starPrecision = false;
+        if ( *pos == '.' )
+        {
+            ++ pos;
+            if ( *pos == '*' )
+            {
+                starPrecision = true;
+                ++ out.fsStars;
+                ++ pos;
+            }
+            else
+            {
+                out.fsPrecision = 0;
+                for ( ; (*pos >= '0') && (*pos <= '9'); ++ pos )
+                    out.fsPrecision = out.fsPrecision * 10 + (*pos - '0');
+            }
+        }
+
+        eArgType intType = eArgType::ArgInt;
+        bool isLongDouble= false;
+        bool isWide      = false;
+        switch ( *pos )
+        {
+        case 'h':
+            pos += (pos[1] == 'h' ? 2 : 1);
+            break;
+        case 'l':
+            intType = pos[1] == 'l' ? eArgType::ArgLongLong : eArgType::ArgLong;
+            isWide  = pos[1] != 'l';
+            pos    += (pos[1] == 'l' ? 2 : 1);
+            break;
+        case 'L':
+        case 'q':
+            intType = eArgType::ArgLongLong;
+            isLongDouble = true;
+            ++ pos;
+            break;
+        case 'z':
+            intType = eArgType::ArgSize;
+            ++ pos;
+            break;
+        case 'j':
+            intType = eArgType::ArgIntMax;
+            ++ pos;
+            break;
+        case 't':
+            intType = eArgType::ArgPtrDiff;
+            ++ pos;
+            break;
+        default:
+            break;
+        }
+
+        switch ( *pos )
+        {
+        case '%':
+            out.fsType = (pos == spec + 1) ? eArgType::ArgNone : eArgType::ArgInvalid;
+            break;
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+            out.fsType = intType;
+            break;
+        case 'c':
+            out.fsType = isWide ? eArgType::ArgInvalid : eArgType::ArgInt;
+            break;
+        case 'e':
+        case 'E':
+        case 'f':
+        case 'F':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            out.fsType = isLongDouble ? eArgType::ArgLongDouble : eArgType::ArgDouble;
+            break;
+        case 'p':
+            out.fsType = eArgType::ArgPointer;
+            break;
+        case 's':
+            out.fsType = isWide ? eArgType::ArgInvalid : eArgType::ArgString;
+            break;
+        default:
+            break; // the '%n', wide and platform specific conversions are not supported.
+        }
+
+        out.fsLength    = static_cast<unsigned int>(pos - spec) + (*pos != '\0' ? 1 : 0);
+        out.fsStarPrec  = starPrecision;
+        if ( out.fsLength >= MAX_SPEC_LENGTH )
+        {
+            out.fsType = eArgType::ArgInvalid;
+        }
+    }
+
+    /**
+     * \brief   Writes the numeric value in the data of record.
+     **/
+    inline bool _writeValue( unsigned char * data, unsigned int & len, const void * value, unsigned int size )
+    {
+        bool result = false;
+        if ( len + ARG_VALUE_SIZE <= TraceRing::RING_DATA_SIZE )
+        {
+            uint64_t raw = 0;
+            ::memcpy( &raw, value, size );
+            ::memcpy( data + len, &raw, ARG_VALUE_SIZE );
+            len += ARG_VALUE_SIZE;
+            result = true;
+        }
+
+        return result;
+    }
+
+    /**
+     * \brief   Reads the numeric value from the data of record.
+     **/
+    template<typename Type>
+    inline Type _readValue( const unsigned char * data, unsigned int & pos )
+    {
+        Type value{ };
+        ::memcpy( &value, data + pos, sizeof(Type) );
+        pos += ARG_VALUE_SIZE;
+        return value;
+    }
+
+    /**
+     * \brief   Writes the string in the data of record. Fails if the string does not
+     *          fit the record, so that the message is not truncated. The 'maxLength'
+     *          limits the string if the conversion has precision, so that not
+     *          null-terminated strings can be logged.
+     **/
+    inline bool _writeString( unsigned char * data, unsigned int & len, const char * str, int maxLength )
+    {
+        bool result = false;
+        if ( len < TraceRing::RING_DATA_SIZE )
+        {
+            const char * src = str != nullptr ? str : "(null)";
+            unsigned int space = TraceRing::RING_DATA_SIZE - len - 1;
+            unsigned int limit = maxLength >= 0 ? static_cast<unsigned int>(maxLength) : ~0u;
+
+            unsigned int count = 0;
+            char * dst = reinterpret_cast<char *>(data + len);
+            for ( ; (count < limit) && (count < space) && (src[count] != '\0'); ++ count )
+            {
+                dst[count] = src[count];
+            }
+
+            // the string fits if the limit or the end of string is reached.
+            if ( (count == limit) || (src[count] == '\0') )
+            {
+                dst[count] = '\0';
+                len += count + 1;
+                result = true;
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * \brief   Prints single argument of the conversion.
+     **/
+    template<typename Type>
+    inline int _printValue( char * buffer, unsigned int space, const char * spec, const int * stars, unsigned int count, Type value )
+    {
+        int result = 0;
+        switch ( count )
+        {
+        case 0:
+            result = ::snprintf( buffer, space, spec, value );
+            break;
+        case 1:
+            result = ::snprintf( buffer, space, spec, stars[0], value );
+            break;
+        default:
+            result = ::snprintf( buffer, space, spec, stars[0], stars[1], value );
+            break;
+        }
+
+        return result;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// TraceRing class implementation
+//////////////////////////////////////////////////////////////////////////
+
+TraceRing::TraceRing( void )
+    : mHead     ( 0 )
+    , mSlots    ( )
+    , mTail     ( 0 )
+    , mReleased ( false )
+    , mFallbackPosted   ( 0 )
+    , mFallbackDone     ( 0 )
+    , mThreadId ( Thread::getCurrentThreadId() )
+{
+    static_assert( (RING_SLOT_COUNT & (RING_SLOT_COUNT - 1)) == 0, "The number of slots should be power of 2" );
+    static_assert( (RING_SLOT_SIZE % sizeof(uint64_t)) == 0, "The size of slot should be aligned" );
+}
+
+bool TraceRing::pushMessage( unsigned int scopeId, NETrace::eLogPriority msgPrio, const char * format, va_list args )
+{
+    bool result = false;
+    sRingRecord * record = _backRecord( );
+    if ( (record != nullptr) && (format != nullptr) )
+    {
+        va_list list;
+        va_copy( list, args );
+
+        unsigned int len = 0;
+        bool valid = true;
+        for ( const char * pos = format; valid && (*pos != '\0'); ++ pos )
+        {
+            if ( *pos != '%' )
+                continue;
+
+            sFormatSpec spec;
+            _parseSpec( pos, spec );
+            pos += spec.fsLength - 1;
+
+            int star = -1;
+            for ( unsigned int i = 0; valid && (i < spec.fsStars); ++ i )
+            {
+                star  = va_arg( list, int );
+                valid = _writeValue( record->rrData, len, &star, sizeof(int) );
+            }
+
+            switch ( valid ? spec.fsType : eArgType::ArgInvalid )
+            {
+            case eArgType::ArgNone:
+                break;
+            case eArgType::ArgInt:
+                {
+                    int value = va_arg( list, int );
+                    valid = _writeValue( record->rrData, len, &value, sizeof(int) );
+                }
+                break;
+            case eArgType::ArgLong:
+                {
+                    long value = va_arg( list, long );
+                    valid = _writeValue( record->rrData, len, &value, sizeof(long) );
+                }
+                break;
+            case eArgType::ArgLongLong:
+                {
+                    long long value = va_arg( list, long long );
+                    valid = _writeValue( record->rrData, len, &value, sizeof(long long) );
+                }
+                break;
+            case eArgType::ArgSize:
+                {
+                    size_t value = va_arg( list, size_t );
+                    valid = _writeValue( record->rrData, len, &value, sizeof(size_t) );
+                }
+                break;
+            case eArgType::ArgIntMax:
+                {
+                    intmax_t value = va_arg( list, intmax_t );
+                    valid = _writeValue( record->rrData, len, &value, sizeof(intmax_t) );
+                }
+                break;
+            case eArgType::ArgPtrDiff:
+                {
+                    ptrdiff_t value = va_arg( list, ptrdiff_t );
+                    valid = _writeValue( record->rrData, len, &value, sizeof(ptrdiff_t) );
+                }
+                break;
+            case eArgType::ArgDouble:
+                {
+                    double value = va_arg( list, double );
+                    valid = _writeValue( record->rrData, len, &value, sizeof(double) );
+                }
+                break;
+            case eArgType::ArgLongDouble:
+                {
+                    // the precision of long double is reduced to double
+                    double value = static_cast<double>(va_arg( list, long double ));
+                    valid = _writeValue( record->rrData, len, &value, sizeof(double) );
+                }
+                break;
+            case eArgType::ArgPointer:
+                {
+                    const void * value = va_arg( list, const void * );
+                    valid = _writeValue( record->rrData, len, &value, sizeof(const void *) );
+                }
+                break;
+            case eArgType::ArgString:
+                {
+                    const char * value = va_arg( list, const char * );
+                    valid = _writeString( record->rrData, len, value, spec.fsStarPrec ? star : spec.fsPrecision );
+                }
+                break;
+            case eArgType::ArgInvalid:  // fall through
+            default:
+                valid = false;
+                break;
+            }
+        }
+
+        va_end( list );
+
+        if ( valid )
+        {
+            record->rrTimestamp = DateTime::getNow( );
+            record->rrThreadId  = mThreadId;
+            record->rrFormat    = format;
+            record->rrScopeId   = scopeId;
+            record->rrLogType   = NETrace::LogMessage;
+            record->rrLogPrio   = msgPrio;
+            record->rrDataLen   = len;
+            record->rrFallbacks = mFallbackPosted.load( std::memory_order_relaxed );
+            _pushRecord( );
+            result = true;
+        }
+    }
+
+    return result;
+}
+
+bool TraceRing::pushScope( NETrace::eLogType logType, unsigned int scopeId, const char * scopeName )
+{
+    bool result = false;
+    sRingRecord * record = _backRecord( );
+    if ( record != nullptr )
+    {
+        unsigned int len = 0;
+        if ( _writeString( record->rrData, len, scopeName, -1 ) )
+        {
+            record->rrTimestamp = DateTime::getNow( );
+            record->rrThreadId  = mThreadId;
+            record->rrFormat    = nullptr;
+            record->rrScopeId   = scopeId;
+            record->rrLogType   = logType;
+            record->rrLogPrio   = NETrace::PrioScope;
+            record->rrDataLen   = len;
+            record->rrFallbacks = mFallbackPosted.load( std::memory_order_relaxed );
+            _pushRecord( );
+            result = true;
+        }
+    }
+
+    return result;
+}
+
+unsigned int TraceRing::formatRecord( const TraceRing::sRingRecord & record, char * buffer, unsigned int space )
+{
+    ASSERT( (buffer != nullptr) && (space != 0) );
+
+    unsigned int len = 0;
+    if ( record.rrFormat == nullptr )
+    {
+        const char * str = reinterpret_cast<const char *>(record.rrData);
+        for ( ; (len + 1 < space) && (len < record.rrDataLen) && (str[len] != '\0'); ++ len )
+        {
+            buffer[len] = str[len];
+        }
+    }
+    else
+    {
+        unsigned int pos = 0;
+        for ( const char * fmt = record.rrFormat; (*fmt != '\0') && (len + 1 < space); ++ fmt )
+        {
+            if ( *fmt != '%' )
+            {
+                buffer[len ++] = *fmt;
+                continue;
+            }
+
+            sFormatSpec spec;
+            _parseSpec( fmt, spec );
+
+            char specText[MAX_SPEC_LENGTH];
+            ::memcpy( specText, fmt, spec.fsLength );
+            specText[spec.fsLength] = '\0';
+            fmt += spec.fsLength - 1;
+
+            int stars[MAX_SPEC_STARS] { 0, 0 };
+            for ( unsigned int i = 0; i < spec.fsStars; ++ i )
+            {
+                stars[i] = _readValue<int>( record.rrData, pos );
+            }
+
+            char * out = buffer + len;
+            unsigned int rest = space - len;
+            int written = 0;
+            switch ( spec.fsType )
+            {
+            case eArgType::ArgNone:
+                *out    = '%';
+                written = 1;
+                break;
+            case eArgType::ArgInt:
+                written = _printValue( out, rest, specText, stars, spec.fsStars, _readValue<int>( record.rrData, pos ) );
+                break;
+            case eArgType::ArgLong:
+                written = _printValue( out, rest, specText, stars, spec.fsStars, _readValue<long>( record.rrData, pos ) );
+                break;
+            case eArgType::ArgLongLong:
+                written = _printValue( out, rest, specText, stars, spec.fsStars, _readValue<long long>( record.rrData, pos ) );
+                break;
+            case eArgType::ArgSize:
+                written = _printValue( out, rest, specText, stars, spec.fsStars, _readValue<size_t>( record.rrData, pos ) );
+                break;
+            case eArgType::ArgIntMax:
+                written = _printValue( out, rest, specText, stars, spec.fsStars, _readValue<intmax_t>( record.rrData, pos ) );
+                break;
+            case eArgType::ArgPtrDiff:
+                written = _printValue( out, rest, specText, stars, spec.fsStars, _readValue<ptrdiff_t>( record.rrData, pos ) );
+                break;
+            case eArgType::ArgDouble:
+                written = _printValue( out, rest, specText, stars, spec.fsStars, _readValue<double>( record.rrData, pos ) );
+                break;
+            case eArgType::ArgLongDouble:
+                written = _printValue( out, rest, specText, stars, spec.fsStars, static_cast<long double>(_readValue<double>( record.rrData, pos )) );
+                break;
+            case eArgType::ArgPointer:
+                written = _printValue( out, rest, specText, stars, spec.fsStars, _readValue<const void *>( record.rrData, pos ) );
+                break;
+            case eArgType::ArgString:
+                {
+                    const char * str = reinterpret_cast<const char *>(record.rrData + pos);
+                    pos += static_cast<unsigned int>(::strlen( str )) + 1;
+                    written = _printValue( out, rest, specText, stars, spec.fsStars, str );
+                }
+                break;
+            case eArgType::ArgInvalid:  // fall through
+            default:
+                ASSERT( false );    // the record with invalid conversion is not written
+                break;
+            }
+
+            if ( written > 0 )
+            {
+                len += MACRO_MIN( static_cast<unsigned int>(written), rest - 1 );
+            }
+        }
+    }
+
+    buffer[len] = '\0';
+    return len;
+}
+
+inline TraceRing::sRingRecord * TraceRing::_backRecord( void )
+{
+    unsigned int tail = mTail.load( std::memory_order_relaxed );
+    return (tail - mHead.load( std::memory_order_acquire ) < RING_SLOT_COUNT ? reinterpret_cast<sRingRecord *>(reinterpret_cast<unsigned char *>(mSlots) + (tail & (RING_SLOT_COUNT - 1)) * RING_SLOT_SIZE) : nullptr);
+}
+
+inline void TraceRing::_pushRecord( void )
+{
+    mTail.store( mTail.load( std::memory_order_relaxed ) + 1, std::memory_order_release );
+}
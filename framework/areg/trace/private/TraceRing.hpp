@@ -0,0 +1,310 @@
+#pragma once
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/trace/private/TraceRing.hpp
+ * \ingroup     AREG Asynchronous Event-Driven Communication Framework
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, The per thread ring buffer of binary log records.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/trace/NETrace.hpp"
+
+#include <atomic>
+#include <stdarg.h>
+#include <stddef.h>
+
+/**
+ * \brief   AREG_TRACE_RING is defined if the logging threads write binary
+ *          log records in the ring buffers, which are drained by the tracer
+ *          thread. It is enabled by ENABLE_TRACE_RING preprocessor define.
+ **/
+#if defined(ENABLE_TRACE_RING) || defined(_ENABLE_TRACE_RING)
+    #define AREG_TRACE_RING
+#endif  // defined(ENABLE_TRACE_RING) || defined(_ENABLE_TRACE_RING)
+
+//////////////////////////////////////////////////////////////////////////
+// TraceRing class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The single producer single consumer ring buffer of log records.
+ *          Every logging thread owns one ring and writes compact binary
+ *          records: the scope ID, priority, timestamp, the pointer to the
+ *          format string and the raw values of arguments. The string arguments
+ *          are copied in the record. The tracer thread drains the rings
+ *          and formats the messages, so that the logging thread neither
+ *          formats the message, nor allocates an event and locks the queue.
+ *
+ *          The format string is not copied, it should be a literal or should
+ *          exist as long as the logging runs. This is how the logging macros
+ *          are used. The records are written in the slots of fixed size.
+ *          If the arguments do not fit the slot, the format contains an
+ *          unsupported conversion or the ring is full, the ring rejects the
+ *          record and the caller should log the message in the usual way.
+ *
+ *          The messages logged in the usual way are counted in the ring and
+ *          every record keeps the count of messages sent before it. The records
+ *          written after such message are not drained until the message is
+ *          logged, so that the messages of the thread keep the order.
+ **/
+class TraceRing
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    //!< The number of record slots in the ring, should be power of 2.
+    static constexpr unsigned int   RING_SLOT_COUNT     { 512 };
+
+    //!< The size in bytes of single record slot.
+    static constexpr unsigned int   RING_SLOT_SIZE      { 256 };
+
+    /**
+     * \brief   TraceRing::sRingRecord
+     *          The binary log record in the slot of the ring.
+     **/
+    typedef struct S_RingRecord
+    {
+        TIME64                  rrTimestamp;    //!< The timestamp of log record.
+        ITEM_ID                 rrThreadId;     //!< The ID of logging thread.
+        const char *            rrFormat;       //!< The format of message. If nullptr, the data contains single string.
+        unsigned int            rrScopeId;      //!< The ID of logging scope.
+        NETrace::eLogType       rrLogType;      //!< The type of log record.
+        NETrace::eLogPriority   rrLogPrio;      //!< The priority of log record.
+        unsigned int            rrDataLen;      //!< The length in bytes of arguments data.
+        unsigned int            rrFallbacks;    //!< The number of messages, which the thread logged without ring before the record.
+        unsigned char           rrData[1];      //!< The raw values of arguments, the data is extended till the end of slot.
+    } sRingRecord;
+
+    //!< The maximum length in bytes of arguments data in the record.
+    static constexpr unsigned int   RING_DATA_SIZE      { RING_SLOT_SIZE - static_cast<unsigned int>(offsetof(TraceRing::sRingRecord, rrData)) };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Initializes empty ring of the current thread.
+     **/
+    TraceRing( void );
+
+    ~TraceRing( void ) = default;
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Called by the owner thread to write the log message record in the ring.
+     * \param   scopeId     The ID of logging scope.
+     * \param   msgPrio     The priority of log message.
+     * \param   format      The format of message. Should be a literal.
+     * \param   args        The arguments of the format. The list is copied, so that
+     *                      it can be used again if the record was rejected.
+     * \return  Returns true if the record is written. Returns false if the ring is full,
+     *          the arguments do not fit the record or the format contains the conversion,
+     *          which is not supported.
+     **/
+    bool pushMessage( unsigned int scopeId, NETrace::eLogPriority msgPrio, const char * format, va_list args );
+
+    /**
+     * \brief   Called by the owner thread to write the record to enter or exit the scope.
+     * \param   logType     The type of log record, either NETrace::LogScopeEnter or NETrace::LogScopeExit.
+     * \param   scopeId     The ID of logging scope.
+     * \param   scopeName   The name of logging scope, which is copied in the record.
+     * \return  Returns true if the record is written. Returns false if the ring is full
+     *          or the name of scope does not fit the record.
+     **/
+    bool pushScope( NETrace::eLogType logType, unsigned int scopeId, const char * scopeName );
+
+    /**
+     * \brief   Called by the consumer thread to get the next record in the ring.
+     *          The record remains in the ring until popRecord( ) is called.
+     * \return  Returns the next record or nullptr if the ring is empty.
+     **/
+    inline const TraceRing::sRingRecord * frontRecord( void ) const;
+
+    /**
+     * \brief   Called by the consumer thread to release the slot of the record
+     *          returned by frontRecord( ).
+     **/
+    inline void popRecord( void );
+
+    /**
+     * \brief   Called by the consumer thread to get the next record in the ring, which
+     *          can be logged. The record is not returned if the owner thread logged
+     *          a message without ring before the record and the message is not logged yet.
+     * \return  Returns the next record or nullptr if the ring is empty or the next
+     *          record waits for the message logged without ring.
+     **/
+    inline const TraceRing::sRingRecord * readyRecord( void ) const;
+
+    /**
+     * \brief   Called by the owner thread before it sends the message, which is logged
+     *          without ring. The records written after the call wait for the message.
+     **/
+    inline void postFallback( void );
+
+    /**
+     * \brief   Called by the owner thread if failed to send the message after postFallback( ).
+     **/
+    inline void cancelFallback( void );
+
+    /**
+     * \brief   Called by the consumer thread when the message, which the owner thread
+     *          logged without ring, is logged. The records written after the message
+     *          can be drained.
+     **/
+    inline void completeFallback( void );
+
+    /**
+     * \brief   Returns true if there is a message logged without ring, which is not logged yet.
+     **/
+    inline bool hasFallback( void ) const;
+
+    /**
+     * \brief   Returns the ID of the owner thread.
+     **/
+    inline ITEM_ID getThreadId( void ) const;
+
+    /**
+     * \brief   Called by the owner thread when it exits. The released ring can be
+     *          deleted by the consumer thread when all records are drained.
+     **/
+    inline void releaseRing( void );
+
+    /**
+     * \brief   Returns true if the owner thread has released the ring.
+     **/
+    inline bool isReleased( void ) const;
+
+    /**
+     * \brief   Formats the message of given record in the buffer.
+     * \param   record  The log record to format.
+     * \param   buffer  The buffer to output the message.
+     * \param   space   The size of the buffer in characters.
+     * \return  Returns the length of the message in the buffer.
+     **/
+    static unsigned int formatRecord( const TraceRing::sRingRecord & record, char * buffer, unsigned int space );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Returns the free slot to write the record or nullptr if the ring is full.
+     **/
+    inline TraceRing::sRingRecord * _backRecord( void );
+
+    /**
+     * \brief   Publishes the record written in the slot returned by _backRecord( ).
+     **/
+    inline void _pushRecord( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The position of next record to read, modified only by the consumer thread.
+     **/
+    std::atomic_uint    mHead;
+    /**
+     * \brief   The slots of records. The slots are placed between the positions,
+     *          so that the positions of the producer and the consumer are in different cache lines.
+     **/
+    uint64_t            mSlots[RING_SLOT_COUNT * RING_SLOT_SIZE / sizeof(uint64_t)];
+    /**
+     * \brief   The position of next record to write, modified only by the owner thread.
+     **/
+    std::atomic_uint    mTail;
+    /**
+     * \brief   The flag, indicating that the owner thread has released the ring.
+     **/
+    std::atomic_bool    mReleased;
+    /**
+     * \brief   The number of messages logged without ring, modified only by the owner thread.
+     **/
+    std::atomic_uint    mFallbackPosted;
+    /**
+     * \brief   The number of logged messages, which the owner thread logged without ring.
+     *          Modified only by the consumer thread.
+     **/
+    unsigned int        mFallbackDone;
+    /**
+     * \brief   The ID of owner thread.
+     **/
+    const ITEM_ID       mThreadId;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    DECLARE_NOCOPY_NOMOVE( TraceRing );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// TraceRing class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline const TraceRing::sRingRecord * TraceRing::frontRecord( void ) const
+{
+    unsigned int head = mHead.load( std::memory_order_relaxed );
+    return (head != mTail.load( std::memory_order_acquire ) ? reinterpret_cast<const sRingRecord *>(reinterpret_cast<const unsigned char *>(mSlots) + (head & (RING_SLOT_COUNT - 1)) * RING_SLOT_SIZE) : nullptr);
+}
+
+inline void TraceRing::popRecord( void )
+{
+    mHead.store( mHead.load( std::memory_order_relaxed ) + 1, std::memory_order_release );
+}
+
+inline const TraceRing::sRingRecord * TraceRing::readyRecord( void ) const
+{
+    const sRingRecord * record = frontRecord( );
+    return ((record != nullptr) && (record->rrFallbacks == mFallbackDone) ? record : nullptr);
+}
+
+inline void TraceRing::postFallback( void )
+{
+    mFallbackPosted.store( mFallbackPosted.load( std::memory_order_relaxed ) + 1, std::memory_order_release );
+}
+
+inline void TraceRing::cancelFallback( void )
+{
+    mFallbackPosted.store( mFallbackPosted.load( std::memory_order_relaxed ) - 1, std::memory_order_release );
+}
+
+inline void TraceRing::completeFallback( void )
+{
+    ++ mFallbackDone;
+}
+
+inline bool TraceRing::hasFallback( void ) const
+{
+    return (mFallbackDone != mFallbackPosted.load( std::memory_order_acquire ));
+}
+
+inline ITEM_ID TraceRing::getThreadId( void ) const
+{
+    return mThreadId;
+}
+
+inline void TraceRing::releaseRing( void )
+{
+    mReleased.store( true, std::memory_order_release );
+}
+
+inline bool TraceRing::isReleased( void ) const
+{
+    return mReleased.load( std::memory_order_acquire );
+}
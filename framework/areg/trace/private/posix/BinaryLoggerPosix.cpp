@@ -0,0 +1,61 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/trace/private/posix/BinaryLoggerPosix.cpp
+ * \ingroup     AREG Asynchronous Event-Driven Communication Framework
+ * \author      Artak Avetyan
+ * \brief       Binary Logger object to log message into the memory-mapped file.
+ *              POSIX specific implementation
+ ************************************************************************/
+#include "areg/trace/private/BinaryLogger.hpp"
+
+#if defined(_POSIX) || defined(POSIX)
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+
+unsigned char * BinaryLogger::_osMapFile( const char * fileName, unsigned int fileSize )
+{
+    unsigned char * result = nullptr;
+
+    int fd = ::open( fileName, O_RDWR | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH );
+    if ( fd != -1 )
+    {
+        // allocate the blocks, so that writing in the mapped memory does not fail if the disk is full.
+        if ( ::posix_fallocate( fd, 0, static_cast<off_t>(fileSize) ) == 0 )
+        {
+            void * data = ::mmap( nullptr, static_cast<size_t>(fileSize), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+            result = data != MAP_FAILED ? reinterpret_cast<unsigned char *>(data) : nullptr;
+        }
+
+        // the mapping remains valid after closing the file.
+        ::close( fd );
+    }
+
+    if ( result == nullptr )
+    {
+        OUTPUT_ERR( "Failed to map binary log file [ %s ], errno = [ %d ]", fileName, errno );
+    }
+
+    return result;
+}
+
+void BinaryLogger::_osUnmapFile( const char * fileName, unsigned int fileSize )
+{
+    ::munmap( mMapData, static_cast<size_t>(mMapSize) );
+    if ( ::truncate( fileName, static_cast<off_t>(fileSize) ) != 0 )
+    {
+        OUTPUT_WARN( "Failed to truncate binary log file [ %s ], errno = [ %d ]", fileName, errno );
+    }
+}
+
+#endif  // defined(_POSIX) || defined(POSIX)
@@ -0,0 +1,77 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        areg/trace/private/win32/BinaryLoggerWin32.cpp
+ * \ingroup     AREG Asynchronous Event-Driven Communication Framework
+ * \author      Artak Avetyan
+ * \brief       Binary Logger object to log message into the memory-mapped file.
+ *              Windows OS specific implementation
+ ************************************************************************/
+#include "areg/trace/private/BinaryLogger.hpp"
+
+#ifdef  _WINDOWS
+
+#define WIN32_LEAN_AND_MEAN             // Exclude rarely-used stuff from Windows headers
+#include <windows.h>
+
+unsigned char * BinaryLogger::_osMapFile( const char * fileName, unsigned int fileSize )
+{
+    unsigned char * result = nullptr;
+
+    HANDLE hFile = ::CreateFileA( fileName, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr );
+    if ( hFile != INVALID_HANDLE_VALUE )
+    {
+        // the mapping of given size extends the file.
+        HANDLE hMap = ::CreateFileMappingA( hFile, nullptr, PAGE_READWRITE, 0, static_cast<DWORD>(fileSize), nullptr );
+        if ( hMap != nullptr )
+        {
+            result = reinterpret_cast<unsigned char *>(::MapViewOfFile( hMap, FILE_MAP_WRITE, 0, 0, static_cast<SIZE_T>(fileSize) ));
+            if ( result != nullptr )
+            {
+                mFileHandle = static_cast<FILEHANDLE>(hFile);
+                mMapHandle  = static_cast<FILEHANDLE>(hMap);
+            }
+            else
+            {
+                ::CloseHandle( hMap );
+            }
+        }
+
+        if ( result == nullptr )
+        {
+            ::CloseHandle( hFile );
+        }
+    }
+
+    if ( result == nullptr )
+    {
+        OUTPUT_ERR( "Failed to map binary log file [ %s ], error = [ %d ]", fileName, static_cast<int>(::GetLastError( )) );
+    }
+
+    return result;
+}
+
+void BinaryLogger::_osUnmapFile( const char * /*fileName*/, unsigned int fileSize )
+{
+    ::UnmapViewOfFile( mMapData );
+    ::CloseHandle( static_cast<HANDLE>(mMapHandle) );
+
+    LARGE_INTEGER pos;
+    pos.QuadPart = static_cast<LONGLONG>(fileSize);
+    if ( ::SetFilePointerEx( static_cast<HANDLE>(mFileHandle), pos, nullptr, FILE_BEGIN ) )
+    {
+        ::SetEndOfFile( static_cast<HANDLE>(mFileHandle) );
+    }
+
+    ::CloseHandle( static_cast<HANDLE>(mFileHandle) );
+    mFileHandle = nullptr;
+    mMapHandle  = nullptr;
+}
+
+#endif  // _WINDOWS
@@ -0,0 +1,152 @@
+#pragma once
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        logdecoder/app/LogDecoder.hpp
+ * \ingroup     AREG Asynchronous Event-Driven Communication Framework
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, The decoder of binary log files.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/String.hpp"
+#include "areg/base/TEHashMap.hpp"
+#include "areg/trace/private/LayoutManager.hpp"
+#include "areg/trace/private/NEBinaryLog.hpp"
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+class IEOutStream;
+class TraceProperty;
+
+//////////////////////////////////////////////////////////////////////////
+// LogDecoder class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The decoder of binary log files, created by the binary logger.
+ *          The decoder reads the layouts of messages from the logging
+ *          configuration file, the same way as the logging module does,
+ *          and outputs the records of binary file as text.
+ *          The module name layout outputs the name of module written in the
+ *          file header. The layouts, which output the information of running
+ *          process (thread name and tick count) output the information of
+ *          decoder. Use thread ID layout instead.
+ *
+ *          Usage: logdecoder <binary log file> [<text file>] [<config file>]
+ *          If the text file is not specified, it is the name of binary file
+ *          with the '.log' extension. If the configuration file is not
+ *          specified, it is './config/log.init'.
+ **/
+class LogDecoder
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The hash map helper of scope names.
+    using ImplMapScopeNames = TEHashMapImpl<unsigned int, const String &>;
+    //!< The hash map of scope names, the key is the scope ID.
+    using MapScopeNames     = TEHashMap<unsigned int, String, unsigned int, const String &, ImplMapScopeNames>;
+
+public:
+    //!< The extension of decoded text file.
+    static constexpr std::string_view   FILE_EXTENSION_TEXT { ".log" };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Initializes the decoder.
+     * \param   configFile  The logging configuration file to read layouts.
+     **/
+    explicit LogDecoder( const char * configFile );
+
+    /**
+     * \brief   Destructor.
+     **/
+    ~LogDecoder( void ) = default;
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Decodes the binary log file and writes the text in the output file.
+     * \param   binaryFile  The binary log file to decode.
+     * \param   textFile    The text file to output messages.
+     * \return  Returns true if the binary file is valid and the text file is written.
+     **/
+    bool decodeFile( const char * binaryFile, const char * textFile );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Reads the layouts of given module from the configuration file.
+     *          If the file does not exist, uses the default layouts.
+     * \param   moduleName  The name of module, which created the binary log file.
+     * \return  Returns true if the layouts are created.
+     **/
+    bool _createLayouts( const char * moduleName );
+
+    /**
+     * \brief   Returns the layout string, where the module name layout is replaced by
+     *          the name of module, which created the binary log file.
+     * \param   layout      The layout property read from the configuration.
+     * \param   moduleName  The name of module, which created the binary log file.
+     **/
+    static String _fixLayout( const TraceProperty & layout, const char * moduleName );
+
+    /**
+     * \brief   Outputs the records of binary log file as text.
+     * \param   data    The data of binary log file, which starts after the header.
+     * \param   size    The size in bytes of data.
+     * \param   stream  The stream to output messages.
+     * \return  Returns the number of decoded records.
+     **/
+    unsigned int _decodeRecords( const unsigned char * data, unsigned int size, IEOutStream & stream );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The logging configuration file to read layouts.
+     **/
+    String          mConfigFile;
+    /**
+     * \brief   The layouts to output messages.
+     **/
+    LayoutManager   mLayoutsMessage;
+    /**
+     * \brief   The layouts to output entering scope.
+     **/
+    LayoutManager   mLayoutsScopeEnter;
+    /**
+     * \brief   The layouts to output exiting scope.
+     **/
+    LayoutManager   mLayoutsScopeExit;
+    /**
+     * \brief   The names of scopes written in the binary log file.
+     **/
+    MapScopeNames   mScopeNames;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    LogDecoder( void ) = delete;
+    DECLARE_NOCOPY_NOMOVE( LogDecoder );
+};
@@ -0,0 +1,235 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2021 Aregtech UG. All rights reserved.
+ * \file        logdecoder/app/private/LogDecoder.cpp
+ * \ingroup     AREG Asynchronous Event-Driven Communication Framework
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, The decoder of binary log files.
+ ************************************************************************/
+#include "logdecoder/app/LogDecoder.hpp"
+
+#include "areg/appbase/NEApplication.hpp"
+#include "areg/base/File.hpp"
+#include "areg/trace/private/LogConfiguration.hpp"
+#include "areg/trace/private/NELogConfig.hpp"
+#include "areg/trace/private/TraceProperty.hpp"
+
+#include <stdio.h>
+
+#ifdef WINDOWS
+    #pragma comment(lib, "areg.lib")
+#endif  // WINDOWS
+
+//////////////////////////////////////////////////////////////////////////
+// Global functions, Begin
+//////////////////////////////////////////////////////////////////////////
+
+int main( int argc, char * argv[] )
+{
+    int result = 0;
+    if ( argc > 1 )
+    {
+        String binaryFile( argv[1] );
+        String textFile( argc > 2 ? argv[2] : argv[1] );
+        if ( argc <= 2 )
+        {
+            textFile += LogDecoder::FILE_EXTENSION_TEXT.data();
+        }
+
+        LogDecoder decoder( argc > 3 ? argv[3] : NEApplication::DEFAULT_TRACING_CONFIG_FILE.data() );
+
+        if ( decoder.decodeFile( binaryFile, textFile ) )
+        {
+            printf( "Decoded binary log file [ %s ] to [ %s ]\n", binaryFile.getString(), textFile.getString() );
+        }
+        else
+        {
+            printf( "Failed to decode binary log file [ %s ]\n", binaryFile.getString() );
+            result = -1;
+        }
+    }
+    else
+    {
+        printf( "Usage: %s <binary log file> [<text file>] [<config file>]\n", argv[0] );
+        result = -2;
+    }
+
+    return result;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Global functions, End
+//////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////
+// LogDecoder class implementation
+//////////////////////////////////////////////////////////////////////////
+
+LogDecoder::LogDecoder( const char * configFile )
+    : mConfigFile       ( File::normalizePath( configFile ) )
+    , mLayoutsMessage   ( )
+    , mLayoutsScopeEnter( )
+    , mLayoutsScopeExit ( )
+    , mScopeNames       ( )
+{
+}
+
+bool LogDecoder::decodeFile( const char * binaryFile, const char * textFile )
+{
+    bool result = false;
+
+    File fileBinary( binaryFile, FileBase::FO_MODE_EXIST | FileBase::FO_MODE_READ | FileBase::FO_MODE_BINARY | FileBase::FO_MODE_SHARE_READ );
+    unsigned int size = fileBinary.open( ) ? fileBinary.getLength( ) : 0;
+    unsigned char * data = size > sizeof(NEBinaryLog::sFileHeader) ? DEBUG_NEW unsigned char[size] : nullptr;
+
+    if ( (data != nullptr) && (fileBinary.read( data, size ) == size) )
+    {
+        const NEBinaryLog::sFileHeader & header = *reinterpret_cast<const NEBinaryLog::sFileHeader *>(data);
+        // the layout of records depends on the platform, the decoder can read only files of the same layout.
+        if (   (header.fhMagic     == NEBinaryLog::FILE_MAGIC)
+            && (header.fhVersion   == NEBinaryLog::FILE_VERSION)
+            && (header.fhFixedSize == NEBinaryLog::LOG_FIXED_SIZE)
+            && (header.fhHeaderSize<= size) )
+        {
+            char moduleName[NEBinaryLog::MODULE_NAME_SIZE];
+            NEString::copyString<char, char>( moduleName, NEBinaryLog::MODULE_NAME_SIZE, header.fhModuleName, NEBinaryLog::MODULE_NAME_SIZE - 1 );
+
+            File fileText( textFile, FileBase::FO_MODE_CREATE | FileBase::FO_MODE_TRUNCATE | FileBase::FO_MODE_WRITE | FileBase::FO_MODE_TEXT | FileBase::FO_MODE_SHARE_READ );
+            if ( _createLayouts( moduleName ) && fileText.open( ) )
+            {
+                _decodeRecords( data + header.fhHeaderSize, size - header.fhHeaderSize, static_cast<IEOutStream &>(fileText) );
+                fileText.close( );
+                result = true;
+            }
+        }
+    }
+
+    delete [] data;
+    fileBinary.close( );
+
+    return result;
+}
+
+bool LogDecoder::_createLayouts( const char * moduleName )
+{
+    LogConfiguration logConfig;
+    logConfig.setDefaultValues( );
+
+    File fileConfig( static_cast<const char *>(mConfigFile), FileBase::FO_MODE_EXIST | FileBase::FO_MODE_READ | FileBase::FO_MODE_TEXT | FileBase::FO_MODE_SHARE_READ );
+    if ( fileConfig.open( ) )
+    {
+        // the later properties overwrite the earlier, the same as the logging module reads them.
+        String line;
+        TraceProperty property;
+        while ( fileConfig.readLine( line ) > 0 )
+        {
+            if ( property.parseProperty( line ) && property.getKey( ).isModuleKeySet( moduleName ) )
+            {
+                logConfig.updateProperty( property );
+            }
+        }
+
+        fileConfig.close( );
+    }
+
+    mLayoutsMessage.deleteLayouts( );
+    mLayoutsScopeEnter.deleteLayouts( );
+    mLayoutsScopeExit.deleteLayouts( );
+
+    bool result = mLayoutsMessage.createLayouts( _fixLayout( logConfig.getLayoutMessage( ), moduleName ) );
+    result     |= mLayoutsScopeEnter.createLayouts( _fixLayout( logConfig.getLayoutEnter( ), moduleName ) );
+    result     |= mLayoutsScopeExit.createLayouts( _fixLayout( logConfig.getLayoutExit( ), moduleName ) );
+
+    return result;
+}
+
+String LogDecoder::_fixLayout( const TraceProperty & layout, const char * moduleName )
+{
+    constexpr char layoutModule[]{ '%', static_cast<char>(NELogConfig::eLayouts::LayoutExecutableName), '\0' };
+
+    // the module name layout outputs the name of running process, replace it by the name of logging module.
+    String result( static_cast<const char *>(layout.getValue( )) );
+    result.replace( layoutModule, moduleName );
+    return result;
+}
+
+unsigned int LogDecoder::_decodeRecords( const unsigned char * data, unsigned int size, IEOutStream & stream )
+{
+    constexpr unsigned int headerSize   { static_cast<unsigned int>(sizeof(NEBinaryLog::sRecord)) };
+    constexpr unsigned int scopeSize    { static_cast<unsigned int>(offsetof(NEBinaryLog::sScopeRecord, srName)) };
+
+    unsigned int count  = 0;
+    unsigned int offset = 0;
+    NETrace::sLogMessage logMessage;
+    mScopeNames.removeAll( );
+
+    while ( offset + headerSize <= size )
+    {
+        const NEBinaryLog::sRecord & record = *reinterpret_cast<const NEBinaryLog::sRecord *>(data + offset);
+        const unsigned char * payload       = data + offset + headerSize;
+        unsigned int length                 = record.recLength;
+
+        if ( (record.recType == NEBinaryLog::eRecord::RecordEnd) || (length < headerSize) || (length > size - offset) )
+        {
+            break;  // end of records or the file is damaged.
+        }
+
+        if ( (record.recType == NEBinaryLog::eRecord::RecordScope) && (length >= headerSize + scopeSize + 1) )
+        {
+            const NEBinaryLog::sScopeRecord & scope = *reinterpret_cast<const NEBinaryLog::sScopeRecord *>(payload);
+            unsigned int nameLen = MACRO_MIN( scope.srNameLen, length - headerSize - scopeSize - 1 );
+            mScopeNames.setAt( scope.srScopeId, String( scope.srName, static_cast<NEString::CharCount>(nameLen) ) );
+        }
+        else if ( (record.recType == NEBinaryLog::eRecord::RecordLog) && (length >= headerSize + NEBinaryLog::LOG_FIXED_SIZE + 1) )
+        {
+            NEMemory::memCopy( &logMessage, static_cast<int>(NEBinaryLog::LOG_FIXED_SIZE), payload, static_cast<int>(NEBinaryLog::LOG_FIXED_SIZE) );
+
+            unsigned int textLen = MACRO_MIN( logMessage.lmTrace.traceMessageLen, length - headerSize - NEBinaryLog::LOG_FIXED_SIZE - 1 );
+            textLen = MACRO_MIN( textLen, NETrace::LOG_MESSAGE_BUFFER_SIZE - 1 );
+            NEMemory::memCopy( logMessage.lmTrace.traceMessage, static_cast<int>(NETrace::LOG_MESSAGE_BUFFER_SIZE), payload + NEBinaryLog::LOG_FIXED_SIZE, static_cast<int>(textLen) );
+            logMessage.lmTrace.traceMessage[textLen] = String::EmptyChar;
+
+            switch ( logMessage.lmHeader.logType )
+            {
+            case NETrace::LogMessage:
+                mLayoutsMessage.logMessage( logMessage, stream );
+                break;
+
+            case NETrace::LogScopeEnter:    // fall through
+            case NETrace::LogScopeExit:
+                {
+                    // the scope records do not contain names, take them from the dictionary.
+                    String scopeName;
+                    mScopeNames.find( logMessage.lmTrace.traceScopeId, scopeName );
+                    NEString::copyString<char, char>( logMessage.lmTrace.traceMessage, NETrace::LOG_MESSAGE_BUFFER_SIZE, scopeName.getString( ) );
+                    logMessage.lmTrace.traceMessageLen = static_cast<unsigned int>(scopeName.getLength( ));
+
+                    if ( logMessage.lmHeader.logType == NETrace::LogScopeEnter )
+                    {
+                        mLayoutsScopeEnter.logMessage( logMessage, stream );
+                    }
+                    else
+                    {
+                        mLayoutsScopeExit.logMessage( logMessage, stream );
+                    }
+                }
+                break;
+
+            default:
+                break;  // ignore unknown records
+            }
+
+            ++ count;
+        }
+
+        offset += length;
+    }
+
+    return count;
+}
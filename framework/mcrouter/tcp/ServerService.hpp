@@ -61,9 +61,21 @@ class ServerService : public    IERemoteService
 //////////////////////////////////////////////////////////////////////////
 private:
     /**
-     * \brief   The default connection type of server service.
+     * \brief   The list of message sender threads of I/O workers.
      **/
-    static constexpr NERemoteService::eServiceConnection    CONNECT_TYPE    { NERemoteService::eServiceConnection::ConnectionTcpip };
+    using ListSendThreads       = TEArrayList<ServerSendThread *, ServerSendThread *>;
+
+    /**
+     * \brief   The list of message receiver threads of I/O workers.
+     **/
+    using ListReceiveThreads    = TEArrayList<ServerReceiveThread *, ServerReceiveThread *>;
+
+    /**
+     * \brief   The addresses, where the connected applications accept direct connections.
+     *          The keys are cookies of connections.
+     **/
+    using ImplMapDirectAddress  = TEHashMapImpl<ITEM_ID, const NESocket::SocketAddress &>;
+    using MapDirectAddress      = TEHashMap<ITEM_ID, NESocket::SocketAddress, ITEM_ID, const NESocket::SocketAddress &, ImplMapDirectAddress>;
 
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
@@ -76,7 +88,7 @@ public:
     /**
      * \brief   Destructor
      **/
-    virtual ~ServerService( void )= default;
+    virtual ~ServerService( void );
 
 //////////////////////////////////////////////////////////////////////////
 // Attributes and operations
@@ -237,6 +249,15 @@ protected:
      **/
     virtual void connectionLost( SocketAccepted & clientSocket ) override;
 
+    /**
+     * \brief   Triggered, when the messages queued to the client reached the high watermark
+     *          or dropped to the low watermark. The source of messages should be notified.
+     * \param   target      The cookie of congested or recovered client.
+     * \param   source      The cookie of the source of messages queued to the client.
+     * \param   congested   If true, the client is congested. If false, the client is recovered.
+     **/
+    virtual void connectionCongested( ITEM_ID target, ITEM_ID source, bool congested ) override;
+
 /************************************************************************/
 // IETimerConsumer interface overrides.
 /************************************************************************/
@@ -409,6 +430,62 @@ private:
      **/
     void stopConnection( void );
 
+    /**
+     * \brief   Starts the message sender and receiver threads of I/O workers.
+     *          The number of workers is defined by server connection. The thread
+     *          objects are created once and reused when connection restarts.
+     * \return  Returns true if all threads are started.
+     **/
+    bool _startWorkerThreads( void );
+
+    /**
+     * \brief   Triggers exit of message receiver threads of I/O workers.
+     **/
+    void _exitReceiveThreads( void );
+
+    /**
+     * \brief   Triggers exit of message sender threads of I/O workers and waits for completion.
+     **/
+    void _exitSendThreads( void );
+
+    /**
+     * \brief   Waits for completion of threads of I/O workers.
+     **/
+    void _waitWorkerThreads( void );
+
+    /**
+     * \brief   Forwards the message to the sender thread of I/O worker, which handles
+     *          the connection of the message target.
+     * \param   msgSend     The message to send.
+     **/
+    void _sendMessage( const RemoteMessage & msgSend );
+
+    /**
+     * \brief   Forwards the message to the sender thread of I/O worker, which handles
+     *          the connection of specified target. The buffer of message is shared.
+     * \param   msgSend     The message to send.
+     * \param   target      The cookie of target connection.
+     **/
+    void _sendMessage( const RemoteMessage & msgSend, ITEM_ID target );
+
+    /**
+     * \brief   Forwards the multicast message to every target connection. The message
+     *          contains the list of cookies of target connections followed by the data
+     *          to forward. The data is copied once and the buffer is shared by all targets.
+     * \param   msgReceived The received multicast message.
+     **/
+    void _sendMulticastMessage( const RemoteMessage & msgReceived );
+
+    /**
+     * \brief   Returns the address of direct connection of the application with cookie
+     *          'source' to pass to the application with cookie 'target'. The returned address
+     *          is invalid if the direct connections are disabled, either application does not
+     *          accept direct connections or the 'target' cannot reach the address of 'source'.
+     * \param   source  The cookie of application, which address of direct connection is requested.
+     * \param   target  The cookie of application to send the address.
+     **/
+    NESocket::SocketAddress _getDirectAddress( ITEM_ID source, ITEM_ID target ) const;
+
     /**
      * \brief   Returns instance of object. For internal use only.
      **/
@@ -420,10 +497,17 @@ private:
 private:
     ServerConnection    mServerConnection;      //!< The instance of server connection object.
     Timer               mTimerConnect;          //!< The timer object to trigger in case if failed to create server socket.
-    ServerSendThread    mThreadSend;            //!< The thread to send messages to clients
-    ServerReceiveThread mThreadReceive;         //!< The thread to receive messages from clients
+    ListSendThreads     mThreadsSend;           //!< The threads of I/O workers to send messages to clients
+    ListReceiveThreads  mThreadsReceive;        //!< The threads of I/O workers to receive messages from clients
+    unsigned int        mWorkerCount;           //!< The configured number of I/O workers.
+    unsigned int        mSendHighMark;          //!< The size in bytes of messages queued to a client, when the client is congested.
+    unsigned int        mSendLowMark;           //!< The size in bytes of messages queued to a congested client, when the client is recovered.
+    unsigned int        mSendLimit;             //!< The maximum size in bytes of messages queued to a client.
     ServiceRegistry     mServiceRegistry;       //!< The service registry map to track stub-proxy connections
     bool                mIsServiceEnabled;      //!< The flag indicating whether the server servicing is enabled or not.
+    bool                mIsSharedMemory;        //!< The flag indicating whether the shared memory of local connections is enabled.
+    bool                mIsDirect;              //!< The flag indicating whether the direct connections between applications are enabled.
+    MapDirectAddress    mDirectAddresses;       //!< The addresses, where the connected applications accept direct connections.
     String              mConfigFile;            //!< The full path of connection configuration file.
     StringArray         mWhiteList;             //!< The list of enabled fixed client hosts.
     StringArray         mBlackList;             //!< The list of disabled fixes client hosts.
@@ -73,6 +73,15 @@ public:
      **/
     virtual void connectionLost( SocketAccepted & clientSocket ) = 0;
 
+    /**
+     * \brief   Triggered, when the messages queued to the client reached the high watermark
+     *          or dropped to the low watermark. The source of messages should be notified.
+     * \param   target      The cookie of congested or recovered client.
+     * \param   source      The cookie of the source of messages queued to the client.
+     * \param   congested   If true, the client is congested. If false, the client is recovered.
+     **/
+    virtual void connectionCongested( ITEM_ID target, ITEM_ID source, bool congested ) = 0;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
 //////////////////////////////////////////////////////////////////////////
@@ -118,6 +118,29 @@ public:
      **/
     inline int sendMessage( const RemoteMessage & in_message, const SocketAccepted & clientSocket ) const;
 
+    /**
+     * \brief   If socket is valid, sends the list of messages to the accepted socket connection
+     *          with single vectored write call. If failed to send data to remote host,
+     *          the messages after the returned number are not delivered.
+     * \param   listMessages    The list of valid messages to send.
+     * \param   count           The number of messages in the list.
+     * \param   clientSocket    The accepted socket object
+     * \return  Returns the number of messages completely sent to remote host.
+     *          Returns negative number if socket is not valid.
+     **/
+    inline int sendMessages( const RemoteMessage * const * listMessages, int count, const SocketAccepted & clientSocket ) const;
+
+    /**
+     * \brief   Prepares the header of message to send to the accepted socket connection later
+     *          with non-blocking calls. The data of message follows the header only if
+     *          the used length in the prepared header is not zero.
+     * \param   in_message      The message to send.
+     * \param   clientSocket    The accepted socket object
+     * \param   out_header      On output, contains the header of message to send.
+     * \return  Returns the length in bytes of header and data to send.
+     **/
+    inline unsigned int prepareMessage( const RemoteMessage & in_message, const SocketAccepted & clientSocket, NEMemory::sRemoteMessageHeader & out_header ) const;
+
     /**
      * \brief   If socket is valid, receives data using existing socket connection and returns length in bytes
      *          of data in Remote Buffer. And returns negative number if either socket is invalid,
@@ -136,6 +159,26 @@ public:
      **/
     inline int receiveMessage( RemoteMessage & out_message, const SocketAccepted & clientSocket ) const;
 
+    /**
+     * \brief   If socket is valid, receives in the receive buffer of accepted connection all data,
+     *          which are available in socket, with single call.
+     * \param   recvBuffer      The receive buffer of accepted connection.
+     * \param   clientSocket    The accepted socket object
+     * \return  Returns number of bytes received from remote host.
+     *          Returns zero or negative number if socket is not valid, connection is closed or failed to receive.
+     **/
+    inline int receiveMessages( SocketReceiveBuffer & recvBuffer, const SocketAccepted & clientSocket ) const;
+
+    /**
+     * \brief   If socket is valid, receives in the receive buffer of accepted connection the data,
+     *          which is already pending in socket, without blocking.
+     * \param   recvBuffer      The receive buffer of accepted connection.
+     * \param   clientSocket    The accepted socket object
+     * \return  Returns number of bytes received from remote host. Returns zero if there is no pending data.
+     *          Returns negative number if socket is not valid, connection is closed or failed to receive.
+     **/
+    inline int receivePendingMessages( SocketReceiveBuffer & recvBuffer, const SocketAccepted & clientSocket ) const;
+
     /**
      * \brief   If socket is valid, sends data using existing socket connection and returns length in bytes
      *          of data in Remote Buffer. And returns negative number if either socket is invalid,
@@ -188,12 +231,27 @@ private:
 
 inline int ServerConnection::sendMessage(const RemoteMessage & in_message, const SocketAccepted & clientSocket) const
 {
-    return SocketConnectionBase::sendMessage(in_message, clientSocket);
+    std::shared_ptr<SharedMemoryRing> sharedMemory( getSharedMemory(clientSocket.getHandle()) );
+    return SocketConnectionBase::sendMessage(in_message, clientSocket, isChecksumSkipped(clientSocket.getHandle()), sharedMemory.get());
+}
+
+inline int ServerConnection::sendMessages(const RemoteMessage * const * listMessages, int count, const SocketAccepted & clientSocket) const
+{
+    std::shared_ptr<SharedMemoryRing> sharedMemory( getSharedMemory(clientSocket.getHandle()) );
+    return SocketConnectionBase::sendMessages(listMessages, count, clientSocket, isChecksumSkipped(clientSocket.getHandle()), sharedMemory.get());
+}
+
+inline unsigned int ServerConnection::prepareMessage(const RemoteMessage & in_message, const SocketAccepted & clientSocket, NEMemory::sRemoteMessageHeader & out_header) const
+{
+    std::shared_ptr<SharedMemoryRing> sharedMemory( getSharedMemory(clientSocket.getHandle()) );
+    return SocketConnectionBase::prepareMessage(in_message, out_header, isChecksumSkipped(clientSocket.getHandle()), sharedMemory.get());
 }
 
 inline int ServerConnection::sendMessage(const RemoteMessage & in_message, ITEM_ID clientCookie) const
 {
-    return SocketConnectionBase::sendMessage(in_message, getClientByCookie(clientCookie) );
+    const SocketAccepted clientSocket( getClientByCookie(clientCookie) );
+    std::shared_ptr<SharedMemoryRing> sharedMemory( getSharedMemory(clientSocket.getHandle()) );
+    return SocketConnectionBase::sendMessage(in_message, clientSocket, isChecksumSkipped(clientSocket.getHandle()), sharedMemory.get() );
 }
 
 inline int ServerConnection::receiveMessage(RemoteMessage & out_message, const SocketAccepted & clientSocket) const
@@ -201,6 +259,16 @@ inline int ServerConnection::receiveMessage(RemoteMessage & out_message, const S
     return SocketConnectionBase::receiveMessage(out_message, clientSocket);
 }
 
+inline int ServerConnection::receiveMessages(SocketReceiveBuffer & recvBuffer, const SocketAccepted & clientSocket) const
+{
+    return SocketConnectionBase::receiveMessages(recvBuffer, clientSocket);
+}
+
+inline int ServerConnection::receivePendingMessages(SocketReceiveBuffer & recvBuffer, const SocketAccepted & clientSocket) const
+{
+    return SocketConnectionBase::receivePendingMessages(recvBuffer, clientSocket);
+}
+
 inline int ServerConnection::receiveMessage(RemoteMessage & out_message, ITEM_ID clientCookie) const
 {
     return SocketConnectionBase::receiveMessage(out_message,getClientByCookie(clientCookie));
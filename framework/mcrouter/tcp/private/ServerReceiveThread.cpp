@@ -20,16 +20,19 @@
 #include "areg/ipc/NEConnection.hpp"
 #include "areg/base/RemoteMessage.hpp"
 #include "areg/base/SocketAccepted.hpp"
+#include "areg/ipc/SocketReceiveBuffer.hpp"
 
 #include "areg/trace/GETrace.h"
 
 DEF_TRACE_SCOPE(areg_ipc_private_ServerReceiveThread_runDispatcher);
 
-ServerReceiveThread::ServerReceiveThread( IEServerConnectionHandler & connectHandler, IERemoteServiceHandler & remoteService, ServerConnection & connection )
-    : DispatcherThread  ( NEConnection::SERVER_RECEIVE_MESSAGE_THREAD.data( ) )
+ServerReceiveThread::ServerReceiveThread( IEServerConnectionHandler & connectHandler, IERemoteServiceHandler & remoteService, ServerConnection & connection, int worker /*= 0*/ )
+    : DispatcherThread  ( NEConnection::getWorkerThreadName(NEConnection::SERVER_RECEIVE_MESSAGE_THREAD, worker).getString() )
     , mRemoteService    ( remoteService )
     , mConnectHandler   ( connectHandler )
     , mConnection       ( connection )
+    , mReceiveBuffers   ( )
+    , mWorker           ( worker )
 {
 }
 
@@ -41,7 +44,8 @@ bool ServerReceiveThread::runDispatcher(void)
     mEventStarted.setEvent();
 
     int whichEvent  = static_cast<int>(EventDispatcherBase::eEventOrder::EventError);
-    if ( mConnection.serverListen( NESocket::MAXIMUM_LISTEN_QUEUE_SIZE) )
+    // only the first worker listens and accepts new connections.
+    if ( (mWorker != 0) || mConnection.serverListen( NESocket::MAXIMUM_LISTEN_QUEUE_SIZE) )
     {
         IESynchObject* syncObjects[2] = {&mEventExit, &mEventQueue};
         MultiLock multiLock(syncObjects, 2, false);
@@ -54,7 +58,7 @@ bool ServerReceiveThread::runDispatcher(void)
             {
                 whichEvent = static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue); // escape quit
                 NESocket::SocketAddress addrAccepted;
-                SOCKETHANDLE hSocket = mConnection.waitForConnectionEvent(addrAccepted);
+                SOCKETHANDLE hSocket = mConnection.waitForConnectionEvent(addrAccepted, mWorker);
                 if ( hSocket != NESocket::InvalidSocketHandle )
                 {
                     SocketAccepted clientSocket;
@@ -76,7 +80,14 @@ bool ServerReceiveThread::runDispatcher(void)
                                             , addrAccepted.getHostAddress().getString()
                                             , addrAccepted.getHostPort());
                             
+                            // the socket handle might be reused, drop the data of previous connection.
+                            _removeReceiveBuffer(hSocket);
                             mConnection.acceptConnection(clientSocket);
+                            if ( mConnection.getConnectionWorker(mConnection.getCookie(hSocket)) != mWorker )
+                            {
+                                // the connection is handled by other worker, which gets the event of initial data.
+                                continue;
+                            }
                         }
                         else
                         {
@@ -91,28 +102,51 @@ bool ServerReceiveThread::runDispatcher(void)
                         }
                     }
 
+                    // receive all available data and process every complete message in the buffer.
+                    // Then drain the socket, in edge-triggered mode there is no event until new data arrives.
+                    // In edge-triggered mode the socket might be already drained when processed previous event.
                     const NESocket::SocketAddress& addSocket = clientSocket.getAddress();
-                    if ( mConnection.receiveMessage(msgReceived, clientSocket) > 0 )
+                    SocketReceiveBuffer & recvBuffer = _getReceiveBuffer(hSocket, mConnection.getCookie(hSocket));
+                    bool noWait     = mConnection.isEdgeTriggered();
+                    int received    = noWait ? mConnection.receivePendingMessages(recvBuffer, clientSocket) : mConnection.receiveMessages(recvBuffer, clientSocket);
+                    bool succeeded  = noWait ? received >= 0 : received > 0;
+                    while ( succeeded && (received > 0) )
                     {
-                        TRACE_DBG("Received message [ %p ] from source [ %p ], client [ %s : %d ]"
-                                    , static_cast<id_type>(msgReceived.getMessageId())
-                                    , static_cast<id_type>(msgReceived.getSource())
-                                    , addSocket.getHostAddress().getString()
-                                    , addSocket.getHostPort());
+                        // the client sends nothing before it receives the accept of connection,
+                        // the checksum mode and shared memory cannot change while the received data is processed.
+                        recvBuffer.setChecksumSkipped( mConnection.isChecksumSkipped(hSocket) );
+                        recvBuffer.setSharedMemory( mConnection.getSharedMemory(hSocket) );
+                        while ( succeeded && recvBuffer.extractMessage(msgReceived) )
+                        {
+                            succeeded = msgReceived.isValid();
+                            if ( succeeded )
+                            {
+                                TRACE_DBG("Received message [ %p ] from source [ %p ], client [ %s : %d ]"
+                                            , static_cast<id_type>(msgReceived.getMessageId())
+                                            , static_cast<id_type>(msgReceived.getSource())
+                                            , addSocket.getHostAddress().getString()
+                                            , addSocket.getHostPort());
+
+                                mRemoteService.processReceivedMessage(msgReceived, addSocket, clientSocket.getHandle());
+                            }
+
+                            msgReceived.invalidate();
+                        }
 
-                        mRemoteService.processReceivedMessage(msgReceived, addSocket, clientSocket.getHandle());
+                        received    = succeeded ? mConnection.receivePendingMessages(recvBuffer, clientSocket) : -1;
+                        succeeded   = received >= 0;
                     }
-                    else
+
+                    if ( succeeded == false )
                     {
                         TRACE_DBG("Failed to receive message from client socket [ %s : %d ], socket [ %u ]. Going to close connection"
                                         , addSocket.getHostAddress().getString()
                                         , addSocket.getHostPort()
                                         , clientSocket.getHandle());
 
+                        _removeReceiveBuffer(hSocket);
                         mRemoteService.failedReceiveMessage(clientSocket.getHandle());
                     }
-
-                    msgReceived.invalidate();
                 }
                 else
                 {
@@ -130,9 +164,51 @@ bool ServerReceiveThread::runDispatcher(void)
 
     mHasStarted = false;
     removeEvents(false);
+    _removeAllReceiveBuffers();
 
     mEventStarted.resetEvent();
 
     TRACE_DBG("Dispatcher [ %s ] completed job and stopping running.", mDispatcherName.getString());
     return (whichEvent == static_cast<int>(EventDispatcherBase::eEventOrder::EventExit));
 }
+
+SocketReceiveBuffer & ServerReceiveThread::_getReceiveBuffer( SOCKETHANDLE hSocket, ITEM_ID cookie )
+{
+    MAPPOS pos = mReceiveBuffers.find(hSocket);
+    if ( pos == nullptr )
+    {
+        pos = mReceiveBuffers.setAt(hSocket, sReceiveBuffer{ cookie, DEBUG_NEW SocketReceiveBuffer( ) }, false);
+    }
+
+    sReceiveBuffer & entry = mReceiveBuffers.getPosition(pos);
+    if ( entry.rbCookie != cookie )
+    {
+        // the socket handle is reused by new connection, drop the data of previous connection.
+        entry.rbCookie = cookie;
+        entry.rbBuffer->reset();
+    }
+
+    ASSERT(entry.rbBuffer != nullptr);
+    return (*entry.rbBuffer);
+}
+
+void ServerReceiveThread::_removeReceiveBuffer( SOCKETHANDLE hSocket )
+{
+    sReceiveBuffer entry{ NEService::COOKIE_UNKNOWN, nullptr };
+    if ( mReceiveBuffers.removeAt(hSocket, entry) )
+    {
+        delete entry.rbBuffer;
+    }
+}
+
+void ServerReceiveThread::_removeAllReceiveBuffers( void )
+{
+    MAPPOS pos = mReceiveBuffers.firstPosition();
+    while ( pos != nullptr )
+    {
+        delete mReceiveBuffers.valueAtPosition(pos).rbBuffer;
+        pos = mReceiveBuffers.nextPosition(pos);
+    }
+
+    mReceiveBuffers.removeAll();
+}
@@ -19,6 +19,7 @@
  ************************************************************************/
 #include "areg/base/GEGlobal.h"
 #include "areg/component/DispatcherThread.hpp"
+#include "areg/base/TEHashMap.hpp"
 
 /************************************************************************
  * Dependencies
@@ -26,6 +27,7 @@
 class IEServerConnectionHandler;
 class IERemoteServiceHandler;
 class ServerConnection;
+class SocketReceiveBuffer;
 
 //////////////////////////////////////////////////////////////////////////
 // ServerConnection class declaration.
@@ -35,6 +37,27 @@ class ServerConnection;
  **/
 class ServerReceiveThread    : public    DispatcherThread
 {
+//////////////////////////////////////////////////////////////////////////
+// Internal types
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The receive buffer of accepted socket and the cookie of connection.
+     *          The socket handle can be reused by new connection, which is
+     *          detected by cookie of connection.
+     **/
+    struct sReceiveBuffer
+    {
+        ITEM_ID                 rbCookie;   //!< The cookie of connection.
+        SocketReceiveBuffer *   rbBuffer;   //!< The receive buffer of connection.
+    };
+
+    /**
+     * \brief   The map of accepted socket and its receive buffer.
+     **/
+    using ImplMapSocketToBuffer = TEHashMapImpl<SOCKETHANDLE, const sReceiveBuffer &>;
+    using MapSocketToBuffer     = TEHashMap<SOCKETHANDLE, sReceiveBuffer, SOCKETHANDLE, const sReceiveBuffer &, ImplMapSocketToBuffer>;
+
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
 //////////////////////////////////////////////////////////////////////////
@@ -44,8 +67,11 @@ public:
      * \param   connectHandler  The instance of server socket connect / disconnect handling interface
      * \param   remoteService   The instance of remote servicing handler
      * \param   connection      The instance of server connection object.
+     * \param   worker          The index of I/O worker. The first worker listens and
+     *                          accepts new connections, every worker receives messages
+     *                          of connections assigned to it.
      **/
-    ServerReceiveThread( IEServerConnectionHandler & connectHandler, IERemoteServiceHandler & remoteService, ServerConnection & connection );
+    ServerReceiveThread( IEServerConnectionHandler & connectHandler, IERemoteServiceHandler & remoteService, ServerConnection & connection, int worker = 0 );
     /**
      * \brief   Destructor
      **/
@@ -65,6 +91,29 @@ protected:
      **/
     virtual bool runDispatcher( void ) override;
 
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Returns the receive buffer of accepted socket. Creates new buffer if it does not exist.
+     *          Resets the buffer if the socket handle is reused by new connection.
+     * \param   hSocket     The handle of accepted socket.
+     * \param   cookie      The cookie of connection.
+     **/
+    SocketReceiveBuffer & _getReceiveBuffer( SOCKETHANDLE hSocket, ITEM_ID cookie );
+
+    /**
+     * \brief   Removes and deletes the receive buffer of accepted socket.
+     * \param   hSocket     The handle of accepted socket.
+     **/
+    void _removeReceiveBuffer( SOCKETHANDLE hSocket );
+
+    /**
+     * \brief   Removes and deletes the receive buffers of all sockets.
+     **/
+    void _removeAllReceiveBuffers( void );
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
@@ -81,6 +130,14 @@ private:
      * \brief   The instance of server connection object
      **/
     ServerConnection &          mConnection;
+    /**
+     * \brief   The receive buffers of accepted sockets.
+     **/
+    MapSocketToBuffer           mReceiveBuffers;
+    /**
+     * \brief   The index of I/O worker.
+     **/
+    const int                   mWorker;
 
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
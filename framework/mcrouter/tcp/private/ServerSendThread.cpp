@@ -15,6 +15,7 @@
 #include "mcrouter/tcp/private/ServerSendThread.hpp"
 
 #include "mcrouter/tcp/private/ServerConnection.hpp"
+#include "mcrouter/tcp/private/IEServerConnectionHandler.hpp"
 #include "areg/ipc/NEConnection.hpp"
 #include "areg/ipc/IERemoteServiceHandler.hpp"
 #include "areg/component/NEService.hpp"
@@ -22,68 +23,598 @@
 #include "areg/trace/GETrace.h"
 
 DEF_TRACE_SCOPE(mcrouter_tcp_private_ServerSendThread_processEvent);
+DEF_TRACE_SCOPE(mcrouter_tcp_private_ServerSendThread__sendMessages);
+DEF_TRACE_SCOPE(mcrouter_tcp_private_ServerSendThread__sendQueuedMessages);
+DEF_TRACE_SCOPE(mcrouter_tcp_private_ServerSendThread__checkClientQueue);
+DEF_TRACE_SCOPE(mcrouter_tcp_private_ServerSendThread__failedMessages);
 
-ServerSendThread::ServerSendThread(IERemoteServiceHandler & remoteService, ServerConnection & connection)
-    : DispatcherThread          ( NEConnection::SERVER_SEND_MESSAGE_THREAD.data() )
+ServerSendThread::ServerSendThread(IEServerConnectionHandler & connectHandler, IERemoteServiceHandler & remoteService, ServerConnection & connection, int worker /*= 0*/)
+    : DispatcherThread          ( NEConnection::getWorkerThreadName(NEConnection::SERVER_SEND_MESSAGE_THREAD, worker).getString() )
     , IESendMessageEventConsumer( )
+    , mConnectHandler           ( connectHandler )
     , mRemoteService            ( remoteService )
     , mConnection               ( connection )
+    , mSendQueue                ( ServerSendThread::SEND_QUEUE_CAPACITY, NECommon::eRingOverlap::ResizeOnOvelap )
+    , mClients                  ( )
+    , mClientsVersion           ( 0 )
+    , mClientQueues             ( )
+    , mHighMark                 ( NEConnection::DEFAULT_SEND_HIGH_WATERMARK )
+    , mLowMark                  ( NEConnection::DEFAULT_SEND_LOW_WATERMARK )
+    , mQueueLimit               ( NEConnection::DEFAULT_SEND_QUEUE_LIMIT )
+    , mRetryTimeout             ( NEConnection::SEND_RETRY_TIMEOUT )
+#ifdef AREG_SOCKET_EPOLL
+    , mWritePoller              ( )
+#endif  // AREG_SOCKET_EPOLL
 {
+#ifdef AREG_SOCKET_EPOLL
+    // created once and released in destructor, since other threads wake up the poller when post events.
+    mWritePoller.create( );
+#endif  // AREG_SOCKET_EPOLL
+}
+
+void ServerSendThread::queueMessage( const RemoteMessage & msgSend )
+{
+    queueMessage( msgSend, static_cast<ITEM_ID>(msgSend.getTarget()) );
+}
+
+void ServerSendThread::queueMessage( const RemoteMessage & msgSend, ITEM_ID target )
+{
+    // notify only when the queue was empty, otherwise the dispatcher is already notified.
+    if ( mSendQueue.pushLast( sSendEntry{ msgSend, target } ) == 1 )
+    {
+        SendMessageEvent::sendEvent( SendMessageEventData(RemoteMessage()), static_cast<IESendMessageEventConsumer &>(*this), static_cast<DispatcherThread &>(*this));
+    }
+}
+
+void ServerSendThread::setQueueLimits( unsigned int highMark, unsigned int lowMark, unsigned int limit )
+{
+    mHighMark   = highMark;
+    mLowMark    = MACRO_MIN( lowMark, highMark );
+    mQueueLimit = MACRO_MAX( limit, highMark );
 }
 
 bool ServerSendThread::runDispatcher( void )
 {
     SendMessageEvent::addListener( static_cast<IESendMessageEventConsumer &>(*this), static_cast<DispatcherThread &>(*this));
+    mRetryTimeout = NEConnection::SEND_RETRY_TIMEOUT;
+    mEventStarted.setEvent();
 
-    bool result = DispatcherThread::runDispatcher();
+    IESynchObject * syncObjects[2] = {&mEventExit, &mEventQueue};
+    MultiLock multiLock(syncObjects, 2, false);
+
+    int whichEvent = static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue);
+    do
+    {
+        whichEvent = _waitEvents( multiLock );
+        if ( whichEvent == MultiLock::LOCK_INDEX_TIMEOUT )
+        {
+            // back off if the sockets still do not accept data.
+            whichEvent      = static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue);
+            mRetryTimeout   = _sendClientQueues( ) ? NEConnection::SEND_RETRY_TIMEOUT : MACRO_MIN( mRetryTimeout * 2, NEConnection::SEND_RETRY_MAXIMUM );
+        }
+        else if ( whichEvent == static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue) )
+        {
+            Event * eventElem = pickEvent();
+            if ( isExitEvent(eventElem) )
+            {
+                whichEvent = static_cast<int>(EventDispatcherBase::eEventOrder::EventExit);
+            }
+            else if ( eventElem != nullptr )
+            {
+                if ( prepareDispatchEvent(eventElem) )
+                {
+                    dispatchEvent(*eventElem);
+                }
+
+                postDispatchEvent(eventElem);
+            }
+        }
+
+    } while ( whichEvent == static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue) );
+
+    mHasStarted = false;
+    removeEvents(false);
+    mEventStarted.resetEvent();
 
     SendMessageEvent::removeListener( static_cast<IESendMessageEventConsumer &>(*this), static_cast<DispatcherThread &>(*this));
+    mSendQueue.removeAll();
+    mClients.removeAll();
+    _removeAllClientQueues();
+
+    return (whichEvent == static_cast<int>(EventDispatcherBase::eEventOrder::EventExit));
+}
+
+int ServerSendThread::_waitEvents( MultiLock & multiLock )
+{
+    int result = MultiLock::LOCK_INDEX_TIMEOUT;
+    if ( mClientQueues.isEmpty( ) )
+    {
+        mRetryTimeout = NEConnection::SEND_RETRY_TIMEOUT;
+        result = multiLock.lock( NECommon::WAIT_INFINITE, false );
+    }
+#ifdef AREG_SOCKET_EPOLL
+    else if ( mWritePoller.isValid( ) )
+    {
+        // the queued sockets are registered in the poller, which is woken up when the events are posted.
+        // the timeout is the last resort if the handle of socket was reused and the socket is not registered.
+        result = multiLock.lock( NECommon::DO_NOT_WAIT, false );
+        if ( result == MultiLock::LOCK_INDEX_TIMEOUT )
+        {
+            mWritePoller.waitSocketEvent( NEConnection::SEND_RETRY_MAXIMUM );
+            mWritePoller.dropReadySockets( );
+        }
+    }
+#endif  // AREG_SOCKET_EPOLL
+    else
+    {
+        // the sockets do not notify when they accept data again, retry to send the queues of clients periodically.
+        result = multiLock.lock( mRetryTimeout, false );
+    }
+
     return result;
 }
 
 void ServerSendThread::processEvent( const SendMessageEventData & data )
 {
     TRACE_SCOPE(mcrouter_tcp_private_ServerSendThread_processEvent);
-    const RemoteMessage & msgSend = data.getRemoteMessage();
-    if ( msgSend.isValid() )
-    {
-        ITEM_ID target = static_cast<ITEM_ID>(msgSend.getTarget());
-        SocketAccepted client = mConnection.getClientByCookie(target);
-        
-        TRACE_DBG("Sending message [ %s ] (ID = [ %u ]) to client [ %s : %d ] of socket [ %u ]. The message sent from source [ %u ] to target [ %u ]"
-                    , NEService::getString( static_cast<NEService::eFuncIdRange>(msgSend.getMessageId()) )
-                    , static_cast<unsigned int>(msgSend.getMessageId())
-                    , client.getAddress().getHostAddress().getString()
-                    , client.getAddress().getHostPort()
-                    , ((unsigned int)(client.getHandle()))
-                    , static_cast<unsigned int>(msgSend.getSource())
-                    , static_cast<unsigned int>(msgSend.getTarget()));
-
-        if ( (client.isAlive() == false) || (mConnection.sendMessage( msgSend, client ) <= 0) )
-        {
-            TRACE_WARN("Failed to send message [ %u ] to target [ %u ], client is [ %s ]"
-                            , msgSend.getMessageId()
-                            , static_cast<unsigned int>(msgSend.getTarget())
-                            , client.isAlive() ? "IS ALIVE" : "IS NOT ALIVE");
-
-            mRemoteService.failedSendMessage( msgSend );
+
+    // Coalesce the messages queued after the current one. The messages to the same
+    // client that follow each other are sent with single call.
+    const RemoteMessage * listMessages[NEConnection::MAXIMUM_SEND_MESSAGES];
+    Event * listEvents[NEConnection::MAXIMUM_SEND_MESSAGES];
+    int countMessages   = 0;
+    int countEvents     = 0;
+
+    const RemoteMessage * msgSend = &data.getRemoteMessage();
+    do
+    {
+        // the event with empty message notifies about messages in the send queue.
+        if ( msgSend->isValid() )
+        {
+            listMessages[countMessages ++] = msgSend;
+        }
+
+        msgSend = nullptr;
+        Event * eventElem = countEvents < (NEConnection::MAXIMUM_SEND_MESSAGES - 1) ? pickNextEvent(SendMessageEvent::_getClassId()) : nullptr;
+        if ( eventElem != nullptr )
+        {
+            listEvents[countEvents ++] = eventElem;
+            msgSend = &static_cast<SendMessageEvent *>(eventElem)->getData().getRemoteMessage();
+        }
+
+    } while ( msgSend != nullptr );
+
+    int first = 0;
+    while ( first < countMessages )
+    {
+        int last = first + 1;
+        while ( (last < countMessages) && (listMessages[last]->getTarget() == listMessages[first]->getTarget()) )
+        {
+            ++ last;
+        }
+
+        _sendMessages( listMessages + first, last - first, static_cast<ITEM_ID>(listMessages[first]->getTarget()) );
+        first = last;
+    }
+
+    for ( int i = 0; i < countEvents; ++ i )
+    {
+        listEvents[i]->destroy();
+    }
+
+    _sendQueuedMessages();
+    if ( _sendClientQueues() )
+    {
+        mRetryTimeout = NEConnection::SEND_RETRY_TIMEOUT;
+    }
+}
+
+void ServerSendThread::_sendQueuedMessages( void )
+{
+    TRACE_SCOPE(mcrouter_tcp_private_ServerSendThread__sendQueuedMessages);
+
+    sSendEntry listQueued[NEConnection::MAXIMUM_SEND_MESSAGES];
+    const RemoteMessage * listMessages[NEConnection::MAXIMUM_SEND_MESSAGES];
+    int countMessages = 0;
+    do
+    {
+        countMessages = 0;
+        mSendQueue.lock();
+        while ( (countMessages < NEConnection::MAXIMUM_SEND_MESSAGES) && (mSendQueue.isEmpty() == false) )
+        {
+            listQueued[countMessages]   = mSendQueue.popFirst();
+            listMessages[countMessages] = &listQueued[countMessages].seMessage;
+            ++ countMessages;
+        }
+
+        mSendQueue.unlock();
+
+        int first = 0;
+        while ( first < countMessages )
+        {
+            int last = first + 1;
+            while ( (last < countMessages) && (listQueued[last].seTarget == listQueued[first].seTarget) )
+            {
+                ++ last;
+            }
+
+            _sendMessages( listMessages + first, last - first, listQueued[first].seTarget );
+            first = last;
+        }
+
+        for ( int i = 0; i < countMessages; ++ i )
+        {
+            // release the shared buffers of sent messages.
+            listQueued[i].seMessage.invalidate();
+        }
+
+    } while ( countMessages == NEConnection::MAXIMUM_SEND_MESSAGES );
+}
+
+const SocketAccepted & ServerSendThread::_getClient( ITEM_ID cookie )
+{
+    unsigned int version = mConnection.getConnectionsVersion();
+    if ( version != mClientsVersion )
+    {
+        // the connections are accepted or closed, release the cached sockets.
+        mClients.removeAll();
+        mClientsVersion = version;
+    }
+
+    MAPPOS pos = mClients.find( cookie );
+    if ( pos == nullptr )
+    {
+        pos = mClients.setAt( cookie, mConnection.getClientByCookie(cookie), false );
+    }
+
+    return mClients.valueAtPosition( pos );
+}
+
+void ServerSendThread::_sendMessages( const RemoteMessage * const * listMessages, int count, ITEM_ID target )
+{
+    TRACE_SCOPE(mcrouter_tcp_private_ServerSendThread__sendMessages);
+
+    const RemoteMessage & msgSend = *listMessages[0];
+    const SocketAccepted & client = _getClient(target);
+
+    TRACE_DBG("Sending [ %d ] message(s), first [ %s ] (ID = [ %u ]) to client [ %s : %d ] of socket [ %u ]. The message sent from source [ %u ] to target [ %u ]"
+                , count
+                , NEService::getString( static_cast<NEService::eFuncIdRange>(msgSend.getMessageId()) )
+                , static_cast<unsigned int>(msgSend.getMessageId())
+                , client.getAddress().getHostAddress().getString()
+                , client.getAddress().getHostPort()
+                , ((unsigned int)(client.getHandle()))
+                , static_cast<unsigned int>(msgSend.getSource())
+                , static_cast<unsigned int>(target));
+
+    if ( client.isAlive() )
+    {
+        static_assert( NEConnection::MAXIMUM_SEND_MESSAGES * 2 <= NESocket::MAXIMUM_SEND_BUFFERS, "Every message might need 2 buffers" );
+        ASSERT( count <= NEConnection::MAXIMUM_SEND_MESSAGES );
+
+        NEMemory::sRemoteMessageHeader listHeaders[NEConnection::MAXIMUM_SEND_MESSAGES];
+        unsigned int listLengths[NEConnection::MAXIMUM_SEND_MESSAGES];
+        for ( int i = 0; i < count; ++ i )
+        {
+            listLengths[i] = mConnection.prepareMessage( *listMessages[i], client, listHeaders[i] );
+        }
+
+        MAPPOS pos = mClientQueues.find( target );
+        sClientQueue * queue = pos != nullptr ? mClientQueues.valueAtPosition( pos ) : nullptr;
+        int first = 0;
+        int sent  = 0;
+        unsigned int sentFirst = 0;
+        if ( queue == nullptr )
+        {
+            // nothing is queued for the client, send without waiting until the socket accepts all data.
+            NESocket::sSocketBuffer listBuffers[NESocket::MAXIMUM_SEND_BUFFERS];
+            int entries = 0;
+            for ( int i = 0; i < count; ++ i )
+            {
+                entries += ServerSendThread::_setPendingBuffers( *listMessages[i], listHeaders[i], listBuffers + entries, 0 );
+            }
+
+            sent = client.sendPendingDataVector( listBuffers, entries );
+            sentFirst = sent > 0 ? static_cast<unsigned int>(sent) : 0u;
+            while ( (first < count) && (sentFirst >= listLengths[first]) )
+            {
+                sentFirst -= listLengths[first ++];
+            }
+        }
+
+        if ( sent < 0 )
+        {
+            _failedMessages( listMessages, count, target, true );
+        }
+        else if ( first < count )
+        {
+            bool wasQueued = queue != nullptr;
+            if ( queue == nullptr )
+            {
+                TRACE_DBG("The client [ %u ] accepted [ %d ] bytes, queuing [ %d ] message(s)", static_cast<unsigned int>(target), sent, count - first);
+                queue = DEBUG_NEW sClientQueue{ };
+                queue->cqSent   = sentFirst;
+                queue->cqSocket = client.getHandle( );
+                mClientQueues.setAt( target, queue );
+                mRetryTimeout   = NEConnection::SEND_RETRY_TIMEOUT;
+#ifdef AREG_SOCKET_EPOLL
+                mWritePoller.addWriteSocket( queue->cqSocket );
+#endif  // AREG_SOCKET_EPOLL
+            }
+
+            for ( int i = first; i < count; ++ i )
+            {
+                queue->cqMessages.pushLast( sPendingMessage{ *listMessages[i], listHeaders[i], listLengths[i] } );
+                queue->cqBytes += listLengths[i];
+            }
+
+            queue->cqBytes -= sentFirst;
+            if ( wasQueued && (_sendClientQueue( client, *queue ) == false) )
+            {
+                _removeClientQueue( target );
+                _failedMessages( listMessages, count, target, true );
+            }
+            else
+            {
+                for ( int i = first; queue->cqCongested && (i < count); ++ i )
+                {
+                    _notifyCongested( target, *queue, static_cast<ITEM_ID>(listMessages[i]->getSource()) );
+                }
+
+                _checkClientQueue( target, *queue );
+            }
+        }
+        else
+        {
+            TRACE_DBG("Succeeded to send [ %d ] message(s) to target [ %p ]", count, static_cast<id_type>(target));
+        }
+    }
+    else
+    {
+        _removeClientQueue( target );
+        _failedMessages( listMessages, count, target, false );
+    }
+}
+
+bool ServerSendThread::_sendClientQueues( void )
+{
+    bool result = false;
+    if ( mClientQueues.isEmpty() == false )
+    {
+        // the queues are removed while sending, collect the clients.
+        TEArrayList<ITEM_ID, ITEM_ID> listTargets;
+        for ( MAPPOS pos = mClientQueues.firstPosition( ); pos != nullptr; pos = mClientQueues.nextPosition( pos ) )
+        {
+            listTargets.add( mClientQueues.keyAtPosition( pos ) );
+        }
+
+        for ( int i = 0; i < listTargets.getSize( ); ++ i )
+        {
+            ITEM_ID target = listTargets[i];
+            sClientQueue * queue = mClientQueues.valueAtPosition( mClientQueues.find( target ) );
+            const SocketAccepted & client = _getClient( target );
+            unsigned int queued = queue->cqBytes;
+            if ( client.isAlive( ) && _sendClientQueue( client, *queue ) )
+            {
+                result |= queue->cqBytes != queued;
+                _checkClientQueue( target, *queue );
+            }
+            else if ( client.isValid( ) )
+            {
+                RemoteMessage msgFailed( queue->cqMessages.getFirstEntry( ).pmMessage );
+                const RemoteMessage * listFailed[1] = { &msgFailed };
+                _removeClientQueue( target );
+                _failedMessages( listFailed, 1, target, client.isAlive( ) );
+            }
+            else
+            {
+                // the connection is already closed.
+                _removeClientQueue( target );
+            }
+        }
+    }
+
+    return result;
+}
+
+bool ServerSendThread::_sendClientQueue( const SocketAccepted & client, sClientQueue & queue )
+{
+    bool result     = true;
+    bool canSend    = true;
+    while ( canSend && (queue.cqMessages.isEmpty( ) == false) )
+    {
+        NESocket::sSocketBuffer listBuffers[NESocket::MAXIMUM_SEND_BUFFERS];
+        int entries = 0;
+        unsigned int length = 0;
+        unsigned int skip   = queue.cqSent;
+        for ( LISTPOS pos = queue.cqMessages.firstPosition( ); (pos != nullptr) && (entries <= NESocket::MAXIMUM_SEND_BUFFERS - 2); pos = queue.cqMessages.nextPosition( pos ) )
+        {
+            const sPendingMessage & entry = queue.cqMessages.getAt( pos );
+            entries += ServerSendThread::_setPendingBuffers( entry.pmMessage, entry.pmHeader, listBuffers + entries, skip );
+            length  += entry.pmLength - skip;
+            skip     = 0;
+        }
+
+        int sent = client.sendPendingDataVector( listBuffers, entries );
+        if ( sent >= 0 )
+        {
+            // remove completely sent messages, the socket accepts more data if it accepted all.
+            unsigned int written = static_cast<unsigned int>(sent);
+            canSend         = written == length;
+            queue.cqBytes  -= written;
+            written        += queue.cqSent;
+            while ( (queue.cqMessages.isEmpty( ) == false) && (written >= queue.cqMessages.getFirstEntry( ).pmLength) )
+            {
+                written -= queue.cqMessages.getFirstEntry( ).pmLength;
+                queue.cqMessages.removeFirst( );
+            }
+
+            queue.cqSent = written;
+        }
+        else
+        {
+            result = false;
+            break;
+        }
+    }
+
+    return result;
+}
+
+void ServerSendThread::_checkClientQueue( ITEM_ID target, sClientQueue & queue )
+{
+    TRACE_SCOPE(mcrouter_tcp_private_ServerSendThread__checkClientQueue);
+
+    if ( queue.cqBytes > mQueueLimit )
+    {
+        TRACE_ERR("The [ %u ] bytes queued to client [ %u ] exceed the limit [ %u ], closing connection"
+                    , queue.cqBytes
+                    , static_cast<unsigned int>(target)
+                    , mQueueLimit);
+
+        RemoteMessage msgFailed( queue.cqMessages.getFirstEntry( ).pmMessage );
+        const RemoteMessage * listFailed[1] = { &msgFailed };
+        _removeClientQueue( target );
+        _failedMessages( listFailed, 1, target, true );
+    }
+    else
+    {
+        if ( (queue.cqCongested == false) && (queue.cqBytes >= mHighMark) )
+        {
+            TRACE_WARN("The client [ %u ] is congested, [ %u ] bytes are queued", static_cast<unsigned int>(target), queue.cqBytes);
+
+            queue.cqCongested = true;
+            for ( LISTPOS pos = queue.cqMessages.firstPosition( ); pos != nullptr; pos = queue.cqMessages.nextPosition( pos ) )
+            {
+                _notifyCongested( target, queue, static_cast<ITEM_ID>(queue.cqMessages.getAt( pos ).pmMessage.getSource( )) );
+            }
+        }
+        else if ( queue.cqCongested && (queue.cqBytes <= mLowMark) )
+        {
+            TRACE_INFO("The client [ %u ] is recovered, [ %u ] bytes are queued", static_cast<unsigned int>(target), queue.cqBytes);
+
+            queue.cqCongested = false;
+            for ( int i = 0; i < queue.cqSources.getSize( ); ++ i )
+            {
+                mConnectHandler.connectionCongested( target, queue.cqSources[i], false );
+            }
+
+            queue.cqSources.removeAll( );
+        }
+
+        if ( queue.cqMessages.isEmpty( ) )
+        {
+            _removeClientQueue( target );
+        }
+    }
+}
+
+void ServerSendThread::_notifyCongested( ITEM_ID target, sClientQueue & queue, ITEM_ID source )
+{
+    if ( (source >= static_cast<ITEM_ID>(NEService::eCookies::CookieFirstValid)) && (source != target) && (queue.cqSources.find( source ) < 0) )
+    {
+        queue.cqSources.add( source );
+        mConnectHandler.connectionCongested( target, source, true );
+    }
+}
+
+void ServerSendThread::_removeClientQueue( ITEM_ID target )
+{
+    sClientQueue * queue = nullptr;
+    if ( mClientQueues.removeAt( target, queue ) )
+    {
+#ifdef AREG_SOCKET_EPOLL
+        mWritePoller.removeSocket( queue->cqSocket );
+#endif  // AREG_SOCKET_EPOLL
+        delete queue;
+    }
+}
+
+void ServerSendThread::_removeAllClientQueues( void )
+{
+    for ( MAPPOS pos = mClientQueues.firstPosition( ); pos != nullptr; pos = mClientQueues.nextPosition( pos ) )
+    {
+#ifdef AREG_SOCKET_EPOLL
+        mWritePoller.removeSocket( mClientQueues.valueAtPosition( pos )->cqSocket );
+#endif  // AREG_SOCKET_EPOLL
+        delete mClientQueues.valueAtPosition( pos );
+    }
+
+    mClientQueues.removeAll( );
+}
+
+void ServerSendThread::_failedMessages( const RemoteMessage * const * listMessages, int count, ITEM_ID target, bool isAlive )
+{
+    TRACE_SCOPE(mcrouter_tcp_private_ServerSendThread__failedMessages);
+
+    for ( int i = 0; i < count; ++ i )
+    {
+        TRACE_WARN("Failed to send message [ %u ] to target [ %u ], client is [ %s ]"
+                        , listMessages[i]->getMessageId()
+                        , static_cast<unsigned int>(target)
+                        , isAlive ? "IS ALIVE" : "IS NOT ALIVE");
+
+        if ( static_cast<ITEM_ID>(listMessages[i]->getTarget()) == target )
+        {
+            mRemoteService.failedSendMessage( *listMessages[i] );
         }
         else
         {
-            TRACE_DBG("Succeeded to send message [ %u ] to target [ %p ]", msgSend.getMessageId(), static_cast<id_type>(msgSend.getTarget()));
+            // the buffer of multicast message is shared, notify with the copy of header, which has the target of failed connection.
+            NEMemory::sRemoteMessageHeader header = listMessages[i]->getRemoteMessage()->rbHeader;
+            header.rbhTarget            = target;
+            header.rbhBufHeader.biUsed  = 0;
+            RemoteMessage msgFailed;
+            msgFailed.initMessage( header );
+            mRemoteService.failedSendMessage( msgFailed );
         }
     }
+}
+
+int ServerSendThread::_setPendingBuffers( const RemoteMessage & message, const NEMemory::sRemoteMessageHeader & header, NESocket::sSocketBuffer * out_buffers, unsigned int skip )
+{
+    int result = 0;
+    constexpr unsigned int sizeHeader = static_cast<unsigned int>(sizeof(NEMemory::sRemoteMessageHeader));
+    if ( skip < sizeHeader )
+    {
+        out_buffers[result].sbData      = reinterpret_cast<const unsigned char *>(&header) + skip;
+        out_buffers[result].sbLength    = static_cast<int>(sizeHeader - skip);
+        ++ result;
+        skip = 0;
+    }
     else
     {
-        TRACE_DBG("Message [ %s ] ( ID = %p ) from source [ %p ] to target [ %p ], ignoring to send message"
-                        , NEService::getString( static_cast<NEService::eFuncIdRange>(msgSend.getMessageId()) )
-                        , static_cast<id_type>(msgSend.getMessageId())
-                        , static_cast<id_type>(msgSend.getSource())
-                        , static_cast<id_type>(msgSend.getTarget()));
+        skip -= sizeHeader;
     }
+
+    // the data follows only if it is not passed via shared memory.
+    if ( header.rbhBufHeader.biUsed != 0 )
+    {
+        out_buffers[result].sbData      = message.getBuffer() + skip;
+        out_buffers[result].sbLength    = static_cast<int>(header.rbhBufHeader.biLength - skip);
+        ++ result;
+    }
+
+    return result;
 }
 
 bool ServerSendThread::postEvent(Event & eventElem)
 {
-    return ( RUNTIME_CAST(&eventElem, SendMessageEvent) != nullptr ? EventDispatcher::postEvent(eventElem) : false );
+    bool result = ( RUNTIME_CAST(&eventElem, SendMessageEvent) != nullptr ? EventDispatcher::postEvent(eventElem) : false );
+#ifdef AREG_SOCKET_EPOLL
+    if ( result )
+    {
+        mWritePoller.wakeUp( );
+    }
+#endif  // AREG_SOCKET_EPOLL
+
+    return result;
+}
+
+void ServerSendThread::stopDispatcher( void )
+{
+    DispatcherThread::stopDispatcher( );
+#ifdef AREG_SOCKET_EPOLL
+    mWritePoller.wakeUp( );
+#endif  // AREG_SOCKET_EPOLL
 }
@@ -20,10 +20,19 @@
 #include "areg/base/GEGlobal.h"
 #include "areg/component/DispatcherThread.hpp"
 #include "areg/ipc/RemoteServiceEvent.hpp"
+#include "areg/base/RemoteMessage.hpp"
+#include "areg/base/SocketAccepted.hpp"
+#include "areg/base/TEHashMap.hpp"
+#include "areg/base/TERingStack.hpp"
+#include "areg/base/TELinkedList.hpp"
+#include "areg/base/TEArrayList.hpp"
+#include "areg/base/NEMemory.hpp"
+#include "areg/base/SocketPoller.hpp"
 
 /************************************************************************
  * Dependencies
  ************************************************************************/
+class IEServerConnectionHandler;
 class IERemoteServiceHandler;
 class ServerConnection;
 
@@ -31,27 +40,178 @@ class ServerConnection;
 // ServerSendThread class declaration.
 //////////////////////////////////////////////////////////////////////////
 /**
- * \brief   The IPC message sender thread
+ * \brief   The IPC message sender thread. The messages to send are queued
+ *          in the send queue of thread, which shares the buffers of messages
+ *          and does not copy the data. The dispatcher is notified by event
+ *          only when the first message is queued in the empty queue.
+ *          The accepted connections are cached by cookie and are looked up
+ *          in the server connection only when the set of connections changes.
+ *
+ *          The messages are written to the sockets without blocking. If a client
+ *          connection cannot accept the data, the rest of messages are queued in
+ *          the outbound queue of the client and are sent when the socket accepts
+ *          data again, so that a slow client does not delay the messages of other
+ *          clients. When the queue of client reaches the high watermark, the sources
+ *          of messages are notified that the client is congested, and when it drops
+ *          to the low watermark, they are notified that the client is recovered.
+ *          If the queue exceeds the limit, the client connection is closed.
+ *          The queues are sent again when the sockets accept data. If the sockets
+ *          are polled by epoll, the thread waits until queued sockets are writable,
+ *          otherwise it retries periodically and doubles the retry timeout every
+ *          time when no data is written.
  **/
 class ServerSendThread  : public    DispatcherThread
                         , public    IESendMessageEventConsumer
 {
+//////////////////////////////////////////////////////////////////////////
+// Internal types
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The entry of send queue. The multicast messages share the
+     *          buffer and are queued with the cookie of every target connection.
+     **/
+    typedef struct S_SendEntry
+    {
+        /**
+         * \brief   The message to send.
+         **/
+        RemoteMessage   seMessage;
+        /**
+         * \brief   The cookie of target connection.
+         **/
+        ITEM_ID         seTarget;
+    } sSendEntry;
+
+    /**
+     * \brief   The queue of messages to send.
+     **/
+    using SendQueue             = TELockRingStack<sSendEntry, const sSendEntry &>;
+
+    /**
+     * \brief   The cache of accepted connections where the keys are cookies.
+     **/
+    using ImplMapCookieToClient = TEHashMapImpl<ITEM_ID, const SocketAccepted &>;
+    using MapCookieToClient     = TEHashMap<ITEM_ID, SocketAccepted, ITEM_ID, const SocketAccepted &, ImplMapCookieToClient>;
+
+    /**
+     * \brief   The message in the outbound queue of client. The header to send is prepared
+     *          when the message is queued, so that the message can be sent in several parts.
+     **/
+    typedef struct S_PendingMessage
+    {
+        /**
+         * \brief   The message to send. The buffer of message is shared.
+         **/
+        RemoteMessage                   pmMessage;
+        /**
+         * \brief   The prepared header of message to send.
+         **/
+        NEMemory::sRemoteMessageHeader  pmHeader;
+        /**
+         * \brief   The length in bytes of header and data to send.
+         **/
+        unsigned int                    pmLength;
+    } sPendingMessage;
+
+    /**
+     * \brief   The list of cookies of sources notified about congested client.
+     **/
+    using ListSources           = TEArrayList<ITEM_ID, ITEM_ID>;
+
+    /**
+     * \brief   The outbound queue of client, which contains the messages that
+     *          the client connection could not accept yet.
+     **/
+    typedef struct S_ClientQueue
+    {
+        /**
+         * \brief   The queued messages.
+         **/
+        TELinkedList<sPendingMessage, const sPendingMessage &>  cqMessages;
+        /**
+         * \brief   The number of bytes to send, i.e. without already sent part of the first message.
+         **/
+        unsigned int                                            cqBytes;
+        /**
+         * \brief   The number of bytes of the first message, which are already sent.
+         **/
+        unsigned int                                            cqSent;
+        /**
+         * \brief   The flag, indicating that the queue reached the high watermark.
+         **/
+        bool                                                    cqCongested;
+        /**
+         * \brief   The sources, which are notified that the client is congested.
+         **/
+        ListSources                                             cqSources;
+        /**
+         * \brief   The socket handle of client, registered to wait until it accepts data.
+         **/
+        SOCKETHANDLE                                            cqSocket;
+    } sClientQueue;
+
+    /**
+     * \brief   The outbound queues of clients where the keys are cookies.
+     *          Only the clients, which have unsent messages, have the queue.
+     **/
+    using ImplMapCookieToQueue  = TEHashMapImpl<ITEM_ID, sClientQueue *>;
+    using MapCookieToQueue      = TEHashMap<ITEM_ID, sClientQueue *, ITEM_ID, sClientQueue *, ImplMapCookieToQueue>;
+
+    /**
+     * \brief   The initial capacity of the send queue.
+     **/
+    static constexpr int    SEND_QUEUE_CAPACITY     { 64 };
+
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
 //////////////////////////////////////////////////////////////////////////
 public:
     /**
      * \brief   Initializes connection servicing handler and server connection objects.
+     * \param   connectHandler  The instance of server connection handling interface,
+     *                          which is notified about congested and recovered clients.
      * \param   remoteService   The instance of remote servicing handle to set.
      * \param   connection      The instance of server socket connection object.
+     * \param   worker          The index of I/O worker. The worker sends messages
+     *                          to the connections assigned to it.
      **/
-    ServerSendThread( IERemoteServiceHandler & remoteService, ServerConnection & connection );
+    ServerSendThread( IEServerConnectionHandler & connectHandler, IERemoteServiceHandler & remoteService, ServerConnection & connection, int worker = 0 );
 
     /**
      * \brief   Destructor
      **/
     virtual ~ServerSendThread( void ) = default;
 
+//////////////////////////////////////////////////////////////////////////
+// Operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Queues the message to send to the target connection. The buffer of message
+     *          is shared and not copied. Can be called by any thread.
+     * \param   msgSend     The message to send. The target of message is the cookie of connection.
+     **/
+    void queueMessage( const RemoteMessage & msgSend );
+
+    /**
+     * \brief   Queues the message to send to the specified target connection. The buffer
+     *          of message is shared and not copied. Used to forward multicast messages,
+     *          which target is not a cookie of connection. Can be called by any thread.
+     * \param   msgSend     The message to send.
+     * \param   target      The cookie of target connection.
+     **/
+    void queueMessage( const RemoteMessage & msgSend, ITEM_ID target );
+
+    /**
+     * \brief   Sets the watermarks and the limit in bytes of the outbound queues of clients.
+     *          Should be called before the thread starts.
+     * \param   highMark    The size of queue, when the sources are notified that the client is congested.
+     * \param   lowMark     The size of queue, when the sources are notified that the client is recovered.
+     * \param   limit       The maximum size of queue. If exceeds, the client connection is closed.
+     **/
+    void setQueueLimits( unsigned int highMark, unsigned int lowMark, unsigned int limit );
+
 protected:
 /************************************************************************/
 // DispatcherThread overrides
@@ -81,6 +241,16 @@ protected:
      **/
     virtual bool postEvent( Event & eventElem ) override;
 
+/************************************************************************/
+// IEEventDispatcher interface overrides
+/************************************************************************/
+
+    /**
+     * \brief   Stops the dispatcher and wakes up the thread if it waits
+     *          until the sockets of clients accept data.
+     **/
+    virtual void stopDispatcher( void ) override;
+
 private:
 /************************************************************************/
 // IESendMessageEventConsumer interface overrides.
@@ -94,10 +264,114 @@ private:
      **/
     virtual void processEvent( const SendMessageEventData & data ) override;
 
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Sends the list of messages to the same target client with single non-blocking call.
+     *          If the client has queued messages or could not accept all data, the rest of messages
+     *          are queued in the outbound queue of client. If fails, notifies remote servicing handler
+     *          for every message.
+     * \param   listMessages    The list of valid messages with the same target.
+     * \param   count           The number of messages in the list.
+     * \param   target          The cookie of target connection.
+     **/
+    void _sendMessages( const RemoteMessage * const * listMessages, int count, ITEM_ID target );
+
+    /**
+     * \brief   Sends the messages in the outbound queues of all clients, as much as the sockets accept.
+     * \return  Returns true if any client accepted data.
+     **/
+    bool _sendClientQueues( void );
+
+    /**
+     * \brief   Waits for the events of dispatcher. If there are queued messages, waits until
+     *          any queued socket accepts data or the retry timeout expires.
+     * \param   multiLock   The lock of exit and event queue synchronization objects.
+     * \return  Returns the index of signaled object or MultiLock::LOCK_INDEX_TIMEOUT
+     *          if should send the queues of clients.
+     **/
+    int _waitEvents( MultiLock & multiLock );
+
+    /**
+     * \brief   Sends the messages in the outbound queue of client without blocking, until the queue
+     *          is empty or the socket cannot accept more data.
+     * \param   client  The accepted socket of client.
+     * \param   queue   The outbound queue of client.
+     * \return  Returns false if failed to send data.
+     **/
+    bool _sendClientQueue( const SocketAccepted & client, sClientQueue & queue );
+
+    /**
+     * \brief   Checks the size of outbound queue of client after the messages are queued or sent.
+     *          Notifies the sources when the client is congested or recovered. Removes the empty queue.
+     *          If the queue exceeds the limit, closes the client connection.
+     * \param   target  The cookie of client.
+     * \param   queue   The outbound queue of client. Invalid after the call if the queue is removed.
+     **/
+    void _checkClientQueue( ITEM_ID target, sClientQueue & queue );
+
+    /**
+     * \brief   Notifies the source that the target client is congested, if the source was not notified yet.
+     * \param   target  The cookie of congested client.
+     * \param   queue   The outbound queue of congested client.
+     * \param   source  The source of queued message.
+     **/
+    void _notifyCongested( ITEM_ID target, sClientQueue & queue, ITEM_ID source );
+
+    /**
+     * \brief   Removes the outbound queue of client, if it exists.
+     * \param   target  The cookie of client.
+     **/
+    void _removeClientQueue( ITEM_ID target );
+
+    /**
+     * \brief   Removes the outbound queues of all clients.
+     **/
+    void _removeAllClientQueues( void );
+
+    /**
+     * \brief   Notifies remote servicing handler that failed to send the messages to the target.
+     * \param   listMessages    The list of failed messages.
+     * \param   count           The number of messages in the list.
+     * \param   target          The cookie of target connection.
+     * \param   isAlive         The flag, indicating whether the target connection is alive. Used for logging.
+     **/
+    void _failedMessages( const RemoteMessage * const * listMessages, int count, ITEM_ID target, bool isAlive );
+
+    /**
+     * \brief   Sets the buffers of prepared message to send, skipping the given number of already sent bytes.
+     * \param   message     The message to send.
+     * \param   header      The prepared header of message to send.
+     * \param   out_buffers On output, contains the buffers to send. Should have at least 2 entries.
+     * \param   skip        The number of bytes of message, which are already sent.
+     * \return  Returns the number of buffers set.
+     **/
+    static int _setPendingBuffers( const RemoteMessage & message, const NEMemory::sRemoteMessageHeader & header, NESocket::sSocketBuffer * out_buffers, unsigned int skip );
+
+    /**
+     * \brief   Sends all messages in the send queue. The messages to the same
+     *          target that follow each other are sent with single call.
+     **/
+    void _sendQueuedMessages( void );
+
+    /**
+     * \brief   Returns the accepted connection of specified cookie. The connection is
+     *          taken from the cache, which is dropped if the set of connections changes.
+     *          The returned socket is invalid if there is no connection with the cookie.
+     * \param   cookie  The cookie of accepted connection.
+     **/
+    const SocketAccepted & _getClient( ITEM_ID cookie );
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
 private:
+    /**
+     * \brief   The instance of server connection handling interface object
+     **/
+    IEServerConnectionHandler & mConnectHandler;
     /**
      * \brief   The instance of remote servicing interface object
      **/
@@ -106,7 +380,44 @@ private:
      * \brief   The instance of server connection object
      **/
     ServerConnection &          mConnection;
-
+    /**
+     * \brief   The queue of messages to send.
+     **/
+    SendQueue                   mSendQueue;
+    /**
+     * \brief   The cache of accepted connections where the keys are cookies.
+     **/
+    MapCookieToClient           mClients;
+    /**
+     * \brief   The version of connections, when the cache was filled.
+     **/
+    unsigned int                mClientsVersion;
+    /**
+     * \brief   The outbound queues of clients, which have unsent messages.
+     **/
+    MapCookieToQueue            mClientQueues;
+    /**
+     * \brief   The size in bytes of outbound queue, when the client is congested.
+     **/
+    unsigned int                mHighMark;
+    /**
+     * \brief   The size in bytes of outbound queue, when the congested client is recovered.
+     **/
+    unsigned int                mLowMark;
+    /**
+     * \brief   The maximum size in bytes of outbound queue.
+     **/
+    unsigned int                mQueueLimit;
+    /**
+     * \brief   The current timeout in milliseconds to retry sending the queues of clients.
+     **/
+    unsigned int                mRetryTimeout;
+#ifdef AREG_SOCKET_EPOLL
+    /**
+     * \brief   The poller to wait until the sockets of queued clients accept data.
+     **/
+    SocketPoller                mWritePoller;
+#endif  // AREG_SOCKET_EPOLL
 
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
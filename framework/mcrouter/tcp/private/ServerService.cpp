@@ -29,6 +29,9 @@ DEF_TRACE_SCOPE(mcrouter_tcp_private_ServerService_stopConnection);
 
 DEF_TRACE_SCOPE(mcrouter_tcp_private_ServerService_failedSendMessage);
 DEF_TRACE_SCOPE(mcrouter_tcp_private_ServerService_failedReceiveMessage);
+DEF_TRACE_SCOPE(mcrouter_tcp_private_ServerService_connectionCongested);
+
+DEF_TRACE_SCOPE(mcrouter_tcp_private_ServerService__sendMulticastMessage);
 
 ServerService::ServerService( void )
     : IERemoteService               ( )
@@ -41,10 +44,17 @@ ServerService::ServerService( void )
 
     , mServerConnection ( )
     , mTimerConnect     ( static_cast<IETimerConsumer &>(self()), NEConnection::SERVER_CONNECT_TIMER_NAME.data( ) )
-    , mThreadSend       ( static_cast<IERemoteServiceHandler &>(self()), mServerConnection )
-    , mThreadReceive    ( static_cast<IEServerConnectionHandler &>(self()), static_cast<IERemoteServiceHandler &>(self()), mServerConnection )
+    , mThreadsSend      ( )
+    , mThreadsReceive   ( )
+    , mWorkerCount      ( NEConnection::DEFAULT_SERVER_WORKERS )
+    , mSendHighMark     ( NEConnection::DEFAULT_SEND_HIGH_WATERMARK )
+    , mSendLowMark      ( NEConnection::DEFAULT_SEND_LOW_WATERMARK )
+    , mSendLimit        ( NEConnection::DEFAULT_SEND_QUEUE_LIMIT )
     , mServiceRegistry  ( )
     , mIsServiceEnabled ( true )    // TODO: by default it should be disabled and enabled via init file
+    , mIsSharedMemory   ( false )
+    , mIsDirect         ( false )
+    , mDirectAddresses  ( )
     , mConfigFile       ( )
     , mWhiteList        ( )
     , mBlackList        ( )
@@ -53,21 +63,61 @@ ServerService::ServerService( void )
 
 }
 
+ServerService::~ServerService( void )
+{
+    for ( int i = 0; i < mThreadsReceive.getSize(); ++ i )
+    {
+        delete mThreadsReceive[i];
+    }
+
+    for ( int i = 0; i < mThreadsSend.getSize(); ++ i )
+    {
+        delete mThreadsSend[i];
+    }
+
+    mThreadsReceive.removeAll();
+    mThreadsSend.removeAll();
+}
+
 bool ServerService::configureRemoteServicing(const char * configFile)
 {
     ConnectionConfiguration configConnect;
     if ( configConnect.loadConfiguration(configFile) )
     {
+        NERemoteService::eServiceConnection connectType = configConnect.getConnectionType();
         mConfigFile             = configConnect.getConfigFileName();
-        mIsServiceEnabled       = configConnect.getConnectionEnableFlag(CONNECT_TYPE);
-        String hostName         = configConnect.getConnectionHost(CONNECT_TYPE);
-        unsigned short hostPort = configConnect.getConnectionPort(CONNECT_TYPE);
+        mIsServiceEnabled       = configConnect.getConnectionEnableFlag(connectType);
+        String hostName         = configConnect.getConnectionHost(connectType);
+        unsigned short hostPort = configConnect.getConnectionPort(connectType);
+        mWorkerCount            = configConnect.getConnectionWorkers(connectType);
+        mSendHighMark           = configConnect.getConnectionSendHighMark(connectType);
+        mSendLowMark            = configConnect.getConnectionSendLowMark(connectType);
+        mSendLimit              = configConnect.getConnectionSendLimit(connectType);
+
+        if ( connectType == NERemoteService::eServiceConnection::ConnectionUnix )
+        {
+            // the local connection listens on the socket path set as the address.
+            mIsSharedMemory     = configConnect.getConnectionSharedMemory(connectType) != 0;
+            mIsDirect           = false;
+            NESocket::SocketAddress addrLocal;
+            addrLocal.setLocalAddress( hostName.getString() );
+            mServerConnection.setAddress( addrLocal );
+            return addrLocal.isValid( );
+        }
 
+        mIsSharedMemory         = false;
+        mIsDirect               = configConnect.getConnectionDirect(connectType);
         return mServerConnection.setAddress( hostName, hostPort );
     }
     else
     {
         mIsServiceEnabled       = NEConnection::DEFAULT_REMOVE_SERVICE_ENABLED;
+        mIsSharedMemory         = false;
+        mIsDirect               = false;
+        mWorkerCount            = NEConnection::DEFAULT_SERVER_WORKERS;
+        mSendHighMark           = NEConnection::DEFAULT_SEND_HIGH_WATERMARK;
+        mSendLowMark            = NEConnection::DEFAULT_SEND_LOW_WATERMARK;
+        mSendLimit              = NEConnection::DEFAULT_SEND_QUEUE_LIMIT;
         return mServerConnection.setAddress( NEConnection::DEFAULT_REMOTE_SERVICE_HOST.data( ), NEConnection::DEFAULT_REMOTE_SERVICE_PORT );
     }
 }
@@ -198,6 +248,17 @@ void ServerService::connectionLost( SocketAccepted & clientSocket )
     }
 }
 
+void ServerService::connectionCongested( ITEM_ID target, ITEM_ID source, bool congested )
+{
+    TRACE_SCOPE(mcrouter_tcp_private_ServerService_connectionCongested);
+    TRACE_DBG("Notifying source [ %u ] that the client [ %u ] is [ %s ]"
+                , static_cast<uint32_t>(source)
+                , static_cast<uint32_t>(target)
+                , congested ? "CONGESTED" : "RECOVERED");
+
+    _sendMessage( NEConnection::createCongestionNotify(source, target, congested) );
+}
+
 void ServerService::processTimer(Timer & timer)
 {
     if ( &timer == &mTimerConnect )
@@ -226,10 +287,7 @@ void ServerService::processEvent(const ServerServiceEventData & data)
             Lock lock(mLock);
             stopConnection();
         }
-        mThreadReceive.completionWait( NECommon::WAIT_INFINITE );
-        mThreadSend.completionWait( NECommon::WAIT_INFINITE );
-        mThreadReceive.destroyThread( NECommon::DO_NOT_WAIT );
-        mThreadSend.destroyThread( NECommon::DO_NOT_WAIT );
+        _waitWorkerThreads();
         break;
 
     case ServerServiceEventData::eServerServiceCommands::CMD_ServiceReceivedMsg:
@@ -298,6 +356,10 @@ void ServerService::processEvent(const ServerServiceEventData & data)
                     ITEM_ID cookie = NEService::COOKIE_UNKNOWN;
                     msgReceived >> cookie;
                     mServerConnection.closeConnection(cookie);
+                    {
+                        Lock lock(mLock);
+                        mDirectAddresses.removeAt(cookie);
+                    }
 
                     TEArrayList<StubAddress, const StubAddress &>   listStubs;
                     TEArrayList<ProxyAddress, const ProxyAddress &> listProxies;
@@ -347,7 +409,7 @@ void ServerService::processEvent(const ServerServiceEventData & data)
                     
                     if ( msgReceived.getTarget() != NEService::TARGET_UNKNOWN )
                     {
-                        SendMessageEvent::sendEvent( SendMessageEventData(msgReceived), static_cast<IESendMessageEventConsumer &>(mThreadSend), static_cast<DispatcherThread &>(mThreadSend));
+                        _sendMessage(msgReceived);
                     }
                 }
                 else
@@ -376,9 +438,7 @@ void ServerService::processEvent(const ServerServiceEventData & data)
             if ( NEService::isExecutableId( static_cast<uint32_t>(msgId)) )
             {
                 if ( msgSend.getTarget() != NEService::TARGET_UNKNOWN )
-                    SendMessageEvent::sendEvent( SendMessageEventData(msgSend)
-                                               , static_cast<IESendMessageEventConsumer &>(mThreadSend)
-                                               , static_cast<DispatcherThread &>(mThreadSend));
+                    _sendMessage(msgSend);
             }
             else
             {
@@ -410,27 +470,27 @@ bool ServerService::startConnection(void)
 
     ASSERT(mServerConnection.getAddress().isValid());
     ASSERT(mServerConnection.isValid() == false);
-    ASSERT(mThreadReceive.isRunning() == false);
-    ASSERT(mThreadSend.isRunning() == false);
 
     bool result = false;
     mTimerConnect.stopTimer();
 
+    mServerConnection.setWorkerCount( mWorkerCount );
     if ( mServerConnection.createSocket() )
     {
-        TRACE_DBG("Created socket [ %d ], going to create send-receive threads", static_cast<uint32_t>(mServerConnection.getSocketHandle()));
+        TRACE_DBG("Created socket [ %d ], going to create send-receive threads of [ %d ] I/O workers"
+                    , static_cast<uint32_t>(mServerConnection.getSocketHandle())
+                    , mServerConnection.getWorkerCount());
 
-        if ( mThreadReceive.createThread( NECommon::WAIT_INFINITE ) && mThreadSend.createThread( NECommon::WAIT_INFINITE ) )
+        if ( _startWorkerThreads() )
         {
-            VERIFY( mThreadReceive.waitForDispatcherStart( NECommon::WAIT_INFINITE ) );
-            VERIFY( mThreadSend.waitForDispatcherStart( NECommon::WAIT_INFINITE ) );
             result = true;
-
             TRACE_DBG("The threads are created. Ready to send-receive messages.");
         }
         else
         {
             TRACE_ERR("Failed to create send-receive threads, cannot communicate. Stop remote service");
+            _exitReceiveThreads();
+            _exitSendThreads();
             mServerConnection.closeSocket();
         }
     }
@@ -453,8 +513,7 @@ void ServerService::stopConnection(void)
     TRACE_SCOPE(mcrouter_tcp_private_ServerService_stopConnection);
     TRACE_WARN("Stopping remote servicing connection");
 
-    mThreadReceive.triggerExitEvent();
-    mThreadReceive.destroyThread( NECommon::DO_NOT_WAIT );
+    _exitReceiveThreads();
 
     TEArrayList<StubAddress, const StubAddress &> stubList;
     TEArrayList<ProxyAddress, const ProxyAddress &> proxyList;
@@ -470,12 +529,133 @@ void ServerService::stopConnection(void)
         unregisterRemoteProxy( proxyList[i], NEService::COOKIE_ANY );
     }
 
-    mThreadSend.triggerExitEvent();
-    mThreadSend.destroyThread( NECommon::WAIT_INFINITE );
+    _exitSendThreads();
 
+    mDirectAddresses.removeAll();
     mServerConnection.closeSocket();
 }
 
+bool ServerService::_startWorkerThreads( void )
+{
+    bool result = true;
+    for ( int i = 0; result && (i < mServerConnection.getWorkerCount()); ++ i )
+    {
+        if ( i == mThreadsReceive.getSize() )
+        {
+            mThreadsReceive.add( DEBUG_NEW ServerReceiveThread( static_cast<IEServerConnectionHandler &>(self()), static_cast<IERemoteServiceHandler &>(self()), mServerConnection, i ) );
+            mThreadsSend.add( DEBUG_NEW ServerSendThread( static_cast<IEServerConnectionHandler &>(self()), static_cast<IERemoteServiceHandler &>(self()), mServerConnection, i ) );
+        }
+
+        ServerReceiveThread & threadReceive = *mThreadsReceive[i];
+        ServerSendThread & threadSend       = *mThreadsSend[i];
+        ASSERT(threadReceive.isRunning() == false);
+        ASSERT(threadSend.isRunning() == false);
+
+        threadSend.setQueueLimits( mSendHighMark, mSendLowMark, mSendLimit );
+        result = threadReceive.createThread( NECommon::WAIT_INFINITE ) && threadSend.createThread( NECommon::WAIT_INFINITE );
+        if ( result )
+        {
+            VERIFY( threadReceive.waitForDispatcherStart( NECommon::WAIT_INFINITE ) );
+            VERIFY( threadSend.waitForDispatcherStart( NECommon::WAIT_INFINITE ) );
+        }
+    }
+
+    return result;
+}
+
+void ServerService::_exitReceiveThreads( void )
+{
+    // the threads waiting for events by poller are woken up when socket is closed,
+    // and they are waited to complete. Otherwise, the waiting on select is not interrupted.
+    bool canWait = mServerConnection.isEdgeTriggered();
+    for ( int i = 0; i < mThreadsReceive.getSize(); ++ i )
+    {
+        mThreadsReceive[i]->triggerExitEvent();
+        if ( canWait == false )
+        {
+            mThreadsReceive[i]->destroyThread( NECommon::DO_NOT_WAIT );
+        }
+    }
+}
+
+void ServerService::_exitSendThreads( void )
+{
+    for ( int i = 0; i < mThreadsSend.getSize(); ++ i )
+    {
+        mThreadsSend[i]->triggerExitEvent();
+        mThreadsSend[i]->destroyThread( NECommon::WAIT_INFINITE );
+    }
+}
+
+void ServerService::_waitWorkerThreads( void )
+{
+    for ( int i = 0; i < mThreadsReceive.getSize(); ++ i )
+    {
+        mThreadsReceive[i]->completionWait( NECommon::WAIT_INFINITE );
+        mThreadsSend[i]->completionWait( NECommon::WAIT_INFINITE );
+        mThreadsReceive[i]->destroyThread( NECommon::DO_NOT_WAIT );
+        mThreadsSend[i]->destroyThread( NECommon::DO_NOT_WAIT );
+    }
+}
+
+void ServerService::_sendMessage( const RemoteMessage & msgSend )
+{
+    _sendMessage( msgSend, static_cast<ITEM_ID>(msgSend.getTarget()) );
+}
+
+void ServerService::_sendMessage( const RemoteMessage & msgSend, ITEM_ID target )
+{
+    // all messages of the same target are sent by the same thread to keep the order of messages.
+    int worker = mServerConnection.getConnectionWorker( target );
+    if ( worker < MACRO_MIN(mServerConnection.getWorkerCount(), mThreadsSend.getSize()) )
+    {
+        mThreadsSend[worker]->queueMessage( msgSend, target );
+    }
+}
+
+void ServerService::_sendMulticastMessage( const RemoteMessage & msgReceived )
+{
+    TRACE_SCOPE(mcrouter_tcp_private_ServerService__sendMulticastMessage);
+
+    TEArrayList<ITEM_ID, ITEM_ID> listTargets;
+    msgReceived.moveToBegin();
+    msgReceived >> listTargets;
+
+    unsigned int position = msgReceived.getPosition();
+    unsigned int sizeUsed = msgReceived.getSizeUsed();
+    if ( (position != IECursorPosition::INVALID_CURSOR_POSITION) && (position < sizeUsed) )
+    {
+        // the receivers do not need the list of targets, copy the data once and share with all targets.
+        RemoteMessage msgForward( msgReceived.getBufferAtCurrentPosition(), sizeUsed - position );
+        msgForward.setSource( msgReceived.getSource() );
+        msgForward.setTarget( NEService::TARGET_MULTICAST );
+        msgForward.setMessageId( msgReceived.getMessageId() );
+        msgForward.setResult( msgReceived.getResult() );
+        msgForward.setSequenceNr( msgReceived.getSequenceNr() );
+        msgForward.bufferCompletionFix();
+
+        TRACE_DBG("Forwarding multicast message [ 0x%X ] of [ %u ] bytes from source [ %u ] to [ %d ] targets"
+                    , msgForward.getMessageId()
+                    , msgForward.getSizeUsed()
+                    , static_cast<uint32_t>(msgForward.getSource())
+                    , listTargets.getSize());
+
+        for ( int i = 0; i < listTargets.getSize(); ++ i )
+        {
+            if ( listTargets[i] >= static_cast<ITEM_ID>(NEService::eCookies::CookieFirstValid) )
+            {
+                _sendMessage( msgForward, listTargets[i] );
+            }
+        }
+    }
+    else
+    {
+        TRACE_WARN("The multicast message [ 0x%X ] from source [ %u ] has no data to forward, ignoring"
+                    , msgReceived.getMessageId()
+                    , static_cast<uint32_t>(msgReceived.getSource()));
+    }
+}
+
 void ServerService::getServiceList(ITEM_ID cookie, TEArrayList<StubAddress, const StubAddress &> & out_listStubs, TEArrayList<ProxyAddress, const ProxyAddress &> & out_lisProxies) const
 {
     mServiceRegistry.getServiceList(cookie, out_listStubs, out_lisProxies);
@@ -505,8 +685,8 @@ void ServerService::registerRemoteStub(const StubAddress & stub)
                 const ProxyAddress & addrProxy    = proxyService.getServiceAddress();
                 if ( (proxyService.getServiceStatus() == NEService::eServiceConnection::ServiceConnected) && (addrProxy.getSource() != stub.getSource()) )
                 {
-                    RemoteMessage msgRegisterProxy = NEConnection::createServiceClientRegisteredNotification(addrProxy, stub.getSource());
-                    SendMessageEvent::sendEvent( SendMessageEventData(msgRegisterProxy), static_cast<IESendMessageEventConsumer &>(mThreadSend), static_cast<DispatcherThread &>(mThreadSend));
+                    RemoteMessage msgRegisterProxy = NEConnection::createServiceClientRegisteredNotification(addrProxy, stub.getSource(), _getDirectAddress(addrProxy.getSource(), stub.getSource()));
+                    _sendMessage(msgRegisterProxy);
                     TRACE_DBG("Send to stub [ %s ] the proxy [ %s ] registration notification. Send message [ %s ] of id [ 0x%X ] from source [ %u ] to target [ %u ]"
                                 , stub.convToString().getString()
                                 , addrProxy.convToString().getString()
@@ -517,8 +697,8 @@ void ServerService::registerRemoteStub(const StubAddress & stub)
 
                     if ( sendList.addUnique(addrProxy.getSource()) )
                     {
-                        RemoteMessage msgRegisterStub  = NEConnection::createServiceRegisteredNotification(stub, addrProxy.getSource());
-                        SendMessageEvent::sendEvent( SendMessageEventData(msgRegisterStub), static_cast<IESendMessageEventConsumer &>(mThreadSend), static_cast<DispatcherThread &>(mThreadSend));
+                        RemoteMessage msgRegisterStub  = NEConnection::createServiceRegisteredNotification(stub, addrProxy.getSource(), _getDirectAddress(stub.getSource(), addrProxy.getSource()));
+                        _sendMessage(msgRegisterStub);
                         TRACE_DBG("Send to proxy [ %s ] the stub [ %s ] registration notification. Send message [ %s ] of id [ 0x%X ] from source [ %u ] to target [ %u ]"
                                     , addrProxy.convToString().getString()
                                     , stub.convToString().getString()
@@ -573,8 +753,8 @@ void ServerService::registerRemoteProxy(const ProxyAddress & proxy)
 
         if ( (proxyService.getServiceStatus() == NEService::eServiceConnection::ServiceConnected) && (proxy.getSource() != addrStub.getSource()) )
         {
-            RemoteMessage msgRegisterProxy = NEConnection::createServiceClientRegisteredNotification(proxy, addrStub.getSource());
-            SendMessageEvent::sendEvent( SendMessageEventData(msgRegisterProxy), static_cast<IESendMessageEventConsumer &>(mThreadSend), static_cast<DispatcherThread &>(mThreadSend));
+            RemoteMessage msgRegisterProxy = NEConnection::createServiceClientRegisteredNotification(proxy, addrStub.getSource(), _getDirectAddress(proxy.getSource(), addrStub.getSource()));
+            _sendMessage(msgRegisterProxy);
             
             TRACE_DBG("Send to stub [ %s ] the proxy [ %s ] registration notification. Send message [ %s ] of id [ 0x%X ] from source [ %u ] to target [ %u ]"
                         , addrStub.convToString().getString()
@@ -584,8 +764,8 @@ void ServerService::registerRemoteProxy(const ProxyAddress & proxy)
                         , static_cast<uint32_t>(msgRegisterProxy.getSource())
                         , static_cast<uint32_t>(msgRegisterProxy.getTarget()));
 
-            RemoteMessage msgRegisterStub  = NEConnection::createServiceRegisteredNotification(addrStub, proxy.getSource());
-            SendMessageEvent::sendEvent( SendMessageEventData(msgRegisterStub), static_cast<IESendMessageEventConsumer &>(mThreadSend), static_cast<DispatcherThread &>(mThreadSend));
+            RemoteMessage msgRegisterStub  = NEConnection::createServiceRegisteredNotification(addrStub, proxy.getSource(), _getDirectAddress(addrStub.getSource(), proxy.getSource()));
+            _sendMessage(msgRegisterStub);
             
             TRACE_DBG("Send to proxy [ %s ] the stub [ %s ] registration notification. Send message [ %s ] of id [ 0x%X ] from source [ %u ] to target [ %u ]"
                         , proxy.convToString().getString()
@@ -634,7 +814,7 @@ void ServerService::unregisterRemoteStub(const StubAddress & stub, ITEM_ID cooki
                 if (sendList.addUnique(addrProxy.getSource()) )
                 {
                     RemoteMessage msgRegisterStub = NEConnection::createServiceUnregisteredNotification( stub, addrProxy.getSource( ) );
-                    SendMessageEvent::sendEvent( SendMessageEventData(msgRegisterStub), static_cast<IESendMessageEventConsumer &>(mThreadSend), static_cast<DispatcherThread &>(mThreadSend));
+                    _sendMessage(msgRegisterStub);
                     TRACE_INFO("Send stub [ %s ] disconnect message to proxy [ %s ]"
                                     , stub.convToString().getString()
                                     , addrProxy.convToString().getString());
@@ -687,7 +867,7 @@ void ServerService::unregisterRemoteProxy(const ProxyAddress & proxy, ITEM_ID co
     if ((svcStub->getServiceStatus() == NEService::eServiceConnection::ServiceConnected) && (proxy.getSource() != addrStub.getSource()))
     {
         msgRegisterProxy = NEConnection::createServiceClientUnregisteredNotification(proxy, addrStub.getSource());
-        SendMessageEvent::sendEvent( SendMessageEventData(msgRegisterProxy), static_cast<IESendMessageEventConsumer &>(mThreadSend), static_cast<DispatcherThread &>(mThreadSend));
+        _sendMessage(msgRegisterProxy);
         TRACE_INFO("Send proxy [ %s ] disconnect message to stub [ %s ]"
                         , proxy.convToString().getString()
                         , addrStub.convToString().getString());
@@ -755,10 +935,12 @@ void ServerService::processReceivedMessage(const RemoteMessage & msgReceived, co
     TRACE_SCOPE(mcrouter_tcp_private_ServerService_processReceivedMessage);
     if ( msgReceived.isValid() )
     {
-        ITEM_ID cookie = mServerConnection.getCookie(whichSource);
         ITEM_ID source = static_cast<ITEM_ID>(msgReceived.getSource());
         ITEM_ID target = static_cast<ITEM_ID>(msgReceived.getTarget());
         NEService::eFuncIdRange msgId  = static_cast<NEService::eFuncIdRange>( msgReceived.getMessageId() );
+        // the forwarded messages do not need the cookie of connection, avoid locking the connection.
+        bool isForward = (source > NEService::COOKIE_ROUTER) && NEService::isExecutableId(static_cast<uint32_t>(msgId));
+        ITEM_ID cookie = isForward ? NEService::COOKIE_UNKNOWN : mServerConnection.getCookie(whichSource);
 
         TRACE_DBG("Received message [ %s ] of id [ 0x%X ] from source [ %u ] ( connection cookie = %u ) of client host [ %s : %d ] for target [ %u ]"
                         , NEService::getString(msgId)
@@ -769,12 +951,16 @@ void ServerService::processReceivedMessage(const RemoteMessage & msgReceived, co
                         , static_cast<int>(addrHost.getHostPort())
                         , static_cast<id_type>(target));
 
-        if ( (source > NEService::COOKIE_ROUTER) && NEService::isExecutableId(static_cast<uint32_t>(msgId)) )
+        if ( isForward )
         {
             TRACE_DBG("Forwarding message [ 0x%X ] to send to target [ %u ]", static_cast<uint32_t>(msgId), static_cast<uint32_t>(target));
-            if ( target != NEService::TARGET_UNKNOWN )
+            if ( target == NEService::TARGET_MULTICAST )
+            {
+                _sendMulticastMessage(msgReceived);
+            }
+            else if ( target != NEService::TARGET_UNKNOWN )
             {
-                SendMessageEvent::sendEvent( SendMessageEventData(msgReceived), static_cast<IESendMessageEventConsumer &>(mThreadSend), static_cast<DispatcherThread &>(mThreadSend));
+                _sendMessage(msgReceived);
             }
         }
         else if ( (source == cookie) && (msgId != NEService::eFuncIdRange::ServiceRouterConnect) )
@@ -786,7 +972,47 @@ void ServerService::processReceivedMessage(const RemoteMessage & msgReceived, co
         }
         else if ( (source == NEService::SOURCE_UNKNOWN) && (msgId == NEService::eFuncIdRange::ServiceRouterConnect) )
         {
-            RemoteMessage msgConnect = NEConnection::createConnectNotify(cookie);
+            // the checksums are skipped only for the connections of local host, if the client requested it.
+            bool skipChecksum = false;
+            String sharedName;
+            msgReceived >> skipChecksum;
+            msgReceived >> sharedName;
+            skipChecksum = skipChecksum && addrHost.isLoopback();
+            mServerConnection.setChecksumSkipped(whichSource, skipChecksum);
+            TRACE_DBG("The checksums of messages of connection [ %u ] are [ %s ]", static_cast<uint32_t>(whichSource), skipChecksum ? "SKIPPED" : "CALCULATED");
+
+            // the shared memory is used only by local connections, which skip checksums.
+            std::shared_ptr<SharedMemoryRing> sharedMemory;
+            if ( mIsSharedMemory && skipChecksum && addrHost.isLocalSocket() && (sharedName.isEmpty() == false) )
+            {
+                sharedMemory = std::make_shared<SharedMemoryRing>();
+                if ( sharedMemory->openRing(sharedName) == false )
+                {
+                    sharedMemory.reset();
+                }
+            }
+
+            mServerConnection.setSharedMemory(whichSource, sharedMemory);
+            TRACE_DBG("The shared memory of connection [ %u ] is [ %s ]", static_cast<uint32_t>(whichSource), sharedMemory != nullptr ? "OPENED" : "NOT USED");
+
+            // the direct connections are accepted only on loopback, only the applications of the same host reach each other.
+            unsigned short directPort = NESocket::InvalidPort;
+            msgReceived >> directPort;
+            NESocket::SocketAddress addrDirect;
+            if ( mIsDirect && (directPort != NESocket::InvalidPort) && (addrHost.isLocalSocket() == false) && addrHost.isLoopback() &&
+                 addrDirect.resolveAddress(addrHost.getHostAddress().getString(), directPort, false) )
+            {
+                Lock lock(mLock);
+                mDirectAddresses.setAt(cookie, addrDirect);
+            }
+
+            TRACE_DBG("The direct connections of [ %u ] are [ %s ], address [ %s : %u ]"
+                        , static_cast<uint32_t>(cookie)
+                        , addrDirect.isValid() ? "ACCEPTED" : "NOT USED"
+                        , addrDirect.getHostAddress().getString()
+                        , static_cast<uint32_t>(addrDirect.getHostPort()));
+
+            RemoteMessage msgConnect = NEConnection::createConnectNotify(cookie, skipChecksum, sharedMemory != nullptr);
             TRACE_DBG("Received request connect message, sending response [ %s ] of id [ 0x%X ], to new target [ %u ], connection socket [ %u ], checksum [ %u ]"
                         , NEService::getString( static_cast<NEService::eFuncIdRange>(msgConnect.getMessageId()))
                         , static_cast<uint32_t>(msgConnect.getMessageId())
@@ -796,9 +1022,7 @@ void ServerService::processReceivedMessage(const RemoteMessage & msgReceived, co
 
             if ( msgConnect.isValid() )
             {
-                SendMessageEvent::sendEvent( SendMessageEventData(msgConnect)
-                                           , static_cast<IESendMessageEventConsumer &>(mThreadSend)
-                                           , static_cast<DispatcherThread &>(mThreadSend));
+                _sendMessage(msgConnect);
             }
         }
         else
@@ -816,6 +1040,24 @@ void ServerService::processReceivedMessage(const RemoteMessage & msgReceived, co
     }
 }
 
+NESocket::SocketAddress ServerService::_getDirectAddress( ITEM_ID source, ITEM_ID target ) const
+{
+    NESocket::SocketAddress result;
+    if ( mIsDirect )
+    {
+        Lock lock(mLock);
+        MAPPOS posSource = mDirectAddresses.find(source);
+        MAPPOS posTarget = mDirectAddresses.find(target);
+        if ( (posSource != nullptr) && (posTarget != nullptr) )
+        {
+            // both applications accept direct connections, they are on the same host.
+            result = mDirectAddresses.valueAtPosition(posSource);
+        }
+    }
+
+    return result;
+}
+
 bool ServerService::runDispatcher(void)
 {
     ServerServiceEvent::addListener( static_cast<IEServerServiceEventConsumer &>(self()), static_cast<DispatcherThread &>(self()) );
@@ -204,15 +204,14 @@ const ServiceStub & ServiceRegistry::unregisterServiceStub(const StubAddress & a
 
 MAPPOS ServiceRegistry::findService( const ServiceAddress & addrService ) const
 {
-    const unsigned int hash = static_cast<unsigned int>(addrService);
-    Block ** result         = &mHashTable[hash % mHashTableSize];
-
-    for ( ; *result != nullptr; result = &(*result)->mNext)
+    MAPPOS pos = firstHashPosition( static_cast<unsigned int>(addrService) );
+    for ( ; pos != nullptr; pos = nextHashPosition(pos) )
     {
-        if ( hash == (*result)->mHash && static_cast<const ServiceAddress &>((*result)->mKey.getServiceAddress()) == addrService )
+        if ( static_cast<const ServiceAddress &>(keyAtPosition(pos).getServiceAddress()) == addrService )
             break;
     }
-    return static_cast<MAPPOS>(*result);
+
+    return pos;
 }
 
 void ServiceRegistry::getServiceList( ITEM_ID cookie , TEArrayList<StubAddress, const StubAddress &> & OUT out_stubServiceList, TEArrayList<ProxyAddress, const ProxyAddress &> & OUT out_proxyServiceList ) const
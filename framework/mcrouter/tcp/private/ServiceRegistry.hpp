@@ -29,7 +29,7 @@
 /**
  * \brief   Service registry map helper class.
  **/
-class ImplServiceRegistry  : public TEHashMapImpl<const ServiceStub &, const ListServiceProxies &>
+class ImplServiceRegistry  : public TEOpenHashMapImpl<const ServiceStub &, const ListServiceProxies &>
 {
 public:
     /**